@@ -5,17 +5,53 @@
 
 # JOBS library source files.
 set( JOBS_SOURCES
-     ${CMAKE_CURRENT_LIST_DIR}/source/jobs.c )
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_correlation.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_version.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_queue.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_coalesce.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_execution.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_gateway.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_timer.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_journal.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_docstore.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_dedup.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_summary.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_rejected.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_scheduler.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_capture.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_trace.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_latency.c )
+
+# Optional JOBS library source files.  They use the atomic operations of
+# jobs_atomic.h, which default to the GCC and Clang __atomic builtins, so
+# toolchains without them either define the JOBS_ATOMIC_* macros or leave
+# these files out.  jobs_log.c is needed when JOBS_LOG_LEVEL is above
+# JOBS_LOG_LEVEL_NONE, and jobs_stats.c when JOBS_STATS_ENABLED is 1.
+set( JOBS_ATOMIC_SOURCES
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_ring.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_ingress.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_executor.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_stats.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/jobs_log.c )
 
 # JOBS library Public Include directories.
 set( JOBS_INCLUDE_PUBLIC_DIRS
      ${CMAKE_CURRENT_LIST_DIR}/source/include )
 
+# JOBS library Private Include directories, holding headers shared between
+# the library sources only.
+set( JOBS_INCLUDE_PRIVATE_DIRS
+     ${CMAKE_CURRENT_LIST_DIR}/source/private )
+
 # OTA Parser source files
 set( OTA_HANDLER_SOURCES
      ${CMAKE_CURRENT_LIST_DIR}/source/otaJobParser/job_parser.c
-     ${CMAKE_CURRENT_LIST_DIR}/source/otaJobParser/ota_job_handler.c )
+     ${CMAKE_CURRENT_LIST_DIR}/source/otaJobParser/ota_job_handler.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/otaJobParser/ota_job_cache.c )
 
-# OTA Parser Public Include directories.
+# OTA Parser Public Include directories, and the JOBS directory holding
+# the instrumentation hooks the parser uses.
 set( OTA_HANDLER_INCLUDES
-     ${CMAKE_CURRENT_LIST_DIR}/source/otaJobParser/include )
+     ${CMAKE_CURRENT_LIST_DIR}/source/otaJobParser/include
+     ${CMAKE_CURRENT_LIST_DIR}/source/include )
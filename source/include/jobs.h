@@ -72,6 +72,24 @@
  */
 #define JOBS_JOBID_MAX_LENGTH        64U       /* per AWS IoT API Reference */
 
+/**
+ * @ingroup jobs_constants
+ * @brief Maximum length of a client token for the AWS IoT Jobs Service.
+ */
+#define JOBS_CLIENT_TOKEN_MAX_LENGTH     64U   /* per AWS IoT API Reference */
+
+/**
+ * @ingroup jobs_constants
+ * @brief Maximum step timeout, in minutes, for the AWS IoT Jobs Service.
+ */
+#define JOBS_STEP_TIMEOUT_MAX_MINUTES    10080U /* per AWS IoT API Reference */
+
+/**
+ * @ingroup jobs_constants
+ * @brief Maximum number of decimal digits in a uint32_t.
+ */
+#define JOBS_UINT32_STRING_MAX_LENGTH    10U
+
 #ifndef THINGNAME_MAX_LENGTH
 
 /**
@@ -317,6 +335,23 @@ typedef enum
     JobsMaxTopic
 } JobsTopic_t;
 
+/**
+ * @ingroup jobs_enum_types
+ * @brief Jobs APIs a device publishes requests to.
+ *
+ * Each request API has an accepted and a rejected response topic in
+ * #JobsTopic_t.
+ */
+typedef enum
+{
+    JobsInvalidApi = -1,
+    JobsApiGetPending,
+    JobsApiStartNext,
+    JobsApiDescribe,
+    JobsApiUpdate,
+    JobsMaxApi
+} JobsApi_t;
+
 /**
  * @ingroup jobs_struct_types
  * @brief Structure for Jobs_UpdateMsg request parameters.
@@ -343,6 +378,83 @@ typedef struct
     size_t statusDetailsLength;   /**< JSON key-value pair length, optional. */
 } JobsUpdateRequest_t;
 
+/**
+ * @ingroup jobs_enum_types
+ * @brief A request flag that may be left out of a message.
+ *
+ * An omitted flag takes the Jobs service default.
+ */
+typedef enum
+{
+    JobsOptionOmitted = 0,
+    JobsOptionFalse,
+    JobsOptionTrue
+} JobsOptionalBool_t;
+
+/**
+ * @ingroup jobs_struct_types
+ * @brief Optional fields of an UpdateJobExecution request.
+ *
+ * @note A zero initialized structure omits every field.  A NULL pointer
+ * or 0U length omits the client token, and 0U omits the numeric fields.
+ *
+ * @note Setting includeJobExecutionState and includeJobDocument to
+ * #JobsOptionFalse keeps the accepted response small.
+ */
+typedef struct
+{
+    const char * clientToken;                    /**< Client token, optional. */
+    size_t clientTokenLength;                    /**< Client token length, optional. */
+    uint32_t executionNumber;                    /**< Execution number, optional. */
+    uint32_t stepTimeoutInMinutes;               /**< Step timeout in minutes, optional. */
+    JobsOptionalBool_t includeJobExecutionState; /**< Return the execution state, optional. */
+    JobsOptionalBool_t includeJobDocument;       /**< Return the job document, optional. */
+} JobsUpdateOptions_t;
+
+/**
+ * @ingroup jobs_struct_types
+ * @brief Structure for Jobs_StartNextMsgWithOptions request parameters.
+ *
+ * @note A zero initialized structure omits every field.
+ *
+ * @note The status details must be a JSON formatted key-value
+ * pair.
+ */
+typedef struct
+{
+    const char * clientToken;      /**< Client token, optional. */
+    size_t clientTokenLength;      /**< Client token length, optional. */
+    const char * statusDetails;    /**< JSON key-value pair, optional. */
+    size_t statusDetailsLength;    /**< JSON key-value pair length, optional. */
+    uint32_t stepTimeoutInMinutes; /**< Step timeout in minutes, optional. */
+} JobsStartNextRequest_t;
+
+/**
+ * @ingroup jobs_struct_types
+ * @brief Structure for Jobs_DescribeMsg request parameters.
+ *
+ * @note A zero initialized structure omits every field.
+ */
+typedef struct
+{
+    const char * clientToken;              /**< Client token, optional. */
+    size_t clientTokenLength;              /**< Client token length, optional. */
+    uint32_t executionNumber;              /**< Execution number, optional. */
+    JobsOptionalBool_t includeJobDocument; /**< Return the job document, optional. */
+} JobsDescribeRequest_t;
+
+/**
+ * @ingroup jobs_struct_types
+ * @brief Structure for Jobs_GetPendingMsg request parameters.
+ *
+ * @note A zero initialized structure omits every field.
+ */
+typedef struct
+{
+    const char * clientToken; /**< Client token, optional. */
+    size_t clientTokenLength; /**< Client token length, optional. */
+} JobsGetPendingRequest_t;
+
 /*-----------------------------------------------------------*/
 
 /**
@@ -912,6 +1024,131 @@ size_t Jobs_UpdateMsg( JobsUpdateRequest_t request,
                        size_t bufferSize );
 /* @[declare_jobs_updatemsg] */
 
+/**
+ * @brief Populate a message string for an UpdateJobExecution request with
+ * optional fields.
+ *
+ * Members are written in the order status, expectedVersion,
+ * executionNumber, includeJobExecutionState, includeJobDocument,
+ * stepTimeoutInMinutes, statusDetails and clientToken, leaving out
+ * omitted fields.
+ *
+ * @param request A jobs update request structure.
+ * @param options The optional fields, NULL is the same as #Jobs_UpdateMsg.
+ * @param buffer The buffer to be written to, NULL to compute the length.
+ * @param bufferSize the size of the buffer.
+ *
+ * @return 0 if the fields are invalid or the buffer is too small.
+ * @return messageLength if the write is successful, or the required
+ * length when buffer is NULL.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example reports progress without asking the Jobs
+ * // service to echo the job document back in the accepted response.
+ *
+ * char messageBuffer[ 128 ];
+ * size_t messageLength = 0U;
+ * JobsUpdateRequest_t request = { 0 };
+ * JobsUpdateOptions_t options = { 0 };
+ *
+ * request.status = InProgress;
+ * options.includeJobDocument = JobsOptionFalse;
+ * options.includeJobExecutionState = JobsOptionFalse;
+ *
+ * messageLength = Jobs_UpdateMsgWithOptions( request,
+ *                                            &options,
+ *                                            messageBuffer,
+ *                                            sizeof( messageBuffer ) );
+ *
+ * if( messageLength > 0U )
+ * {
+ *     // Publish this message to the topic generated by Jobs_Update.
+ * }
+ * @endcode
+ */
+/* @[declare_jobs_updatemsgwithoptions] */
+size_t Jobs_UpdateMsgWithOptions( JobsUpdateRequest_t request,
+                                  const JobsUpdateOptions_t * options,
+                                  char * buffer,
+                                  size_t bufferSize );
+/* @[declare_jobs_updatemsgwithoptions] */
+
+/**
+ * @brief Populate a message string for a StartNextPendingJobExecution
+ * request with optional fields.
+ *
+ * @param request A start next request structure.
+ * @param buffer The buffer to be written to, NULL to compute the length.
+ * @param bufferSize the size of the buffer.
+ *
+ * @return 0 if the fields are invalid or the buffer is too small.
+ * @return messageLength if the write is successful, or the required
+ * length when buffer is NULL.
+ */
+/* @[declare_jobs_startnextmsgwithoptions] */
+size_t Jobs_StartNextMsgWithOptions( const JobsStartNextRequest_t * request,
+                                     char * buffer,
+                                     size_t bufferSize );
+/* @[declare_jobs_startnextmsgwithoptions] */
+
+/**
+ * @brief Populate a message string for a DescribeJobExecution request.
+ *
+ * @param request A describe request structure.
+ * @param buffer The buffer to be written to, NULL to compute the length.
+ * @param bufferSize the size of the buffer.
+ *
+ * @return 0 if the fields are invalid or the buffer is too small.
+ * @return messageLength if the write is successful, or the required
+ * length when buffer is NULL.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example polls the status of a job execution without
+ * // downloading the job document again.
+ *
+ * char messageBuffer[ 64 ];
+ * size_t messageLength = 0U;
+ * JobsDescribeRequest_t request = { 0 };
+ *
+ * request.includeJobDocument = JobsOptionFalse;
+ *
+ * messageLength = Jobs_DescribeMsg( &request,
+ *                                   messageBuffer,
+ *                                   sizeof( messageBuffer ) );
+ *
+ * if( messageLength > 0U )
+ * {
+ *     // Publish this message to the topic generated by Jobs_Describe.
+ * }
+ * @endcode
+ */
+/* @[declare_jobs_describemsg] */
+size_t Jobs_DescribeMsg( const JobsDescribeRequest_t * request,
+                         char * buffer,
+                         size_t bufferSize );
+/* @[declare_jobs_describemsg] */
+
+/**
+ * @brief Populate a message string for a GetPendingJobExecutions request.
+ *
+ * @param request A get pending request structure.
+ * @param buffer The buffer to be written to, NULL to compute the length.
+ * @param bufferSize the size of the buffer.
+ *
+ * @return 0 if the fields are invalid or the buffer is too small.
+ * @return messageLength if the write is successful, or the required
+ * length when buffer is NULL.
+ */
+/* @[declare_jobs_getpendingmsg] */
+size_t Jobs_GetPendingMsg( const JobsGetPendingRequest_t * request,
+                           char * buffer,
+                           size_t bufferSize );
+/* @[declare_jobs_getpendingmsg] */
+
 /**
  * @brief Retrieves the job ID from a given message (if applicable)
  *
@@ -1028,6 +1265,48 @@ bool Jobs_IsJobUpdateStatus( const char * topic,
                              JobUpdateStatus_t expectedStatus );
 /* @[declare_jobs_isjobupdatestatus] */
 
+/**
+ * @brief Checks if a job execution status is terminal.
+ *
+ * The Jobs service accepts no further updates for an execution in a
+ * terminal status.
+ *
+ * @param status The job execution status.
+ * @return true If the status is FAILED, SUCCEEDED or REJECTED
+ * @return false If the status is QUEUED or IN_PROGRESS
+ */
+/* @[declare_jobs_isterminalstatus] */
+bool Jobs_IsTerminalStatus( JobCurrentStatus_t status );
+/* @[declare_jobs_isterminalstatus] */
+
+/**
+ * @brief Checks if a job ID can be used in a Jobs topic.
+ *
+ * @param jobId The job ID.
+ * @param jobIdLength The length of the job ID.
+ * @return true If the job ID is 1 to #JOBID_MAX_LENGTH characters from
+ * the set allowed by the AWS IoT Jobs service
+ * @return false Otherwise
+ */
+/* @[declare_jobs_isvalidjobid] */
+bool Jobs_IsValidJobId( const char * jobId,
+                        uint16_t jobIdLength );
+/* @[declare_jobs_isvalidjobid] */
+
+/**
+ * @brief Checks if a thing name can be used in a Jobs topic.
+ *
+ * @param thingName The thing name.
+ * @param thingNameLength The length of the thing name.
+ * @return true If the thing name is 1 to #THINGNAME_MAX_LENGTH characters
+ * from the set allowed by AWS IoT
+ * @return false Otherwise
+ */
+/* @[declare_jobs_isvalidthingname] */
+bool Jobs_IsValidThingName( const char * thingName,
+                            uint16_t thingNameLength );
+/* @[declare_jobs_isvalidthingname] */
+
 
 /* *INDENT-OFF* */
 #ifdef __cplusplus
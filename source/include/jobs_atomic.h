@@ -0,0 +1,95 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_atomic.h
+ * @brief Atomic operations used by the Jobs modules shared between tasks.
+ *
+ * The ingress ring, the executor and the statistics shards need atomic
+ * access to uint32_t values.  The defaults use the GCC and Clang atomic
+ * builtins, which are available in C99 mode; define every macro in this
+ * file for other compilers.
+ */
+
+#ifndef JOBS_ATOMIC_H_
+#define JOBS_ATOMIC_H_
+
+#ifndef JOBS_ATOMIC_LOAD_ACQUIRE
+
+/**
+ * @brief Atomically load a uint32_t with acquire ordering.
+ *
+ * <br><b>Default value</b>: `__atomic_load_n( pValue, __ATOMIC_ACQUIRE )`
+ */
+    #define JOBS_ATOMIC_LOAD_ACQUIRE( pValue )    __atomic_load_n( ( pValue ), __ATOMIC_ACQUIRE )
+#endif
+
+#ifndef JOBS_ATOMIC_LOAD_RELAXED
+
+/**
+ * @brief Atomically load a uint32_t without ordering.
+ *
+ * <br><b>Default value</b>: `__atomic_load_n( pValue, __ATOMIC_RELAXED )`
+ */
+    #define JOBS_ATOMIC_LOAD_RELAXED( pValue )    __atomic_load_n( ( pValue ), __ATOMIC_RELAXED )
+#endif
+
+#ifndef JOBS_ATOMIC_FETCH_ADD
+
+/**
+ * @brief Atomically add to a uint32_t without ordering.
+ *
+ * Evaluates to the value before the addition.
+ *
+ * <br><b>Default value</b>: `__atomic_fetch_add( pValue, value, __ATOMIC_RELAXED )`
+ */
+    #define JOBS_ATOMIC_FETCH_ADD( pValue, value )    __atomic_fetch_add( ( pValue ), ( value ), __ATOMIC_RELAXED )
+#endif
+
+#ifndef JOBS_ATOMIC_STORE_RELEASE
+
+/**
+ * @brief Atomically store a uint32_t with release ordering.
+ *
+ * <br><b>Default value</b>: `__atomic_store_n( pValue, value, __ATOMIC_RELEASE )`
+ */
+    #define JOBS_ATOMIC_STORE_RELEASE( pValue, value )    __atomic_store_n( ( pValue ), ( value ), __ATOMIC_RELEASE )
+#endif
+
+#ifndef JOBS_ATOMIC_COMPARE_EXCHANGE
+
+/**
+ * @brief Atomically replace a uint32_t if it holds an expected value.
+ *
+ * Evaluates to true if *pValue was equal to *pExpected and was replaced
+ * by desired, with acquire and release ordering; otherwise *pExpected
+ * receives the current value, with acquire ordering.
+ *
+ * <br><b>Default value</b>: `__atomic_compare_exchange_n( pValue, pExpected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE )`
+ */
+    #define JOBS_ATOMIC_COMPARE_EXCHANGE( pValue, pExpected, desired ) \
+    __atomic_compare_exchange_n( ( pValue ), ( pExpected ), ( desired ), false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE )
+#endif
+
+#endif /* ifndef JOBS_ATOMIC_H_ */
@@ -0,0 +1,233 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_capture.h
+ * @brief Capture and replay of the MQTT messages a device receives on
+ * Jobs topics.
+ *
+ * A capture is a header followed by one record per message.  A record
+ * holds the time since the previous record, the topic length and the
+ * payload length as LEB128 variable length integers, then the topic and
+ * payload bytes.  Most records add 3 to 5 bytes to the message.
+ *
+ * Captures are written through a caller provided sink, e.g. a file or a
+ * RAM buffer uploaded later, and read back from memory without copies.
+ */
+
+#ifndef JOBS_CAPTURE_H_
+#define JOBS_CAPTURE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * @ingroup jobs_constants
+ * @brief Size, in bytes, of the header of a capture.
+ */
+#define JOBS_CAPTURE_HEADER_SIZE        8U
+
+/**
+ * @ingroup jobs_constants
+ * @brief Largest size, in bytes, a record adds to its topic and payload.
+ */
+#define JOBS_CAPTURE_RECORD_OVERHEAD    15U
+
+/**
+ * @ingroup jobs_structs
+ * @brief Where a capture is written.
+ */
+typedef struct
+{
+    /**
+     * @brief Append bytes to the capture.
+     *
+     * @return The number of bytes written.
+     */
+    size_t ( * write )( void * pContext,
+                        const uint8_t * buffer,
+                        size_t length );
+
+    void * pContext; /**< @brief Passed to write. */
+} JobsCaptureSink_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief A capture being written.
+ *
+ * @note Members are private, initialize with #Jobs_CaptureInit.
+ */
+typedef struct
+{
+    JobsCaptureSink_t sink;   /**< @brief The sink. */
+    uint32_t lastTimestampMs; /**< @brief Time of the last record. */
+    uint32_t recordCount;     /**< @brief Number of records written. */
+} JobsCapture_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief A captured message.
+ *
+ * Topic and payload point into the capture and are not NUL terminated.
+ */
+typedef struct
+{
+    uint32_t timestampMs; /**< @brief Time the message was received, in milliseconds. */
+    const char * topic;   /**< @brief The topic. */
+    size_t topicLength;   /**< @brief The length of the topic. */
+    const char * payload; /**< @brief The payload. */
+    size_t payloadLength; /**< @brief The length of the payload. */
+} JobsCaptureRecord_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief A capture being read.
+ *
+ * @note Members are private, initialize with #Jobs_ReplayInit.
+ */
+typedef struct
+{
+    const uint8_t * data;     /**< @brief The capture. */
+    size_t length;            /**< @brief The length of the capture. */
+    size_t offset;            /**< @brief Offset of the next record. */
+    uint32_t lastTimestampMs; /**< @brief Time of the last record read. */
+} JobsReplay_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Start a capture by writing its header to a sink.
+ *
+ * @param[out] capture  The capture to initialize.
+ * @param[in] sink  The sink, with a write function.
+ *
+ * @return #JobsSuccess if the header was written;
+ * #JobsBadParameter if invalid parameters are passed;
+ * #JobsError if the sink did not take the header.
+ */
+/* @[declare_jobs_captureinit] */
+JobsStatus_t Jobs_CaptureInit( JobsCapture_t * capture,
+                               const JobsCaptureSink_t * sink );
+/* @[declare_jobs_captureinit] */
+
+/**
+ * @brief Record a message received on a Jobs topic.
+ *
+ * Call from the MQTT callback, before the message is processed.
+ * Messages on topics outside the Jobs API are not recorded.
+ *
+ * @param[in] capture  The capture.
+ * @param[in] timestampMs  Time the message was received, in milliseconds.
+ * @param[in] topic  The topic.
+ * @param[in] topicLength  The length of the topic.
+ * @param[in] payload  The payload, may be NULL when payloadLength is 0.
+ * @param[in] payloadLength  The length of the payload.
+ *
+ * @return #JobsSuccess if the message was recorded;
+ * #JobsNoMatch if the topic is not a Jobs topic;
+ * #JobsBadParameter if invalid parameters are passed;
+ * #JobsError if the sink did not take the record.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example captures the Jobs messages of a device to a file.
+ *
+ * static size_t writeFile( void * pContext, const uint8_t * buffer, size_t length )
+ * {
+ *     return fwrite( buffer, 1U, length, ( FILE * ) pContext );
+ * }
+ *
+ * JobsCaptureSink_t sink = { writeFile, NULL };
+ * JobsCapture_t capture;
+ *
+ * sink.pContext = fopen( "jobs.cap", "wb" );
+ * ( void ) Jobs_CaptureInit( &capture, &sink );
+ *
+ * // In the MQTT callback.
+ * ( void ) Jobs_CaptureRecord( &capture, nowMs, topic, topicLength,
+ *                              payload, payloadLength );
+ * @endcode
+ */
+/* @[declare_jobs_capturerecord] */
+JobsStatus_t Jobs_CaptureRecord( JobsCapture_t * capture,
+                                 uint32_t timestampMs,
+                                 const char * topic,
+                                 size_t topicLength,
+                                 const char * payload,
+                                 size_t payloadLength );
+/* @[declare_jobs_capturerecord] */
+
+/**
+ * @brief Start reading a capture.
+ *
+ * @param[out] replay  The replay to initialize.
+ * @param[in] data  The capture.
+ * @param[in] length  The length of the capture.
+ *
+ * @return #JobsSuccess if the capture header is valid;
+ * #JobsBadParameter if invalid parameters are passed, or the data is
+ * not a capture.
+ */
+/* @[declare_jobs_replayinit] */
+JobsStatus_t Jobs_ReplayInit( JobsReplay_t * replay,
+                              const uint8_t * data,
+                              size_t length );
+/* @[declare_jobs_replayinit] */
+
+/**
+ * @brief Read the next message of a capture.
+ *
+ * A record cut short, as when the device lost power while capturing,
+ * ends the capture.
+ *
+ * @param[in] replay  The replay.
+ * @param[out] outRecord  The message.
+ *
+ * @return #JobsSuccess if a message was read;
+ * #JobsNoMatch at the end of the capture;
+ * #JobsBadParameter if invalid parameters are passed;
+ * #JobsError if the record is corrupt.
+ */
+/* @[declare_jobs_replaynext] */
+JobsStatus_t Jobs_ReplayNext( JobsReplay_t * replay,
+                              JobsCaptureRecord_t * outRecord );
+/* @[declare_jobs_replaynext] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_CAPTURE_H_ */
@@ -0,0 +1,219 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_coalesce.h
+ * @brief Rate limiting of progress updates per job.
+ *
+ * A coalescer accepts UpdateJobExecution requests at any rate and emits
+ * at most one update per job per interval.  The statusDetails of the
+ * updates received in between are merged key by key, the last writer
+ * winning.  A change of status is emitted without waiting for the
+ * interval.  Time is supplied by the caller in milliseconds, and the
+ * coalescer operates only on storage provided by the caller.
+ */
+
+#ifndef JOBS_COALESCE_H_
+#define JOBS_COALESCE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#ifndef JOBS_COALESCE_STATUS_DETAILS_MAX_LENGTH
+
+/**
+ * @brief User defined maximum length of the merged statusDetails of a
+ * coalesced update.
+ *
+ * <br><b>Default value</b>: 256
+ */
+    #define JOBS_COALESCE_STATUS_DETAILS_MAX_LENGTH    256U
+#endif
+
+/**
+ * @ingroup jobs_structs
+ * @brief The coalesced update of one job.
+ *
+ * @note Members are private, the coalescer manages every entry.
+ */
+typedef struct
+{
+    char jobId[ JOBID_MAX_LENGTH ];                                /**< @brief Job ID, not NUL terminated. */
+    char statusDetails[ JOBS_COALESCE_STATUS_DETAILS_MAX_LENGTH ]; /**< @brief Merged status details. */
+    size_t statusDetailsLength;                                    /**< @brief Merged status details length. */
+    uint32_t lastSentMs;                                           /**< @brief Time the last update was emitted. */
+    JobCurrentStatus_t status;                                     /**< @brief Status of the pending update. */
+    JobCurrentStatus_t sentStatus;                                 /**< @brief Status of the last emitted update. */
+    uint16_t jobIdLength;                                          /**< @brief Job ID length, 0 for a free entry. */
+    bool pending;                                                  /**< @brief Whether an update awaits emission. */
+    bool sent;                                                     /**< @brief Whether an update was emitted. */
+} JobsCoalescedJob_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief A fixed capacity progress update coalescer.
+ *
+ * @note Members are private, initialize with #Jobs_CoalescerInit.
+ */
+typedef struct
+{
+    JobsCoalescedJob_t * pJobs; /**< @brief Caller provided entries. */
+    size_t jobCount;            /**< @brief Number of entries. */
+    uint32_t intervalMs;        /**< @brief Minimum time between updates of a job. */
+} JobsCoalescer_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Initialize a coalescer over caller provided entries.
+ *
+ * @param[out] coalescer  The coalescer to initialize.
+ * @param[in] jobs  Storage for one entry per concurrently reporting job.
+ * @param[in] jobCount  Number of elements in jobs.
+ * @param[in] intervalMs  Minimum time, in milliseconds, between two
+ * updates of the same job with the same status.
+ *
+ * @return #JobsSuccess if the coalescer was initialized;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_coalescerinit] */
+JobsStatus_t Jobs_CoalescerInit( JobsCoalescer_t * coalescer,
+                                 JobsCoalescedJob_t * jobs,
+                                 size_t jobCount,
+                                 uint32_t intervalMs );
+/* @[declare_jobs_coalescerinit] */
+
+/**
+ * @brief Submit an update for a job.
+ *
+ * The status replaces the pending status, unless the pending status is
+ * terminal: a terminal status is kept until it is emitted, so a later
+ * progress update cannot hide it.  The keys of the statusDetails
+ * object are merged into the pending status details, replacing the value
+ * of a key already present.  The expectedVersion of the request is not
+ * used.
+ *
+ * @param[in] coalescer  The coalescer.
+ * @param[in] jobId  The job ID.
+ * @param[in] jobIdLength  The length of the job ID.
+ * @param[in] request  The update request.
+ *
+ * @return #JobsSuccess if the update was merged;
+ * #JobsBadParameter if invalid parameters are passed, or the status
+ * details are not a JSON object;
+ * #JobsBufferTooSmall if no entry is free for a new job, or the merged
+ * status details are longer than #JOBS_COALESCE_STATUS_DETAILS_MAX_LENGTH.
+ */
+/* @[declare_jobs_coalescersubmit] */
+JobsStatus_t Jobs_CoalescerSubmit( JobsCoalescer_t * coalescer,
+                                   const char * jobId,
+                                   uint16_t jobIdLength,
+                                   JobsUpdateRequest_t request );
+/* @[declare_jobs_coalescersubmit] */
+
+/**
+ * @brief Take the next update that is due.
+ *
+ * An update is due when it is the first of its job, its status differs
+ * from the last emitted status, or the interval has elapsed since the
+ * last emitted update.  Once a terminal status is emitted, the entry of
+ * the job is released.
+ *
+ * @param[in] coalescer  The coalescer.
+ * @param[in] nowMs  The current time in milliseconds.
+ * @param[out] outJobId  The job ID of the update, valid until the next
+ * call to #Jobs_CoalescerSubmit.
+ * @param[out] outJobIdLength  The length of the job ID.
+ * @param[out] buffer  The buffer to receive the update message.
+ * @param[in] bufferSize  The size of the buffer.
+ * @param[out] outLength  The length of the update message.
+ *
+ * @return #JobsSuccess if an update message was written;
+ * #JobsNoMatch if no update is due;
+ * #JobsBadParameter if invalid parameters are passed;
+ * #JobsBufferTooSmall if the buffer cannot hold the update, which stays
+ * pending.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example publishes every due update from a periodic task.
+ *
+ * const char * jobId;
+ * uint16_t jobIdLength;
+ * char message[ 300 ];
+ * size_t messageLength;
+ *
+ * while( Jobs_CoalescerNext( &coalescer, now, &jobId, &jobIdLength,
+ *                            message, sizeof( message ),
+ *                            &messageLength ) == JobsSuccess )
+ * {
+ *     // Publish message to the topic generated by Jobs_Update() for jobId.
+ * }
+ * @endcode
+ */
+/* @[declare_jobs_coalescernext] */
+JobsStatus_t Jobs_CoalescerNext( JobsCoalescer_t * coalescer,
+                                 uint32_t nowMs,
+                                 const char ** outJobId,
+                                 uint16_t * outJobIdLength,
+                                 char * buffer,
+                                 size_t bufferSize,
+                                 size_t * outLength );
+/* @[declare_jobs_coalescernext] */
+
+/**
+ * @brief Get the time until the next update is due.
+ *
+ * @param[in] coalescer  The coalescer.
+ * @param[in] nowMs  The current time in milliseconds.
+ * @param[out] outDelayMs  Milliseconds until an update is due, 0 if one
+ * is due now.
+ *
+ * @return #JobsSuccess if an update is pending;
+ * #JobsNoMatch if no update is pending;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_coalescernextdelay] */
+JobsStatus_t Jobs_CoalescerNextDelay( const JobsCoalescer_t * coalescer,
+                                      uint32_t nowMs,
+                                      uint32_t * outDelayMs );
+/* @[declare_jobs_coalescernextdelay] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_COALESCE_H_ */
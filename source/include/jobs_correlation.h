@@ -0,0 +1,248 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_correlation.h
+ * @brief Client token correlation of in-flight AWS IoT Jobs requests.
+ *
+ * A correlation table hands out compact client tokens for requests
+ * published to the Jobs service, and resolves the accepted or rejected
+ * response carrying that token back to its request in constant time.
+ * The table operates only on storage provided by the caller.
+ */
+
+#ifndef JOBS_CORRELATION_H_
+#define JOBS_CORRELATION_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * @ingroup jobs_constants
+ * @brief Length of a client token generated by a correlation table.
+ *
+ * Tokens are eight lowercase hexadecimal characters encoding the table
+ * slot and a generation count for that slot.
+ */
+#define JOBS_CLIENT_TOKEN_LENGTH         8U
+
+/**
+ * @ingroup jobs_constants
+ * @brief Maximum number of slots a correlation table can manage.
+ */
+#define JOBS_CORRELATION_MAX_REQUESTS    0xFFFFU
+
+/**
+ * @ingroup jobs_structs
+ * @brief A request awaiting its response from the Jobs service.
+ *
+ * @note The table manages the sequence, nextFree and inUse members.
+ */
+typedef struct
+{
+    JobsApi_t api;       /**< @brief The Jobs API the request was published to. */
+    uint32_t deadlineMs; /**< @brief Time, in milliseconds, when the request times out. */
+    uint32_t userData;   /**< @brief Caller value handed back when the request completes. */
+    uint16_t sequence;   /**< @brief Generation of the slot, embedded in the client token. */
+    uint16_t nextFree;   /**< @brief Index of the next free slot. */
+    bool inUse;          /**< @brief Whether the slot holds a pending request. */
+} JobsPendingRequest_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief A fixed capacity table of pending requests.
+ *
+ * @note Members are private, initialize with #Jobs_CorrelationInit.
+ */
+typedef struct
+{
+    JobsPendingRequest_t * pRequests; /**< @brief Caller provided slots. */
+    uint16_t capacity;                /**< @brief Number of slots. */
+    uint16_t count;                   /**< @brief Number of slots in use. */
+    uint16_t freeHead;                /**< @brief First free slot, equal to capacity when full. */
+    uint16_t expireCursor;            /**< @brief Slot #Jobs_CorrelationExpire examines first. */
+} JobsCorrelationTable_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Initialize a correlation table over caller provided slots.
+ *
+ * @param[out] table  The table to initialize.
+ * @param[in] requests  Storage for the pending requests.
+ * @param[in] requestCount  Number of elements in requests, at most
+ * #JOBS_CORRELATION_MAX_REQUESTS.
+ *
+ * @return #JobsSuccess if the table was initialized;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_correlationinit] */
+JobsStatus_t Jobs_CorrelationInit( JobsCorrelationTable_t * table,
+                                   JobsPendingRequest_t * requests,
+                                   size_t requestCount );
+/* @[declare_jobs_correlationinit] */
+
+/**
+ * @brief Reserve a slot for a request and generate its client token.
+ *
+ * @param[in] table  The correlation table.
+ * @param[in] api  The Jobs API the request will be published to.
+ * @param[in] deadlineMs  Time, in milliseconds, when the request times out.
+ * @param[in] userData  Caller value handed back with the request.
+ * @param[out] tokenBuffer  The buffer to contain the client token.
+ * @param[in] tokenBufferLength  The size of tokenBuffer.
+ *
+ * @return #JobsSuccess if the request was added and its token written;
+ * #JobsBadParameter if invalid parameters are passed;
+ * #JobsBufferTooSmall if every slot is in use, or tokenBuffer cannot hold
+ * #JOBS_CLIENT_TOKEN_LENGTH characters.
+ *
+ * @note The token is not NUL terminated.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example reserves a slot for a StartNextPendingJobExecution
+ * // request, publishes it, and later resolves the response.
+ *
+ * JobsPendingRequest_t slots[ 8 ];
+ * JobsCorrelationTable_t table;
+ * JobsPendingRequest_t completed;
+ * char token[ JOBS_CLIENT_TOKEN_LENGTH ];
+ * char message[ START_JOB_MSG_LENGTH ];
+ * size_t messageLength;
+ *
+ * ( void ) Jobs_CorrelationInit( &table, slots, 8U );
+ *
+ * if( Jobs_CorrelationAdd( &table, JobsApiStartNext, now + 5000U, 0U,
+ *                          token, sizeof( token ) ) == JobsSuccess )
+ * {
+ *     messageLength = Jobs_StartNextMsg( token, sizeof( token ),
+ *                                        message, sizeof( message ) );
+ *     // Publish message to the topic from Jobs_StartNext().
+ * }
+ *
+ * // In the MQTT callback, after Jobs_MatchTopic() returned api.
+ * if( Jobs_CorrelationResolve( &table, api, payload, payloadLength,
+ *                              &completed ) == JobsSuccess )
+ * {
+ *     // completed.api and completed.userData identify the request.
+ * }
+ * @endcode
+ */
+/* @[declare_jobs_correlationadd] */
+JobsStatus_t Jobs_CorrelationAdd( JobsCorrelationTable_t * table,
+                                  JobsApi_t api,
+                                  uint32_t deadlineMs,
+                                  uint32_t userData,
+                                  char * tokenBuffer,
+                                  size_t tokenBufferLength );
+/* @[declare_jobs_correlationadd] */
+
+/**
+ * @brief Resolve a response from the Jobs service to its pending request.
+ *
+ * The clientToken is read from the response payload, decoded to its slot,
+ * and checked against the slot generation and the request API.  A match
+ * releases the slot.
+ *
+ * @param[in] table  The correlation table.
+ * @param[in] topic  The topic value output by #Jobs_MatchTopic.
+ * @param[in] message  The response payload.
+ * @param[in] messageLength  The length of the response payload.
+ * @param[out] outRequest  The completed request, may be NULL.
+ *
+ * @return #JobsSuccess if the response matched a pending request;
+ * #JobsNoMatch if the topic is not a response, or the payload has no
+ * matching client token;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_correlationresolve] */
+JobsStatus_t Jobs_CorrelationResolve( JobsCorrelationTable_t * table,
+                                      JobsTopic_t topic,
+                                      const char * message,
+                                      size_t messageLength,
+                                      JobsPendingRequest_t * outRequest );
+/* @[declare_jobs_correlationresolve] */
+
+/**
+ * @brief Release the pending request for a client token.
+ *
+ * Use this when the request could not be published.
+ *
+ * @param[in] table  The correlation table.
+ * @param[in] token  The client token returned by #Jobs_CorrelationAdd.
+ * @param[in] tokenLength  The length of the token.
+ *
+ * @return #JobsSuccess if the request was released;
+ * #JobsNoMatch if no pending request has the token;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_correlationremove] */
+JobsStatus_t Jobs_CorrelationRemove( JobsCorrelationTable_t * table,
+                                     const char * token,
+                                     size_t tokenLength );
+/* @[declare_jobs_correlationremove] */
+
+/**
+ * @brief Release one pending request whose deadline has passed.
+ *
+ * Call repeatedly until #JobsNoMatch is returned to collect every
+ * timed out request.  Each call resumes the scan after the slot the
+ * previous call released, so collecting k requests examines each slot
+ * about twice, not k times.
+ *
+ * @param[in] table  The correlation table.
+ * @param[in] nowMs  The current time in milliseconds.
+ * @param[out] outRequest  The timed out request, may be NULL.
+ *
+ * @return #JobsSuccess if a timed out request was released;
+ * #JobsNoMatch if no request has timed out;
+ * #JobsBadParameter if invalid parameters are passed.
+ *
+ * @note Deadlines are compared modulo 2^32, so they must be less than
+ * 2^31 milliseconds in the future.
+ */
+/* @[declare_jobs_correlationexpire] */
+JobsStatus_t Jobs_CorrelationExpire( JobsCorrelationTable_t * table,
+                                     uint32_t nowMs,
+                                     JobsPendingRequest_t * outRequest );
+/* @[declare_jobs_correlationexpire] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_CORRELATION_H_ */
@@ -0,0 +1,165 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_dedup.h
+ * @brief Suppression of repeated job execution notifications.
+ *
+ * After a reconnect, or when several jobs change, the same job execution
+ * is often described by DescribeJobExecution ($next) responses,
+ * NextJobExecutionChanged notifications and StartNextPendingJobExecution
+ * responses in quick succession.  A
+ * filter remembers the last executions seen, keyed by job ID, version
+ * number and execution number read from the message, so repeats can be
+ * dropped before the job document is parsed.  The filter operates only on
+ * storage provided by the caller, whose size sets the window of executions
+ * remembered.
+ */
+
+#ifndef JOBS_DEDUP_H_
+#define JOBS_DEDUP_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * @ingroup jobs_structs
+ * @brief A job execution remembered by a filter.
+ */
+typedef struct
+{
+    char jobId[ JOBID_MAX_LENGTH ]; /**< @brief Job ID, not NUL terminated. */
+    uint32_t versionNumber;         /**< @brief Version of the job execution. */
+    uint32_t executionNumber;       /**< @brief Execution number of the job execution. */
+    uint16_t jobIdLength;           /**< @brief Job ID length, 0 for a free entry. */
+} JobsDedupEntry_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief A filter of repeated job executions.
+ *
+ * @note Members are private, initialize with #Jobs_DedupInit.
+ */
+typedef struct
+{
+    JobsDedupEntry_t * pEntries; /**< @brief Caller provided window. */
+    size_t window;               /**< @brief Number of entries. */
+    size_t next;                 /**< @brief Entry replaced by the next new execution. */
+} JobsDedupFilter_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Initialize a filter over a caller provided window.
+ *
+ * @param[out] filter  The filter to initialize.
+ * @param[in] entries  Storage for the remembered executions.
+ * @param[in] window  Number of elements in entries, the number of
+ * distinct executions remembered.
+ *
+ * @return #JobsSuccess if the filter was initialized;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_dedupinit] */
+JobsStatus_t Jobs_DedupInit( JobsDedupFilter_t * filter,
+                             JobsDedupEntry_t * entries,
+                             size_t window );
+/* @[declare_jobs_dedupinit] */
+
+/**
+ * @brief Check whether a message describes a job execution seen before,
+ * and remember the execution if not.
+ *
+ * The execution is read from the "execution" object of the message, as
+ * sent on the NextJobExecutionChanged, StartNextPendingJobExecution and
+ * DescribeJobExecution accepted topics.  Messages without a job ID,
+ * version number and execution number, or with a job ID longer than
+ * #JOBID_MAX_LENGTH, are never repeats.
+ *
+ * @param[in] filter  The filter.
+ * @param[in] message  The message payload.
+ * @param[in] messageLength  The length of the message payload.
+ *
+ * @return true if the execution was seen within the window, and the
+ * message may be dropped;
+ * false otherwise, or if invalid parameters are passed.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example drops repeated notifications before the job
+ * // document is read.
+ *
+ * static JobsDedupEntry_t window[ 8 ];
+ * static JobsDedupFilter_t filter;
+ *
+ * ( void ) Jobs_DedupInit( &filter, window, 8U );
+ *
+ * // In the MQTT callback, after Jobs_MatchTopic() returned api.
+ * if( ( ( api == JobsNextJobChanged ) || ( api == JobsStartNextSuccess ) ) &&
+ *     ( Jobs_DedupIsRepeat( &filter, payload, payloadLength ) == false ) )
+ * {
+ *     documentLength = Jobs_GetJobDocument( payload, payloadLength, &document );
+ *     // Process the job document.
+ * }
+ * @endcode
+ */
+/* @[declare_jobs_dedupisrepeat] */
+bool Jobs_DedupIsRepeat( JobsDedupFilter_t * filter,
+                         const char * message,
+                         size_t messageLength );
+/* @[declare_jobs_dedupisrepeat] */
+
+/**
+ * @brief Forget every execution seen, so the next message for each is
+ * processed.
+ *
+ * Use this before requesting a job execution again on purpose, e.g.
+ * after the job document was lost.
+ *
+ * @param[in] filter  The filter.
+ *
+ * @return #JobsSuccess if the filter was reset;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_dedupreset] */
+JobsStatus_t Jobs_DedupReset( JobsDedupFilter_t * filter );
+/* @[declare_jobs_dedupreset] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_DEDUP_H_ */
@@ -0,0 +1,252 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_docstore.h
+ * @brief Persistent store of job documents keyed by job ID and version.
+ *
+ * Job documents are appended to a caller provided region, indexed by a
+ * fixed size open addressing table on the job ID and version number of
+ * the job execution.  Lookups return a slice of the region, which can be
+ * passed directly to populateJobDocFields() or other job document APIs
+ * without copying.
+ *
+ * The store keeps its state only in the region, so a region mapped from
+ * a file keeps the documents across restarts, and repeated describes or
+ * retries of a job need not download its document again.
+ * #Jobs_DocStoreMapFile maps such a file on Linux; on other platforms the
+ * region may be any memory, such as memory mapped flash.
+ *
+ * @warning The store survives a crash of the process, but not a power
+ * loss or kernel crash: pages of a shared mapping reach the disk in any
+ * order, so after one the index may refer to data never written.
+ * #Jobs_DocStoreInit formats a store whose index refers past the written
+ * data, but a document read after such a failure may still hold stale
+ * bytes.  Check the document, for example against a signature, or
+ * clear the store after an unclean shutdown.
+ */
+
+#ifndef JOBS_DOCSTORE_H_
+#define JOBS_DOCSTORE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * @ingroup jobs_constants
+ * @brief Size, in bytes, of the store header in a region.
+ */
+#define JOBS_DOCSTORE_HEADER_SIZE    32U
+
+/**
+ * @ingroup jobs_constants
+ * @brief Size, in bytes, of an index slot in a region.
+ */
+#define JOBS_DOCSTORE_SLOT_SIZE      16U
+
+/**
+ * @ingroup jobs_structs
+ * @brief A job document store over a caller provided region.
+ *
+ * @note Members are private, initialize with #Jobs_DocStoreInit.
+ */
+typedef struct
+{
+    uint32_t * pHeader;  /**< @brief Header at the start of the region. */
+    uint32_t * pSlots;   /**< @brief Index slots following the header. */
+    char * pData;        /**< @brief Document data following the slots. */
+    uint32_t slotMask;   /**< @brief Number of slots less one. */
+    uint32_t dataSize;   /**< @brief Size of the document data area. */
+} JobsDocStore_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Open a store over a region, keeping the documents already in it.
+ *
+ * A region that does not hold a store with the same slot count and size
+ * is formatted as an empty store.
+ *
+ * @param[out] store  The store to initialize.
+ * @param[in] region  The region, aligned to 4 bytes.
+ * @param[in] regionSize  The size of the region in bytes.
+ * @param[in] slotCount  Number of index slots, a power of 2.  At most
+ * three quarters of them are used.
+ *
+ * @return #JobsSuccess if the store was opened;
+ * #JobsBadParameter if invalid parameters are passed, or the region
+ * cannot hold the index and some document data.
+ */
+/* @[declare_jobs_docstoreinit] */
+JobsStatus_t Jobs_DocStoreInit( JobsDocStore_t * store,
+                                uint32_t * region,
+                                size_t regionSize,
+                                size_t slotCount );
+/* @[declare_jobs_docstoreinit] */
+
+/**
+ * @brief Add the document of a job execution.
+ *
+ * A document already stored for the job ID and version is kept.  When
+ * the index or the data area is full, the store is emptied first.
+ *
+ * @param[in] store  The store.
+ * @param[in] jobId  The job ID.
+ * @param[in] jobIdLength  The length of the job ID.
+ * @param[in] versionNumber  The version of the job execution.
+ * @param[in] document  The job document.
+ * @param[in] documentLength  The length of the job document.
+ * @param[out] outDocument  The stored document, may be NULL.
+ * @param[out] outDocumentLength  The length of the stored document, may
+ * be NULL.
+ *
+ * @return #JobsSuccess if the document is stored;
+ * #JobsBufferTooSmall if the document does not fit the data area;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_docstoreput] */
+JobsStatus_t Jobs_DocStorePut( JobsDocStore_t * store,
+                               const char * jobId,
+                               uint16_t jobIdLength,
+                               uint32_t versionNumber,
+                               const char * document,
+                               size_t documentLength,
+                               const char ** outDocument,
+                               size_t * outDocumentLength );
+/* @[declare_jobs_docstoreput] */
+
+/**
+ * @brief Look up the document of a job execution.
+ *
+ * @param[in] store  The store.
+ * @param[in] jobId  The job ID.
+ * @param[in] jobIdLength  The length of the job ID.
+ * @param[in] versionNumber  The version of the job execution.
+ * @param[out] outDocument  The stored document, not NUL terminated.
+ * @param[out] outDocumentLength  The length of the stored document.
+ *
+ * @return #JobsSuccess if the document was found;
+ * #JobsNoMatch if no document is stored for the job ID and version;
+ * #JobsBadParameter if invalid parameters are passed.
+ *
+ * @note The document stays valid until the store is emptied by
+ * #Jobs_DocStorePut or #Jobs_DocStoreClear.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example parses an OTA job document from the store,
+ * // and stores it from the DescribeJobExecution response otherwise.
+ *
+ * const char * document;
+ * size_t documentLength;
+ * AfrOtaJobDocumentFields_t fields;
+ *
+ * if( Jobs_DocStoreGet( &store, jobId, jobIdLength, versionNumber,
+ *                       &document, &documentLength ) == JobsSuccess )
+ * {
+ *     ( void ) populateJobDocFields( document, documentLength, 0,
+ *                                    "MQTT", 4U, &fields );
+ * }
+ * else
+ * {
+ *     documentLength = Jobs_GetJobDocument( message, messageLength, &document );
+ *     ( void ) Jobs_DocStorePut( &store, jobId, jobIdLength, versionNumber,
+ *                                document, documentLength, NULL, NULL );
+ * }
+ * @endcode
+ */
+/* @[declare_jobs_docstoreget] */
+JobsStatus_t Jobs_DocStoreGet( const JobsDocStore_t * store,
+                               const char * jobId,
+                               uint16_t jobIdLength,
+                               uint32_t versionNumber,
+                               const char ** outDocument,
+                               size_t * outDocumentLength );
+/* @[declare_jobs_docstoreget] */
+
+/**
+ * @brief Remove every document from the store.
+ *
+ * @param[in] store  The store.
+ *
+ * @return #JobsSuccess if the store was emptied;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_docstoreclear] */
+JobsStatus_t Jobs_DocStoreClear( JobsDocStore_t * store );
+/* @[declare_jobs_docstoreclear] */
+
+/**
+ * @brief Map a file as a shared region for a store, creating it if needed.
+ *
+ * Writes to the region reach the file without further calls.
+ *
+ * @param[in] path  The NUL terminated path of the file.
+ * @param[in] regionSize  The size of the region in bytes.
+ * @param[out] outRegion  The mapped region.
+ *
+ * @return #JobsSuccess if the file was mapped;
+ * #JobsError if the file could not be opened or mapped, and always on
+ * platforms other than Linux;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_docstoremapfile] */
+JobsStatus_t Jobs_DocStoreMapFile( const char * path,
+                                   size_t regionSize,
+                                   uint32_t ** outRegion );
+/* @[declare_jobs_docstoremapfile] */
+
+/**
+ * @brief Unmap a region mapped by #Jobs_DocStoreMapFile.
+ *
+ * @param[in] region  The mapped region.
+ * @param[in] regionSize  The size of the region in bytes.
+ *
+ * @return #JobsSuccess if the region was unmapped;
+ * #JobsError if unmapping failed, and always on platforms other than
+ * Linux;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_docstoreunmapfile] */
+JobsStatus_t Jobs_DocStoreUnmapFile( uint32_t * region,
+                                     size_t regionSize );
+/* @[declare_jobs_docstoreunmapfile] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_DOCSTORE_H_ */
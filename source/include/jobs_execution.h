@@ -0,0 +1,317 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_execution.h
+ * @brief State machine for the lifecycle of a job execution.
+ *
+ * A job execution record follows one job at a time from
+ * StartNextPendingJobExecution through IN_PROGRESS updates to a terminal
+ * status.  Matched Jobs messages, reports from the application and the
+ * passage of time are its events, and each event yields at most one
+ * request to publish.
+ *
+ * A record is 24 bytes: the job ID is kept as a 32-bit FNV-1a hash, so
+ * the application keeps the job ID string with the job document it is
+ * acting on.  Every transition is O(1) apart from reading the execution
+ * fields from a message, which is linear in the message length.
+ */
+
+#ifndef JOBS_EXECUTION_H_
+#define JOBS_EXECUTION_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#ifndef JOBS_EXECUTION_RESPONSE_TIMEOUT_MS
+
+/**
+ * @brief User defined time, in milliseconds, to wait for the response
+ * to a request before the request is retried.
+ *
+ * <br><b>Default value</b>: 5000
+ */
+    #define JOBS_EXECUTION_RESPONSE_TIMEOUT_MS    5000U
+#endif
+
+#ifndef JOBS_EXECUTION_MAX_RETRIES
+
+/**
+ * @brief User defined number of times a rejected update is sent again
+ * before the status known to the service is kept.
+ *
+ * Only a VersionMismatch sends the same update again at once; other
+ * rejections take the execution state of the response, or describe the
+ * job execution, and count against the same limit.  At most 254.
+ *
+ * <br><b>Default value</b>: 3
+ */
+    #define JOBS_EXECUTION_MAX_RETRIES    3U
+#endif
+
+/**
+ * @ingroup jobs_enum_types
+ * @brief States of a job execution record.
+ */
+typedef enum
+{
+    JobsExecutionIdle = 0, /**< @brief No job, nothing in flight. */
+    JobsExecutionStarting, /**< @brief StartNextPendingJobExecution in flight. */
+    JobsExecutionRunning,  /**< @brief The job is IN_PROGRESS on the device. */
+    JobsExecutionUpdating, /**< @brief UpdateJobExecution in flight. */
+    JobsExecutionSyncing   /**< @brief DescribeJobExecution in flight to recover the state. */
+} JobsExecutionState_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief Compact record of one job execution.
+ *
+ * @note Members are private, initialize with #Jobs_ExecutionInit.
+ */
+typedef struct
+{
+    uint32_t jobIdHash;       /**< @brief FNV-1a hash of the job ID. */
+    uint32_t versionNumber;   /**< @brief Last version reported by the service. */
+    uint32_t executionNumber; /**< @brief Execution number of the job. */
+    uint32_t deadlineMs;      /**< @brief Response deadline of the request in flight. */
+    uint8_t state;            /**< @brief A #JobsExecutionState_t. */
+    uint8_t status;           /**< @brief Status known to the service, a #JobCurrentStatus_t. */
+    uint8_t pendingStatus;    /**< @brief Status reported by the application, a #JobCurrentStatus_t. */
+    uint8_t dirty;            /**< @brief Set when a report arrived while a request was in flight. */
+    uint8_t retries;          /**< @brief Rejected updates since the last accepted one. */
+} JobsExecution_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief A request to publish, produced by an event.
+ */
+typedef struct
+{
+    JobsApi_t api;             /**< @brief The API to publish to, #JobsInvalidApi for none. */
+    JobCurrentStatus_t status; /**< @brief The status to report for #JobsApiUpdate. */
+} JobsExecutionAction_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Initialize a job execution record in the idle state.
+ *
+ * @param[out] execution  The record to initialize.
+ *
+ * @return #JobsSuccess if the record was initialized;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_executioninit] */
+JobsStatus_t Jobs_ExecutionInit( JobsExecution_t * execution );
+/* @[declare_jobs_executioninit] */
+
+/**
+ * @brief Ask for the next pending job execution.
+ *
+ * Call this when the device is ready for work, for example after
+ * connecting.
+ *
+ * @param[in] execution  The record.
+ * @param[in] nowMs  The current time in milliseconds.
+ * @param[out] outAction  The request to publish.
+ *
+ * @return #JobsSuccess if a StartNextPendingJobExecution request is due;
+ * #JobsNoMatch if the record is not idle;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_executionstart] */
+JobsStatus_t Jobs_ExecutionStart( JobsExecution_t * execution,
+                                  uint32_t nowMs,
+                                  JobsExecutionAction_t * outAction );
+/* @[declare_jobs_executionstart] */
+
+/**
+ * @brief Report a new status of the current job from the application.
+ *
+ * While another request is in flight the report is held and sent once
+ * the response arrives.
+ *
+ * @param[in] execution  The record.
+ * @param[in] status  The new status, any but #Queued.
+ * @param[in] nowMs  The current time in milliseconds.
+ * @param[out] outAction  The request to publish, if any.
+ *
+ * @return #JobsSuccess if the report was accepted;
+ * #JobsNoMatch if there is no current job;
+ * #JobsBadParameter if invalid parameters are passed, or status is
+ * #Queued, which only the service sets.
+ */
+/* @[declare_jobs_executionreport] */
+JobsStatus_t Jobs_ExecutionReport( JobsExecution_t * execution,
+                                   JobCurrentStatus_t status,
+                                   uint32_t nowMs,
+                                   JobsExecutionAction_t * outAction );
+/* @[declare_jobs_executionreport] */
+
+/**
+ * @brief Handle a matched Jobs message.
+ *
+ * | State    | Message                                | Next state and request        |
+ * | :------- | :------------------------------------- | :---------------------------- |
+ * | Idle     | notify-next with an execution          | Starting, StartNext           |
+ * | Starting | start-next accepted with an execution  | Running                       |
+ * | Starting | start-next accepted without, rejected  | Idle                          |
+ * | Running  | notify-next naming another or no job   | Starting, StartNext, or Idle  |
+ * | Updating | update accepted                        | Running, or Idle and StartNext if terminal |
+ * | Updating | update rejected with a terminal state  | Idle, StartNext               |
+ * | Updating | VersionMismatch with executionState    | Updating, Update with the new version |
+ * | Updating | other rejection with executionState    | Running with the service's status |
+ * | Updating | update rejected without executionState | Syncing, Describe             |
+ * | Syncing  | describe accepted                      | Running or Updating, or Idle and StartNext if terminal |
+ * | Syncing  | describe rejected                      | Idle, StartNext               |
+ *
+ * After #JOBS_EXECUTION_MAX_RETRIES rejected updates, the status known
+ * to the service is kept instead of the reported one.
+ *
+ * @param[in] execution  The record.
+ * @param[in] topic  The topic value output by #Jobs_MatchTopic.
+ * @param[in] jobId  The job ID output by #Jobs_MatchTopic, may be NULL.
+ * @param[in] jobIdLength  The length of the job ID.
+ * @param[in] message  The message payload.
+ * @param[in] messageLength  The length of the message payload.
+ * @param[in] nowMs  The current time in milliseconds.
+ * @param[out] outAction  The request to publish, if any.
+ *
+ * @return #JobsSuccess if the message caused a transition;
+ * #JobsNoMatch if the message is not for this record in its state;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_executionhandle] */
+JobsStatus_t Jobs_ExecutionHandle( JobsExecution_t * execution,
+                                   JobsTopic_t topic,
+                                   const char * jobId,
+                                   uint16_t jobIdLength,
+                                   const char * message,
+                                   size_t messageLength,
+                                   uint32_t nowMs,
+                                   JobsExecutionAction_t * outAction );
+/* @[declare_jobs_executionhandle] */
+
+/**
+ * @brief Retry the request in flight once its response is overdue.
+ *
+ * An overdue StartNextPendingJobExecution or DescribeJobExecution request
+ * is sent again; an overdue UpdateJobExecution request is followed by a
+ * DescribeJobExecution request, since the update may have been applied.
+ *
+ * @param[in] execution  The record.
+ * @param[in] nowMs  The current time in milliseconds.
+ * @param[out] outAction  The request to publish, if any.
+ *
+ * @return #JobsSuccess if a request is due;
+ * #JobsNoMatch if nothing is overdue;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_executiontick] */
+JobsStatus_t Jobs_ExecutionTick( JobsExecution_t * execution,
+                                 uint32_t nowMs,
+                                 JobsExecutionAction_t * outAction );
+/* @[declare_jobs_executiontick] */
+
+/**
+ * @brief Populate the message string of a request produced by an event.
+ *
+ * Updates carry the expectedVersion and executionNumber of the record
+ * and ask the service to leave the job document and execution state out
+ * of the response.
+ *
+ * @param[in] execution  The record.
+ * @param[in] action  The request produced by the record.
+ * @param[in] statusDetails  JSON status details for an update, may be NULL.
+ * @param[in] statusDetailsLength  The length of the status details.
+ * @param[out] buffer  The buffer to be written to, NULL to compute the length.
+ * @param[in] bufferSize  The size of the buffer.
+ *
+ * @return 0 if invalid parameters are passed or the write fails.
+ * @return messageLength if the write is successful, or the required
+ * length when buffer is NULL.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example drives a record from the MQTT callback.
+ *
+ * JobsExecutionAction_t action;
+ * char message[ 128 ];
+ * size_t messageLength;
+ *
+ * if( Jobs_ExecutionHandle( &execution, topic, jobId, jobIdLength,
+ *                           payload, payloadLength, now,
+ *                           &action ) == JobsSuccess )
+ * {
+ *     if( action.api != JobsInvalidApi )
+ *     {
+ *         messageLength = Jobs_ExecutionMsg( &execution, &action, NULL, 0U,
+ *                                            message, sizeof( message ) );
+ *         // Publish message to the topic for action.api.
+ *     }
+ * }
+ * @endcode
+ */
+/* @[declare_jobs_executionmsg] */
+size_t Jobs_ExecutionMsg( const JobsExecution_t * execution,
+                          const JobsExecutionAction_t * action,
+                          const char * statusDetails,
+                          size_t statusDetailsLength,
+                          char * buffer,
+                          size_t bufferSize );
+/* @[declare_jobs_executionmsg] */
+
+/**
+ * @brief Checks if a record follows a job.
+ *
+ * @param[in] execution  The record.
+ * @param[in] jobId  The job ID.
+ * @param[in] jobIdLength  The length of the job ID.
+ *
+ * @return true if the record is not idle and the job ID hash matches;
+ * false otherwise
+ */
+/* @[declare_jobs_executionisjob] */
+bool Jobs_ExecutionIsJob( const JobsExecution_t * execution,
+                          const char * jobId,
+                          size_t jobIdLength );
+/* @[declare_jobs_executionisjob] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_EXECUTION_H_ */
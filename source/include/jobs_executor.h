@@ -0,0 +1,319 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_executor.h
+ * @brief Work-stealing executor for job steps of many things.
+ *
+ * Tasks, such as parsing, verifying or downloading one file of a job
+ * document, are submitted against a thing.  Tasks of one thing run one at
+ * a time in submission order; tasks of different things run in parallel on
+ * the worker tasks that call #Jobs_ExecutorRun.  Each worker takes things
+ * from the head of its own queue.  A worker whose queue is empty steals
+ * the newer half of the queue of another worker, taken from the tail so
+ * the owner keeps the things it runs next.  When a task returns, the
+ * completion callback receives the UpdateJobExecution message built from
+ * the status the task reported.
+ *
+ * The executor creates no threads and allocates no memory.  Tasks, things
+ * and workers live in storage provided by the caller, and shared state is
+ * guarded by spin locks built on the operations in jobs_atomic.h.  A
+ * worker that finds a lock taken backs off with #JOBS_EXECUTOR_PAUSE,
+ * and yields with #JOBS_EXECUTOR_YIELD once the backoff reaches
+ * #JOBS_EXECUTOR_BACKOFF_LIMIT.
+ */
+
+#ifndef JOBS_EXECUTOR_H_
+#define JOBS_EXECUTOR_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#ifndef JOBS_EXECUTOR_MESSAGE_MAX_LENGTH
+
+/**
+ * @brief User defined size of the buffer each worker builds completion
+ * messages in.
+ *
+ * <br><b>Default value</b>: 512
+ */
+    #define JOBS_EXECUTOR_MESSAGE_MAX_LENGTH    512U
+#endif
+
+#ifndef JOBS_EXECUTOR_PAUSE
+
+/**
+ * @brief Wait a moment before trying a taken lock again.
+ *
+ * Define it to the spin-wait hint of the processor, such as
+ * `__builtin_ia32_pause()` on x86 or `__asm__ volatile ( "yield" )` on
+ * Arm, so a spinning worker leaves the core to the lock holder.
+ *
+ * <br><b>Default value</b>: A compiler barrier, `__asm__ volatile ( "" ::: "memory" )`
+ */
+    #define JOBS_EXECUTOR_PAUSE()    __asm__ volatile ( "" ::: "memory" )
+#endif
+
+#ifndef JOBS_EXECUTOR_YIELD
+
+/**
+ * @brief Give up the processor while a lock stays taken.
+ *
+ * Define it to, e.g., taskYIELD() on FreeRTOS or sched_yield() on POSIX,
+ * so a worker preempting the lock holder does not spin out its time
+ * slice.
+ *
+ * <br><b>Default value</b>: #JOBS_EXECUTOR_PAUSE
+ */
+    #define JOBS_EXECUTOR_YIELD()    JOBS_EXECUTOR_PAUSE()
+#endif
+
+#ifndef JOBS_EXECUTOR_BACKOFF_LIMIT
+
+/**
+ * @brief User defined largest number of #JOBS_EXECUTOR_PAUSE calls
+ * between two attempts to take a lock.
+ *
+ * The number doubles after each failed attempt, from 1; past the limit a
+ * worker calls #JOBS_EXECUTOR_YIELD before each attempt.
+ *
+ * <br><b>Default value</b>: 64
+ */
+    #define JOBS_EXECUTOR_BACKOFF_LIMIT    64U
+#endif
+
+/**
+ * @ingroup jobs_structs
+ * @brief A task, see #JobsTask.
+ */
+typedef struct JobsTask JobsTask_t;
+
+/**
+ * @ingroup jobs_callback_types
+ * @brief Run a task.
+ *
+ * The function sets the status, and optionally the status details, of the
+ * task before it returns.
+ *
+ * @param[in] task  The task.
+ */
+typedef void (* JobsTaskFunction_t)( JobsTask_t * task );
+
+/**
+ * @ingroup jobs_callback_types
+ * @brief Receive the update message of a completed task.
+ *
+ * Called on the worker that ran the task, before the next task of the
+ * same thing starts.  The task storage may be reused once this returns.
+ *
+ * @param[in] task  The completed task.
+ * @param[in] message  The UpdateJobExecution message, not NUL terminated.
+ * @param[in] messageLength  The length of the message, 0 if the message
+ * does not fit in #JOBS_EXECUTOR_MESSAGE_MAX_LENGTH.
+ * @param[in] pContext  The context given to #Jobs_ExecutorInit.
+ */
+typedef void (* JobsTaskCompletion_t)( JobsTask_t * task,
+                                       const char * message,
+                                       size_t messageLength,
+                                       void * pContext );
+
+/**
+ * @ingroup jobs_structs
+ * @brief A unit of work for one thing.
+ */
+struct JobsTask
+{
+    JobsTaskFunction_t function; /**< @brief The function to run. */
+    void * pContext;             /**< @brief Caller data, e.g. an AfrOtaJobDocumentFields_t. */
+    uint32_t thingIndex;         /**< @brief Index of the thing, orders the tasks of one thing. */
+    JobCurrentStatus_t status;   /**< @brief Status reported by the function. */
+    const char * statusDetails;  /**< @brief Status details reported by the function, may be NULL. */
+    size_t statusDetailsLength;  /**< @brief Length of the status details. */
+    JobsTask_t * pNext;          /**< @brief Private, next task of the thing. */
+};
+
+/**
+ * @ingroup jobs_structs
+ * @brief The task list of one thing.
+ *
+ * @note Members are private, the executor manages every thing.
+ */
+typedef struct JobsThingTasks
+{
+    JobsTask_t * pHead;            /**< @brief Oldest task not yet started. */
+    JobsTask_t * pTail;            /**< @brief Newest task. */
+    struct JobsThingTasks * pNext; /**< @brief Next thing in a worker queue. */
+    uint32_t lock;                 /**< @brief Spin lock of the thing. */
+    bool scheduled;                /**< @brief Whether the thing is queued or running. */
+} JobsThingTasks_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief The queue and message buffer of one worker.
+ *
+ * @note Members are private, the executor manages every worker.
+ */
+typedef struct
+{
+    JobsThingTasks_t * pHead;                         /**< @brief First thing in the queue, taken by the owner. */
+    JobsThingTasks_t * pTail;                         /**< @brief Last thing in the queue, stolen first. */
+    uint32_t count;                                   /**< @brief Number of things in the queue. */
+    uint32_t lock;                                    /**< @brief Spin lock of the queue. */
+    char message[ JOBS_EXECUTOR_MESSAGE_MAX_LENGTH ]; /**< @brief Completion message buffer. */
+} JobsWorker_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief A work-stealing executor.
+ *
+ * @note Members are private, initialize with #Jobs_ExecutorInit.
+ */
+typedef struct
+{
+    JobsWorker_t * pWorkers;         /**< @brief Caller provided workers. */
+    JobsThingTasks_t * pThings;      /**< @brief Caller provided things. */
+    JobsTaskCompletion_t completion; /**< @brief Completion callback. */
+    void * pCompletionContext;       /**< @brief Context for the completion callback. */
+    uint32_t workerCount;            /**< @brief Number of workers. */
+    uint32_t thingCount;             /**< @brief Number of things. */
+} JobsExecutor_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Initialize an executor over caller provided storage.
+ *
+ * @param[out] executor  The executor to initialize.
+ * @param[in] workers  Storage for the workers, one per worker task.
+ * @param[in] workerCount  Number of elements in workers.
+ * @param[in] things  Storage for the task lists of the things.
+ * @param[in] thingCount  Number of elements in things.
+ * @param[in] completion  The completion callback.
+ * @param[in] pContext  Context passed to the completion callback.
+ *
+ * @return #JobsSuccess if the executor was initialized;
+ * #JobsBadParameter if invalid parameters are passed.
+ *
+ * @note Initialize the executor before any task uses it.
+ */
+/* @[declare_jobs_executorinit] */
+JobsStatus_t Jobs_ExecutorInit( JobsExecutor_t * executor,
+                                JobsWorker_t * workers,
+                                size_t workerCount,
+                                JobsThingTasks_t * things,
+                                size_t thingCount,
+                                JobsTaskCompletion_t completion,
+                                void * pContext );
+/* @[declare_jobs_executorinit] */
+
+/**
+ * @brief Submit a task.
+ *
+ * May be called from any task, including from a task function.
+ *
+ * @param[in] executor  The executor.
+ * @param[in] task  The task, with function, pContext and thingIndex set.
+ * Its storage must stay valid until its completion callback returns.
+ * @param[in] workerHint  The worker to queue the thing on if it is idle,
+ * e.g. the worker submitting the task.
+ *
+ * @return #JobsSuccess if the task was submitted;
+ * #JobsBadParameter if invalid parameters are passed.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example runs the files of an OTA job document of one
+ * // child thing in order, on whichever worker is free.
+ *
+ * static JobsWorker_t workers[ 4 ];
+ * static JobsThingTasks_t things[ CHILD_COUNT ];
+ * static JobsExecutor_t executor;
+ * static JobsTask_t fileTasks[ MAX_FILES ];
+ *
+ * // processFile() casts task->pContext to AfrOtaJobDocumentFields_t,
+ * // downloads and verifies the file, and sets task->status.
+ * ( void ) Jobs_ExecutorInit( &executor, workers, 4U, things, CHILD_COUNT,
+ *                             publishUpdate, NULL );
+ *
+ * for( i = 0; i < fileCount; i++ )
+ * {
+ *     fileTasks[ i ].function = processFile;
+ *     fileTasks[ i ].pContext = &fields[ i ];
+ *     fileTasks[ i ].thingIndex = child;
+ *     ( void ) Jobs_ExecutorSubmit( &executor, &fileTasks[ i ], 0U );
+ * }
+ *
+ * // In worker task n.
+ * for( ; ; )
+ * {
+ *     if( Jobs_ExecutorRun( &executor, n ) == JobsNoMatch )
+ *     {
+ *         // Nothing to run, wait for work.
+ *     }
+ * }
+ * @endcode
+ */
+/* @[declare_jobs_executorsubmit] */
+JobsStatus_t Jobs_ExecutorSubmit( JobsExecutor_t * executor,
+                                  JobsTask_t * task,
+                                  uint32_t workerHint );
+/* @[declare_jobs_executorsubmit] */
+
+/**
+ * @brief Run one task on a worker.
+ *
+ * The worker takes the next thing from its own queue, or first steals the
+ * newer half of the queue of the next worker with queued things, runs the
+ * oldest task of that thing, and calls the completion callback.
+ *
+ * @param[in] executor  The executor.
+ * @param[in] workerIndex  The index of the calling worker.  Each worker
+ * index must be used by one task only.
+ *
+ * @return #JobsSuccess if a task ran;
+ * #JobsNoMatch if no task was waiting;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_executorrun] */
+JobsStatus_t Jobs_ExecutorRun( JobsExecutor_t * executor,
+                               uint32_t workerIndex );
+/* @[declare_jobs_executorrun] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_EXECUTOR_H_ */
@@ -0,0 +1,322 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_gateway.h
+ * @brief Job state of many child things managed by one gateway.
+ *
+ * A gateway table keeps the thing name, current job and deadline of each
+ * child thing in separate arrays carved from one caller provided arena,
+ * so that bulk scans such as the deadline sweep touch only the arrays
+ * they read.  Things are addressed by the index assigned when they are
+ * added, and found by name through a hash index with two slots per
+ * thing.
+ */
+
+#ifndef JOBS_GATEWAY_H_
+#define JOBS_GATEWAY_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * @ingroup jobs_constants
+ * @brief Arena bytes used per thing, excluding its name.
+ */
+#define JOBS_GATEWAY_THING_SIZE    ( ( 6U * sizeof( uint32_t ) ) + ( 2U * sizeof( uint8_t ) ) )
+
+/**
+ * @ingroup jobs_structs
+ * @brief A table of child things, stored as one array per field.
+ *
+ * @note Members are private, initialize with #Jobs_GatewayInit.
+ */
+typedef struct
+{
+    uint32_t * pNameHash;   /**< @brief Hash of each thing name. */
+    uint32_t * pNameOffset; /**< @brief Offset of each thing name in pNames. */
+    uint32_t * pJobIdHash;  /**< @brief Hash of the current job ID of each thing. */
+    uint32_t * pDeadlineMs; /**< @brief Deadline of the current job of each thing. */
+    uint32_t * pIndex;      /**< @brief Open addressing index of the names, thing index plus one, 0 if free. */
+    uint8_t * pNameLength;  /**< @brief Length of each thing name. */
+    uint8_t * pStatus;      /**< @brief Status of the current job of each thing. */
+    char * pNames;          /**< @brief Validated thing names, not NUL terminated. */
+    size_t namesSize;       /**< @brief Size of pNames. */
+    size_t namesUsed;       /**< @brief Bytes of pNames in use. */
+    uint32_t capacity;      /**< @brief Maximum number of things. */
+    uint32_t count;         /**< @brief Number of things added. */
+} JobsGateway_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Compute the arena size needed for a gateway table.
+ *
+ * @param[in] thingCount  The maximum number of things.
+ * @param[in] namesSize  Bytes to reserve for thing names.
+ *
+ * @return The arena size in bytes, or 0 if it does not fit in a size_t.
+ */
+/* @[declare_jobs_gatewayarenasize] */
+size_t Jobs_GatewayArenaSize( uint32_t thingCount,
+                              size_t namesSize );
+/* @[declare_jobs_gatewayarenasize] */
+
+/**
+ * @brief Initialize a gateway table over a caller provided arena.
+ *
+ * Arena bytes left after the per-thing arrays hold the thing names.
+ *
+ * @param[out] gateway  The table to initialize.
+ * @param[in] arena  The arena, aligned for uint32_t.
+ * @param[in] arenaSize  The size of the arena in bytes.
+ * @param[in] thingCount  The maximum number of things.
+ *
+ * @return #JobsSuccess if the table was initialized;
+ * #JobsBadParameter if invalid parameters are passed;
+ * #JobsBufferTooSmall if the arena cannot hold thingCount things.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example sizes an arena for 50000 things with names of
+ * // up to 16 characters, and adds a thing.
+ *
+ * static uint32_t arena[ 525000 ];
+ * JobsGateway_t gateway;
+ * uint32_t index;
+ *
+ * assert( Jobs_GatewayArenaSize( 50000U, 50000U * 16U ) <= sizeof( arena ) );
+ *
+ * ( void ) Jobs_GatewayInit( &gateway, arena, sizeof( arena ), 50000U );
+ * ( void ) Jobs_GatewayAdd( &gateway, "sensor-0001", 11U, &index );
+ * @endcode
+ */
+/* @[declare_jobs_gatewayinit] */
+JobsStatus_t Jobs_GatewayInit( JobsGateway_t * gateway,
+                               uint32_t * arena,
+                               size_t arenaSize,
+                               uint32_t thingCount );
+/* @[declare_jobs_gatewayinit] */
+
+/**
+ * @brief Add a child thing to a gateway table.
+ *
+ * @param[in] gateway  The table.
+ * @param[in] thingName  The thing name.
+ * @param[in] thingNameLength  The length of the thing name.
+ * @param[out] outIndex  The index of the thing.
+ *
+ * @return #JobsSuccess if the thing was added;
+ * #JobsBadParameter if invalid parameters are passed;
+ * #JobsBufferTooSmall if the table or its name storage is full.
+ *
+ * @note The table does not check for duplicate names.
+ */
+/* @[declare_jobs_gatewayadd] */
+JobsStatus_t Jobs_GatewayAdd( JobsGateway_t * gateway,
+                              const char * thingName,
+                              uint16_t thingNameLength,
+                              uint32_t * outIndex );
+/* @[declare_jobs_gatewayadd] */
+
+/**
+ * @brief Find the index of a child thing by name.
+ *
+ * Probes the hash index from the slot of the name hash, comparing
+ * names only when their hashes match, so a lookup takes constant time
+ * on average however many things the table holds.
+ *
+ * @param[in] gateway  The table.
+ * @param[in] thingName  The thing name.
+ * @param[in] thingNameLength  The length of the thing name.
+ * @param[out] outIndex  The index of the thing.
+ *
+ * @return #JobsSuccess if the thing was found;
+ * #JobsNoMatch if no thing has the name;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_gatewayfind] */
+JobsStatus_t Jobs_GatewayFind( const JobsGateway_t * gateway,
+                               const char * thingName,
+                               uint16_t thingNameLength,
+                               uint32_t * outIndex );
+/* @[declare_jobs_gatewayfind] */
+
+/**
+ * @brief Get the name of a child thing.
+ *
+ * @param[in] gateway  The table.
+ * @param[in] index  The index of the thing.
+ * @param[out] outThingName  The thing name, not NUL terminated.
+ * @param[out] outThingNameLength  The length of the thing name.
+ *
+ * @return #JobsSuccess if the name was output;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_gatewaythingname] */
+JobsStatus_t Jobs_GatewayThingName( const JobsGateway_t * gateway,
+                                    uint32_t index,
+                                    const char ** outThingName,
+                                    uint16_t * outThingNameLength );
+/* @[declare_jobs_gatewaythingname] */
+
+/**
+ * @brief Set the current job of a child thing.
+ *
+ * @param[in] gateway  The table.
+ * @param[in] index  The index of the thing.
+ * @param[in] jobId  The job ID.
+ * @param[in] jobIdLength  The length of the job ID.
+ * @param[in] status  The status of the job.
+ * @param[in] deadlineMs  Time, in milliseconds, when the job is due.
+ *
+ * @return #JobsSuccess if the job was set;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_gatewaysetjob] */
+JobsStatus_t Jobs_GatewaySetJob( JobsGateway_t * gateway,
+                                 uint32_t index,
+                                 const char * jobId,
+                                 uint16_t jobIdLength,
+                                 JobCurrentStatus_t status,
+                                 uint32_t deadlineMs );
+/* @[declare_jobs_gatewaysetjob] */
+
+/**
+ * @brief Update the status and deadline of the current job of a child thing.
+ *
+ * @param[in] gateway  The table.
+ * @param[in] index  The index of the thing.
+ * @param[in] status  The status of the job.
+ * @param[in] deadlineMs  Time, in milliseconds, when the job is due.
+ *
+ * @return #JobsSuccess if the job was updated;
+ * #JobsNoMatch if the thing has no current job;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_gatewayupdatejob] */
+JobsStatus_t Jobs_GatewayUpdateJob( JobsGateway_t * gateway,
+                                    uint32_t index,
+                                    JobCurrentStatus_t status,
+                                    uint32_t deadlineMs );
+/* @[declare_jobs_gatewayupdatejob] */
+
+/**
+ * @brief Clear the current job of a child thing.
+ *
+ * @param[in] gateway  The table.
+ * @param[in] index  The index of the thing.
+ *
+ * @return #JobsSuccess if the job was cleared;
+ * #JobsNoMatch if the thing has no current job;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_gatewayclearjob] */
+JobsStatus_t Jobs_GatewayClearJob( JobsGateway_t * gateway,
+                                   uint32_t index );
+/* @[declare_jobs_gatewayclearjob] */
+
+/**
+ * @brief Get the status and deadline of the current job of a child thing.
+ *
+ * @param[in] gateway  The table.
+ * @param[in] index  The index of the thing.
+ * @param[out] outStatus  The status of the job.
+ * @param[out] outDeadlineMs  The deadline of the job, may be NULL.
+ *
+ * @return #JobsSuccess if the thing has a current job;
+ * #JobsNoMatch if the thing has no current job;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_gatewaygetjob] */
+JobsStatus_t Jobs_GatewayGetJob( const JobsGateway_t * gateway,
+                                 uint32_t index,
+                                 JobCurrentStatus_t * outStatus,
+                                 uint32_t * outDeadlineMs );
+/* @[declare_jobs_gatewaygetjob] */
+
+/**
+ * @brief Checks if the current job of a child thing has a job ID.
+ *
+ * @param[in] gateway  The table.
+ * @param[in] index  The index of the thing.
+ * @param[in] jobId  The job ID.
+ * @param[in] jobIdLength  The length of the job ID.
+ *
+ * @return true if the thing has a current job and its job ID hash matches;
+ * false otherwise
+ */
+/* @[declare_jobs_gatewayisjob] */
+bool Jobs_GatewayIsJob( const JobsGateway_t * gateway,
+                        uint32_t index,
+                        const char * jobId,
+                        uint16_t jobIdLength );
+/* @[declare_jobs_gatewayisjob] */
+
+/**
+ * @brief Collect the things whose current job deadline has passed.
+ *
+ * The scan resumes from *cursor and stops when indices is full or every
+ * thing was visited; *cursor equal to the thing count means the sweep is
+ * complete.  Only the status and deadline arrays are read.
+ *
+ * @param[in] gateway  The table.
+ * @param[in] nowMs  The current time in milliseconds.
+ * @param[in,out] cursor  The index to resume the scan from.
+ * @param[out] indices  The indices of the overdue things.
+ * @param[in] maxIndices  The number of elements in indices.
+ * @param[out] outCount  The number of indices output.
+ *
+ * @return #JobsSuccess if the scan ran;
+ * #JobsBadParameter if invalid parameters are passed.
+ *
+ * @note Deadlines are compared modulo 2^32, so they must be less than
+ * 2^31 milliseconds in the future.
+ */
+/* @[declare_jobs_gatewayexpired] */
+JobsStatus_t Jobs_GatewayExpired( const JobsGateway_t * gateway,
+                                  uint32_t nowMs,
+                                  uint32_t * cursor,
+                                  uint32_t * indices,
+                                  size_t maxIndices,
+                                  size_t * outCount );
+/* @[declare_jobs_gatewayexpired] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_GATEWAY_H_ */
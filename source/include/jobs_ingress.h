@@ -0,0 +1,211 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_ingress.h
+ * @brief Hand-off of incoming Jobs messages from the MQTT callback to
+ * worker tasks.
+ *
+ * The MQTT callback classifies the topic with #Jobs_MatchTopic, which does
+ * not parse JSON, and pushes a descriptor into a bounded lock-free ring.
+ * Worker tasks pop descriptors and parse payloads outside the network
+ * task.  A ring accepts a single producer, or many producers when
+ * initialized for it, and a single consumer.  The ring operates only on
+ * storage provided by the caller.
+ */
+
+#ifndef JOBS_INGRESS_H_
+#define JOBS_INGRESS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+#include "jobs_atomic.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#ifndef JOBS_INGRESS_CACHE_LINE_SIZE
+
+/**
+ * @brief Size, in bytes, of a cache line.
+ *
+ * The producer and consumer indices of a ring are kept this far apart so
+ * that the producer and consumer tasks do not share a cache line.
+ *
+ * <br><b>Default value</b>: 64
+ */
+    #define JOBS_INGRESS_CACHE_LINE_SIZE    64U
+#endif
+
+/**
+ * @ingroup jobs_structs
+ * @brief A classified Jobs message waiting for a worker.
+ */
+typedef struct
+{
+    void * pPayload;                /**< @brief Caller handle to the payload. */
+    size_t payloadLength;           /**< @brief The length of the payload. */
+    JobsTopic_t topic;              /**< @brief The topic value output by #Jobs_MatchTopic. */
+    uint16_t jobIdLength;           /**< @brief The length of the job ID, 0 if the topic has none. */
+    char jobId[ JOBID_MAX_LENGTH ]; /**< @brief Copy of the job ID from the topic. */
+} JobsIngressItem_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief A slot of an ingress ring.
+ *
+ * @note Members are private, the ring manages every slot.
+ */
+typedef struct
+{
+    uint32_t sequence;      /**< @brief Position the slot is ready for. */
+    JobsIngressItem_t item; /**< @brief The descriptor. */
+} JobsIngressSlot_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief A bounded ring of descriptors.
+ *
+ * @note Members are private, initialize with #Jobs_IngressInit.
+ */
+typedef struct
+{
+    uint32_t head;                                                            /**< @brief Next position to push. */
+    uint8_t headPadding[ JOBS_INGRESS_CACHE_LINE_SIZE - sizeof( uint32_t ) ]; /**< @brief Keeps head and tail apart. */
+    uint32_t tail;                                                            /**< @brief Next position to pop. */
+    uint8_t tailPadding[ JOBS_INGRESS_CACHE_LINE_SIZE - sizeof( uint32_t ) ]; /**< @brief Keeps tail and the rest apart. */
+    JobsIngressSlot_t * pSlots;                                               /**< @brief Caller provided slots. */
+    uint32_t mask;                                                            /**< @brief Slot count minus one. */
+    bool multiProducer;                                                       /**< @brief Whether several tasks push. */
+} JobsIngressQueue_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Initialize an ingress ring over caller provided slots.
+ *
+ * @param[out] queue  The ring to initialize.
+ * @param[in] slots  Storage for the descriptors.
+ * @param[in] slotCount  Number of elements in slots, a power of two of
+ * at least 2 and at most 2^31.
+ * @param[in] multiProducer  true if more than one task pushes.
+ *
+ * @return #JobsSuccess if the ring was initialized;
+ * #JobsBadParameter if invalid parameters are passed.
+ *
+ * @note Initialize the ring before any task uses it.
+ */
+/* @[declare_jobs_ingressinit] */
+JobsStatus_t Jobs_IngressInit( JobsIngressQueue_t * queue,
+                               JobsIngressSlot_t * slots,
+                               size_t slotCount,
+                               bool multiProducer );
+/* @[declare_jobs_ingressinit] */
+
+/**
+ * @brief Classify an incoming message and push its descriptor.
+ *
+ * Meant for the MQTT callback: the topic is matched without parsing the
+ * payload, and the job ID is copied so the topic buffer may be released
+ * once this returns.  The payload is passed by handle only.
+ *
+ * @param[in] queue  The ring.
+ * @param[in] topic  The topic string.
+ * @param[in] topicLength  The length of the topic string.
+ * @param[in] thingName  The device's thingName as registered with AWS IoT.
+ * @param[in] thingNameLength  The length of the thingName.
+ * @param[in] pPayload  Caller handle to the payload, may be NULL.
+ * @param[in] payloadLength  The length of the payload.
+ *
+ * @return #JobsSuccess if the descriptor was pushed;
+ * #JobsNoMatch if the topic is not a Jobs topic for the thing;
+ * #JobsBufferTooSmall if the ring is full;
+ * #JobsBadParameter if invalid parameters are passed.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example hands Jobs messages from the MQTT callback to
+ * // a worker task.
+ *
+ * static JobsIngressSlot_t slots[ 16 ];
+ * static JobsIngressQueue_t queue;
+ *
+ * // At start up.
+ * ( void ) Jobs_IngressInit( &queue, slots, 16U, false );
+ *
+ * // In the MQTT callback, after copying the payload to pBuffer.
+ * ( void ) Jobs_IngressPush( &queue, pTopic, topicLength,
+ *                            THING_NAME, THING_NAME_LENGTH,
+ *                            pBuffer, payloadLength );
+ *
+ * // In the worker task.
+ * JobsIngressItem_t item;
+ *
+ * while( Jobs_IngressPop( &queue, &item ) == JobsSuccess )
+ * {
+ *     // Parse item.pPayload according to item.topic, then release it.
+ * }
+ * @endcode
+ */
+/* @[declare_jobs_ingresspush] */
+JobsStatus_t Jobs_IngressPush( JobsIngressQueue_t * queue,
+                               char * topic,
+                               size_t topicLength,
+                               const char * thingName,
+                               uint16_t thingNameLength,
+                               void * pPayload,
+                               size_t payloadLength );
+/* @[declare_jobs_ingresspush] */
+
+/**
+ * @brief Pop the oldest descriptor.
+ *
+ * @param[in] queue  The ring.
+ * @param[out] outItem  The descriptor.
+ *
+ * @return #JobsSuccess if a descriptor was popped;
+ * #JobsNoMatch if the ring is empty;
+ * #JobsBadParameter if invalid parameters are passed.
+ *
+ * @note Only one task may pop from a ring.
+ */
+/* @[declare_jobs_ingresspop] */
+JobsStatus_t Jobs_IngressPop( JobsIngressQueue_t * queue,
+                              JobsIngressItem_t * outItem );
+/* @[declare_jobs_ingresspop] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_INGRESS_H_ */
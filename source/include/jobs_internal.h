@@ -0,0 +1,155 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+/**
+ * @file jobs_internal.h
+ * @brief Helpers shared by the Jobs modules.
+ *
+ * These functions are internal to the library and are not part of its
+ * API; they may change without notice.
+ */
+
+#ifndef JOBS_INTERNAL_H_
+#define JOBS_INTERNAL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * @brief FNV-1a 32-bit offset basis, the hash of no bytes.
+ */
+#define JOBS_FNV1A_OFFSET_BASIS      2166136261U
+
+/**
+ * @brief FNV-1a 64-bit offset basis, the hash of no bytes.
+ */
+#define JOBS_FNV1A64_OFFSET_BASIS    14695981039346656037U
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Convert an unsigned integer to decimal characters, for example
+ * a versionNumber into an expectedVersion.
+ *
+ * @param value The value to convert.
+ * @param buffer The buffer to be written to.
+ * @param bufferSize The size of the buffer, #JOBS_UINT32_STRING_MAX_LENGTH
+ * is always enough.
+ *
+ * @return 0 if the buffer is too small.
+ * @return The number of characters written.
+ *
+ * @note The output is not NUL terminated.
+ */
+size_t Jobs_UintToString( uint32_t value,
+                          char * buffer,
+                          size_t bufferSize );
+
+/**
+ * @brief Convert decimal characters to an unsigned integer, for example
+ * a versionNumber read from a response.
+ *
+ * @param string The decimal characters, without sign or exponent.
+ * @param stringLength The number of characters.
+ * @param outValue The value.
+ *
+ * @return #JobsSuccess if the characters are a 32-bit unsigned integer;
+ * #JobsNoMatch if they are not;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+JobsStatus_t Jobs_StringToUint( const char * string,
+                                size_t stringLength,
+                                uint32_t * outValue );
+
+/**
+ * @brief Convert a job execution status string, such as "IN_PROGRESS",
+ * to its status code.
+ *
+ * @param string The status string, not NUL terminated.
+ * @param stringLength The length of the status string.
+ * @param outStatus The status code.
+ *
+ * @return #JobsSuccess if the string names a #JobCurrentStatus_t;
+ * #JobsNoMatch if it does not, for example "CANCELED";
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+JobsStatus_t Jobs_StatusFromString( const char * string,
+                                    size_t stringLength,
+                                    JobCurrentStatus_t * outStatus );
+
+/**
+ * @brief Continue a 32-bit FNV-1a hash over bytes.
+ *
+ * @param hash The hash so far, #JOBS_FNV1A_OFFSET_BASIS to start.
+ * @param data The bytes.
+ * @param length The number of bytes.
+ *
+ * @return The hash including the bytes.
+ */
+uint32_t Jobs_Fnv1a( uint32_t hash,
+                     const void * data,
+                     size_t length );
+
+/**
+ * @brief Continue a 64-bit FNV-1a hash over bytes.
+ *
+ * @param hash The hash so far, #JOBS_FNV1A64_OFFSET_BASIS to start.
+ * @param data The bytes.
+ * @param length The number of bytes.
+ *
+ * @return The hash including the bytes.
+ */
+uint64_t Jobs_Fnv1a64( uint64_t hash,
+                       const void * data,
+                       size_t length );
+
+/**
+ * @brief Check whether a deadline has been reached on a clock that wraps.
+ *
+ * @param now The current time, or tick.
+ * @param deadline The deadline, less than 2^31 away from now.
+ *
+ * @return true if now is at or after deadline, modulo 2^32;
+ * false otherwise
+ */
+bool Jobs_IsDeadlineReached( uint32_t now,
+                             uint32_t deadline );
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_INTERNAL_H_ */
@@ -0,0 +1,289 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_journal.h
+ * @brief Append-only journal of job execution state in local storage.
+ *
+ * Each change of a job execution (status, version, progress cursor and a
+ * slice of its job document) is appended as one fixed-size, CRC protected
+ * record, so that after a restart the in progress jobs are restored with
+ * one sequential read instead of GetPendingJobExecutions and
+ * DescribeJobExecution round trips.
+ *
+ * The storage is split into two segments.  Compaction writes a snapshot
+ * of the live jobs into the other segment under a new generation number,
+ * and appending continues there.  A segment is only used on restore if
+ * its snapshot is complete, and replay stops at the first torn record,
+ * so a power cut at any point restores the state of the last completed
+ * call.  The journal reaches storage only through #JobsJournalStore_t.
+ */
+
+#ifndef JOBS_JOURNAL_H_
+#define JOBS_JOURNAL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#ifndef JOBS_JOURNAL_DOCUMENT_MAX_LENGTH
+
+/**
+ * @brief User defined maximum length of the job document slice kept with
+ * each job.
+ *
+ * The length is stored in 16 bits, so it must not exceed 65535.
+ *
+ * <br><b>Default value</b>: 256
+ */
+    #define JOBS_JOURNAL_DOCUMENT_MAX_LENGTH    256U
+#endif
+
+#if ( JOBS_JOURNAL_DOCUMENT_MAX_LENGTH > 0xFFFFU )
+    #error "The value of JOBS_JOURNAL_DOCUMENT_MAX_LENGTH exceeds the 16-bit length of a journal record."
+#endif
+
+/**
+ * @ingroup jobs_constants
+ * @brief Size, in bytes, of a journal record in storage.
+ */
+#define JOBS_JOURNAL_RECORD_SIZE    ( 24U + JOBID_MAX_LENGTH + JOBS_JOURNAL_DOCUMENT_MAX_LENGTH )
+
+/**
+ * @ingroup jobs_structs
+ * @brief Access to the storage holding a journal.
+ *
+ * Offsets are relative to the start of the journal storage, which must
+ * be at least twice the segment size.
+ */
+typedef struct
+{
+    /**
+     * @brief Read from storage.
+     *
+     * @return The number of bytes read.
+     */
+    size_t ( * read )( void * pContext,
+                       size_t offset,
+                       uint8_t * buffer,
+                       size_t length );
+
+    /**
+     * @brief Write to storage, returning once the bytes are durable.
+     *
+     * @return The number of bytes written.
+     */
+    size_t ( * write )( void * pContext,
+                        size_t offset,
+                        const uint8_t * buffer,
+                        size_t length );
+
+    void * pContext; /**< @brief Passed to read and write. */
+} JobsJournalStore_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief The journaled state of one job execution.
+ */
+typedef struct
+{
+    char jobId[ JOBID_MAX_LENGTH ];                    /**< @brief Job ID, not NUL terminated. */
+    char document[ JOBS_JOURNAL_DOCUMENT_MAX_LENGTH ]; /**< @brief Job document slice. */
+    uint32_t versionNumber;                            /**< @brief Version of the job execution. */
+    uint32_t progress;                                 /**< @brief Caller defined progress cursor. */
+    JobCurrentStatus_t status;                         /**< @brief Status of the job execution. */
+    uint16_t jobIdLength;                              /**< @brief Length of the job ID. */
+    uint16_t documentLength;                           /**< @brief Length of the document slice. */
+    bool inUse;                                        /**< @brief Private, whether the entry holds a job. */
+} JobsJournalEntry_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief A change to the journaled state of a job execution.
+ */
+typedef struct
+{
+    const char * jobId;        /**< @brief The job ID. */
+    uint16_t jobIdLength;      /**< @brief The length of the job ID. */
+    JobCurrentStatus_t status; /**< @brief The status; a terminal status removes the job. */
+    uint32_t versionNumber;    /**< @brief The version of the job execution. */
+    uint32_t progress;         /**< @brief Caller defined progress cursor, e.g. a byte offset. */
+    const char * document;     /**< @brief The job document slice, NULL to keep the journaled one. */
+    size_t documentLength;     /**< @brief The length of the document slice. */
+} JobsJournalUpdate_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief A journal of job execution state.
+ *
+ * @note Members are private, initialize with #Jobs_JournalInit.
+ */
+typedef struct
+{
+    JobsJournalStore_t store;                   /**< @brief The storage. */
+    JobsJournalEntry_t * pEntries;              /**< @brief Caller provided live job state. */
+    size_t entryCount;                          /**< @brief Number of entries. */
+    size_t segmentSize;                         /**< @brief Size of each segment in bytes. */
+    size_t appendOffset;                        /**< @brief Offset of the next record. */
+    uint32_t generation;                        /**< @brief Generation of the active segment. */
+    uint32_t lastGeneration;                    /**< @brief Newest generation written to storage. */
+    uint8_t record[ JOBS_JOURNAL_RECORD_SIZE ]; /**< @brief Encoding buffer. */
+} JobsJournal_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Initialize a journal.  No storage is accessed.
+ *
+ * @param[out] journal  The journal to initialize.
+ * @param[in] store  Access to the storage.
+ * @param[in] segmentSize  Size of each of the two segments, at least
+ * entryCount + 2 records.
+ * @param[in] entries  Storage for the live job state.
+ * @param[in] entryCount  Number of elements in entries.
+ *
+ * @return #JobsSuccess if the journal was initialized;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_journalinit] */
+JobsStatus_t Jobs_JournalInit( JobsJournal_t * journal,
+                               const JobsJournalStore_t * store,
+                               size_t segmentSize,
+                               JobsJournalEntry_t * entries,
+                               size_t entryCount );
+/* @[declare_jobs_journalinit] */
+
+/**
+ * @brief Restore the live job state from storage.
+ *
+ * Storage without a valid journal is formatted as an empty journal.
+ *
+ * @param[in] journal  The journal.
+ *
+ * @return #JobsSuccess if the state was restored;
+ * #JobsBufferTooSmall if the journal holds more jobs than entries, the
+ * extra jobs are dropped;
+ * #JobsError if the storage failed;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_journalrestore] */
+JobsStatus_t Jobs_JournalRestore( JobsJournal_t * journal );
+/* @[declare_jobs_journalrestore] */
+
+/**
+ * @brief Append a change to the journal and apply it to the live state.
+ *
+ * The active segment is compacted first when it is full.
+ *
+ * @param[in] journal  The journal, restored.
+ * @param[in] update  The change.
+ *
+ * @return #JobsSuccess if the change is durable;
+ * #JobsNoMatch if the change ends a job that is not live, nothing is
+ * written;
+ * #JobsBufferTooSmall if the change is for a new job and every entry is
+ * in use;
+ * #JobsError if the storage failed, the live state is unchanged;
+ * #JobsBadParameter if invalid parameters are passed.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example journals download progress of a job, and
+ * // restores the jobs at start up.
+ *
+ * static JobsJournalEntry_t entries[ 4 ];
+ * static JobsJournal_t journal;
+ * JobsJournalUpdate_t update = { 0 };
+ * const JobsJournalEntry_t * pEntry;
+ * size_t i;
+ *
+ * ( void ) Jobs_JournalInit( &journal, &flashStore, 8192U, entries, 4U );
+ * ( void ) Jobs_JournalRestore( &journal );
+ *
+ * for( i = 0; Jobs_JournalEntry( &journal, i, &pEntry ) != JobsBadParameter; i++ )
+ * {
+ *     // Resume pEntry->jobId from pEntry->progress when JobsSuccess.
+ * }
+ *
+ * update.jobId = jobId;
+ * update.jobIdLength = jobIdLength;
+ * update.status = InProgress;
+ * update.versionNumber = versionNumber;
+ * update.progress = bytesWritten;
+ * ( void ) Jobs_JournalRecord( &journal, &update );
+ * @endcode
+ */
+/* @[declare_jobs_journalrecord] */
+JobsStatus_t Jobs_JournalRecord( JobsJournal_t * journal,
+                                 const JobsJournalUpdate_t * update );
+/* @[declare_jobs_journalrecord] */
+
+/**
+ * @brief Write a snapshot of the live jobs to the other segment and
+ * continue appending there.
+ *
+ * @param[in] journal  The journal, restored.
+ *
+ * @return #JobsSuccess if the journal was compacted;
+ * #JobsError if the storage failed, the previous segment stays in use;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_journalcompact] */
+JobsStatus_t Jobs_JournalCompact( JobsJournal_t * journal );
+/* @[declare_jobs_journalcompact] */
+
+/**
+ * @brief Get a live job entry by index.
+ *
+ * @param[in] journal  The journal.
+ * @param[in] index  The entry index, less than the entry count.
+ * @param[out] outEntry  The entry.
+ *
+ * @return #JobsSuccess if the entry holds a job;
+ * #JobsNoMatch if the entry is free;
+ * #JobsBadParameter if invalid parameters are passed or index is out of
+ * range.
+ */
+/* @[declare_jobs_journalentry] */
+JobsStatus_t Jobs_JournalEntry( const JobsJournal_t * journal,
+                                size_t index,
+                                const JobsJournalEntry_t ** outEntry );
+/* @[declare_jobs_journalentry] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_JOURNAL_H_ */
@@ -0,0 +1,274 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_latency.h
+ * @brief Latency histograms of the phases of job executions.
+ *
+ * A latency record timestamps the lifecycle events of the current job as
+ * the application feeds them: the NextJobExecutionChanged notification,
+ * the accepted StartNextPendingJobExecution response, each
+ * UpdateJobExecution message built and its accepted response.  The time
+ * between events is counted in fixed size histograms, one per phase,
+ * which serialize to a JSON object of strings that can be sent as the
+ * statusDetails of an update or as telemetry.
+ *
+ * Buckets are logarithmic with four linear sub-buckets per power of two,
+ * so a duration is known within 25% from 1 millisecond to 49 days.
+ */
+
+#ifndef JOBS_LATENCY_H_
+#define JOBS_LATENCY_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * @ingroup jobs_constants
+ * @brief Number of buckets in a latency histogram.
+ *
+ * Buckets 0 to 3 count durations of 0 to 3 milliseconds.  Above, bucket
+ * i counts durations from ( 4 + i % 4 ) << ( i / 4 - 1 ) milliseconds up
+ * to the start of bucket i + 1.
+ */
+#define JOBS_LATENCY_HISTOGRAM_BUCKETS    124U
+
+/**
+ * @ingroup jobs_enum_types
+ * @brief Phases of a job execution.
+ */
+typedef enum
+{
+    JobsLatencyQueued,         /**< @brief From notify-next to start-next accepted. */
+    JobsLatencyFirstUpdate,    /**< @brief From start-next accepted to the first update built. */
+    JobsLatencyUpdateInterval, /**< @brief Between two updates built. */
+    JobsLatencyUpdateAck,      /**< @brief From an update built to its accepted response. */
+    JobsLatencyRunning,        /**< @brief From start-next accepted to a terminal update accepted. */
+    JobsLatencyTotal,          /**< @brief From notify-next to a terminal update accepted. */
+    JobsLatencyMaxPhase        /**< @brief The number of phases. */
+} JobsLatencyPhase_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief Durations of one phase.
+ */
+typedef struct
+{
+    uint16_t counts[ JOBS_LATENCY_HISTOGRAM_BUCKETS ]; /**< @brief Per bucket counts, saturating at UINT16_MAX. */
+} JobsLatencyHistogram_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief Latency histograms and the timestamps of the current job.
+ *
+ * @note Members are private, initialize with #Jobs_LatencyInit.
+ */
+typedef struct
+{
+    JobsLatencyHistogram_t phases[ JobsLatencyMaxPhase ]; /**< @brief Indexed by #JobsLatencyPhase_t. */
+    char jobId[ JOBS_JOBID_MAX_LENGTH ];                  /**< @brief The current job ID. */
+    char nextJobId[ JOBS_JOBID_MAX_LENGTH ];              /**< @brief The job ID last notified. */
+    uint32_t notifyMs;                                    /**< @brief When the current job was notified. */
+    uint32_t startMs;                                     /**< @brief When the current job was started. */
+    uint32_t updateMs;                                    /**< @brief When the last update was built. */
+    uint32_t nextNotifyMs;                                /**< @brief When that job was notified. */
+    uint16_t jobIdLength;                                 /**< @brief Length of the current job ID. */
+    uint16_t nextJobIdLength;                             /**< @brief Length of the job ID last notified. */
+    bool hasJob;                                          /**< @brief Whether a job is started. */
+    bool hasNotify;                                       /**< @brief Whether the current job was notified. */
+    bool hasUpdate;                                       /**< @brief Whether an update was built. */
+    bool isPending;                                       /**< @brief Whether the last update awaits its response. */
+    bool isTerminal;                                      /**< @brief Whether the last update has a terminal status. */
+    bool hasNext;                                         /**< @brief Whether another job was notified. */
+} JobsLatency_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Initialize a latency record with empty histograms and no job.
+ *
+ * @param[out] latency  The record to initialize.
+ *
+ * @return #JobsSuccess if the record was initialized;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_latencyinit] */
+JobsStatus_t Jobs_LatencyInit( JobsLatency_t * latency );
+/* @[declare_jobs_latencyinit] */
+
+/**
+ * @brief Timestamp a matched Jobs message.
+ *
+ * | Message                                 | Recorded                          |
+ * | :-------------------------------------- | :-------------------------------- |
+ * | notify-next naming another job          | The notify time of that job       |
+ * | start-next accepted with an execution   | Queued, the job becomes current   |
+ * | update accepted for the current job     | UpdateAck, and Running and Total if the update was terminal |
+ *
+ * Total is recorded only for jobs that were notified before they started.
+ *
+ * @param[in] latency  The record.
+ * @param[in] topic  The topic value output by #Jobs_MatchTopic.
+ * @param[in] jobId  The job ID output by #Jobs_MatchTopic, may be NULL.
+ * @param[in] jobIdLength  The length of the job ID.
+ * @param[in] message  The message payload.
+ * @param[in] messageLength  The length of the message payload.
+ * @param[in] nowMs  The current time in milliseconds.
+ *
+ * @return #JobsSuccess if the message was timestamped;
+ * #JobsNoMatch if the message is not a lifecycle event of a job;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_latencyhandle] */
+JobsStatus_t Jobs_LatencyHandle( JobsLatency_t * latency,
+                                 JobsTopic_t topic,
+                                 const char * jobId,
+                                 uint16_t jobIdLength,
+                                 const char * message,
+                                 size_t messageLength,
+                                 uint32_t nowMs );
+/* @[declare_jobs_latencyhandle] */
+
+/**
+ * @brief Timestamp an UpdateJobExecution message built for a job.
+ *
+ * Call this after #Jobs_UpdateMsg or #Jobs_UpdateMsgWithOptions wrote
+ * the message.  Records FirstUpdate for the first update of the current
+ * job and UpdateInterval for the next ones.
+ *
+ * @param[in] latency  The record.
+ * @param[in] jobId  The job ID of the update.
+ * @param[in] jobIdLength  The length of the job ID.
+ * @param[in] status  The status of the update.
+ * @param[in] nowMs  The current time in milliseconds.
+ *
+ * @return #JobsSuccess if the update was timestamped;
+ * #JobsNoMatch if the job is not the current job;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_latencyupdatebuilt] */
+JobsStatus_t Jobs_LatencyUpdateBuilt( JobsLatency_t * latency,
+                                      const char * jobId,
+                                      size_t jobIdLength,
+                                      JobCurrentStatus_t status,
+                                      uint32_t nowMs );
+/* @[declare_jobs_latencyupdatebuilt] */
+
+/**
+ * @brief Estimate a percentile of the durations of a phase.
+ *
+ * @param[in] latency  The record.
+ * @param[in] phase  The phase.
+ * @param[in] percent  The percentile, from 1 to 100.
+ *
+ * @return The upper bound, in milliseconds, of the bucket holding the
+ * percentile; 0 if the phase has no durations or invalid parameters are
+ * passed.
+ */
+/* @[declare_jobs_latencypercentile] */
+uint32_t Jobs_LatencyPercentile( const JobsLatency_t * latency,
+                                 JobsLatencyPhase_t phase,
+                                 uint32_t percent );
+/* @[declare_jobs_latencypercentile] */
+
+/**
+ * @brief Serialize the histograms to a JSON object.
+ *
+ * Each phase with durations is a member whose value is a string of
+ * comma separated bucket:count pairs, for example
+ * `{"queued":"9:2,13:1","updateAck":"22:3"}`.  Values are strings so
+ * the object is valid statusDetails.  Phases are named queued,
+ * firstUpdate, updateInterval, updateAck, running and total.
+ *
+ * @param[in] latency  The record.
+ * @param[out] buffer  The buffer to write to.
+ * @param[in] bufferSize  The size of the buffer.
+ * @param[out] outLength  The length of the object, or the length needed
+ * if the buffer is too small.
+ *
+ * @return #JobsSuccess if the object was written;
+ * #JobsBufferTooSmall if the object does not fit;
+ * #JobsBadParameter if invalid parameters are passed.
+ *
+ * @note The object is not NUL terminated.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example reports the histograms with the final update
+ * // of a job, then starts new histograms.
+ *
+ * char details[ 512 ];
+ * char message[ 640 ];
+ * size_t detailsLength;
+ * JobsUpdateRequest_t request = { Succeeded, NULL, 0U, NULL, 0U };
+ *
+ * if( Jobs_LatencySerialize( &latency, details, sizeof( details ),
+ *                            &detailsLength ) == JobsSuccess )
+ * {
+ *     request.statusDetails = details;
+ *     request.statusDetailsLength = detailsLength;
+ * }
+ *
+ * if( Jobs_UpdateMsg( request, message, sizeof( message ) ) > 0U )
+ * {
+ *     ( void ) Jobs_LatencyUpdateBuilt( &latency, jobId, jobIdLength,
+ *                                       Succeeded, now );
+ *     Jobs_LatencyClear( &latency );
+ *     // Publish message to the topic from Jobs_Update().
+ * }
+ * @endcode
+ */
+/* @[declare_jobs_latencyserialize] */
+JobsStatus_t Jobs_LatencySerialize( const JobsLatency_t * latency,
+                                    char * buffer,
+                                    size_t bufferSize,
+                                    size_t * outLength );
+/* @[declare_jobs_latencyserialize] */
+
+/**
+ * @brief Empty the histograms, keeping the timestamps of the current job.
+ *
+ * @param[in] latency  The record.
+ */
+/* @[declare_jobs_latencyclear] */
+void Jobs_LatencyClear( JobsLatency_t * latency );
+/* @[declare_jobs_latencyclear] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_LATENCY_H_ */
@@ -0,0 +1,405 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_log.h
+ * @brief Deferred formatting binary logging of the Jobs library.
+ *
+ * A log point writes a message ID, a level, a timestamp and two integer
+ * arguments to a lock-free ring; no string is formatted or stored on the
+ * device.  The application drains the ring with #Jobs_LogRead, encodes
+ * records with #Jobs_LogEncode, and ships them to a host where the
+ * jobs_logdecode tool prints them with the format strings of
+ * #JOBS_LOG_MESSAGES.
+ *
+ * Log points below #JOBS_LOG_LEVEL expand to nothing.  With the default
+ * level every log point compiles out.
+ */
+
+#ifndef JOBS_LOG_H_
+#define JOBS_LOG_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+#include "jobs_atomic.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * @ingroup jobs_constants
+ * @brief No log points.
+ */
+#define JOBS_LOG_LEVEL_NONE     0U
+
+/**
+ * @ingroup jobs_constants
+ * @brief Log points of invalid parameters.
+ */
+#define JOBS_LOG_LEVEL_ERROR    1U
+
+/**
+ * @ingroup jobs_constants
+ * @brief Log points of truncated output and rejected messages.
+ */
+#define JOBS_LOG_LEVEL_WARN     2U
+
+/**
+ * @ingroup jobs_constants
+ * @brief Log points of successful OTA parsing.
+ */
+#define JOBS_LOG_LEVEL_INFO     3U
+
+/**
+ * @ingroup jobs_constants
+ * @brief Log points of expected misses, such as topics of other services.
+ */
+#define JOBS_LOG_LEVEL_DEBUG    4U
+
+/**
+ * @ingroup jobs_constants
+ * @brief Size, in bytes, of an encoded record.
+ */
+#define JOBS_LOG_RECORD_SIZE    16U
+
+#ifndef JOBS_LOG_LEVEL
+
+/**
+ * @brief The most detailed level of the log points compiled in.
+ *
+ * One of #JOBS_LOG_LEVEL_NONE, #JOBS_LOG_LEVEL_ERROR,
+ * #JOBS_LOG_LEVEL_WARN, #JOBS_LOG_LEVEL_INFO or #JOBS_LOG_LEVEL_DEBUG.
+ *
+ * <br><b>Default value</b>: #JOBS_LOG_LEVEL_NONE
+ */
+    #define JOBS_LOG_LEVEL    JOBS_LOG_LEVEL_NONE
+#endif
+
+#ifndef JOBS_LOG_TIMESTAMP
+
+/**
+ * @brief Read the timestamp of a record as a uint32_t.
+ *
+ * For example `xTaskGetTickCount()` on FreeRTOS.
+ *
+ * <br><b>Default value</b>: `0U`
+ */
+    #define JOBS_LOG_TIMESTAMP()    ( 0U )
+#endif
+
+#ifndef JOBS_LOG_CACHE_LINE_SIZE
+
+/**
+ * @brief Size, in bytes, of a cache line.
+ *
+ * The producer and consumer indices of the ring are kept this far apart.
+ *
+ * <br><b>Default value</b>: 64
+ */
+    #define JOBS_LOG_CACHE_LINE_SIZE    64U
+#endif
+
+/**
+ * @brief The log messages, as X( id, format ) entries.
+ *
+ * The format receives the two arguments of a record as unsigned int.
+ * Append new messages at the end so recorded IDs keep their meaning.
+ */
+#define JOBS_LOG_MESSAGES( X )                                                                                            \
+    X( JobsLogGetTopic, "Jobs_GetTopic returned %u for topic %u" )                                                        \
+    X( JobsLogMatchTopic, "Jobs_MatchTopic returned %u for a topic of %u characters" )                                    \
+    X( JobsLogGetPending, "Jobs_GetPending returned %u for a thing name of %u characters" )                               \
+    X( JobsLogStartNext, "Jobs_StartNext returned %u for a thing name of %u characters" )                                 \
+    X( JobsLogDescribe, "Jobs_Describe returned %u for a job ID of %u characters" )                                       \
+    X( JobsLogUpdate, "Jobs_Update returned %u for a job ID of %u characters" )                                           \
+    X( JobsLogStartNextMsg, "Jobs_StartNextMsg: invalid client token of %u characters or buffer of %u" )                  \
+    X( JobsLogUpdateMsgInvalid, "UpdateJobExecution: invalid request, status details of %u characters, step timeout %u" ) \
+    X( JobsLogStartNextMsgInvalid, "StartNextPendingJobExecution: invalid request, client token of %u characters" )       \
+    X( JobsLogDescribeMsgInvalid, "DescribeJobExecution: invalid request, client token of %u characters" )                \
+    X( JobsLogGetPendingMsgInvalid, "GetPendingJobExecutions: invalid request, client token of %u characters" )           \
+    X( JobsLogMessageTooLong, "A message of %u characters does not fit a buffer of %u" )                                  \
+    X( JobsLogStringToUint, "Jobs_StringToUint returned %u for %u characters" )                                           \
+    X( JobsLogStatusFromString, "Jobs_StatusFromString returned %u for %u characters" )                                   \
+    X( JobsLogInvalidJson, "A message of %u characters is not valid JSON, coreJSON status %u" )                           \
+    X( JobsLogNoJobId, "No execution.jobId in a message of %u characters, coreJSON status %u" )                           \
+    X( JobsLogNoJobDocument, "No execution.jobDocument in a message of %u characters, coreJSON status %u" )               \
+    X( JobsLogOtaFileIndex, "OTA file %u: index above 9" )                                                                \
+    X( JobsLogOtaFileSize, "OTA file %u: missing or invalid filesize, coreJSON status %u" )                               \
+    X( JobsLogOtaFileId, "OTA file %u: missing or invalid fileid, coreJSON status %u" )                                   \
+    X( JobsLogOtaFilePath, "OTA file %u: no filepath, coreJSON status %u" )                                               \
+    X( JobsLogOtaCertFile, "OTA file %u: no certfile, coreJSON status %u" )                                               \
+    X( JobsLogOtaSignature, "OTA file %u: no sig-sha256-ecdsa, coreJSON status %u" )                                      \
+    X( JobsLogOtaFileType, "OTA file %u: fileType is not an unsigned integer" )                                           \
+    X( JobsLogOtaNoProtocol, "OTA: no protocol to match" )                                                                \
+    X( JobsLogOtaProtocol, "OTA: protocol of %u characters not listed, coreJSON status %u" )                              \
+    X( JobsLogOtaStreamName, "OTA: no streamname, coreJSON status %u" )                                                   \
+    X( JobsLogOtaAuthScheme, "OTA file %u: no auth_scheme, coreJSON status %u" )                                          \
+    X( JobsLogOtaUpdateDataUrl, "OTA file %u: no update_data_url, coreJSON status %u" )                                   \
+    X( JobsLogOtaNotOtaJob, "OTA: document of %u characters is not an OTA job with file %u" )                             \
+    X( JobsLogOtaParsed, "OTA file %u parsed, next file %u" )                                                             \
+    X( JobsLogIsStartNextAccepted, "Jobs_IsStartNextAccepted: no match for a topic of %u characters" )                    \
+    X( JobsLogIsJobUpdateStatus, "Jobs_IsJobUpdateStatus: no match for a topic of %u characters, status %u" )
+
+/** @cond DO_NOT_DOCUMENT */
+#define JOBS_LOG_ENUM( id, format )    id,
+/** @endcond */
+
+/**
+ * @ingroup jobs_enum_types
+ * @brief IDs of the log messages, see #JOBS_LOG_MESSAGES.
+ */
+typedef enum
+{
+    JOBS_LOG_MESSAGES( JOBS_LOG_ENUM )
+    JobsLogMaxId /**< @brief The number of messages. */
+} JobsLogId_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief A log record.
+ */
+typedef struct
+{
+    uint32_t timestamp; /**< @brief The value of #JOBS_LOG_TIMESTAMP. */
+    uint32_t args[ 2 ]; /**< @brief The arguments of the message. */
+    uint16_t id;        /**< @brief A #JobsLogId_t. */
+    uint8_t level;      /**< @brief The level of the log point. */
+} JobsLogRecord_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief A slot of a log ring.
+ *
+ * @note Members are private, the ring manages every slot.
+ */
+typedef struct
+{
+    uint32_t sequence;      /**< @brief Position the slot is ready for. */
+    JobsLogRecord_t record; /**< @brief The record. */
+} JobsLogSlot_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief A bounded ring of log records.
+ *
+ * @note Members are private, initialize with #Jobs_LogInit.
+ */
+typedef struct
+{
+    uint32_t head;                                                        /**< @brief Next position to write. */
+    uint8_t headPadding[ JOBS_LOG_CACHE_LINE_SIZE - sizeof( uint32_t ) ]; /**< @brief Keeps head and tail apart. */
+    uint32_t tail;                                                        /**< @brief Next position to read. */
+    uint8_t tailPadding[ JOBS_LOG_CACHE_LINE_SIZE - sizeof( uint32_t ) ]; /**< @brief Keeps tail and the rest apart. */
+    JobsLogSlot_t * pSlots;                                               /**< @brief Caller provided slots. */
+    uint32_t mask;                                                        /**< @brief Slot count minus one. */
+    uint32_t dropped;                                                     /**< @brief Records dropped while the ring was full. */
+} JobsLogRing_t;
+
+/** @cond DO_NOT_DOCUMENT */
+
+#if ( JOBS_LOG_LEVEL >= JOBS_LOG_LEVEL_ERROR )
+    #define JOBS_LOG_ERROR( id, arg0, arg1 ) \
+    Jobs_LogWrite( JOBS_LOG_LEVEL_ERROR, ( id ), ( uint32_t ) ( arg0 ), ( uint32_t ) ( arg1 ) )
+    #define JOBS_LOG_STATUS( id, status, arg ) \
+    Jobs_LogStatus( ( id ), ( status ), ( uint32_t ) ( arg ) )
+#else
+    #define JOBS_LOG_ERROR( id, arg0, arg1 )
+    #define JOBS_LOG_STATUS( id, status, arg )
+#endif
+
+#if ( JOBS_LOG_LEVEL >= JOBS_LOG_LEVEL_WARN )
+    #define JOBS_LOG_WARN( id, arg0, arg1 ) \
+    Jobs_LogWrite( JOBS_LOG_LEVEL_WARN, ( id ), ( uint32_t ) ( arg0 ), ( uint32_t ) ( arg1 ) )
+#else
+    #define JOBS_LOG_WARN( id, arg0, arg1 )
+#endif
+
+#if ( JOBS_LOG_LEVEL >= JOBS_LOG_LEVEL_INFO )
+    #define JOBS_LOG_INFO( id, arg0, arg1 ) \
+    Jobs_LogWrite( JOBS_LOG_LEVEL_INFO, ( id ), ( uint32_t ) ( arg0 ), ( uint32_t ) ( arg1 ) )
+#else
+    #define JOBS_LOG_INFO( id, arg0, arg1 )
+#endif
+
+#if ( JOBS_LOG_LEVEL >= JOBS_LOG_LEVEL_DEBUG )
+    #define JOBS_LOG_DEBUG( id, arg0, arg1 ) \
+    Jobs_LogWrite( JOBS_LOG_LEVEL_DEBUG, ( id ), ( uint32_t ) ( arg0 ), ( uint32_t ) ( arg1 ) )
+#else
+    #define JOBS_LOG_DEBUG( id, arg0, arg1 )
+#endif
+
+/** @endcond */
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Initialize a log ring over caller provided slots and register it
+ * as the destination of the log points.
+ *
+ * @param[out] ring  The ring to initialize, or NULL to stop logging.
+ * @param[in] slots  Storage for the records.
+ * @param[in] slotCount  Number of elements in slots, a power of two of
+ * at least 2 and at most 2^31.
+ *
+ * @return #JobsSuccess if the ring was registered;
+ * #JobsBadParameter if invalid parameters are passed.
+ *
+ * @note Register the ring before other tasks use the library.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example logs to a ring of 64 records and ships them
+ * // from a low priority task.
+ *
+ * static JobsLogSlot_t slots[ 64 ];
+ * static JobsLogRing_t ring;
+ * JobsLogRecord_t record;
+ * uint8_t encoded[ JOBS_LOG_RECORD_SIZE ];
+ *
+ * // At start up.
+ * ( void ) Jobs_LogInit( &ring, slots, 64U );
+ *
+ * // In the low priority task.
+ * while( Jobs_LogRead( &record ) == JobsSuccess )
+ * {
+ *     ( void ) Jobs_LogEncode( &record, encoded, sizeof( encoded ) );
+ *     // Write encoded to a file or a serial port for jobs_logdecode.
+ * }
+ * @endcode
+ */
+/* @[declare_jobs_loginit] */
+JobsStatus_t Jobs_LogInit( JobsLogRing_t * ring,
+                           JobsLogSlot_t * slots,
+                           size_t slotCount );
+/* @[declare_jobs_loginit] */
+
+/**
+ * @brief Write a record to the registered ring.
+ *
+ * Called by the log points; any task may write.  The record is dropped
+ * and counted if the ring is full.
+ *
+ * @param[in] level  The level of the log point.
+ * @param[in] id  The message.
+ * @param[in] arg0  The first argument of the message.
+ * @param[in] arg1  The second argument of the message.
+ */
+/* @[declare_jobs_logwrite] */
+void Jobs_LogWrite( uint32_t level,
+                    JobsLogId_t id,
+                    uint32_t arg0,
+                    uint32_t arg1 );
+/* @[declare_jobs_logwrite] */
+
+/**
+ * @brief Write a record for a failed call.
+ *
+ * Called by the log points.  #JobsBadParameter and #JobsError are logged
+ * as errors, #JobsBufferTooSmall as a warning and #JobsNoMatch for
+ * debugging, each only if #JOBS_LOG_LEVEL includes its level.
+ *
+ * @param[in] id  The message, whose arguments are status and arg.
+ * @param[in] status  The result of the call.
+ * @param[in] arg  The second argument of the message.
+ */
+/* @[declare_jobs_logstatus] */
+void Jobs_LogStatus( JobsLogId_t id,
+                     JobsStatus_t status,
+                     uint32_t arg );
+/* @[declare_jobs_logstatus] */
+
+/**
+ * @brief Read the oldest record of the registered ring.
+ *
+ * @param[out] outRecord  The record.
+ *
+ * @return #JobsSuccess if a record was read;
+ * #JobsNoMatch if the ring is empty or none is registered;
+ * #JobsBadParameter if invalid parameters are passed.
+ *
+ * @note Only one task may read.
+ */
+/* @[declare_jobs_logread] */
+JobsStatus_t Jobs_LogRead( JobsLogRecord_t * outRecord );
+/* @[declare_jobs_logread] */
+
+/**
+ * @brief Get the number of records dropped because the ring was full.
+ *
+ * @return The count, modulo 2^32.
+ */
+/* @[declare_jobs_logdropped] */
+uint32_t Jobs_LogDropped( void );
+/* @[declare_jobs_logdropped] */
+
+/**
+ * @brief Encode a record in #JOBS_LOG_RECORD_SIZE little endian bytes.
+ *
+ * The bytes are the ID on 2 bytes, the level, a zero byte, then the
+ * timestamp and both arguments on 4 bytes each.
+ *
+ * @param[in] record  The record.
+ * @param[out] buffer  The buffer to write to.
+ * @param[in] bufferSize  The size of the buffer.
+ *
+ * @return #JOBS_LOG_RECORD_SIZE if the record was encoded;
+ * 0 if invalid parameters are passed or the buffer is too small.
+ */
+/* @[declare_jobs_logencode] */
+size_t Jobs_LogEncode( const JobsLogRecord_t * record,
+                       uint8_t * buffer,
+                       size_t bufferSize );
+/* @[declare_jobs_logencode] */
+
+/**
+ * @brief Decode a record encoded by #Jobs_LogEncode.
+ *
+ * @param[in] buffer  The encoded record.
+ * @param[in] bufferSize  The size of the buffer.
+ * @param[out] outRecord  The record.
+ *
+ * @return #JobsSuccess if the record was decoded;
+ * #JobsNoMatch if the bytes are not a record;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_logdecode] */
+JobsStatus_t Jobs_LogDecode( const uint8_t * buffer,
+                             size_t bufferSize,
+                             JobsLogRecord_t * outRecord );
+/* @[declare_jobs_logdecode] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_LOG_H_ */
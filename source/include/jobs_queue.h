@@ -0,0 +1,231 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_queue.h
+ * @brief Offline queue of UpdateJobExecution requests.
+ *
+ * While the MQTT connection is down, updates are queued and compacted so
+ * that each job keeps at most one pending non-terminal update.  On
+ * reconnect the queue hands back ready to publish topic and payload pairs
+ * in batches.  The queue operates only on storage provided by the caller.
+ */
+
+#ifndef JOBS_QUEUE_H_
+#define JOBS_QUEUE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#ifndef JOBS_QUEUE_STATUS_DETAILS_MAX_LENGTH
+
+/**
+ * @brief User defined maximum length of the statusDetails of a queued
+ * update.
+ *
+ * <br><b>Default value</b>: 128
+ */
+    #define JOBS_QUEUE_STATUS_DETAILS_MAX_LENGTH    128U
+#endif
+
+/**
+ * @ingroup jobs_structs
+ * @brief An UpdateJobExecution request waiting to be published.
+ *
+ * @note Members are private, the queue manages every entry.
+ */
+typedef struct
+{
+    char jobId[ JOBID_MAX_LENGTH ];                             /**< @brief Job ID, not NUL terminated. */
+    char statusDetails[ JOBS_QUEUE_STATUS_DETAILS_MAX_LENGTH ]; /**< @brief Copy of the status details. */
+    size_t statusDetailsLength;                                 /**< @brief Status details length, 0 if omitted. */
+    JobCurrentStatus_t status;                                  /**< @brief Status to update the job to. */
+    uint16_t jobIdLength;                                       /**< @brief Job ID length. */
+} JobsQueuedUpdate_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief A fixed capacity queue of updates, in publish order.
+ *
+ * @note Members are private, initialize with #Jobs_QueueInit.
+ */
+typedef struct
+{
+    JobsQueuedUpdate_t * pEntries; /**< @brief Caller provided entries, used as a ring. */
+    size_t capacity;               /**< @brief Number of entries. */
+    size_t head;                   /**< @brief Index of the oldest update. */
+    size_t count;                  /**< @brief Number of queued updates. */
+} JobsUpdateQueue_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief A topic and payload pair ready to publish.
+ *
+ * @note The topic and payload point into the buffer passed to
+ * #Jobs_QueueGetBatch.
+ */
+typedef struct
+{
+    const char * pTopic;   /**< @brief Topic to publish to, NUL terminated. */
+    size_t topicLength;    /**< @brief Length of the topic. */
+    const char * pPayload; /**< @brief Payload to publish, not NUL terminated. */
+    size_t payloadLength;  /**< @brief Length of the payload. */
+} JobsOutboundMessage_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Initialize an update queue over caller provided entries.
+ *
+ * @param[out] queue  The queue to initialize.
+ * @param[in] entries  Storage for the queued updates.
+ * @param[in] entryCount  Number of elements in entries.
+ *
+ * @return #JobsSuccess if the queue was initialized;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_queueinit] */
+JobsStatus_t Jobs_QueueInit( JobsUpdateQueue_t * queue,
+                             JobsQueuedUpdate_t * entries,
+                             size_t entryCount );
+/* @[declare_jobs_queueinit] */
+
+/**
+ * @brief Queue an update for a job.
+ *
+ * If the job already has a queued non-terminal update, that update takes
+ * the new status and statusDetails and keeps its place in the queue.
+ * Otherwise, including when the queued update is terminal, the update is
+ * appended, so a terminal update is never dropped.
+ *
+ * The status details are validated and copied, so the caller may reuse
+ * its buffers.  The expectedVersion of the request is not queued.
+ *
+ * @param[in] queue  The update queue.
+ * @param[in] jobId  The job ID.
+ * @param[in] jobIdLength  The length of the job ID.
+ * @param[in] request  The update request.
+ *
+ * @return #JobsSuccess if the update was queued or merged;
+ * #JobsBadParameter if invalid parameters are passed, or the status
+ * details are not valid JSON;
+ * #JobsBufferTooSmall if the queue is full, or the status details are
+ * longer than #JOBS_QUEUE_STATUS_DETAILS_MAX_LENGTH.
+ *
+ * @note Finding the update to merge scans the queued updates, O(n) in
+ * the queue length.
+ */
+/* @[declare_jobs_queueupdate] */
+JobsStatus_t Jobs_QueueUpdate( JobsUpdateQueue_t * queue,
+                               const char * jobId,
+                               uint16_t jobIdLength,
+                               JobsUpdateRequest_t request );
+/* @[declare_jobs_queueupdate] */
+
+/**
+ * @brief Build the oldest queued updates as topic and payload pairs.
+ *
+ * The queue is not modified; call #Jobs_QueueConsume once the messages
+ * have been published.  The batch ends when messages or buffer is full,
+ * or the queue is exhausted.
+ *
+ * @param[in] queue  The update queue.
+ * @param[in] thingName  The device's thingName as registered with AWS IoT.
+ * @param[in] thingNameLength  The length of the thingName.
+ * @param[out] messages  The array to receive the messages.
+ * @param[in] messageCount  Number of elements in messages.
+ * @param[out] buffer  Storage for the topics and payloads.
+ * @param[in] bufferSize  The size of the buffer.
+ * @param[out] outCount  The number of messages built.
+ *
+ * @return #JobsSuccess if at least one message was built, or the queue
+ * is empty;
+ * #JobsBadParameter if invalid parameters are passed;
+ * #JobsBufferTooSmall if the buffer cannot hold the oldest update.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example replays queued updates after reconnecting.
+ *
+ * JobsOutboundMessage_t messages[ 4 ];
+ * char buffer[ 1024 ];
+ * size_t count = 0U;
+ * size_t i;
+ *
+ * while( ( Jobs_QueueGetBatch( &queue, THING_NAME, THING_NAME_LENGTH,
+ *                              messages, 4U, buffer, sizeof( buffer ),
+ *                              &count ) == JobsSuccess ) && ( count > 0U ) )
+ * {
+ *     for( i = 0U; i < count; i++ )
+ *     {
+ *         // Publish messages[ i ].pPayload to messages[ i ].pTopic.
+ *     }
+ *
+ *     ( void ) Jobs_QueueConsume( &queue, count );
+ * }
+ * @endcode
+ */
+/* @[declare_jobs_queuegetbatch] */
+JobsStatus_t Jobs_QueueGetBatch( const JobsUpdateQueue_t * queue,
+                                 const char * thingName,
+                                 uint16_t thingNameLength,
+                                 JobsOutboundMessage_t * messages,
+                                 size_t messageCount,
+                                 char * buffer,
+                                 size_t bufferSize,
+                                 size_t * outCount );
+/* @[declare_jobs_queuegetbatch] */
+
+/**
+ * @brief Remove the oldest updates from the queue after publishing.
+ *
+ * @param[in] queue  The update queue.
+ * @param[in] count  The number of updates published.
+ *
+ * @return #JobsSuccess if the updates were removed;
+ * #JobsBadParameter if invalid parameters are passed, or count exceeds
+ * the number of queued updates.
+ */
+/* @[declare_jobs_queueconsume] */
+JobsStatus_t Jobs_QueueConsume( JobsUpdateQueue_t * queue,
+                                size_t count );
+/* @[declare_jobs_queueconsume] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_QUEUE_H_ */
@@ -0,0 +1,188 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_rejected.h
+ * @brief Decoding of rejected responses from the Jobs service.
+ *
+ * The payload of a rejected response carries an error code, a message,
+ * the client token of the request and, for some errors, the current
+ * state of the job execution.  A decoder reads them in one pass and
+ * classifies the error code with a perfect hash, so retry logic can
+ * choose to back off, resynchronize or give up without comparing
+ * strings.
+ */
+
+#ifndef JOBS_REJECTED_H_
+#define JOBS_REJECTED_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * @ingroup jobs_enum_types
+ * @brief Error codes of rejected responses.
+ */
+typedef enum
+{
+    JobsRejectedUnknown,                /**< @brief A code not known to the library, or none. */
+    JobsRejectedInvalidTopic,           /**< @brief The request was sent to an invalid topic. */
+    JobsRejectedInvalidJson,            /**< @brief The request payload is not valid JSON. */
+    JobsRejectedInvalidRequest,         /**< @brief The request is invalid. */
+    JobsRejectedInvalidStateTransition, /**< @brief The update is not valid for the execution state. */
+    JobsRejectedResourceNotFound,       /**< @brief The job or job execution does not exist. */
+    JobsRejectedVersionMismatch,        /**< @brief The expected version does not match. */
+    JobsRejectedInternalError,          /**< @brief The service failed to process the request. */
+    JobsRejectedRequestThrottled,       /**< @brief The request was throttled. */
+    JobsRejectedTerminalStateReached    /**< @brief The job execution is in a terminal state. */
+} JobsRejectedCode_t;
+
+/**
+ * @ingroup jobs_enum_types
+ * @brief How to handle a rejected request.
+ */
+typedef enum
+{
+    JobsRejectedBackoff, /**< @brief Retry the request after a delay. */
+    JobsRejectedResync,  /**< @brief Describe the job execution, then decide again. */
+    JobsRejectedGiveUp   /**< @brief Do not retry the request. */
+} JobsRejectedAction_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief The fields of a rejected response.
+ *
+ * Strings point into the message and are not NUL terminated.  Absent
+ * strings are NULL with length 0.
+ */
+typedef struct
+{
+    JobsRejectedCode_t code;    /**< @brief The error code. */
+    const char * codeString;    /**< @brief The error code as sent. */
+    size_t codeStringLength;    /**< @brief The length of the error code. */
+    const char * message;       /**< @brief The error message. */
+    size_t messageLength;       /**< @brief The length of the error message. */
+    const char * clientToken;   /**< @brief The client token of the request. */
+    size_t clientTokenLength;   /**< @brief The length of the client token. */
+    const char * statusDetails; /**< @brief The statusDetails object of the execution state. */
+    size_t statusDetailsLength; /**< @brief The length of the statusDetails object. */
+    uint32_t versionNumber;     /**< @brief The version of the execution state. */
+    JobCurrentStatus_t status;  /**< @brief The status of the execution state. */
+    bool hasExecutionState;     /**< @brief Whether the response has an execution state with a status. */
+} JobsRejected_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Decode the payload of a rejected response.
+ *
+ * @param[in] topic  The topic value output by #Jobs_MatchTopic.
+ * @param[in] message  The response payload.
+ * @param[in] messageLength  The length of the response payload.
+ * @param[out] outRejected  The fields of the response.
+ *
+ * @return #JobsSuccess if the response was decoded;
+ * #JobsNoMatch if the topic is not a rejected response;
+ * #JobsBadParameter if invalid parameters are passed, or the message is
+ * not a valid JSON object.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example decides how to handle a rejected
+ * // UpdateJobExecution request.
+ *
+ * JobsRejected_t rejected;
+ *
+ * if( Jobs_RejectedDecode( topic, payload, payloadLength, &rejected ) == JobsSuccess )
+ * {
+ *     switch( Jobs_RejectedAction( rejected.code ) )
+ *     {
+ *         case JobsRejectedBackoff:
+ *             // Publish the update again after a delay.
+ *             break;
+ *
+ *         case JobsRejectedResync:
+ *             // rejected.versionNumber holds the current version when
+ *             // rejected.hasExecutionState, otherwise describe the job.
+ *             break;
+ *
+ *         default:
+ *             // Report rejected.message and drop the update.
+ *             break;
+ *     }
+ * }
+ * @endcode
+ */
+/* @[declare_jobs_rejecteddecode] */
+JobsStatus_t Jobs_RejectedDecode( JobsTopic_t topic,
+                                  const char * message,
+                                  size_t messageLength,
+                                  JobsRejected_t * outRejected );
+/* @[declare_jobs_rejecteddecode] */
+
+/**
+ * @brief Classify an error code string.
+ *
+ * @param[in] code  The error code.
+ * @param[in] codeLength  The length of the error code.
+ *
+ * @return The error code, #JobsRejectedUnknown if it is not known.
+ */
+/* @[declare_jobs_rejectedcode] */
+JobsRejectedCode_t Jobs_RejectedCode( const char * code,
+                                      size_t codeLength );
+/* @[declare_jobs_rejectedcode] */
+
+/**
+ * @brief Get how to handle a request rejected with an error code.
+ *
+ * Throttling and internal errors are transient.  A version mismatch or
+ * invalid state transition means the device has a stale view of the job
+ * execution.  Every other error recurs if the request is sent again.
+ *
+ * @param[in] code  The error code.
+ *
+ * @return The action.
+ */
+/* @[declare_jobs_rejectedaction] */
+JobsRejectedAction_t Jobs_RejectedAction( JobsRejectedCode_t code );
+/* @[declare_jobs_rejectedaction] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_REJECTED_H_ */
@@ -0,0 +1,251 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_scheduler.h
+ * @brief Pacing of Jobs requests sent after a connection.
+ *
+ * When many devices reconnect at once, requests such as
+ * StartNextPendingJobExecution and GetPendingJobExecutions arrive at the
+ * service together and are throttled.  A scheduler decides when a device
+ * sends them: the first request after a connection is delayed by a
+ * per-thing offset derived from a hash of the thing name, throttled
+ * requests are retried after an exponential backoff, and a token bucket
+ * bounds the request rate of the device.
+ */
+
+#ifndef JOBS_SCHEDULER_H_
+#define JOBS_SCHEDULER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+#include "jobs_rejected.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * @ingroup jobs_constants
+ * @brief Wait reported by #Jobs_SchedulerPoll when no request is due.
+ */
+#define JOBS_SCHEDULER_IDLE    UINT32_MAX
+
+/**
+ * @ingroup jobs_structs
+ * @brief Pacing parameters of a scheduler.
+ */
+typedef struct
+{
+    uint32_t jitterWindowMs;   /**< @brief Window, in milliseconds, the first request after a connection is spread over. */
+    uint32_t backoffBaseMs;    /**< @brief Delay, in milliseconds, after the first throttled request. */
+    uint32_t backoffMaxMs;     /**< @brief Largest delay, in milliseconds, after a throttled request. */
+    uint32_t refillIntervalMs; /**< @brief Time, in milliseconds, to add one token to the bucket. */
+    uint16_t bucketSize;       /**< @brief Number of tokens of the bucket, the largest burst of requests. */
+} JobsSchedulerConfig_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief The request scheduler of one thing.
+ *
+ * @note Members are private, initialize with #Jobs_SchedulerInit.
+ */
+typedef struct
+{
+    JobsSchedulerConfig_t config; /**< @brief The pacing parameters. */
+    uint32_t thingHash;           /**< @brief Hash of the thing name, seed of the jitter. */
+    uint32_t notBeforeMs;         /**< @brief Time, in milliseconds, before which no request is sent. */
+    uint32_t refillMs;            /**< @brief Time, in milliseconds, the bucket was last refilled. */
+    uint16_t tokens;              /**< @brief Number of tokens in the bucket. */
+    uint8_t attempts;             /**< @brief Number of consecutive throttled requests. */
+    uint8_t wanted;               /**< @brief Bit set of the APIs to send. */
+    uint8_t inFlight;             /**< @brief Bit set of the APIs awaiting a response. */
+    bool connected;               /**< @brief Whether #Jobs_SchedulerConnect was called. */
+} JobsScheduler_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Initialize the scheduler of a thing.
+ *
+ * @param[out] scheduler  The scheduler to initialize.
+ * @param[in] config  The pacing parameters.  refillIntervalMs and
+ * bucketSize must not be 0, backoffBaseMs must not be more than
+ * backoffMaxMs, and jitterWindowMs and backoffMaxMs must be less than
+ * 2^31 milliseconds.
+ * @param[in] thingName  The name of the thing.
+ * @param[in] thingNameLength  The length of the thing name.
+ *
+ * @return #JobsSuccess if the scheduler was initialized;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_schedulerinit] */
+JobsStatus_t Jobs_SchedulerInit( JobsScheduler_t * scheduler,
+                                 const JobsSchedulerConfig_t * config,
+                                 const char * thingName,
+                                 uint16_t thingNameLength );
+/* @[declare_jobs_schedulerinit] */
+
+/**
+ * @brief Start pacing requests for a new connection.
+ *
+ * The next request is delayed by the offset of the thing within the
+ * jitter window, which is the same on every connection.  The bucket is
+ * filled and requests awaiting a response are sent again.
+ *
+ * @param[in] scheduler  The scheduler.
+ * @param[in] nowMs  The current time in milliseconds.
+ *
+ * @return #JobsSuccess if the scheduler was reset;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_schedulerconnect] */
+JobsStatus_t Jobs_SchedulerConnect( JobsScheduler_t * scheduler,
+                                    uint32_t nowMs );
+/* @[declare_jobs_schedulerconnect] */
+
+/**
+ * @brief Ask for a request to be sent.
+ *
+ * Asking again for a request that is not yet sent has no effect.
+ *
+ * @param[in] scheduler  The scheduler.
+ * @param[in] api  The Jobs API of the request.
+ *
+ * @return #JobsSuccess if the request was added;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_schedulerrequest] */
+JobsStatus_t Jobs_SchedulerRequest( JobsScheduler_t * scheduler,
+                                    JobsApi_t api );
+/* @[declare_jobs_schedulerrequest] */
+
+/**
+ * @brief Get the request to send now.
+ *
+ * Requests are sent in #JobsApi_t order, at most one request per API is
+ * awaiting a response, and each request takes a token from the bucket.
+ *
+ * @param[in] scheduler  The scheduler.
+ * @param[in] nowMs  The current time in milliseconds.
+ * @param[out] outApi  The Jobs API of the request to send.
+ * @param[out] outWaitMs  When no request is due, the time in milliseconds
+ * until one may be, or #JOBS_SCHEDULER_IDLE if no request is waiting to
+ * be sent.  May be NULL.
+ *
+ * @return #JobsSuccess if a request is due;
+ * #JobsNoMatch if no request is due;
+ * #JobsBadParameter if invalid parameters are passed.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example paces the GetPendingJobExecutions and
+ * // StartNextPendingJobExecution requests sent after a connection.
+ *
+ * static const JobsSchedulerConfig_t config = { 30000U, 1000U, 60000U, 1000U, 2U };
+ * JobsScheduler_t scheduler;
+ * JobsApi_t api;
+ * uint32_t waitMs;
+ *
+ * ( void ) Jobs_SchedulerInit( &scheduler, &config, THING_NAME, THING_NAME_LENGTH );
+ *
+ * // On connection.
+ * ( void ) Jobs_SchedulerConnect( &scheduler, now );
+ * ( void ) Jobs_SchedulerRequest( &scheduler, JobsApiGetPending );
+ * ( void ) Jobs_SchedulerRequest( &scheduler, JobsApiStartNext );
+ *
+ * // In the main loop.
+ * while( Jobs_SchedulerPoll( &scheduler, now, &api, &waitMs ) == JobsSuccess )
+ * {
+ *     // Publish the request for api.
+ * }
+ *
+ * // Sleep for at most waitMs.
+ *
+ * // When a rejected response is decoded with Jobs_RejectedDecode().
+ * ( void ) Jobs_SchedulerRejected( &scheduler, api, rejected.code, now );
+ * @endcode
+ */
+/* @[declare_jobs_schedulerpoll] */
+JobsStatus_t Jobs_SchedulerPoll( JobsScheduler_t * scheduler,
+                                 uint32_t nowMs,
+                                 JobsApi_t * outApi,
+                                 uint32_t * outWaitMs );
+/* @[declare_jobs_schedulerpoll] */
+
+/**
+ * @brief Record the accepted response of a request.
+ *
+ * The backoff is reset.
+ *
+ * @param[in] scheduler  The scheduler.
+ * @param[in] api  The Jobs API of the request.
+ *
+ * @return #JobsSuccess if the response was recorded;
+ * #JobsNoMatch if no request of the API is awaiting a response;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_scheduleraccepted] */
+JobsStatus_t Jobs_SchedulerAccepted( JobsScheduler_t * scheduler,
+                                     JobsApi_t api );
+/* @[declare_jobs_scheduleraccepted] */
+
+/**
+ * @brief Record the rejected response of a request.
+ *
+ * A request rejected with a code whose #Jobs_RejectedAction is
+ * #JobsRejectedBackoff is sent again.  The delay doubles with each
+ * consecutive throttled request, up to backoffMaxMs, and is jittered
+ * between half and all of its value by the hash of the thing name.
+ * Other rejections are left to the caller.
+ *
+ * @param[in] scheduler  The scheduler.
+ * @param[in] api  The Jobs API of the request.
+ * @param[in] code  The error code of the response.
+ * @param[in] nowMs  The current time in milliseconds.
+ *
+ * @return #JobsSuccess if the response was recorded;
+ * #JobsNoMatch if no request of the API is awaiting a response;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_schedulerrejected] */
+JobsStatus_t Jobs_SchedulerRejected( JobsScheduler_t * scheduler,
+                                     JobsApi_t api,
+                                     JobsRejectedCode_t code,
+                                     uint32_t nowMs );
+/* @[declare_jobs_schedulerrejected] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_SCHEDULER_H_ */
@@ -0,0 +1,328 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_stats.h
+ * @brief Runtime counters of the Jobs library hot paths.
+ *
+ * When #JOBS_STATS_ENABLED is 1, jobs.c and the OTA job document parser
+ * count matched topics, failed calls, update messages built, truncated
+ * writes, OTA parse results and JSON bytes scanned.  Counters live in
+ * caller provided shards, ideally one per task, each aligned to its own
+ * cache lines, so a count is an atomic addition to memory no other task
+ * writes.  #Jobs_StatsRead sums the shards.
+ *
+ * When #JOBS_STATS_ENABLED is 0, the default, the hooks expand to nothing.
+ */
+
+#ifndef JOBS_STATS_H_
+#define JOBS_STATS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+
+/* External Dependencies */
+#include "core_json.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#ifndef JOBS_STATS_ENABLED
+
+/**
+ * @brief Set to 1 to build the library with statistics counters.
+ *
+ * <br><b>Default value</b>: `0`
+ */
+    #define JOBS_STATS_ENABLED    0
+#endif
+
+#ifndef JOBS_STATS_SHARD_INDEX
+
+/**
+ * @brief Index of the shard of the calling task.
+ *
+ * The index is taken modulo the shard count.  Tasks mapping to the same
+ * shard lose no counts, but contend for its cache lines.  On FreeRTOS,
+ * `uxTaskGetTaskNumber( NULL )` after numbering the tasks that use the
+ * library is a good choice.
+ *
+ * <br><b>Default value</b>: on Linux with GCC or Clang,
+ * `Jobs_StatsShardIndex()`, which numbers threads in the order they first
+ * count; register as many shards as threads to avoid contention.
+ * Elsewhere `0U`, and #Jobs_StatsInit accepts a single shard only, which
+ * every task shares.
+ */
+    #if defined( __linux__ ) && defined( __GNUC__ )
+        #define JOBS_STATS_SHARD_INDEX()    Jobs_StatsShardIndex()
+        #define JOBS_STATS_THREAD_SHARDS    1
+    #else
+        #define JOBS_STATS_SHARD_INDEX()    ( 0U )
+        #define JOBS_STATS_SINGLE_SHARD     1
+    #endif
+#endif
+
+#ifndef JOBS_STATS_CACHE_LINE_SIZE
+
+/**
+ * @brief Size, in bytes, of a cache line.
+ *
+ * Shards are padded to a multiple of this size.
+ *
+ * <br><b>Default value</b>: 64
+ */
+    #define JOBS_STATS_CACHE_LINE_SIZE    64U
+#endif
+
+#ifndef JOBS_STATS_ALIGN
+
+/**
+ * @brief Attribute aligning a shard to a cache line.
+ *
+ * #Jobs_StatsInit rejects shards that are not aligned to
+ * #JOBS_STATS_CACHE_LINE_SIZE, so define this for compilers other than
+ * GCC and Clang, or align the shard array where it is defined.
+ *
+ * <br><b>Default value</b>: `__attribute__( ( aligned( JOBS_STATS_CACHE_LINE_SIZE ) ) )`
+ * with GCC and Clang, otherwise empty
+ */
+    #if defined( __GNUC__ )
+        #define JOBS_STATS_ALIGN    __attribute__( ( aligned( JOBS_STATS_CACHE_LINE_SIZE ) ) )
+    #else
+        #define JOBS_STATS_ALIGN
+    #endif
+#endif
+
+/**
+ * @ingroup jobs_enum_types
+ * @brief Statistics counters.
+ *
+ * The first counters follow the order of #JobsTopic_t.
+ */
+typedef enum
+{
+    JobsStatsMatchedJobsChanged,       /**< @brief #Jobs_MatchTopic matched #JobsJobsChanged. */
+    JobsStatsMatchedNextJobChanged,    /**< @brief #Jobs_MatchTopic matched #JobsNextJobChanged. */
+    JobsStatsMatchedGetPendingSuccess, /**< @brief #Jobs_MatchTopic matched #JobsGetPendingSuccess. */
+    JobsStatsMatchedGetPendingFailed,  /**< @brief #Jobs_MatchTopic matched #JobsGetPendingFailed. */
+    JobsStatsMatchedStartNextSuccess,  /**< @brief #Jobs_MatchTopic matched #JobsStartNextSuccess. */
+    JobsStatsMatchedStartNextFailed,   /**< @brief #Jobs_MatchTopic matched #JobsStartNextFailed. */
+    JobsStatsMatchedDescribeSuccess,   /**< @brief #Jobs_MatchTopic matched #JobsDescribeSuccess. */
+    JobsStatsMatchedDescribeFailed,    /**< @brief #Jobs_MatchTopic matched #JobsDescribeFailed. */
+    JobsStatsMatchedUpdateSuccess,     /**< @brief #Jobs_MatchTopic matched #JobsUpdateSuccess. */
+    JobsStatsMatchedUpdateFailed,      /**< @brief #Jobs_MatchTopic matched #JobsUpdateFailed. */
+    JobsStatsNoMatch,                  /**< @brief A topic function returned #JobsNoMatch. */
+    JobsStatsBadParameter,             /**< @brief A topic function returned #JobsBadParameter. */
+    JobsStatsBufferTooSmall,           /**< @brief A topic or message did not fit its buffer. */
+    JobsStatsUpdateMessages,           /**< @brief UpdateJobExecution messages written. */
+    JobsStatsOtaParsed,                /**< @brief Files parsed by otaParser_parseJobDocFile. */
+    JobsStatsOtaFailed,                /**< @brief Failed otaParser_parseJobDocFile calls. */
+    JobsStatsOtaBadFileSize,           /**< @brief OTA files with a missing or invalid filesize. */
+    JobsStatsOtaBadFileId,             /**< @brief OTA files with a missing or invalid fileid. */
+    JobsStatsOtaBadFilePath,           /**< @brief OTA files without filepath. */
+    JobsStatsOtaBadCertFile,           /**< @brief OTA files without certfile. */
+    JobsStatsOtaBadSignature,          /**< @brief OTA files without sig-sha256-ecdsa. */
+    JobsStatsOtaBadFileType,           /**< @brief OTA files with an invalid fileType. */
+    JobsStatsOtaBadProtocol,           /**< @brief OTA documents not listing the protocol. */
+    JobsStatsOtaBadStreamName,         /**< @brief OTA documents without streamname for MQTT. */
+    JobsStatsOtaBadAuthScheme,         /**< @brief OTA files without auth_scheme for HTTP. */
+    JobsStatsOtaBadUpdateDataUrl,      /**< @brief OTA files without update_data_url for HTTP. */
+    JobsStatsJsonBytes,                /**< @brief Bytes of JSON searched or validated. */
+    JobsStatsMaxCounter                /**< @brief The number of counters. */
+} JobsStatsCounter_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief The counters of one task.
+ *
+ * @note Members are private, initialize with #Jobs_StatsInit.
+ */
+typedef struct JOBS_STATS_ALIGN
+{
+    uint32_t counters[ JobsStatsMaxCounter ]; /**< @brief Indexed by #JobsStatsCounter_t. */
+
+    /** @brief Pads the shard to a multiple of the cache line size. */
+    uint8_t padding[ JOBS_STATS_CACHE_LINE_SIZE -
+                     ( ( JobsStatsMaxCounter * sizeof( uint32_t ) ) % JOBS_STATS_CACHE_LINE_SIZE ) ];
+} JobsStatsShard_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief The counters summed over every shard.
+ *
+ * Counters wrap modulo 2^32; export differences between reads.
+ */
+typedef struct
+{
+    uint32_t counters[ JobsStatsMaxCounter ]; /**< @brief Indexed by #JobsStatsCounter_t. */
+} JobsStatsSnapshot_t;
+
+/** @cond DO_NOT_DOCUMENT */
+
+#if ( JOBS_STATS_ENABLED != 0 )
+    #define JOBS_STATS_ADD( counter, amount )    Jobs_StatsAdd( ( counter ), ( uint32_t ) ( amount ) )
+    #define JOBS_STATS_STATUS( status )          Jobs_StatsTopic( ( status ), JobsInvalidTopic )
+    #define JOBS_STATS_TOPIC( status, topic )    Jobs_StatsTopic( ( status ), ( topic ) )
+#else
+    #define JOBS_STATS_ADD( counter, amount )
+    #define JOBS_STATS_STATUS( status )
+    #define JOBS_STATS_TOPIC( status, topic )
+#endif
+
+/** @endcond */
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Register the shards counting for the library, and zero them.
+ *
+ * Register before other tasks use the library.
+ *
+ * @param[in] shards  The shards, aligned to #JOBS_STATS_CACHE_LINE_SIZE,
+ * or NULL to stop counting.
+ * @param[in] shardCount  Number of elements in shards.
+ *
+ * @return #JobsSuccess if the shards were registered;
+ * #JobsBadParameter if shards is not NULL and shardCount is 0, shards is
+ * not aligned, or shardCount is more than 1 without a
+ * #JOBS_STATS_SHARD_INDEX to choose between them.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example counts for 4 tasks and exports the counters.
+ *
+ * static JobsStatsShard_t shards[ 4 ];
+ * JobsStatsSnapshot_t snapshot;
+ *
+ * ( void ) Jobs_StatsInit( shards, 4U );
+ *
+ * // Later, from a metrics task.
+ * ( void ) Jobs_StatsRead( &snapshot );
+ * publishCounter( "jobs.json_bytes", snapshot.counters[ JobsStatsJsonBytes ] );
+ * @endcode
+ */
+/* @[declare_jobs_statsinit] */
+JobsStatus_t Jobs_StatsInit( JobsStatsShard_t * shards,
+                             size_t shardCount );
+/* @[declare_jobs_statsinit] */
+
+/**
+ * @brief Add to a counter in the shard of the calling task.
+ *
+ * Called by the statistics hooks.
+ *
+ * @param[in] counter  The counter.
+ * @param[in] amount  The amount to add.
+ */
+/* @[declare_jobs_statsadd] */
+void Jobs_StatsAdd( JobsStatsCounter_t counter,
+                    uint32_t amount );
+/* @[declare_jobs_statsadd] */
+
+#if defined( JOBS_STATS_THREAD_SHARDS )
+
+/**
+ * @brief Get the shard index of the calling thread.
+ *
+ * The default #JOBS_STATS_SHARD_INDEX on Linux.  Threads are numbered
+ * from 0 in the order they first call this.
+ *
+ * @return The index.
+ */
+/* @[declare_jobs_statsshardindex] */
+    size_t Jobs_StatsShardIndex( void );
+/* @[declare_jobs_statsshardindex] */
+#endif
+
+/**
+ * @brief Count the result of a topic function.
+ *
+ * Called by the statistics hooks.  #JobsNoMatch, #JobsBadParameter and
+ * #JobsBufferTooSmall are counted, and the topic when status is
+ * #JobsSuccess and topic is valid.
+ *
+ * @param[in] status  The result.
+ * @param[in] topic  The topic matched, or #JobsInvalidTopic.
+ */
+/* @[declare_jobs_statstopic] */
+void Jobs_StatsTopic( JobsStatus_t status,
+                      JobsTopic_t topic );
+/* @[declare_jobs_statstopic] */
+
+/**
+ * @brief JSON_SearchConst counting the bytes it scanned.
+ *
+ * The bytes run from the start of the buffer to the end of the value
+ * found, or are the whole buffer if none was found.
+ *
+ * @return The result of JSON_SearchConst.
+ */
+/* @[declare_jobs_statsjsonsearch] */
+JSONStatus_t Jobs_StatsJsonSearch( const char * buf,
+                                   size_t max,
+                                   const char * query,
+                                   size_t queryLength,
+                                   const char ** outValue,
+                                   size_t * outValueLength,
+                                   JSONTypes_t * outType );
+/* @[declare_jobs_statsjsonsearch] */
+
+/**
+ * @brief JSON_Validate counting the bytes it scanned.
+ *
+ * @return The result of JSON_Validate.
+ */
+/* @[declare_jobs_statsjsonvalidate] */
+JSONStatus_t Jobs_StatsJsonValidate( const char * buf,
+                                     size_t max );
+/* @[declare_jobs_statsjsonvalidate] */
+
+/**
+ * @brief Sum the counters of every shard.
+ *
+ * May run while other tasks count; each counter is read atomically.
+ *
+ * @param[out] snapshot  The sums.
+ *
+ * @return #JobsSuccess if the counters were read;
+ * #JobsBadParameter if snapshot is NULL;
+ * #JobsNoMatch if no shards are registered, snapshot is then zeroed.
+ */
+/* @[declare_jobs_statsread] */
+JobsStatus_t Jobs_StatsRead( JobsStatsSnapshot_t * snapshot );
+/* @[declare_jobs_statsread] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_STATS_H_ */
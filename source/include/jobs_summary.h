@@ -0,0 +1,150 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_summary.h
+ * @brief Iteration over the job summaries of job list messages.
+ *
+ * JobExecutionsChanged notifications and GetPendingJobExecutions
+ * responses list the in progress and queued job executions of a thing.
+ * An iterator walks both lists in one pass over the message and yields
+ * each job as a summary whose job ID points into the message, so a
+ * device can choose what to work on without describing every job.
+ */
+
+#ifndef JOBS_SUMMARY_H_
+#define JOBS_SUMMARY_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * @ingroup jobs_structs
+ * @brief A job execution listed by a message.
+ *
+ * Numbers absent from the message are 0.
+ */
+typedef struct
+{
+    const char * jobId;        /**< @brief The job ID, in the message. */
+    size_t jobIdLength;        /**< @brief The length of the job ID. */
+    JobCurrentStatus_t status; /**< @brief #InProgress or #Queued, from the list holding the job. */
+    uint32_t queuedAt;         /**< @brief Time, in seconds since the epoch, the job was queued. */
+    uint32_t lastUpdatedAt;    /**< @brief Time, in seconds since the epoch, the job was last updated. */
+    uint32_t executionNumber;  /**< @brief Execution number of the job execution. */
+    uint32_t versionNumber;    /**< @brief Version of the job execution. */
+} JobsJobSummary_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief An iterator over the job summaries of a message.
+ *
+ * @note Members are private, initialize with #Jobs_SummaryInit.
+ */
+typedef struct
+{
+    const char * message; /**< @brief The message payload. */
+    size_t messageLength; /**< @brief The length of the message payload. */
+    const char * list;    /**< @brief The list being walked, NULL between lists. */
+    size_t listLength;    /**< @brief The length of the list. */
+    size_t start;         /**< @brief Iteration state of the list. */
+    size_t next;          /**< @brief Iteration state of the list. */
+    uint8_t lists;        /**< @brief Number of lists started. */
+    bool getPending;      /**< @brief Whether the message is a GetPendingJobExecutions response. */
+} JobsSummaryIterator_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Start iterating over the job summaries of a message.
+ *
+ * @param[out] iterator  The iterator to initialize.
+ * @param[in] topic  The topic value output by #Jobs_MatchTopic, either
+ * #JobsJobsChanged or #JobsGetPendingSuccess.
+ * @param[in] message  The message payload.
+ * @param[in] messageLength  The length of the message payload.
+ *
+ * @return #JobsSuccess if the iterator was initialized;
+ * #JobsBadParameter if invalid parameters are passed, or the message is
+ * not valid JSON.
+ */
+/* @[declare_jobs_summaryinit] */
+JobsStatus_t Jobs_SummaryInit( JobsSummaryIterator_t * iterator,
+                               JobsTopic_t topic,
+                               const char * message,
+                               size_t messageLength );
+/* @[declare_jobs_summaryinit] */
+
+/**
+ * @brief Get the next job summary of a message.
+ *
+ * In progress jobs are yielded before queued jobs, each in the order of
+ * the message.  Entries without a valid job ID are skipped.  Iteration
+ * may stop at any point.
+ *
+ * @param[in] iterator  The iterator.
+ * @param[out] outSummary  The job summary.
+ *
+ * @return #JobsSuccess if a summary was output;
+ * #JobsNoMatch if every job was yielded;
+ * #JobsBadParameter if invalid parameters are passed.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example resumes the first in progress job, or starts
+ * // the first queued one, from a GetPendingJobExecutions response.
+ *
+ * JobsSummaryIterator_t iterator;
+ * JobsJobSummary_t summary;
+ *
+ * if( ( Jobs_SummaryInit( &iterator, JobsGetPendingSuccess,
+ *                         payload, payloadLength ) == JobsSuccess ) &&
+ *     ( Jobs_SummaryNext( &iterator, &summary ) == JobsSuccess ) )
+ * {
+ *     // Describe summary.jobId to get its job document.
+ * }
+ * @endcode
+ */
+/* @[declare_jobs_summarynext] */
+JobsStatus_t Jobs_SummaryNext( JobsSummaryIterator_t * iterator,
+                               JobsJobSummary_t * outSummary );
+/* @[declare_jobs_summarynext] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_SUMMARY_H_ */
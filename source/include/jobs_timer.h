@@ -0,0 +1,243 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_timer.h
+ * @brief Hierarchical timing wheel for job execution deadlines.
+ *
+ * A wheel holds any number of caller provided timers, such as step
+ * timeouts derived from stepTimeoutInMinutes or local watchdogs.  Timers
+ * are kept in four levels of 64 slots, so arming, cancelling and expiring
+ * a timer are O(1); a timer is moved to a lower level at most three times
+ * before it expires.
+ *
+ * An expired timer linked to a job execution record reports FAILED
+ * through #Jobs_ExecutionReport, and the resulting UpdateJobExecution
+ * message is handed to the expiry callback.
+ */
+
+#ifndef JOBS_TIMER_H_
+#define JOBS_TIMER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+#include "jobs_execution.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#ifndef JOBS_TIMER_STATUS_DETAILS
+
+/**
+ * @brief User defined statusDetails of the FAILED update sent when a
+ * timer expires.
+ *
+ * <br><b>Default value</b>: `{"reason":"TIMED_OUT"}`
+ */
+    #define JOBS_TIMER_STATUS_DETAILS    "{\"reason\":\"TIMED_OUT\"}"
+#endif
+
+/**
+ * @ingroup jobs_constants
+ * @brief Number of levels of a timing wheel.
+ */
+#define JOBS_TIMER_LEVELS        4U
+
+/**
+ * @ingroup jobs_constants
+ * @brief Number of slots in each level of a timing wheel.
+ */
+#define JOBS_TIMER_SLOTS         64U
+
+/**
+ * @ingroup jobs_structs
+ * @brief A timer, see #JobsTimer.
+ */
+typedef struct JobsTimer JobsTimer_t;
+
+/**
+ * @ingroup jobs_callback_types
+ * @brief Receive an expired timer.
+ *
+ * The timer may be armed again from the callback.
+ *
+ * @param[in] timer  The expired timer.
+ * @param[in] message  The FAILED UpdateJobExecution message, not NUL
+ * terminated.
+ * @param[in] messageLength  The length of the message; 0 if the message
+ * does not fit the buffer given to #Jobs_TimerAdvance, or if the linked
+ * execution record holds the report until its request in flight completes.
+ * @param[in] pContext  The context given to #Jobs_TimerAdvance.
+ */
+typedef void (* JobsTimerExpired_t)( JobsTimer_t * timer,
+                                     const char * message,
+                                     size_t messageLength,
+                                     void * pContext );
+
+/**
+ * @ingroup jobs_structs
+ * @brief A deadline of one job execution.
+ */
+struct JobsTimer
+{
+    JobsExecution_t * pExecution; /**< @brief The linked execution record, may be NULL. */
+    void * pContext;              /**< @brief Caller data, e.g. the job ID. */
+    JobsTimer_t * pNext;          /**< @brief Private, next timer in the slot. */
+    JobsTimer_t * pPrev;          /**< @brief Private, previous timer in the slot. */
+    uint32_t expiryTick;          /**< @brief Private, tick the timer expires on. */
+    uint8_t level;                /**< @brief Private, level of the slot. */
+    uint8_t slot;                 /**< @brief Private, index of the slot. */
+    bool armed;                   /**< @brief Private, whether the timer is in the wheel. */
+};
+
+/**
+ * @ingroup jobs_structs
+ * @brief A hierarchical timing wheel.
+ *
+ * @note Members are private, initialize with #Jobs_TimerInit.
+ */
+typedef struct
+{
+    JobsTimer_t * pSlots[ JOBS_TIMER_LEVELS ][ JOBS_TIMER_SLOTS ]; /**< @brief Timer lists of each slot. */
+    uint32_t currentTick;                                          /**< @brief The last tick processed. */
+    uint32_t currentMs;                                            /**< @brief Time of the last tick processed. */
+    uint32_t tickMs;                                               /**< @brief Length of a tick in milliseconds. */
+    size_t count;                                                  /**< @brief Number of armed timers. */
+} JobsTimerWheel_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Initialize a timing wheel.
+ *
+ * @param[out] wheel  The wheel to initialize.
+ * @param[in] nowMs  The current time in milliseconds.
+ * @param[in] tickMs  The resolution of the wheel in milliseconds, e.g.
+ * 1000 for step timeouts.
+ *
+ * @return #JobsSuccess if the wheel was initialized;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_timerinit] */
+JobsStatus_t Jobs_TimerInit( JobsTimerWheel_t * wheel,
+                             uint32_t nowMs,
+                             uint32_t tickMs );
+/* @[declare_jobs_timerinit] */
+
+/**
+ * @brief Arm a timer, or move an armed timer to a new deadline.
+ *
+ * The timer expires on the first #Jobs_TimerAdvance at or after the
+ * deadline, rounded up to the wheel resolution.
+ *
+ * @param[in] wheel  The wheel.
+ * @param[in] timer  The timer, with pExecution and pContext set.  Zero
+ * initialize a timer before it is first armed.
+ * @param[in] deadlineMs  Time, in milliseconds, when the timer expires,
+ * less than 2^31 milliseconds in the future.
+ *
+ * @return #JobsSuccess if the timer was armed;
+ * #JobsBadParameter if invalid parameters are passed.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example arms a step timeout for a job started with
+ * // stepTimeoutInMinutes, and reports it when it expires.
+ *
+ * static JobsTimerWheel_t wheel;
+ * static JobsTimer_t timers[ MAX_JOBS ] = { 0 };
+ * char message[ 256 ];
+ *
+ * ( void ) Jobs_TimerInit( &wheel, now, 1000U );
+ *
+ * timers[ i ].pExecution = &executions[ i ];
+ * ( void ) Jobs_TimerArm( &wheel, &timers[ i ], now + ( stepTimeoutInMinutes * 60000U ) );
+ *
+ * // Periodically.
+ * ( void ) Jobs_TimerAdvance( &wheel, now, message, sizeof( message ),
+ *                             publishUpdate, NULL );
+ * @endcode
+ */
+/* @[declare_jobs_timerarm] */
+JobsStatus_t Jobs_TimerArm( JobsTimerWheel_t * wheel,
+                            JobsTimer_t * timer,
+                            uint32_t deadlineMs );
+/* @[declare_jobs_timerarm] */
+
+/**
+ * @brief Cancel a timer.
+ *
+ * @param[in] wheel  The wheel.
+ * @param[in] timer  The timer.
+ *
+ * @return #JobsSuccess if the timer was cancelled;
+ * #JobsNoMatch if the timer is not armed;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_timercancel] */
+JobsStatus_t Jobs_TimerCancel( JobsTimerWheel_t * wheel,
+                               JobsTimer_t * timer );
+/* @[declare_jobs_timercancel] */
+
+/**
+ * @brief Advance the wheel to the current time and expire due timers.
+ *
+ * For each expired timer, a FAILED update with #JOBS_TIMER_STATUS_DETAILS
+ * is built in buffer and passed to the callback.  When the timer has an
+ * execution record, the update goes through #Jobs_ExecutionReport and
+ * carries the expected version of the record.
+ *
+ * @param[in] wheel  The wheel.
+ * @param[in] nowMs  The current time in milliseconds.
+ * @param[out] buffer  The buffer to build the messages in.
+ * @param[in] bufferSize  The size of the buffer.
+ * @param[in] callback  The expiry callback.
+ * @param[in] pContext  Context passed to the callback.
+ *
+ * @return #JobsSuccess if the wheel was advanced;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_timeradvance] */
+JobsStatus_t Jobs_TimerAdvance( JobsTimerWheel_t * wheel,
+                                uint32_t nowMs,
+                                char * buffer,
+                                size_t bufferSize,
+                                JobsTimerExpired_t callback,
+                                void * pContext );
+/* @[declare_jobs_timeradvance] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_TIMER_H_ */
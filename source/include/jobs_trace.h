@@ -0,0 +1,303 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_trace.h
+ * @brief Optional instrumentation of the Jobs library hot paths.
+ *
+ * When #JOBS_TRACE_ENABLED is 1, the public functions of jobs.c, the OTA
+ * job document parser, and every coreJSON search and validation made by
+ * a module of the library report an event to a sink registered with
+ * #Jobs_TraceSetSink.  An event carries the elapsed cycles, the bytes
+ * processed, and the result.
+ *
+ * When #JOBS_TRACE_ENABLED is 0, the default, the hooks expand to nothing
+ * and the library calls coreJSON directly, or through the wrappers of
+ * jobs_stats.h when #JOBS_STATS_ENABLED is 1.
+ */
+
+#ifndef JOBS_TRACE_H_
+#define JOBS_TRACE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Internal Includes */
+#include "jobs_stats.h"
+
+/* External Dependencies */
+#include "core_json.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#ifndef JOBS_TRACE_ENABLED
+
+/**
+ * @brief Set to 1 to build the library with instrumentation hooks.
+ *
+ * <br><b>Default value</b>: `0`
+ */
+    #define JOBS_TRACE_ENABLED    0
+#endif
+
+#ifndef JOBS_TRACE_CYCLES
+
+/**
+ * @brief Read a free running cycle counter as a uint32_t.
+ *
+ * Define for targets other than x86, e.g. as `DWT->CYCCNT` on Cortex-M
+ * or a read of `cntvct_el0` on AArch64.
+ *
+ * <br><b>Default value</b>: `__builtin_ia32_rdtsc()` on x86, `0U` elsewhere
+ */
+    #if defined( __x86_64__ ) || defined( __i386__ )
+        #define JOBS_TRACE_CYCLES()    ( ( uint32_t ) __builtin_ia32_rdtsc() )
+    #else
+        #define JOBS_TRACE_CYCLES()    ( 0U )
+    #endif
+#endif
+
+/**
+ * @ingroup jobs_constants
+ * @brief Number of buckets in a cycle histogram.
+ *
+ * Bucket i counts events of 2^i to 2^(i+1) - 1 cycles, and bucket 0 also
+ * counts events of 0 cycles.
+ */
+#define JOBS_TRACE_HISTOGRAM_BUCKETS    32U
+
+/**
+ * @ingroup jobs_enum_types
+ * @brief Instrumented functions.
+ */
+typedef enum
+{
+    JobsTraceGetTopic,                 /**< @brief #Jobs_GetTopic. */
+    JobsTraceMatchTopic,               /**< @brief #Jobs_MatchTopic. */
+    JobsTraceGetPending,               /**< @brief #Jobs_GetPending. */
+    JobsTraceStartNext,                /**< @brief #Jobs_StartNext. */
+    JobsTraceDescribe,                 /**< @brief #Jobs_Describe. */
+    JobsTraceUpdate,                   /**< @brief #Jobs_Update. */
+    JobsTraceStartNextMsg,             /**< @brief #Jobs_StartNextMsg. */
+    JobsTraceUpdateMsg,                /**< @brief #Jobs_UpdateMsg. */
+    JobsTraceUpdateMsgWithOptions,     /**< @brief #Jobs_UpdateMsgWithOptions. */
+    JobsTraceStartNextMsgWithOptions,  /**< @brief #Jobs_StartNextMsgWithOptions. */
+    JobsTraceDescribeMsg,              /**< @brief #Jobs_DescribeMsg. */
+    JobsTraceGetPendingMsg,            /**< @brief #Jobs_GetPendingMsg. */
+    JobsTraceIsStartNextAccepted,      /**< @brief #Jobs_IsStartNextAccepted. */
+    JobsTraceIsJobUpdateStatus,        /**< @brief #Jobs_IsJobUpdateStatus. */
+    JobsTraceGetJobId,                 /**< @brief #Jobs_GetJobId. */
+    JobsTraceGetJobDocument,           /**< @brief #Jobs_GetJobDocument. */
+    JobsTraceParseJobDocFile,          /**< @brief otaParser_parseJobDocFile. */
+    JobsTracePopulateJobDocFields,     /**< @brief populateJobDocFields, the fields of one file. */
+    JobsTraceJsonSearch,               /**< @brief A JSON_SearchConst call. */
+    JobsTraceJsonValidate,             /**< @brief A JSON_Validate call. */
+    JobsTraceMaxPoint                  /**< @brief The number of instrumented functions. */
+} JobsTracePoint_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief An instrumented function call.
+ */
+typedef struct
+{
+    JobsTracePoint_t point; /**< @brief The function. */
+    uint32_t cycles;        /**< @brief Cycles from entry to exit. */
+    size_t bytes;           /**< @brief Bytes read or written. */
+    int32_t result;         /**< @brief The return value, cast to int32_t. */
+} JobsTraceEvent_t;
+
+/**
+ * @brief Receive an event.
+ *
+ * Called from the task that made the instrumented call, before the call
+ * returns.
+ */
+typedef void ( * JobsTraceSink_t )( void * pContext,
+                                    const JobsTraceEvent_t * event );
+
+/**
+ * @ingroup jobs_structs
+ * @brief Statistics of one instrumented function.
+ */
+typedef struct
+{
+    uint32_t count;                                     /**< @brief Number of calls. */
+    uint32_t maxCycles;                                 /**< @brief Longest call. */
+    uint64_t totalCycles;                               /**< @brief Cycles of all calls. */
+    uint64_t totalBytes;                                /**< @brief Bytes of all calls. */
+    uint32_t buckets[ JOBS_TRACE_HISTOGRAM_BUCKETS ];   /**< @brief Calls by power of two of cycles. */
+} JobsTraceStats_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief Statistics of every instrumented function, filled by
+ * #Jobs_TraceHistogramSink.
+ */
+typedef struct
+{
+    JobsTraceStats_t points[ JobsTraceMaxPoint ]; /**< @brief Indexed by #JobsTracePoint_t. */
+} JobsTraceHistogram_t;
+
+/** @cond DO_NOT_DOCUMENT */
+
+#if ( JOBS_TRACE_ENABLED != 0 )
+    #define JOBS_TRACE_ENTER()    const uint32_t jobsTraceStart = JOBS_TRACE_CYCLES()
+    #define JOBS_TRACE_EXIT( point, bytes, result ) \
+    Jobs_TraceEmit( ( point ), JOBS_TRACE_CYCLES() - jobsTraceStart, ( bytes ), ( int32_t ) ( result ) )
+    #define JOBS_TRACE_JSON_SEARCH      Jobs_TraceJsonSearch
+    #define JOBS_TRACE_JSON_VALIDATE    Jobs_TraceJsonValidate
+#elif ( JOBS_STATS_ENABLED != 0 )
+    #define JOBS_TRACE_ENTER()
+    #define JOBS_TRACE_EXIT( point, bytes, result )
+    #define JOBS_TRACE_JSON_SEARCH      Jobs_StatsJsonSearch
+    #define JOBS_TRACE_JSON_VALIDATE    Jobs_StatsJsonValidate
+#else
+    #define JOBS_TRACE_ENTER()
+    #define JOBS_TRACE_EXIT( point, bytes, result )
+    #define JOBS_TRACE_JSON_SEARCH      JSON_SearchConst
+    #define JOBS_TRACE_JSON_VALIDATE    JSON_Validate
+#endif
+
+/** @endcond */
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Register the sink receiving events.
+ *
+ * Register before other tasks use the library.
+ *
+ * @param[in] sink  The sink, or NULL to drop events.
+ * @param[in] pContext  Passed to the sink.
+ */
+/* @[declare_jobs_tracesetsink] */
+void Jobs_TraceSetSink( JobsTraceSink_t sink,
+                        void * pContext );
+/* @[declare_jobs_tracesetsink] */
+
+/**
+ * @brief Report an event to the registered sink.
+ *
+ * Called by the instrumentation hooks.
+ *
+ * @param[in] point  The function.
+ * @param[in] cycles  Cycles from entry to exit.
+ * @param[in] bytes  Bytes read or written.
+ * @param[in] result  The return value.
+ */
+/* @[declare_jobs_traceemit] */
+void Jobs_TraceEmit( JobsTracePoint_t point,
+                     uint32_t cycles,
+                     size_t bytes,
+                     int32_t result );
+/* @[declare_jobs_traceemit] */
+
+/**
+ * @brief JSON_SearchConst reporting a #JobsTraceJsonSearch event.
+ *
+ * The bytes of the event run from the start of the buffer to the end of
+ * the value found, or are the whole buffer if none was found.
+ *
+ * @return The result of JSON_SearchConst.
+ */
+/* @[declare_jobs_tracejsonsearch] */
+JSONStatus_t Jobs_TraceJsonSearch( const char * buf,
+                                   size_t max,
+                                   const char * query,
+                                   size_t queryLength,
+                                   const char ** outValue,
+                                   size_t * outValueLength,
+                                   JSONTypes_t * outType );
+/* @[declare_jobs_tracejsonsearch] */
+
+/**
+ * @brief JSON_Validate reporting a #JobsTraceJsonValidate event.
+ *
+ * @return The result of JSON_Validate.
+ */
+/* @[declare_jobs_tracejsonvalidate] */
+JSONStatus_t Jobs_TraceJsonValidate( const char * buf,
+                                     size_t max );
+/* @[declare_jobs_tracejsonvalidate] */
+
+/**
+ * @brief A sink accumulating per function statistics.
+ *
+ * @param[in] pContext  The #JobsTraceHistogram_t to fill, zeroed before
+ * the first event.
+ * @param[in] event  The event.
+ *
+ * @note Not safe to share between tasks; give each task its own
+ * histogram or serialize the calls.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example measures Jobs_MatchTopic over a test run.
+ *
+ * static JobsTraceHistogram_t histogram;
+ *
+ * Jobs_TraceSetSink( Jobs_TraceHistogramSink, &histogram );
+ *
+ * // Run the workload.
+ *
+ * printf( "p99 %u cycles over %u calls\n",
+ *         Jobs_TraceHistogramPercentile( &histogram, JobsTraceMatchTopic, 99U ),
+ *         histogram.points[ JobsTraceMatchTopic ].count );
+ * @endcode
+ */
+/* @[declare_jobs_tracehistogramsink] */
+void Jobs_TraceHistogramSink( void * pContext,
+                              const JobsTraceEvent_t * event );
+/* @[declare_jobs_tracehistogramsink] */
+
+/**
+ * @brief Estimate a percentile of the cycles of a function.
+ *
+ * @param[in] histogram  The histogram.
+ * @param[in] point  The function.
+ * @param[in] percent  The percentile, 1 to 100.
+ *
+ * @return The upper bound of the bucket holding the percentile, capped at
+ * the longest call; 0 if there were no calls or invalid parameters are
+ * passed.
+ */
+/* @[declare_jobs_tracehistogrampercentile] */
+uint32_t Jobs_TraceHistogramPercentile( const JobsTraceHistogram_t * histogram,
+                                        JobsTracePoint_t point,
+                                        uint32_t percent );
+/* @[declare_jobs_tracehistogrampercentile] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_TRACE_H_ */
@@ -0,0 +1,230 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_version.h
+ * @brief Tracking of job execution version numbers for update requests.
+ *
+ * The Jobs service rejects an UpdateJobExecution request whose
+ * expectedVersion does not match the current version of the execution.
+ * A version cache records the versionNumber reported in responses and
+ * notifications, and fills expectedVersion into later update messages.
+ * The cache operates only on storage provided by the caller.
+ */
+
+#ifndef JOBS_VERSION_H_
+#define JOBS_VERSION_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * @ingroup jobs_structs
+ * @brief The last known version of one job execution.
+ *
+ * @note Members are private, the cache manages every entry.
+ */
+typedef struct
+{
+    char jobId[ JOBS_JOBID_MAX_LENGTH ]; /**< @brief Job ID, not NUL terminated. */
+    uint16_t jobIdLength;                /**< @brief Job ID length, 0 for an empty entry. */
+    uint32_t versionNumber;              /**< @brief Last version reported by the service. */
+    uint32_t lastUsed;                   /**< @brief Use stamp for least recently used eviction. */
+} JobsVersionEntry_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief A fixed capacity cache of job execution versions.
+ *
+ * @note Members are private, initialize with #Jobs_VersionCacheInit.
+ */
+typedef struct
+{
+    JobsVersionEntry_t * pEntries; /**< @brief Caller provided entries. */
+    size_t entryCount;             /**< @brief Number of entries. */
+    uint32_t useCount;             /**< @brief Source of use stamps. */
+} JobsVersionCache_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Initialize a version cache over caller provided entries.
+ *
+ * When every entry is in use, recording a new job replaces the least
+ * recently used entry.
+ *
+ * @param[out] cache  The cache to initialize.
+ * @param[in] entries  Storage for the cache entries.
+ * @param[in] entryCount  Number of elements in entries.
+ *
+ * @return #JobsSuccess if the cache was initialized;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_versioncacheinit] */
+JobsStatus_t Jobs_VersionCacheInit( JobsVersionCache_t * cache,
+                                    JobsVersionEntry_t * entries,
+                                    size_t entryCount );
+/* @[declare_jobs_versioncacheinit] */
+
+/**
+ * @brief Record the versions reported in a matched Jobs message.
+ *
+ * Versions are read from:
+ *    * execution.versionNumber of StartNextPendingJobExecution and
+ *      DescribeJobExecution responses, and NextJobExecutionChanged
+ *      notifications;
+ *    * executionState.versionNumber of UpdateJobExecution responses;
+ *    * the job summaries of GetPendingJobExecutions responses and
+ *      JobExecutionsChanged notifications.
+ *
+ * An accepted UpdateJobExecution response without executionState
+ * increments the cached version of the job, since the service increments
+ * the version on every successful update.
+ *
+ * @param[in] cache  The version cache.
+ * @param[in] topic  The topic value output by #Jobs_MatchTopic.
+ * @param[in] jobId  The job ID output by #Jobs_MatchTopic, may be NULL.
+ * @param[in] jobIdLength  The length of the job ID.
+ * @param[in] message  The message payload.
+ * @param[in] messageLength  The length of the message payload.
+ *
+ * @return #JobsSuccess if at least one version was recorded;
+ * #JobsNoMatch if the message carries no version;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_versioncacheobserve] */
+JobsStatus_t Jobs_VersionCacheObserve( JobsVersionCache_t * cache,
+                                       JobsTopic_t topic,
+                                       const char * jobId,
+                                       uint16_t jobIdLength,
+                                       const char * message,
+                                       size_t messageLength );
+/* @[declare_jobs_versioncacheobserve] */
+
+/**
+ * @brief Look up the last known version of a job execution.
+ *
+ * @param[in] cache  The version cache.
+ * @param[in] jobId  The job ID.
+ * @param[in] jobIdLength  The length of the job ID.
+ * @param[out] outVersion  The cached version.
+ *
+ * @return #JobsSuccess if the job has a cached version;
+ * #JobsNoMatch if it does not;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_versioncacheget] */
+JobsStatus_t Jobs_VersionCacheGet( JobsVersionCache_t * cache,
+                                   const char * jobId,
+                                   uint16_t jobIdLength,
+                                   uint32_t * outVersion );
+/* @[declare_jobs_versioncacheget] */
+
+/**
+ * @brief Forget the version of a job execution, for example once it
+ * reached a terminal status.
+ *
+ * @param[in] cache  The version cache.
+ * @param[in] jobId  The job ID.
+ * @param[in] jobIdLength  The length of the job ID.
+ *
+ * @return #JobsSuccess if the entry was removed;
+ * #JobsNoMatch if the job has no cached version;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+/* @[declare_jobs_versioncacheremove] */
+JobsStatus_t Jobs_VersionCacheRemove( JobsVersionCache_t * cache,
+                                      const char * jobId,
+                                      uint16_t jobIdLength );
+/* @[declare_jobs_versioncacheremove] */
+
+/**
+ * @brief Populate a message string for an UpdateJobExecution request,
+ * filling expectedVersion from the cache.
+ *
+ * An expectedVersion already set in the request is kept.  When the job
+ * has no cached version the message is written without expectedVersion.
+ *
+ * @param[in] cache  The version cache.
+ * @param[in] jobId  The job ID the update is published for.
+ * @param[in] jobIdLength  The length of the job ID.
+ * @param[in] request  A jobs update request structure.
+ * @param[in] options  The optional fields, may be NULL.
+ * @param[out] buffer  The buffer to be written to, NULL to compute the length.
+ * @param[in] bufferSize  The size of the buffer.
+ *
+ * @return 0 if invalid parameters are passed or the write fails.
+ * @return messageLength if the write is successful, or the required
+ * length when buffer is NULL.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example records the version from a StartNext response
+ * // and reports the outcome without a version conflict.
+ *
+ * JobsVersionEntry_t entries[ 4 ];
+ * JobsVersionCache_t cache;
+ * JobsUpdateRequest_t request = { 0 };
+ * char messageBuffer[ UPDATE_JOB_MSG_LENGTH ];
+ * size_t messageLength;
+ *
+ * ( void ) Jobs_VersionCacheInit( &cache, entries, 4U );
+ *
+ * // In the MQTT callback, after Jobs_MatchTopic() returned topic and jobId.
+ * ( void ) Jobs_VersionCacheObserve( &cache, topic, jobId, jobIdLength,
+ *                                    payload, payloadLength );
+ *
+ * request.status = Succeeded;
+ * messageLength = Jobs_VersionCacheUpdateMsg( &cache, jobId, jobIdLength,
+ *                                             request, NULL, messageBuffer,
+ *                                             sizeof( messageBuffer ) );
+ * @endcode
+ */
+/* @[declare_jobs_versioncacheupdatemsg] */
+size_t Jobs_VersionCacheUpdateMsg( JobsVersionCache_t * cache,
+                                   const char * jobId,
+                                   uint16_t jobIdLength,
+                                   JobsUpdateRequest_t request,
+                                   const JobsUpdateOptions_t * options,
+                                   char * buffer,
+                                   size_t bufferSize );
+/* @[declare_jobs_versioncacheupdatemsg] */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_VERSION_H_ */
@@ -33,6 +33,9 @@
 
 /* Internal Includes */
 #include "jobs.h"
+#include "jobs_internal.h"
+#include "jobs_trace.h"
+#include "jobs_log.h"
 /* External Dependencies */
 #include "core_json.h"
 
@@ -292,6 +295,8 @@ JobsStatus_t Jobs_GetTopic( char * buffer,
     JobsStatus_t ret = JobsBadParameter;
     size_t start = 0U;
 
+    JOBS_TRACE_ENTER();
+
     if( checkCommonParams() &&
         ( api > JobsInvalidTopic ) && ( api < JobsMaxTopic ) )
     {
@@ -319,6 +324,10 @@ JobsStatus_t Jobs_GetTopic( char * buffer,
         }
     }
 
+    JOBS_STATS_STATUS( ret );
+    JOBS_LOG_STATUS( JobsLogGetTopic, ret, api );
+    JOBS_TRACE_EXIT( JobsTraceGetTopic, start, ret );
+
     return ret;
 }
 
@@ -616,6 +625,8 @@ JobsStatus_t Jobs_MatchTopic( char * topic,
     char * jobId = NULL;
     uint16_t jobIdLength = 0U;
 
+    JOBS_TRACE_ENTER();
+
     if( ( topic != NULL ) && ( outApi != NULL ) && checkThingParams() && ( length > 0U ) )
     {
         ret = JobsNoMatch;
@@ -655,6 +666,10 @@ JobsStatus_t Jobs_MatchTopic( char * topic,
         *outJobIdLength = jobIdLength;
     }
 
+    JOBS_STATS_TOPIC( ret, api );
+    JOBS_LOG_STATUS( JobsLogMatchTopic, ret, length );
+    JOBS_TRACE_EXIT( JobsTraceMatchTopic, length, ret );
+
     return ret;
 }
 
@@ -672,6 +687,8 @@ JobsStatus_t Jobs_GetPending( char * buffer,
     JobsStatus_t ret = JobsBadParameter;
     size_t start = 0U;
 
+    JOBS_TRACE_ENTER();
+
     if( checkCommonParams() )
     {
         writePreamble( buffer, &start, length, thingName, thingNameLength );
@@ -688,6 +705,10 @@ JobsStatus_t Jobs_GetPending( char * buffer,
         }
     }
 
+    JOBS_STATS_STATUS( ret );
+    JOBS_LOG_STATUS( JobsLogGetPending, ret, thingNameLength );
+    JOBS_TRACE_EXIT( JobsTraceGetPending, start, ret );
+
     return ret;
 }
 
@@ -705,6 +726,8 @@ JobsStatus_t Jobs_StartNext( char * buffer,
     JobsStatus_t ret = JobsBadParameter;
     size_t start = 0U;
 
+    JOBS_TRACE_ENTER();
+
     if( checkCommonParams() )
     {
         writePreamble( buffer, &start, length, thingName, thingNameLength );
@@ -721,6 +744,10 @@ JobsStatus_t Jobs_StartNext( char * buffer,
         }
     }
 
+    JOBS_STATS_STATUS( ret );
+    JOBS_LOG_STATUS( JobsLogStartNext, ret, thingNameLength );
+    JOBS_TRACE_EXIT( JobsTraceStartNext, start, ret );
+
     return ret;
 }
 
@@ -731,12 +758,20 @@ size_t Jobs_StartNextMsg( const char * clientToken,
 {
     size_t start = 0U;
 
+    JOBS_TRACE_ENTER();
+
     if( ( clientToken != NULL ) && ( clientTokenLength > 0U ) && ( bufferSize >= ( 18U + clientTokenLength ) ) )
     {
         ( void ) strnAppend( buffer, &start, bufferSize, JOBS_API_CLIENTTOKEN, JOBS_API_CLIENTTOKEN_LENGTH );
         ( void ) strnAppend( buffer, &start, bufferSize, clientToken, clientTokenLength );
         ( void ) strnAppend( buffer, &start, bufferSize, "\"}", ( CONST_STRLEN( "\"}" ) ) );
     }
+    else
+    {
+        JOBS_LOG_ERROR( JobsLogStartNextMsg, clientTokenLength, bufferSize );
+    }
+
+    JOBS_TRACE_EXIT( JobsTraceStartNextMsg, start, start );
 
     return start;
 }
@@ -757,6 +792,8 @@ JobsStatus_t Jobs_Describe( char * buffer,
     JobsStatus_t ret = JobsBadParameter;
     size_t start = 0U;
 
+    JOBS_TRACE_ENTER();
+
     if( checkCommonParams() &&
         ( ( isNextJobId( jobId, jobIdLength ) == true ) ||
           ( isValidJobId( jobId, jobIdLength ) == true ) ) )
@@ -779,6 +816,10 @@ JobsStatus_t Jobs_Describe( char * buffer,
         }
     }
 
+    JOBS_STATS_STATUS( ret );
+    JOBS_LOG_STATUS( JobsLogDescribe, ret, jobIdLength );
+    JOBS_TRACE_EXIT( JobsTraceDescribe, start, ret );
+
     return ret;
 }
 
@@ -798,6 +839,8 @@ JobsStatus_t Jobs_Update( char * buffer,
     JobsStatus_t ret = JobsBadParameter;
     size_t start = 0U;
 
+    JOBS_TRACE_ENTER();
+
     if( checkCommonParams() &&
         ( isValidJobId( jobId, jobIdLength ) == true ) )
     {
@@ -819,103 +862,742 @@ JobsStatus_t Jobs_Update( char * buffer,
         }
     }
 
+    JOBS_STATS_STATUS( ret );
+    JOBS_LOG_STATUS( JobsLogUpdate, ret, jobIdLength );
+    JOBS_TRACE_EXIT( JobsTraceUpdate, start, ret );
+
     return ret;
 }
 
+/** @cond DO_NOT_DOCUMENT */
+
 /**
- * @brief Get the total length of optional fields provided for
- * the Jobs_UpdateMsg. These optional fields, if provided, require
- * additional buffer space.
+ * @brief Append characters to a message, or only count them.
  *
- * @param request A JobsUpdateRequest_t containing the optional fields.
- * @return size_t The buffer space required for the optional fields.
+ * When buffer is NULL nothing is written and start is advanced by
+ * valueLength, so the same writer computes a message length before
+ * writing the message.
+ *
+ * @param[in] buffer  The buffer to be written, may be NULL.
+ * @param[in,out] start  The index at which to begin.
+ * @param[in] max  The size of the buffer.
+ * @param[in] value  The characters to copy.
+ * @param[in] valueLength  How many characters to copy.
  */
-static size_t getOptionalFieldsLength( JobsUpdateRequest_t request )
+static void writeChars( char * buffer,
+                        size_t * start,
+                        size_t max,
+                        const char * value,
+                        size_t valueLength )
 {
-    size_t minimumOptionalFieldsBufferSize = 0U;
+    if( buffer == NULL )
+    {
+        *start += valueLength;
+    }
+    else
+    {
+        ( void ) strnAppend( buffer, start, max, value, valueLength );
+    }
+}
 
-    if( ( request.expectedVersion != NULL ) && ( request.expectedVersionLength > 0U ) )
+/**
+ * @brief Append a JSON member to a message.
+ *
+ * The first member of a message opens the JSON object, later members
+ * are preceded by a comma.
+ *
+ * @param[in] buffer  The buffer to be written, may be NULL.
+ * @param[in,out] start  The index at which to begin.
+ * @param[in] max  The size of the buffer.
+ * @param[in] key  The member key.
+ * @param[in] keyLength  The length of the key.
+ * @param[in] value  The member value.
+ * @param[in] valueLength  The length of the value.
+ * @param[in] quoted  Set to true for string values.
+ */
+static void writeMember( char * buffer,
+                         size_t * start,
+                         size_t max,
+                         const char * key,
+                         size_t keyLength,
+                         const char * value,
+                         size_t valueLength,
+                         bool quoted )
+{
+    if( *start == 0U )
     {
-        minimumOptionalFieldsBufferSize += JOBS_API_EXPECTED_VERSION_LENGTH + request.expectedVersionLength;
+        writeChars( buffer, start, max, "{\"", CONST_STRLEN( "{\"" ) );
     }
+    else
+    {
+        writeChars( buffer, start, max, ",\"", CONST_STRLEN( ",\"" ) );
+    }
+
+    writeChars( buffer, start, max, key, keyLength );
 
-    if( ( request.statusDetails != NULL ) && ( request.statusDetailsLength > 0U ) )
+    if( quoted == true )
+    {
+        writeChars( buffer, start, max, "\":\"", CONST_STRLEN( "\":\"" ) );
+        writeChars( buffer, start, max, value, valueLength );
+        writeChars( buffer, start, max, "\"", CONST_STRLEN( "\"" ) );
+    }
+    else
     {
-        minimumOptionalFieldsBufferSize += JOBS_API_STATUS_DETAILS_LENGTH + request.statusDetailsLength;
+        writeChars( buffer, start, max, "\":", CONST_STRLEN( "\":" ) );
+        writeChars( buffer, start, max, value, valueLength );
     }
+}
 
-    return minimumOptionalFieldsBufferSize;
+/**
+ * @brief Append an unsigned integer member to a message when it is non-zero.
+ *
+ * @param[in] buffer  The buffer to be written, may be NULL.
+ * @param[in,out] start  The index at which to begin.
+ * @param[in] max  The size of the buffer.
+ * @param[in] key  The member key.
+ * @param[in] keyLength  The length of the key.
+ * @param[in] value  The member value, 0 to omit the member.
+ */
+static void writeUintMember( char * buffer,
+                             size_t * start,
+                             size_t max,
+                             const char * key,
+                             size_t keyLength,
+                             uint32_t value )
+{
+    char digits[ JOBS_UINT32_STRING_MAX_LENGTH ];
+    size_t digitsLength;
+
+    if( value > 0U )
+    {
+        digitsLength = Jobs_UintToString( value, digits, sizeof( digits ) );
+        writeMember( buffer, start, max, key, keyLength, digits, digitsLength, false );
+    }
 }
 
 /**
- * @brief Get the total length of the required fields in the
- * Jobs_UpdateMsg request.
+ * @brief Append a boolean member to a message when it is not omitted.
  *
- * @param request A JobsUpdateRequest_t containing the optional fields.
- * @return size_t The buffer space required for the optional fields.
+ * @param[in] buffer  The buffer to be written, may be NULL.
+ * @param[in,out] start  The index at which to begin.
+ * @param[in] max  The size of the buffer.
+ * @param[in] key  The member key.
+ * @param[in] keyLength  The length of the key.
+ * @param[in] value  The member value.
  */
-static size_t getRequiredFieldsLength( JobsUpdateRequest_t request )
+static void writeBoolMember( char * buffer,
+                             size_t * start,
+                             size_t max,
+                             const char * key,
+                             size_t keyLength,
+                             JobsOptionalBool_t value )
 {
-    return JOBS_API_STATUS_LENGTH + strlen( jobStatusString[ request.status ] ) + CONST_STRLEN( "\"}" );
+    if( value == JobsOptionTrue )
+    {
+        writeMember( buffer, start, max, key, keyLength, "true", CONST_STRLEN( "true" ), false );
+    }
+    else if( value == JobsOptionFalse )
+    {
+        writeMember( buffer, start, max, key, keyLength, "false", CONST_STRLEN( "false" ), false );
+    }
+    else
+    {
+        /* MISRA Empty Body */
+    }
 }
 
 /**
- * @brief Check non-null optional fields in the Jobs_UpdateMsg request
- * for validity.
+ * @brief Append an optional string or JSON member to a message.
  *
- * @param request A JobsUpdateRequest_t containing the optional fields.
- * @return true Optional fields appear valid.
- * @return false Optional fields are invalid.
+ * @param[in] buffer  The buffer to be written, may be NULL.
+ * @param[in,out] start  The index at which to begin.
+ * @param[in] max  The size of the buffer.
+ * @param[in] key  The member key.
+ * @param[in] keyLength  The length of the key.
+ * @param[in] value  The member value, NULL to omit the member.
+ * @param[in] valueLength  The length of the value, 0 to omit the member.
+ * @param[in] quoted  Set to true for string values.
  */
-static bool areOptionalFieldsValid( JobsUpdateRequest_t request )
+static void writeOptionalMember( char * buffer,
+                                 size_t * start,
+                                 size_t max,
+                                 const char * key,
+                                 size_t keyLength,
+                                 const char * value,
+                                 size_t valueLength,
+                                 bool quoted )
 {
-    bool optionalFieldsValid = true;
+    if( ( value != NULL ) && ( valueLength > 0U ) )
+    {
+        writeMember( buffer, start, max, key, keyLength, value, valueLength, quoted );
+    }
+}
 
-    if( ( request.statusDetails != NULL ) && ( request.statusDetailsLength > 0U ) )
+/**
+ * @brief Close the JSON object of a message.
+ *
+ * A message without members is written as an empty object.
+ *
+ * @param[in] buffer  The buffer to be written, may be NULL.
+ * @param[in,out] start  The index at which to begin.
+ * @param[in] max  The size of the buffer.
+ */
+static void writeEnd( char * buffer,
+                      size_t * start,
+                      size_t max )
+{
+    if( *start == 0U )
+    {
+        writeChars( buffer, start, max, "{}", CONST_STRLEN( "{}" ) );
+    }
+    else
     {
-        optionalFieldsValid = ( JSONSuccess == JSON_Validate( request.statusDetails, request.statusDetailsLength ) );
+        writeChars( buffer, start, max, "}", CONST_STRLEN( "}" ) );
     }
+}
 
-    return optionalFieldsValid;
+/**
+ * @brief Write the members shared by every request message.
+ *
+ * @param[in] buffer  The buffer to be written, may be NULL.
+ * @param[in,out] start  The index at which to begin.
+ * @param[in] max  The size of the buffer.
+ * @param[in] clientToken  The client token, may be NULL.
+ * @param[in] clientTokenLength  The length of the client token.
+ */
+static void writeClientTokenAndEnd( char * buffer,
+                                    size_t * start,
+                                    size_t max,
+                                    const char * clientToken,
+                                    size_t clientTokenLength )
+{
+    writeOptionalMember( buffer, start, max, "clientToken", CONST_STRLEN( "clientToken" ),
+                         clientToken, clientTokenLength, true );
+    writeEnd( buffer, start, max );
+}
+
+/**
+ * @brief Write an UpdateJobExecution request message.
+ *
+ * @param[in] buffer  The buffer to be written, may be NULL.
+ * @param[in,out] start  The index at which to begin.
+ * @param[in] max  The size of the buffer.
+ * @param[in] request  The update request.
+ * @param[in] options  The request options, may be NULL.
+ */
+static void writeUpdateMsg( char * buffer,
+                            size_t * start,
+                            size_t max,
+                            const JobsUpdateRequest_t * request,
+                            const JobsUpdateOptions_t * options )
+{
+    const char * status = jobStatusString[ request->status ];
+
+    writeMember( buffer, start, max, "status", CONST_STRLEN( "status" ),
+                 status, strlen( status ), true );
+    writeOptionalMember( buffer, start, max, "expectedVersion", CONST_STRLEN( "expectedVersion" ),
+                         request->expectedVersion, request->expectedVersionLength, true );
+
+    if( options != NULL )
+    {
+        writeUintMember( buffer, start, max, "executionNumber", CONST_STRLEN( "executionNumber" ),
+                         options->executionNumber );
+        writeBoolMember( buffer, start, max, "includeJobExecutionState", CONST_STRLEN( "includeJobExecutionState" ),
+                         options->includeJobExecutionState );
+        writeBoolMember( buffer, start, max, "includeJobDocument", CONST_STRLEN( "includeJobDocument" ),
+                         options->includeJobDocument );
+        writeUintMember( buffer, start, max, "stepTimeoutInMinutes", CONST_STRLEN( "stepTimeoutInMinutes" ),
+                         options->stepTimeoutInMinutes );
+    }
+
+    writeOptionalMember( buffer, start, max, "statusDetails", CONST_STRLEN( "statusDetails" ),
+                         request->statusDetails, request->statusDetailsLength, false );
+
+    if( options != NULL )
+    {
+        writeClientTokenAndEnd( buffer, start, max, options->clientToken, options->clientTokenLength );
+    }
+    else
+    {
+        writeEnd( buffer, start, max );
+    }
+}
+
+/**
+ * @brief Write a StartNextPendingJobExecution request message.
+ *
+ * @param[in] buffer  The buffer to be written, may be NULL.
+ * @param[in,out] start  The index at which to begin.
+ * @param[in] max  The size of the buffer.
+ * @param[in] request  The start next request.
+ */
+static void writeStartNextMsg( char * buffer,
+                               size_t * start,
+                               size_t max,
+                               const JobsStartNextRequest_t * request )
+{
+    writeOptionalMember( buffer, start, max, "statusDetails", CONST_STRLEN( "statusDetails" ),
+                         request->statusDetails, request->statusDetailsLength, false );
+    writeUintMember( buffer, start, max, "stepTimeoutInMinutes", CONST_STRLEN( "stepTimeoutInMinutes" ),
+                     request->stepTimeoutInMinutes );
+    writeClientTokenAndEnd( buffer, start, max, request->clientToken, request->clientTokenLength );
+}
+
+/**
+ * @brief Write a DescribeJobExecution request message.
+ *
+ * @param[in] buffer  The buffer to be written, may be NULL.
+ * @param[in,out] start  The index at which to begin.
+ * @param[in] max  The size of the buffer.
+ * @param[in] request  The describe request.
+ */
+static void writeDescribeMsg( char * buffer,
+                              size_t * start,
+                              size_t max,
+                              const JobsDescribeRequest_t * request )
+{
+    writeUintMember( buffer, start, max, "executionNumber", CONST_STRLEN( "executionNumber" ),
+                     request->executionNumber );
+    writeBoolMember( buffer, start, max, "includeJobDocument", CONST_STRLEN( "includeJobDocument" ),
+                     request->includeJobDocument );
+    writeClientTokenAndEnd( buffer, start, max, request->clientToken, request->clientTokenLength );
+}
+
+/**
+ * @brief Predicate returns true for a valid optional client token.
+ *
+ * A client token is embedded in a JSON string without escaping, so
+ * quotes, backslashes and control characters are rejected.
+ *
+ * @param[in] clientToken  The client token, may be NULL.
+ * @param[in] clientTokenLength  The length of the client token.
+ *
+ * @return true if the token is absent or valid;
+ * false otherwise
+ */
+static bool isValidClientToken( const char * clientToken,
+                                size_t clientTokenLength )
+{
+    bool ret = true;
+    size_t i;
+
+    if( ( clientToken != NULL ) && ( clientTokenLength > 0U ) )
+    {
+        ret = ( clientTokenLength <= JOBS_CLIENT_TOKEN_MAX_LENGTH ) ? true : false;
+
+        for( i = 0U; ( ret == true ) && ( i < clientTokenLength ); i++ )
+        {
+            if( ( clientToken[ i ] == '"' ) || ( clientToken[ i ] == '\\' ) ||
+                ( ( uint8_t ) clientToken[ i ] < 0x20U ) )
+            {
+                ret = false;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Predicate returns true for a valid optional status details object.
+ *
+ * @param[in] statusDetails  The status details, may be NULL.
+ * @param[in] statusDetailsLength  The length of the status details.
+ *
+ * @return true if the status details are absent or valid JSON;
+ * false otherwise
+ */
+static bool isValidStatusDetails( const char * statusDetails,
+                                  size_t statusDetailsLength )
+{
+    bool ret = true;
+
+    if( ( statusDetails != NULL ) && ( statusDetailsLength > 0U ) )
+    {
+        ret = ( JSONSuccess == JOBS_TRACE_JSON_VALIDATE( statusDetails, statusDetailsLength ) );
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Write a message after computing its length.
+ *
+ * @param[in] buffer  The buffer to be written, NULL to only compute the length.
+ * @param[in] bufferSize  The size of the buffer.
+ * @param[in] requiredLength  The length computed by a writer with a NULL buffer.
+ * @param[in] written  The number of characters written to a non-NULL buffer.
+ *
+ * @return The message length, or 0 if the buffer is too small.
+ */
+static size_t messageLength( const char * buffer,
+                             size_t bufferSize,
+                             size_t requiredLength,
+                             size_t written )
+{
+    size_t ret = 0U;
+
+    if( buffer == NULL )
+    {
+        ret = requiredLength;
+    }
+    else if( bufferSize >= requiredLength )
+    {
+        ret = written;
+    }
+    else
+    {
+        /* The message did not fit. */
+        JOBS_STATS_ADD( JobsStatsBufferTooSmall, 1U );
+        JOBS_LOG_WARN( JobsLogMessageTooLong, requiredLength, bufferSize );
+    }
+
+    return ret;
+}
+
+/** @endcond */
+
+/**
+ * See jobs_internal.h for docs.
+ *
+ * @brief Convert an unsigned integer to decimal characters.
+ */
+size_t Jobs_UintToString( uint32_t value,
+                          char * buffer,
+                          size_t bufferSize )
+{
+    char digits[ JOBS_UINT32_STRING_MAX_LENGTH ];
+    size_t count = 0U;
+    size_t i;
+    uint32_t remaining = value;
+
+    do
+    {
+        digits[ count ] = ( char ) ( ( uint32_t ) '0' + ( remaining % 10U ) );
+        remaining /= 10U;
+        count++;
+    } while( remaining > 0U );
+
+    if( ( buffer != NULL ) && ( bufferSize >= count ) )
+    {
+        for( i = 0U; i < count; i++ )
+        {
+            buffer[ i ] = digits[ count - 1U - i ];
+        }
+    }
+    else
+    {
+        count = 0U;
+    }
+
+    return count;
+}
+
+/**
+ * See jobs_internal.h for docs.
+ *
+ * @brief Convert decimal characters to an unsigned integer.
+ */
+JobsStatus_t Jobs_StringToUint( const char * string,
+                                size_t stringLength,
+                                uint32_t * outValue )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    uint32_t value = 0U;
+    uint32_t digit;
+    size_t i;
+
+    if( ( string != NULL ) && ( stringLength > 0U ) && ( outValue != NULL ) )
+    {
+        ret = ( stringLength <= JOBS_UINT32_STRING_MAX_LENGTH ) ? JobsSuccess : JobsNoMatch;
+
+        for( i = 0U; ( ret == JobsSuccess ) && ( i < stringLength ); i++ )
+        {
+            digit = ( uint32_t ) string[ i ] - ( uint32_t ) '0';
+
+            if( ( digit > 9U ) || ( value > ( ( UINT32_MAX - digit ) / 10U ) ) )
+            {
+                ret = JobsNoMatch;
+            }
+            else
+            {
+                value = ( value * 10U ) + digit;
+            }
+        }
+
+        if( ret == JobsSuccess )
+        {
+            *outValue = value;
+        }
+    }
+
+    JOBS_LOG_STATUS( JobsLogStringToUint, ret, stringLength );
+
+    return ret;
+}
+
+/**
+ * See jobs_internal.h for docs.
+ *
+ * @brief Convert a job execution status string to its status code.
+ */
+JobsStatus_t Jobs_StatusFromString( const char * string,
+                                    size_t stringLength,
+                                    JobCurrentStatus_t * outStatus )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    size_t i;
+
+    if( ( string != NULL ) && ( outStatus != NULL ) )
+    {
+        ret = JobsNoMatch;
+
+        for( i = 0U; ( ret == JobsNoMatch ) && ( i < ARRAY_LENGTH( jobStatusString ) ); i++ )
+        {
+            if( ( strlen( jobStatusString[ i ] ) == stringLength ) &&
+                ( strncmp( jobStatusString[ i ], string, stringLength ) == 0 ) )
+            {
+                *outStatus = ( JobCurrentStatus_t ) i;
+                ret = JobsSuccess;
+            }
+        }
+    }
+
+    JOBS_LOG_STATUS( JobsLogStatusFromString, ret, stringLength );
+
+    return ret;
+}
+
+/**
+ * See jobs_internal.h for docs.
+ *
+ * @brief Continue a 32-bit FNV-1a hash over bytes.
+ */
+uint32_t Jobs_Fnv1a( uint32_t hash,
+                     const void * data,
+                     size_t length )
+{
+    const uint8_t * bytes = ( const uint8_t * ) data;
+    uint32_t ret = hash;
+    size_t i;
+
+    for( i = 0U; i < length; i++ )
+    {
+        ret ^= ( uint32_t ) bytes[ i ];
+        ret *= 16777619U;
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_internal.h for docs.
+ *
+ * @brief Continue a 64-bit FNV-1a hash over bytes.
+ */
+uint64_t Jobs_Fnv1a64( uint64_t hash,
+                       const void * data,
+                       size_t length )
+{
+    const uint8_t * bytes = ( const uint8_t * ) data;
+    uint64_t ret = hash;
+    size_t i;
+
+    for( i = 0U; i < length; i++ )
+    {
+        ret ^= ( uint64_t ) bytes[ i ];
+        ret *= 1099511628211U;
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_internal.h for docs.
+ *
+ * @brief Check whether a deadline has been reached on a clock that wraps.
+ */
+bool Jobs_IsDeadlineReached( uint32_t now,
+                             uint32_t deadline )
+{
+    return ( ( uint32_t ) ( now - deadline ) < 0x80000000U ) ? true : false;
 }
 
 size_t Jobs_UpdateMsg( JobsUpdateRequest_t request,
                        char * buffer,
                        size_t bufferSize )
 {
+    size_t ret;
+
+    JOBS_TRACE_ENTER();
+
     assert( ( ( size_t ) request.status ) < ARRAY_LENGTH( jobStatusString ) );
 
+    ret = ( buffer != NULL ) ? Jobs_UpdateMsgWithOptions( request, NULL, buffer, bufferSize ) : 0U;
+    JOBS_TRACE_EXIT( JobsTraceUpdateMsg, ret, ret );
+
+    return ret;
+}
+
+/**
+ * See jobs.h for docs.
+ *
+ * @brief Populate a message string for an UpdateJobExecution request with
+ * optional fields.
+ */
+size_t Jobs_UpdateMsgWithOptions( JobsUpdateRequest_t request,
+                                  const JobsUpdateOptions_t * options,
+                                  char * buffer,
+                                  size_t bufferSize )
+{
+    size_t requiredLength = 0U;
     size_t start = 0U;
-    size_t minimumBufferSize = getRequiredFieldsLength( request ) + getOptionalFieldsLength( request );
-    bool writeFailed = ( bufferSize < minimumBufferSize ) || !areOptionalFieldsValid( request );
+    size_t ret;
+    bool valid;
+
+    JOBS_TRACE_ENTER();
 
-    if( !writeFailed )
+    assert( ( ( size_t ) request.status ) < ARRAY_LENGTH( jobStatusString ) );
+
+    valid = isValidStatusDetails( request.statusDetails, request.statusDetailsLength );
+
+    if( ( valid == true ) && ( options != NULL ) )
+    {
+        valid = isValidClientToken( options->clientToken, options->clientTokenLength ) &&
+                ( options->stepTimeoutInMinutes <= JOBS_STEP_TIMEOUT_MAX_MINUTES );
+    }
+
+    if( valid == true )
     {
-        ( void ) strnAppend( buffer, &start, bufferSize, JOBS_API_STATUS, JOBS_API_STATUS_LENGTH );
-        ( void ) strnAppend( buffer, &start, bufferSize, jobStatusString[ request.status ], strlen( jobStatusString[ request.status ] ) );
+        writeUpdateMsg( NULL, &requiredLength, 0U, &request, options );
 
-        /* This is an optional field so do not fail if expected version is missing.*/
-        if( ( request.expectedVersion != NULL ) && ( request.expectedVersionLength > 0U ) )
+        if( ( buffer != NULL ) && ( bufferSize >= requiredLength ) )
         {
-            ( void ) strnAppend( buffer, &start, bufferSize, JOBS_API_EXPECTED_VERSION, JOBS_API_EXPECTED_VERSION_LENGTH );
-            ( void ) strnAppend( buffer, &start, bufferSize, request.expectedVersion, request.expectedVersionLength );
+            writeUpdateMsg( buffer, &start, bufferSize, &request, options );
         }
+    }
+    else
+    {
+        JOBS_LOG_ERROR( JobsLogUpdateMsgInvalid, request.statusDetailsLength,
+                        ( options != NULL ) ? options->stepTimeoutInMinutes : 0U );
+    }
+
+    ret = messageLength( buffer, bufferSize, requiredLength, start );
+    JOBS_STATS_ADD( JobsStatsUpdateMessages, ( ( buffer != NULL ) && ( ret > 0U ) ) ? 1U : 0U );
+    JOBS_TRACE_EXIT( JobsTraceUpdateMsgWithOptions, ret, ret );
+
+    return ret;
+}
 
-        /* This is an optional field so do not fail if status details is missing.*/
-        if( ( request.statusDetails != NULL ) && ( request.statusDetailsLength > 0U ) )
+/**
+ * See jobs.h for docs.
+ *
+ * @brief Populate a message string for a StartNextPendingJobExecution request
+ * with optional fields.
+ */
+size_t Jobs_StartNextMsgWithOptions( const JobsStartNextRequest_t * request,
+                                     char * buffer,
+                                     size_t bufferSize )
+{
+    size_t requiredLength = 0U;
+    size_t start = 0U;
+    size_t ret;
+
+    JOBS_TRACE_ENTER();
+
+    if( ( request != NULL ) &&
+        ( isValidClientToken( request->clientToken, request->clientTokenLength ) == true ) &&
+        ( isValidStatusDetails( request->statusDetails, request->statusDetailsLength ) == true ) &&
+        ( request->stepTimeoutInMinutes <= JOBS_STEP_TIMEOUT_MAX_MINUTES ) )
+    {
+        writeStartNextMsg( NULL, &requiredLength, 0U, request );
+
+        if( ( buffer != NULL ) && ( bufferSize >= requiredLength ) )
         {
-            ( void ) strnAppend( buffer, &start, bufferSize, JOBS_API_STATUS_DETAILS, JOBS_API_STATUS_DETAILS_LENGTH );
-            ( void ) strnAppend( buffer, &start, bufferSize, request.statusDetails, request.statusDetailsLength );
+            writeStartNextMsg( buffer, &start, bufferSize, request );
+        }
+    }
+    else
+    {
+        JOBS_LOG_ERROR( JobsLogStartNextMsgInvalid, ( request != NULL ) ? request->clientTokenLength : 0U, 0U );
+    }
+
+    ret = messageLength( buffer, bufferSize, requiredLength, start );
+    JOBS_TRACE_EXIT( JobsTraceStartNextMsgWithOptions, ret, ret );
+
+    return ret;
+}
 
-            ( void ) strnAppend( buffer, &start, bufferSize, "}", ( CONST_STRLEN( "}" ) ) );
+/**
+ * See jobs.h for docs.
+ *
+ * @brief Populate a message string for a DescribeJobExecution request.
+ */
+size_t Jobs_DescribeMsg( const JobsDescribeRequest_t * request,
+                         char * buffer,
+                         size_t bufferSize )
+{
+    size_t requiredLength = 0U;
+    size_t start = 0U;
+    size_t ret;
+
+    JOBS_TRACE_ENTER();
+
+    if( ( request != NULL ) &&
+        ( isValidClientToken( request->clientToken, request->clientTokenLength ) == true ) )
+    {
+        writeDescribeMsg( NULL, &requiredLength, 0U, request );
+
+        if( ( buffer != NULL ) && ( bufferSize >= requiredLength ) )
+        {
+            writeDescribeMsg( buffer, &start, bufferSize, request );
         }
-        else
+    }
+    else
+    {
+        JOBS_LOG_ERROR( JobsLogDescribeMsgInvalid, ( request != NULL ) ? request->clientTokenLength : 0U, 0U );
+    }
+
+    ret = messageLength( buffer, bufferSize, requiredLength, start );
+    JOBS_TRACE_EXIT( JobsTraceDescribeMsg, ret, ret );
+
+    return ret;
+}
+
+/**
+ * See jobs.h for docs.
+ *
+ * @brief Populate a message string for a GetPendingJobExecutions request.
+ */
+size_t Jobs_GetPendingMsg( const JobsGetPendingRequest_t * request,
+                           char * buffer,
+                           size_t bufferSize )
+{
+    size_t requiredLength = 0U;
+    size_t start = 0U;
+    size_t ret;
+
+    JOBS_TRACE_ENTER();
+
+    if( ( request != NULL ) &&
+        ( isValidClientToken( request->clientToken, request->clientTokenLength ) == true ) )
+    {
+        writeClientTokenAndEnd( NULL, &requiredLength, 0U, request->clientToken, request->clientTokenLength );
+
+        if( ( buffer != NULL ) && ( bufferSize >= requiredLength ) )
         {
-            ( void ) strnAppend( buffer, &start, bufferSize, "\"}", ( CONST_STRLEN( "\"}" ) ) );
+            writeClientTokenAndEnd( buffer, &start, bufferSize, request->clientToken, request->clientTokenLength );
         }
     }
+    else
+    {
+        JOBS_LOG_ERROR( JobsLogGetPendingMsgInvalid, ( request != NULL ) ? request->clientTokenLength : 0U, 0U );
+    }
 
-    return start;
+    ret = messageLength( buffer, bufferSize, requiredLength, start );
+    JOBS_TRACE_EXIT( JobsTraceGetPendingMsg, ret, ret );
+
+    return ret;
 }
 
 bool Jobs_IsStartNextAccepted( const char * topic,
@@ -923,7 +1605,20 @@ bool Jobs_IsStartNextAccepted( const char * topic,
                                const char * thingName,
                                const size_t thingNameLength )
 {
-    return isThingnameTopicMatch( topic, topicLength, "start-next/accepted", strlen( "start-next/accepted" ), thingName, thingNameLength );
+    bool ret;
+
+    JOBS_TRACE_ENTER();
+
+    ret = isThingnameTopicMatch( topic, topicLength, "start-next/accepted", strlen( "start-next/accepted" ), thingName, thingNameLength );
+
+    if( ret == false )
+    {
+        JOBS_LOG_DEBUG( JobsLogIsStartNextAccepted, topicLength, 0U );
+    }
+
+    JOBS_TRACE_EXIT( JobsTraceIsStartNextAccepted, topicLength, ret );
+
+    return ret;
 }
 
 bool Jobs_IsJobUpdateStatus( const char * topic,
@@ -952,12 +1647,41 @@ bool Jobs_IsJobUpdateStatus( const char * topic,
     size_t suffixBufferLength = ( TOPIC_BUFFER_SIZE - CONST_STRLEN( "$aws/<thingname>" ) );
     char suffixBuffer[ TOPIC_BUFFER_SIZE - CONST_STRLEN( "$aws/<thingname>" ) ] = { '\0' };
     size_t start = 0U;
+    bool ret;
+
+    JOBS_TRACE_ENTER();
 
     ( void ) strnAppend( suffixBuffer, &start, suffixBufferLength, jobId, jobIdLength );
     ( void ) strnAppend( suffixBuffer, &start, suffixBufferLength, "/update/", ( CONST_STRLEN( "/update/" ) ) );
     ( void ) strnAppend( suffixBuffer, &start, suffixBufferLength, jobUpdateStatusString[ expectedStatus ], jobUpdateStatusStringLengths[ expectedStatus ] );
 
-    return isThingnameTopicMatch( topic, topicLength, suffixBuffer, strnlen( suffixBuffer, suffixBufferLength ), thingName, thingNameLength );
+    ret = isThingnameTopicMatch( topic, topicLength, suffixBuffer, strnlen( suffixBuffer, suffixBufferLength ), thingName, thingNameLength );
+
+    if( ret == false )
+    {
+        JOBS_LOG_DEBUG( JobsLogIsJobUpdateStatus, topicLength, expectedStatus );
+    }
+
+    JOBS_TRACE_EXIT( JobsTraceIsJobUpdateStatus, topicLength, ret );
+
+    return ret;
+}
+
+bool Jobs_IsTerminalStatus( JobCurrentStatus_t status )
+{
+    return ( ( status == Failed ) || ( status == Succeeded ) || ( status == Rejected ) ) ? true : false;
+}
+
+bool Jobs_IsValidJobId( const char * jobId,
+                        uint16_t jobIdLength )
+{
+    return isValidJobId( jobId, jobIdLength );
+}
+
+bool Jobs_IsValidThingName( const char * thingName,
+                            uint16_t thingNameLength )
+{
+    return isValidThingName( thingName, thingNameLength );
 }
 
 size_t Jobs_GetJobId( const char * message,
@@ -967,19 +1691,32 @@ size_t Jobs_GetJobId( const char * message,
     size_t jobIdLength = 0U;
     JSONStatus_t jsonResult = JSONNotFound;
 
-    jsonResult = JSON_Validate( message, messageLength );
+    JOBS_TRACE_ENTER();
+
+    jsonResult = JOBS_TRACE_JSON_VALIDATE( message, messageLength );
 
     if( jsonResult == JSONSuccess )
     {
-        jsonResult = JSON_SearchConst( message,
-                                       messageLength,
-                                       "execution.jobId",
-                                       CONST_STRLEN( "execution.jobId" ),
-                                       jobId,
-                                       &jobIdLength,
-                                       NULL );
+        jsonResult = JOBS_TRACE_JSON_SEARCH( message,
+                                             messageLength,
+                                             "execution.jobId",
+                                             CONST_STRLEN( "execution.jobId" ),
+                                             jobId,
+                                             &jobIdLength,
+                                             NULL );
+
+        if( jsonResult != JSONSuccess )
+        {
+            JOBS_LOG_DEBUG( JobsLogNoJobId, messageLength, jsonResult );
+        }
+    }
+    else
+    {
+        JOBS_LOG_WARN( JobsLogInvalidJson, messageLength, jsonResult );
     }
 
+    JOBS_TRACE_EXIT( JobsTraceGetJobId, messageLength, jobIdLength );
+
     return jobIdLength;
 }
 
@@ -990,18 +1727,31 @@ size_t Jobs_GetJobDocument( const char * message,
     size_t jobDocLength = 0U;
     JSONStatus_t jsonResult = JSONNotFound;
 
-    jsonResult = JSON_Validate( message, messageLength );
+    JOBS_TRACE_ENTER();
+
+    jsonResult = JOBS_TRACE_JSON_VALIDATE( message, messageLength );
 
     if( jsonResult == JSONSuccess )
     {
-        jsonResult = JSON_SearchConst( message,
-                                       messageLength,
-                                       "execution.jobDocument",
-                                       CONST_STRLEN( "execution.jobDocument" ),
-                                       jobDoc,
-                                       &jobDocLength,
-                                       NULL );
+        jsonResult = JOBS_TRACE_JSON_SEARCH( message,
+                                             messageLength,
+                                             "execution.jobDocument",
+                                             CONST_STRLEN( "execution.jobDocument" ),
+                                             jobDoc,
+                                             &jobDocLength,
+                                             NULL );
+
+        if( jsonResult != JSONSuccess )
+        {
+            JOBS_LOG_DEBUG( JobsLogNoJobDocument, messageLength, jsonResult );
+        }
+    }
+    else
+    {
+        JOBS_LOG_WARN( JobsLogInvalidJson, messageLength, jsonResult );
     }
 
+    JOBS_TRACE_EXIT( JobsTraceGetJobDocument, messageLength, jobDocLength );
+
     return jobDocLength;
 }
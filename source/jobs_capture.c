@@ -0,0 +1,318 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_capture.c
+ * @brief Implementation of the APIs from jobs_capture.h.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Internal Includes */
+#include "jobs_capture.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief Version of the capture format.
+ */
+#define CAPTURE_VERSION       1U
+
+/**
+ * @brief Largest size of a LEB128 encoded 32-bit integer.
+ */
+#define VARINT_MAX_SIZE       5U
+
+/**
+ * @brief Check common parameters.
+ */
+#define checkCapture() \
+    ( ( capture != NULL ) && ( capture->sink.write != NULL ) )
+
+/**
+ * @brief The header of a capture.
+ */
+static const uint8_t captureHeader[ JOBS_CAPTURE_HEADER_SIZE ] =
+{
+    ( uint8_t ) 'J', ( uint8_t ) 'C', ( uint8_t ) 'A', ( uint8_t ) 'P', CAPTURE_VERSION, 0U, 0U, 0U
+};
+
+/**
+ * @brief Encode an integer as LEB128.
+ *
+ * @param[in] value  The integer.
+ * @param[out] buffer  The buffer, at least #VARINT_MAX_SIZE bytes.
+ *
+ * @return The number of bytes written.
+ */
+static size_t encodeVarint( uint32_t value,
+                            uint8_t * buffer )
+{
+    uint32_t rest = value;
+    size_t length = 0U;
+
+    while( rest >= 0x80U )
+    {
+        buffer[ length ] = ( uint8_t ) ( ( rest & 0x7FU ) | 0x80U );
+        rest >>= 7;
+        length++;
+    }
+
+    buffer[ length ] = ( uint8_t ) rest;
+
+    return length + 1U;
+}
+
+/**
+ * @brief Decode a LEB128 integer of a replay.
+ *
+ * @param[in] replay  The replay, the offset is advanced past the integer.
+ * @param[out] outValue  The integer.
+ *
+ * @return #JobsSuccess if the integer was decoded;
+ * #JobsNoMatch if the capture ends within the integer;
+ * #JobsError if the integer does not fit 32 bits.
+ */
+static JobsStatus_t decodeVarint( JobsReplay_t * replay,
+                                  uint32_t * outValue )
+{
+    uint32_t value = 0U;
+    uint8_t byte = 0x80U;
+    size_t i;
+    JobsStatus_t ret = JobsNoMatch;
+
+    for( i = 0U; ( i < VARINT_MAX_SIZE ) && ( ( byte & 0x80U ) != 0U ) &&
+         ( replay->offset < replay->length ); i++ )
+    {
+        byte = replay->data[ replay->offset ];
+        replay->offset++;
+        value |= ( uint32_t ) ( byte & 0x7FU ) << ( 7U * i );
+    }
+
+    if( ( byte & 0x80U ) == 0U )
+    {
+        /* The fifth byte holds the top 4 bits. */
+        ret = ( ( i == VARINT_MAX_SIZE ) && ( byte > 0x0FU ) ) ? JobsError : JobsSuccess;
+        *outValue = value;
+    }
+    else if( i == VARINT_MAX_SIZE )
+    {
+        ret = JobsError;
+    }
+    else
+    {
+        /* MISRA Empty Body */
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Check a topic is under the Jobs API of a thing.
+ *
+ * @param[in] topic  The topic.
+ * @param[in] topicLength  The length of the topic.
+ *
+ * @return true if the topic starts with the Jobs API prefix of a thing.
+ */
+static bool isJobsTopic( const char * topic,
+                         size_t topicLength )
+{
+    size_t i = JOBS_API_PREFIX_LENGTH;
+    bool ret = false;
+
+    if( ( topicLength > ( JOBS_API_PREFIX_LENGTH + JOBS_API_BRIDGE_LENGTH ) ) &&
+        ( strncmp( topic, JOBS_API_PREFIX, JOBS_API_PREFIX_LENGTH ) == 0 ) )
+    {
+        while( ( i < topicLength ) && ( topic[ i ] != '/' ) )
+        {
+            i++;
+        }
+
+        ret = ( ( i > JOBS_API_PREFIX_LENGTH ) &&
+                ( ( topicLength - i ) > JOBS_API_BRIDGE_LENGTH ) &&
+                ( strncmp( &topic[ i ], JOBS_API_BRIDGE, JOBS_API_BRIDGE_LENGTH ) == 0 ) ) ? true : false;
+    }
+
+    return ret;
+}
+
+/** @endcond */
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_capture.h for docs.
+ *
+ * @brief Start a capture by writing its header to a sink.
+ */
+JobsStatus_t Jobs_CaptureInit( JobsCapture_t * capture,
+                               const JobsCaptureSink_t * sink )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( ( capture != NULL ) && ( sink != NULL ) && ( sink->write != NULL ) )
+    {
+        capture->sink = *sink;
+        capture->lastTimestampMs = 0U;
+        capture->recordCount = 0U;
+
+        ret = ( sink->write( sink->pContext, captureHeader, sizeof( captureHeader ) ) ==
+                sizeof( captureHeader ) ) ? JobsSuccess : JobsError;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_capture.h for docs.
+ *
+ * @brief Record a message received on a Jobs topic.
+ */
+JobsStatus_t Jobs_CaptureRecord( JobsCapture_t * capture,
+                                 uint32_t timestampMs,
+                                 const char * topic,
+                                 size_t topicLength,
+                                 const char * payload,
+                                 size_t payloadLength )
+{
+    uint8_t header[ JOBS_CAPTURE_RECORD_OVERHEAD ];
+    size_t headerLength;
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkCapture() && ( topic != NULL ) && ( topicLength <= UINT32_MAX ) &&
+        ( ( payload != NULL ) || ( payloadLength == 0U ) ) && ( payloadLength <= UINT32_MAX ) )
+    {
+        ret = JobsNoMatch;
+
+        if( isJobsTopic( topic, topicLength ) )
+        {
+            /* The first record holds the time since 0. */
+            headerLength = encodeVarint( timestampMs - capture->lastTimestampMs, header );
+            headerLength += encodeVarint( ( uint32_t ) topicLength, &header[ headerLength ] );
+            headerLength += encodeVarint( ( uint32_t ) payloadLength, &header[ headerLength ] );
+
+            ret = ( ( capture->sink.write( capture->sink.pContext, header, headerLength ) == headerLength ) &&
+                    ( capture->sink.write( capture->sink.pContext, ( const uint8_t * ) topic,
+                                           topicLength ) == topicLength ) &&
+                    ( ( payloadLength == 0U ) ||
+                      ( capture->sink.write( capture->sink.pContext, ( const uint8_t * ) payload,
+                                             payloadLength ) == payloadLength ) ) ) ? JobsSuccess : JobsError;
+
+            capture->lastTimestampMs = timestampMs;
+            capture->recordCount++;
+        }
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_capture.h for docs.
+ *
+ * @brief Start reading a capture.
+ */
+JobsStatus_t Jobs_ReplayInit( JobsReplay_t * replay,
+                              const uint8_t * data,
+                              size_t length )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( ( replay != NULL ) && ( data != NULL ) && ( length >= JOBS_CAPTURE_HEADER_SIZE ) &&
+        ( memcmp( data, captureHeader, JOBS_CAPTURE_HEADER_SIZE ) == 0 ) )
+    {
+        replay->data = data;
+        replay->length = length;
+        replay->offset = JOBS_CAPTURE_HEADER_SIZE;
+        replay->lastTimestampMs = 0U;
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_capture.h for docs.
+ *
+ * @brief Read the next message of a capture.
+ */
+JobsStatus_t Jobs_ReplayNext( JobsReplay_t * replay,
+                              JobsCaptureRecord_t * outRecord )
+{
+    size_t start;
+    uint32_t delta = 0U;
+    uint32_t topicLength = 0U;
+    uint32_t payloadLength = 0U;
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( ( replay != NULL ) && ( replay->data != NULL ) && ( outRecord != NULL ) )
+    {
+        start = replay->offset;
+        ret = decodeVarint( replay, &delta );
+
+        if( ret == JobsSuccess )
+        {
+            ret = decodeVarint( replay, &topicLength );
+        }
+
+        if( ret == JobsSuccess )
+        {
+            ret = decodeVarint( replay, &payloadLength );
+        }
+
+        if( ( ret == JobsSuccess ) &&
+            ( ( replay->length - replay->offset ) < ( ( size_t ) topicLength + payloadLength ) ) )
+        {
+            ret = JobsNoMatch;
+        }
+
+        if( ret == JobsSuccess )
+        {
+            replay->lastTimestampMs += delta;
+            outRecord->timestampMs = replay->lastTimestampMs;
+            outRecord->topic = ( const char * ) &replay->data[ replay->offset ];
+            outRecord->topicLength = topicLength;
+            outRecord->payload = ( const char * ) &replay->data[ replay->offset + topicLength ];
+            outRecord->payloadLength = payloadLength;
+            replay->offset += ( size_t ) topicLength + payloadLength;
+        }
+        else
+        {
+            /* Stay at the end of the capture. */
+            replay->offset = start;
+        }
+    }
+
+    return ret;
+}
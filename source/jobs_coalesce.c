@@ -0,0 +1,473 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_coalesce.c
+ * @brief Implementation of the APIs from jobs_coalesce.h.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Internal Includes */
+#include "jobs_coalesce.h"
+#include "jobs_trace.h"
+/* External Dependencies */
+#include "core_json.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief Output of the status details being merged.
+ */
+typedef struct
+{
+    char * buffer;  /**< @brief Merged status details. */
+    size_t length;  /**< @brief Characters written, or needed. */
+    size_t members; /**< @brief Members written. */
+} MergeOutput_t;
+
+/**
+ * @brief Append characters to the merge output.
+ *
+ * Once the output is full, only the needed length is counted.
+ *
+ * @param[in] out  The merge output.
+ * @param[in] value  The characters to append.
+ * @param[in] valueLength  The number of characters.
+ */
+static void mergeAppend( MergeOutput_t * out,
+                         const char * value,
+                         size_t valueLength )
+{
+    if( ( out->length <= JOBS_COALESCE_STATUS_DETAILS_MAX_LENGTH ) &&
+        ( valueLength <= ( JOBS_COALESCE_STATUS_DETAILS_MAX_LENGTH - out->length ) ) )
+    {
+        ( void ) memcpy( &out->buffer[ out->length ], value, valueLength );
+    }
+
+    out->length += valueLength;
+}
+
+/**
+ * @brief Append a member to the merge output.
+ *
+ * @param[in] out  The merge output.
+ * @param[in] pair  The member, as output by JSON_Iterate().
+ */
+static void mergeMember( MergeOutput_t * out,
+                         const JSONPair_t * pair )
+{
+    mergeAppend( out, ( out->members == 0U ) ? "{\"" : ",\"", 2U );
+    mergeAppend( out, pair->key, pair->keyLength );
+    mergeAppend( out, "\":", 2U );
+
+    /* JSON_Iterate() strips the quotes of string values. */
+    if( pair->jsonType == JSONString )
+    {
+        mergeAppend( out, "\"", 1U );
+        mergeAppend( out, pair->value, pair->valueLength );
+        mergeAppend( out, "\"", 1U );
+    }
+    else
+    {
+        mergeAppend( out, pair->value, pair->valueLength );
+    }
+
+    out->members++;
+}
+
+/**
+ * @brief Find a member of a JSON object by key.
+ *
+ * Keys are compared literally, unlike JSON_SearchConst() which treats
+ * '.' as a separator.
+ *
+ * @param[in] object  The JSON object, may be NULL.
+ * @param[in] objectLength  The length of the object.
+ * @param[in] key  The key.
+ * @param[in] keyLength  The length of the key.
+ * @param[out] outPair  The member found.
+ *
+ * @return true if the object has the key;
+ * false otherwise
+ */
+static bool findMember( const char * object,
+                        size_t objectLength,
+                        const char * key,
+                        size_t keyLength,
+                        JSONPair_t * outPair )
+{
+    bool ret = false;
+    size_t start = 0U;
+    size_t next = 0U;
+
+    while( ( ret == false ) && ( object != NULL ) && ( objectLength > 0U ) &&
+           ( JSON_Iterate( object, objectLength, &start, &next, outPair ) == JSONSuccess ) )
+    {
+        if( ( outPair->keyLength == keyLength ) &&
+            ( memcmp( outPair->key, key, keyLength ) == 0 ) )
+        {
+            ret = true;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Merge status details into the pending status details of a job.
+ *
+ * Members already pending keep their position and take the new value,
+ * new members are appended.
+ *
+ * @param[in] job  The job entry.
+ * @param[in] details  The new status details, a JSON object.
+ * @param[in] detailsLength  The length of the new status details.
+ *
+ * @return true if the merged status details fit the entry;
+ * false otherwise, leaving the entry unchanged
+ */
+static bool mergeDetails( JobsCoalescedJob_t * job,
+                          const char * details,
+                          size_t detailsLength )
+{
+    char merged[ JOBS_COALESCE_STATUS_DETAILS_MAX_LENGTH ];
+    MergeOutput_t out = { merged, 0U, 0U };
+    JSONPair_t pair = { 0 };
+    JSONPair_t update = { 0 };
+    size_t start = 0U;
+    size_t next = 0U;
+
+    if( job->statusDetailsLength > 0U )
+    {
+        while( JSON_Iterate( job->statusDetails, job->statusDetailsLength,
+                             &start, &next, &pair ) == JSONSuccess )
+        {
+            if( findMember( details, detailsLength, pair.key, pair.keyLength, &update ) == true )
+            {
+                mergeMember( &out, &update );
+            }
+            else
+            {
+                mergeMember( &out, &pair );
+            }
+        }
+    }
+
+    start = 0U;
+    next = 0U;
+
+    while( JSON_Iterate( details, detailsLength, &start, &next, &pair ) == JSONSuccess )
+    {
+        if( findMember( job->statusDetails, job->statusDetailsLength,
+                        pair.key, pair.keyLength, &update ) == false )
+        {
+            mergeMember( &out, &pair );
+        }
+    }
+
+    if( out.members > 0U )
+    {
+        mergeAppend( &out, "}", 1U );
+    }
+
+    if( out.length <= JOBS_COALESCE_STATUS_DETAILS_MAX_LENGTH )
+    {
+        ( void ) memcpy( job->statusDetails, merged, out.length );
+        job->statusDetailsLength = out.length;
+    }
+
+    return ( out.length <= JOBS_COALESCE_STATUS_DETAILS_MAX_LENGTH ) ? true : false;
+}
+
+/**
+ * @brief Find the entry of a job, or a free entry.
+ *
+ * @param[in] coalescer  The coalescer.
+ * @param[in] jobId  The job ID.
+ * @param[in] jobIdLength  The length of the job ID.
+ *
+ * @return The entry, or NULL if the job has none and none is free.
+ */
+static JobsCoalescedJob_t * findJob( const JobsCoalescer_t * coalescer,
+                                     const char * jobId,
+                                     uint16_t jobIdLength )
+{
+    JobsCoalescedJob_t * ret = NULL;
+    JobsCoalescedJob_t * freeJob = NULL;
+    size_t i;
+
+    for( i = 0U; ( ret == NULL ) && ( i < coalescer->jobCount ); i++ )
+    {
+        JobsCoalescedJob_t * job = &coalescer->pJobs[ i ];
+
+        if( job->jobIdLength == 0U )
+        {
+            freeJob = ( freeJob == NULL ) ? job : freeJob;
+        }
+        else if( ( job->jobIdLength == jobIdLength ) &&
+                 ( memcmp( job->jobId, jobId, jobIdLength ) == 0 ) )
+        {
+            ret = job;
+        }
+        else
+        {
+            /* MISRA Empty Body */
+        }
+    }
+
+    if( ( ret == NULL ) && ( freeJob != NULL ) )
+    {
+        ret = freeJob;
+        ( void ) memcpy( ret->jobId, jobId, jobIdLength );
+        ret->jobIdLength = jobIdLength;
+        ret->statusDetailsLength = 0U;
+        ret->lastSentMs = 0U;
+        ret->pending = false;
+        ret->sent = false;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Get the time until the pending update of a job is due.
+ *
+ * @param[in] coalescer  The coalescer.
+ * @param[in] job  A job entry with a pending update.
+ * @param[in] nowMs  The current time in milliseconds.
+ *
+ * @return Milliseconds until the update is due, 0 if it is due now.
+ */
+static uint32_t dueDelay( const JobsCoalescer_t * coalescer,
+                          const JobsCoalescedJob_t * job,
+                          uint32_t nowMs )
+{
+    uint32_t ret = 0U;
+    uint32_t elapsed = nowMs - job->lastSentMs;
+
+    if( ( job->sent == true ) && ( job->status == job->sentStatus ) &&
+        ( elapsed < coalescer->intervalMs ) )
+    {
+        ret = coalescer->intervalMs - elapsed;
+    }
+
+    return ret;
+}
+
+#define checkCoalescer() \
+    ( ( coalescer != NULL ) && ( coalescer->pJobs != NULL ) )
+
+/** @endcond */
+
+/**
+ * See jobs_coalesce.h for docs.
+ *
+ * @brief Initialize a coalescer over caller provided entries.
+ */
+JobsStatus_t Jobs_CoalescerInit( JobsCoalescer_t * coalescer,
+                                 JobsCoalescedJob_t * jobs,
+                                 size_t jobCount,
+                                 uint32_t intervalMs )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    size_t i;
+
+    if( ( coalescer != NULL ) && ( jobs != NULL ) && ( jobCount > 0U ) )
+    {
+        coalescer->pJobs = jobs;
+        coalescer->jobCount = jobCount;
+        coalescer->intervalMs = intervalMs;
+
+        for( i = 0U; i < jobCount; i++ )
+        {
+            jobs[ i ].jobIdLength = 0U;
+            jobs[ i ].pending = false;
+        }
+
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_coalesce.h for docs.
+ *
+ * @brief Submit an update for a job.
+ */
+JobsStatus_t Jobs_CoalescerSubmit( JobsCoalescer_t * coalescer,
+                                   const char * jobId,
+                                   uint16_t jobIdLength,
+                                   JobsUpdateRequest_t request )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    JobsCoalescedJob_t * job = NULL;
+    size_t detailsLength = ( request.statusDetails != NULL ) ? request.statusDetailsLength : 0U;
+
+    if( checkCoalescer() && ( Jobs_IsValidJobId( jobId, jobIdLength ) == true ) &&
+        ( ( size_t ) request.status <= ( size_t ) Rejected ) &&
+        ( ( detailsLength == 0U ) ||
+          ( ( request.statusDetails[ 0 ] == '{' ) &&
+            ( JOBS_TRACE_JSON_VALIDATE( request.statusDetails, detailsLength ) == JSONSuccess ) ) ) )
+    {
+        ret = JobsBufferTooSmall;
+        job = findJob( coalescer, jobId, jobIdLength );
+
+        if( ( job != NULL ) &&
+            ( ( detailsLength == 0U ) ||
+              ( mergeDetails( job, request.statusDetails, detailsLength ) == true ) ) )
+        {
+            /* A pending terminal status is never replaced, only its status
+             * details are merged. */
+            if( ( job->pending == false ) || ( Jobs_IsTerminalStatus( job->status ) == false ) )
+            {
+                job->status = request.status;
+            }
+
+            job->pending = true;
+            ret = JobsSuccess;
+        }
+        else if( ( job != NULL ) && ( job->pending == false ) && ( job->sent == false ) )
+        {
+            /* Do not keep an entry claimed for an update that was refused. */
+            job->jobIdLength = 0U;
+        }
+        else
+        {
+            /* MISRA Empty Body */
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_coalesce.h for docs.
+ *
+ * @brief Take the next update that is due.
+ */
+JobsStatus_t Jobs_CoalescerNext( JobsCoalescer_t * coalescer,
+                                 uint32_t nowMs,
+                                 const char ** outJobId,
+                                 uint16_t * outJobIdLength,
+                                 char * buffer,
+                                 size_t bufferSize,
+                                 size_t * outLength )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    JobsCoalescedJob_t * job = NULL;
+    JobsUpdateRequest_t request = { 0 };
+    size_t length = 0U;
+    size_t i;
+
+    if( checkCoalescer() && ( outJobId != NULL ) && ( outJobIdLength != NULL ) &&
+        ( buffer != NULL ) && ( outLength != NULL ) )
+    {
+        ret = JobsNoMatch;
+
+        for( i = 0U; ( job == NULL ) && ( i < coalescer->jobCount ); i++ )
+        {
+            if( ( coalescer->pJobs[ i ].jobIdLength > 0U ) &&
+                ( coalescer->pJobs[ i ].pending == true ) &&
+                ( dueDelay( coalescer, &coalescer->pJobs[ i ], nowMs ) == 0U ) )
+            {
+                job = &coalescer->pJobs[ i ];
+            }
+        }
+
+        if( job != NULL )
+        {
+            request.status = job->status;
+            request.statusDetails = job->statusDetails;
+            request.statusDetailsLength = job->statusDetailsLength;
+            length = Jobs_UpdateMsgWithOptions( request, NULL, buffer, bufferSize );
+            ret = JobsBufferTooSmall;
+        }
+
+        if( length > 0U )
+        {
+            job->pending = false;
+            job->sent = true;
+            job->sentStatus = job->status;
+            job->lastSentMs = nowMs;
+
+            *outJobId = job->jobId;
+            *outJobIdLength = job->jobIdLength;
+            *outLength = length;
+
+            /* The job ID stays readable until a new job claims the entry. */
+            if( Jobs_IsTerminalStatus( job->status ) == true )
+            {
+                job->jobIdLength = 0U;
+            }
+
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_coalesce.h for docs.
+ *
+ * @brief Get the time until the next update is due.
+ */
+JobsStatus_t Jobs_CoalescerNextDelay( const JobsCoalescer_t * coalescer,
+                                      uint32_t nowMs,
+                                      uint32_t * outDelayMs )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    uint32_t delay = UINT32_MAX;
+    uint32_t jobDelay;
+    size_t i;
+
+    if( checkCoalescer() && ( outDelayMs != NULL ) )
+    {
+        ret = JobsNoMatch;
+
+        for( i = 0U; i < coalescer->jobCount; i++ )
+        {
+            if( ( coalescer->pJobs[ i ].jobIdLength > 0U ) &&
+                ( coalescer->pJobs[ i ].pending == true ) )
+            {
+                jobDelay = dueDelay( coalescer, &coalescer->pJobs[ i ], nowMs );
+                delay = ( jobDelay < delay ) ? jobDelay : delay;
+                ret = JobsSuccess;
+            }
+        }
+
+        if( ret == JobsSuccess )
+        {
+            *outDelayMs = delay;
+        }
+    }
+
+    return ret;
+}
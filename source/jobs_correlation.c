@@ -0,0 +1,432 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_correlation.c
+ * @brief Implementation of the APIs from jobs_correlation.h.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Internal Includes */
+#include "jobs_correlation.h"
+#include "jobs_internal.h"
+#include "jobs_trace.h"
+/* External Dependencies */
+#include "core_json.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief Get the length of a string literal.
+ */
+#define CONST_STRLEN( x )    ( sizeof( ( x ) ) - 1U )
+
+/**
+ * @brief Key of the client token in Jobs service responses.
+ */
+#define CLIENT_TOKEN_KEY     "clientToken"
+
+/**
+ * @brief Lowercase hexadecimal digits used by client tokens.
+ */
+static const char hexDigits[] = "0123456789abcdef";
+
+/**
+ * @brief Write a client token for a slot.
+ *
+ * @param[out] buffer  At least #JOBS_CLIENT_TOKEN_LENGTH characters.
+ * @param[in] index  The slot index.
+ * @param[in] sequence  The slot generation.
+ */
+static void encodeToken( char * buffer,
+                         uint16_t index,
+                         uint16_t sequence )
+{
+    uint32_t value = ( ( uint32_t ) sequence << 16U ) | ( uint32_t ) index;
+    size_t i;
+
+    assert( buffer != NULL );
+
+    for( i = 0U; i < JOBS_CLIENT_TOKEN_LENGTH; i++ )
+    {
+        buffer[ JOBS_CLIENT_TOKEN_LENGTH - 1U - i ] = hexDigits[ value & 0xFU ];
+        value >>= 4U;
+    }
+}
+
+/**
+ * @brief Decode a client token into its slot index and generation.
+ *
+ * @param[in] token  The client token.
+ * @param[in] tokenLength  The length of the token.
+ * @param[out] outIndex  The slot index.
+ * @param[out] outSequence  The slot generation.
+ *
+ * @return true if the token is well formed;
+ * false otherwise
+ */
+static bool decodeToken( const char * token,
+                         size_t tokenLength,
+                         uint16_t * outIndex,
+                         uint16_t * outSequence )
+{
+    bool ret = ( tokenLength == JOBS_CLIENT_TOKEN_LENGTH ) ? true : false;
+    uint32_t value = 0U;
+    size_t i;
+
+    assert( ( token != NULL ) && ( outIndex != NULL ) && ( outSequence != NULL ) );
+
+    for( i = 0U; ( ret == true ) && ( i < tokenLength ); i++ )
+    {
+        char c = token[ i ];
+        uint32_t nibble = 0U;
+
+        if( ( c >= '0' ) && ( c <= '9' ) )
+        {
+            nibble = ( uint32_t ) c - ( uint32_t ) '0';
+        }
+        else if( ( c >= 'a' ) && ( c <= 'f' ) )
+        {
+            nibble = ( ( uint32_t ) c - ( uint32_t ) 'a' ) + 10U;
+        }
+        else
+        {
+            ret = false;
+        }
+
+        value = ( value << 4U ) | nibble;
+    }
+
+    if( ret == true )
+    {
+        *outIndex = ( uint16_t ) ( value & 0xFFFFU );
+        *outSequence = ( uint16_t ) ( value >> 16U );
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Map a response topic to the API of its request.
+ *
+ * @param[in] topic  The topic value output by Jobs_MatchTopic().
+ *
+ * @return The request API, or #JobsInvalidApi if the topic is
+ * not a response.
+ */
+static JobsApi_t responseApi( JobsTopic_t topic )
+{
+    JobsApi_t api = JobsInvalidApi;
+
+    switch( topic )
+    {
+        case JobsGetPendingSuccess:
+        case JobsGetPendingFailed:
+            api = JobsApiGetPending;
+            break;
+
+        case JobsStartNextSuccess:
+        case JobsStartNextFailed:
+            api = JobsApiStartNext;
+            break;
+
+        case JobsDescribeSuccess:
+        case JobsDescribeFailed:
+            api = JobsApiDescribe;
+            break;
+
+        case JobsUpdateSuccess:
+        case JobsUpdateFailed:
+            api = JobsApiUpdate;
+            break;
+
+        default:
+            /* Notifications do not carry a client token. */
+            break;
+    }
+
+    return api;
+}
+
+/**
+ * @brief Return a slot to the free list.
+ *
+ * @param[in] table  The correlation table.
+ * @param[in] index  The slot to release.
+ * @param[out] outRequest  Receives a copy of the slot, may be NULL.
+ */
+static void releaseSlot( JobsCorrelationTable_t * table,
+                         uint16_t index,
+                         JobsPendingRequest_t * outRequest )
+{
+    JobsPendingRequest_t * slot = &table->pRequests[ index ];
+
+    assert( slot->inUse == true );
+
+    if( outRequest != NULL )
+    {
+        *outRequest = *slot;
+    }
+
+    slot->inUse = false;
+    slot->nextFree = table->freeHead;
+    table->freeHead = index;
+    table->count--;
+}
+
+/**
+ * @brief Find the slot in use for a client token.
+ *
+ * @param[in] table  The correlation table.
+ * @param[in] token  The client token.
+ * @param[in] tokenLength  The length of the token.
+ * @param[out] outIndex  The slot index.
+ *
+ * @return true if a pending request has the token;
+ * false otherwise
+ */
+static bool findToken( const JobsCorrelationTable_t * table,
+                       const char * token,
+                       size_t tokenLength,
+                       uint16_t * outIndex )
+{
+    bool ret = false;
+    uint16_t index = 0U;
+    uint16_t sequence = 0U;
+
+    if( ( decodeToken( token, tokenLength, &index, &sequence ) == true ) &&
+        ( index < table->capacity ) )
+    {
+        const JobsPendingRequest_t * slot = &table->pRequests[ index ];
+
+        if( ( slot->inUse == true ) && ( slot->sequence == sequence ) )
+        {
+            *outIndex = index;
+            ret = true;
+        }
+    }
+
+    return ret;
+}
+
+#define checkTable() \
+    ( ( table != NULL ) && ( table->pRequests != NULL ) )
+
+/** @endcond */
+
+/**
+ * See jobs_correlation.h for docs.
+ *
+ * @brief Initialize a correlation table over caller provided slots.
+ */
+JobsStatus_t Jobs_CorrelationInit( JobsCorrelationTable_t * table,
+                                   JobsPendingRequest_t * requests,
+                                   size_t requestCount )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    uint16_t i;
+
+    if( ( table != NULL ) && ( requests != NULL ) &&
+        ( requestCount > 0U ) && ( requestCount <= JOBS_CORRELATION_MAX_REQUESTS ) )
+    {
+        table->pRequests = requests;
+        table->capacity = ( uint16_t ) requestCount;
+        table->count = 0U;
+        table->freeHead = 0U;
+        table->expireCursor = 0U;
+
+        for( i = 0U; i < table->capacity; i++ )
+        {
+            requests[ i ].api = JobsInvalidApi;
+            requests[ i ].deadlineMs = 0U;
+            requests[ i ].userData = 0U;
+            requests[ i ].sequence = 0U;
+            requests[ i ].nextFree = ( uint16_t ) ( i + 1U );
+            requests[ i ].inUse = false;
+        }
+
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_correlation.h for docs.
+ *
+ * @brief Reserve a slot for a request and generate its client token.
+ */
+JobsStatus_t Jobs_CorrelationAdd( JobsCorrelationTable_t * table,
+                                  JobsApi_t api,
+                                  uint32_t deadlineMs,
+                                  uint32_t userData,
+                                  char * tokenBuffer,
+                                  size_t tokenBufferLength )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkTable() && ( tokenBuffer != NULL ) &&
+        ( api > JobsInvalidApi ) && ( api < JobsMaxApi ) )
+    {
+        ret = JobsBufferTooSmall;
+
+        if( ( tokenBufferLength >= JOBS_CLIENT_TOKEN_LENGTH ) &&
+            ( table->freeHead < table->capacity ) )
+        {
+            uint16_t index = table->freeHead;
+            JobsPendingRequest_t * slot = &table->pRequests[ index ];
+
+            table->freeHead = slot->nextFree;
+            table->count++;
+
+            slot->api = api;
+            slot->deadlineMs = deadlineMs;
+            slot->userData = userData;
+            slot->sequence++;
+            slot->inUse = true;
+
+            encodeToken( tokenBuffer, index, slot->sequence );
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_correlation.h for docs.
+ *
+ * @brief Resolve a response from the Jobs service to its pending request.
+ */
+JobsStatus_t Jobs_CorrelationResolve( JobsCorrelationTable_t * table,
+                                      JobsTopic_t topic,
+                                      const char * message,
+                                      size_t messageLength,
+                                      JobsPendingRequest_t * outRequest )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    JobsApi_t api = responseApi( topic );
+    const char * token = NULL;
+    size_t tokenLength = 0U;
+    uint16_t index = 0U;
+
+    if( checkTable() && ( message != NULL ) && ( messageLength > 0U ) )
+    {
+        ret = JobsNoMatch;
+
+        /* JSON_SearchConst() stops at the matching key, so the remainder of
+         * a potentially large response is not scanned. */
+        if( ( api != JobsInvalidApi ) &&
+            ( JOBS_TRACE_JSON_SEARCH( message,
+                                      messageLength,
+                                      CLIENT_TOKEN_KEY,
+                                      CONST_STRLEN( CLIENT_TOKEN_KEY ),
+                                      &token,
+                                      &tokenLength,
+                                      NULL ) == JSONSuccess ) &&
+            ( findToken( table, token, tokenLength, &index ) == true ) &&
+            ( table->pRequests[ index ].api == api ) )
+        {
+            releaseSlot( table, index, outRequest );
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_correlation.h for docs.
+ *
+ * @brief Release the pending request for a client token.
+ */
+JobsStatus_t Jobs_CorrelationRemove( JobsCorrelationTable_t * table,
+                                     const char * token,
+                                     size_t tokenLength )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    uint16_t index = 0U;
+
+    if( checkTable() && ( token != NULL ) )
+    {
+        ret = JobsNoMatch;
+
+        if( findToken( table, token, tokenLength, &index ) == true )
+        {
+            releaseSlot( table, index, NULL );
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_correlation.h for docs.
+ *
+ * @brief Release one pending request whose deadline has passed.
+ */
+JobsStatus_t Jobs_CorrelationExpire( JobsCorrelationTable_t * table,
+                                     uint32_t nowMs,
+                                     JobsPendingRequest_t * outRequest )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    uint16_t index;
+    uint16_t seen = 0U;
+    uint16_t scanned = 0U;
+
+    if( checkTable() )
+    {
+        ret = JobsNoMatch;
+        index = table->expireCursor;
+
+        /* Stop once every request in use was examined. */
+        while( ( ret == JobsNoMatch ) && ( seen < table->count ) && ( scanned < table->capacity ) )
+        {
+            const JobsPendingRequest_t * slot = &table->pRequests[ index ];
+
+            if( slot->inUse == true )
+            {
+                seen++;
+
+                if( Jobs_IsDeadlineReached( nowMs, slot->deadlineMs ) == true )
+                {
+                    releaseSlot( table, index, outRequest );
+                    ret = JobsSuccess;
+                }
+            }
+
+            scanned++;
+            index = ( ( index + 1U ) < table->capacity ) ? ( uint16_t ) ( index + 1U ) : 0U;
+        }
+
+        table->expireCursor = index;
+    }
+
+    return ret;
+}
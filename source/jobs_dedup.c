@@ -0,0 +1,210 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_dedup.c
+ * @brief Implementation of the APIs from jobs_dedup.h.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Internal Includes */
+#include "jobs_dedup.h"
+#include "jobs_internal.h"
+#include "jobs_trace.h"
+/* External Dependencies */
+#include "core_json.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief Get the length of a string literal.
+ */
+#define CONST_STRLEN( x )    ( sizeof( ( x ) ) - 1U )
+
+/**
+ * @brief Check common parameters.
+ */
+#define checkFilter() \
+    ( ( filter != NULL ) && ( filter->pEntries != NULL ) )
+
+/**
+ * @brief Read an unsigned member of the execution object of a message.
+ *
+ * @param[in] message  The message payload.
+ * @param[in] messageLength  The length of the message payload.
+ * @param[in] query  The query of the member.
+ * @param[in] queryLength  The length of the query.
+ * @param[out] outValue  The value.
+ *
+ * @return true if the member is an unsigned 32-bit integer;
+ * false otherwise
+ */
+static bool readExecutionUint( const char * message,
+                               size_t messageLength,
+                               const char * query,
+                               size_t queryLength,
+                               uint32_t * outValue )
+{
+    const char * value = NULL;
+    size_t valueLength = 0U;
+    JSONTypes_t type = JSONInvalid;
+
+    return ( ( JOBS_TRACE_JSON_SEARCH( message, messageLength, query, queryLength,
+                                       &value, &valueLength, &type ) == JSONSuccess ) &&
+             ( type == JSONNumber ) &&
+             ( Jobs_StringToUint( value, valueLength, outValue ) == JobsSuccess ) ) ? true : false;
+}
+
+/**
+ * @brief Read the execution key of a message.
+ *
+ * The message is not validated, as the search stops at the first syntax
+ * error, and validating would cost as much as the parse to be avoided.
+ *
+ * @param[in] message  The message payload.
+ * @param[in] messageLength  The length of the message payload.
+ * @param[out] outKey  The key.
+ *
+ * @return true if the message has the execution key, with a job ID that
+ * fits an entry;
+ * false otherwise
+ */
+static bool readExecutionKey( const char * message,
+                              size_t messageLength,
+                              JobsDedupEntry_t * outKey )
+{
+    const char * value = NULL;
+    size_t valueLength = 0U;
+    JSONTypes_t type = JSONInvalid;
+    bool ret;
+
+    ret = ( ( JOBS_TRACE_JSON_SEARCH( message, messageLength, "execution.jobId",
+                                      CONST_STRLEN( "execution.jobId" ),
+                                      &value, &valueLength, &type ) == JSONSuccess ) &&
+            ( type == JSONString ) && ( valueLength > 0U ) &&
+            ( valueLength <= JOBID_MAX_LENGTH ) &&
+            ( readExecutionUint( message, messageLength, "execution.versionNumber",
+                                 CONST_STRLEN( "execution.versionNumber" ),
+                                 &outKey->versionNumber ) == true ) &&
+            ( readExecutionUint( message, messageLength, "execution.executionNumber",
+                                 CONST_STRLEN( "execution.executionNumber" ),
+                                 &outKey->executionNumber ) == true ) ) ? true : false;
+
+    if( ret == true )
+    {
+        ( void ) memcpy( outKey->jobId, value, valueLength );
+        outKey->jobIdLength = ( uint16_t ) valueLength;
+    }
+
+    return ret;
+}
+
+/** @endcond */
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_dedup.h for docs.
+ *
+ * @brief Initialize a filter over a caller provided window.
+ */
+JobsStatus_t Jobs_DedupInit( JobsDedupFilter_t * filter,
+                             JobsDedupEntry_t * entries,
+                             size_t window )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( ( filter != NULL ) && ( entries != NULL ) && ( window > 0U ) )
+    {
+        filter->pEntries = entries;
+        filter->window = window;
+        ret = Jobs_DedupReset( filter );
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_dedup.h for docs.
+ *
+ * @brief Check whether a message describes a job execution seen before.
+ */
+bool Jobs_DedupIsRepeat( JobsDedupFilter_t * filter,
+                         const char * message,
+                         size_t messageLength )
+{
+    JobsDedupEntry_t key = { 0 };
+    const JobsDedupEntry_t * entry;
+    bool ret = false;
+    size_t i;
+
+    if( checkFilter() && ( message != NULL ) && ( messageLength > 0U ) &&
+        ( readExecutionKey( message, messageLength, &key ) == true ) )
+    {
+        for( i = 0U; ( i < filter->window ) && ( ret == false ); i++ )
+        {
+            entry = &filter->pEntries[ i ];
+            ret = ( ( entry->jobIdLength == key.jobIdLength ) &&
+                    ( entry->versionNumber == key.versionNumber ) &&
+                    ( entry->executionNumber == key.executionNumber ) &&
+                    ( memcmp( entry->jobId, key.jobId, key.jobIdLength ) == 0 ) ) ? true : false;
+        }
+
+        if( ret == false )
+        {
+            filter->pEntries[ filter->next ] = key;
+            filter->next = ( filter->next + 1U ) % filter->window;
+        }
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_dedup.h for docs.
+ *
+ * @brief Forget every execution seen.
+ */
+JobsStatus_t Jobs_DedupReset( JobsDedupFilter_t * filter )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkFilter() )
+    {
+        ( void ) memset( filter->pEntries, 0, filter->window * sizeof( JobsDedupEntry_t ) );
+        filter->next = 0U;
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
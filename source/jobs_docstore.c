@@ -0,0 +1,501 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_docstore.c
+ * @brief Implementation of the APIs from jobs_docstore.h.
+ */
+
+#if defined( __linux__ ) && !defined( _POSIX_C_SOURCE )
+    #define _POSIX_C_SOURCE    200809L
+#endif
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined( __linux__ )
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+/* Internal Includes */
+#include "jobs_docstore.h"
+#include "jobs_internal.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief Marks a region holding a store, "JDS1".
+ */
+#define STORE_MAGIC          0x3153444AU
+
+/**
+ * @brief Words of the store header.
+ */
+#define HEADER_MAGIC         0U
+#define HEADER_SLOTS         1U
+#define HEADER_DATA_SIZE     2U
+#define HEADER_APPEND        3U
+#define HEADER_COUNT         4U
+
+/**
+ * @brief Words of an index slot.  A zero hash marks an empty slot.
+ */
+#define SLOT_HASH            0U
+#define SLOT_VERSION         1U
+#define SLOT_OFFSET          2U
+#define SLOT_LENGTH          3U
+#define SLOT_WORDS           ( JOBS_DOCSTORE_SLOT_SIZE / 4U )
+
+/**
+ * @brief Most documents an index of a number of slots holds, so that
+ * probing always reaches an empty slot.
+ */
+#define MAX_DOCUMENTS( slots )    ( ( ( slots ) * 3U ) / 4U )
+
+/**
+ * @brief Check common parameters.
+ */
+#define checkStore()     \
+    ( ( store != NULL ) && \
+      ( store->pHeader != NULL ) )
+
+/**
+ * @brief Check job key parameters.
+ */
+#define checkKey() \
+    ( Jobs_IsValidJobId( jobId, jobIdLength ) == true )
+
+/**
+ * @brief Hash a job ID and version with FNV-1a.
+ *
+ * @param[in] jobId  The job ID.
+ * @param[in] jobIdLength  The length of the job ID.
+ * @param[in] versionNumber  The version of the job execution.
+ *
+ * @return The hash, never zero.
+ */
+static uint32_t hashDocument( const char * jobId,
+                              uint16_t jobIdLength,
+                              uint32_t versionNumber )
+{
+    uint8_t version[ 4 ];
+    uint32_t hash;
+    size_t i;
+
+    for( i = 0U; i < sizeof( version ); i++ )
+    {
+        version[ i ] = ( uint8_t ) ( versionNumber >> ( 8U * i ) );
+    }
+
+    hash = Jobs_Fnv1a( JOBS_FNV1A_OFFSET_BASIS, jobId, jobIdLength );
+    hash = Jobs_Fnv1a( hash, version, sizeof( version ) );
+
+    return ( hash == 0U ) ? 1U : hash;
+}
+
+/**
+ * @brief Find the slot of a document, or the empty slot ending its probe.
+ *
+ * @param[in] store  The store.
+ * @param[in] jobId  The job ID.
+ * @param[in] jobIdLength  The length of the job ID.
+ * @param[in] versionNumber  The version of the job execution.
+ * @param[in] hash  The hash of the job ID and version.
+ *
+ * @return The slot.
+ */
+static uint32_t * findDocument( const JobsDocStore_t * store,
+                                const char * jobId,
+                                uint16_t jobIdLength,
+                                uint32_t versionNumber,
+                                uint32_t hash )
+{
+    uint32_t index = hash & store->slotMask;
+    uint32_t * slot = &store->pSlots[ index * SLOT_WORDS ];
+    const char * record;
+    bool found = false;
+
+    while( ( slot[ SLOT_HASH ] != 0U ) && ( found == false ) )
+    {
+        record = &store->pData[ slot[ SLOT_OFFSET ] ];
+
+        if( ( slot[ SLOT_HASH ] == hash ) && ( slot[ SLOT_VERSION ] == versionNumber ) &&
+            ( ( uint8_t ) record[ 0 ] == jobIdLength ) &&
+            ( memcmp( &record[ 1 ], jobId, jobIdLength ) == 0 ) )
+        {
+            found = true;
+        }
+        else
+        {
+            index = ( index + 1U ) & store->slotMask;
+            slot = &store->pSlots[ index * SLOT_WORDS ];
+        }
+    }
+
+    return slot;
+}
+
+/**
+ * @brief Predicate returns true for a slot whose record lies within the
+ * appended data.
+ *
+ * @param[in] store  The store, with an append offset within its data.
+ * @param[in] slot  The slot.
+ *
+ * @return true if the record is within the data;
+ * false otherwise
+ */
+static bool isRecordInData( const JobsDocStore_t * store,
+                            const uint32_t * slot )
+{
+    uint32_t offset = slot[ SLOT_OFFSET ];
+    uint32_t remaining;
+    bool ret = false;
+
+    if( offset < store->pHeader[ HEADER_APPEND ] )
+    {
+        /* Subtract rather than add, so no length can wrap around. */
+        remaining = store->pHeader[ HEADER_APPEND ] - offset - 1U;
+        ret = ( ( slot[ SLOT_LENGTH ] <= remaining ) &&
+                ( ( uint32_t ) ( uint8_t ) store->pData[ offset ] <= ( remaining - slot[ SLOT_LENGTH ] ) ) ) ? true : false;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Empty the store.
+ *
+ * @param[in] store  The store.
+ */
+static void clearDocuments( JobsDocStore_t * store )
+{
+    ( void ) memset( store->pSlots, 0, ( ( size_t ) store->slotMask + 1U ) * JOBS_DOCSTORE_SLOT_SIZE );
+    store->pHeader[ HEADER_APPEND ] = 0U;
+    store->pHeader[ HEADER_COUNT ] = 0U;
+}
+
+/** @endcond */
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_docstore.h for docs.
+ *
+ * @brief Open a store over a region.
+ */
+JobsStatus_t Jobs_DocStoreInit( JobsDocStore_t * store,
+                                uint32_t * region,
+                                size_t regionSize,
+                                size_t slotCount )
+{
+    size_t indexSize = JOBS_DOCSTORE_HEADER_SIZE + ( slotCount * JOBS_DOCSTORE_SLOT_SIZE );
+    uint32_t * header = region;
+    const uint32_t * slot;
+    bool valid = true;
+    size_t i;
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( ( store != NULL ) && ( region != NULL ) && ( slotCount >= 2U ) &&
+        ( slotCount <= 0x10000000U ) && ( ( slotCount & ( slotCount - 1U ) ) == 0U ) &&
+        ( regionSize > indexSize ) && ( ( regionSize - indexSize ) <= UINT32_MAX ) )
+    {
+        store->pHeader = header;
+        store->pSlots = &region[ JOBS_DOCSTORE_HEADER_SIZE / 4U ];
+        store->pData = ( char * ) &region[ indexSize / 4U ];
+        store->slotMask = ( uint32_t ) slotCount - 1U;
+        store->dataSize = ( uint32_t ) ( regionSize - indexSize );
+
+        if( ( header[ HEADER_MAGIC ] == STORE_MAGIC ) &&
+            ( header[ HEADER_SLOTS ] == ( uint32_t ) slotCount ) &&
+            ( header[ HEADER_DATA_SIZE ] == store->dataSize ) &&
+            ( header[ HEADER_APPEND ] <= store->dataSize ) )
+        {
+            /* The count may lag the slots after a crash, so recount, and
+             * check no slot refers past the appended data. */
+            header[ HEADER_COUNT ] = 0U;
+
+            for( i = 0U; ( i < slotCount ) && ( valid == true ); i++ )
+            {
+                slot = &store->pSlots[ i * SLOT_WORDS ];
+
+                if( slot[ SLOT_HASH ] != 0U )
+                {
+                    header[ HEADER_COUNT ]++;
+                    valid = isRecordInData( store, slot );
+                }
+            }
+        }
+
+        if( ( header[ HEADER_MAGIC ] != STORE_MAGIC ) ||
+            ( header[ HEADER_SLOTS ] != ( uint32_t ) slotCount ) ||
+            ( header[ HEADER_DATA_SIZE ] != store->dataSize ) ||
+            ( header[ HEADER_APPEND ] > store->dataSize ) ||
+            ( header[ HEADER_COUNT ] > MAX_DOCUMENTS( ( uint32_t ) slotCount ) ) ||
+            ( valid == false ) )
+        {
+            ( void ) memset( header, 0, JOBS_DOCSTORE_HEADER_SIZE );
+            clearDocuments( store );
+            header[ HEADER_SLOTS ] = ( uint32_t ) slotCount;
+            header[ HEADER_DATA_SIZE ] = store->dataSize;
+            header[ HEADER_MAGIC ] = STORE_MAGIC;
+        }
+
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_docstore.h for docs.
+ *
+ * @brief Add the document of a job execution.
+ */
+JobsStatus_t Jobs_DocStorePut( JobsDocStore_t * store,
+                               const char * jobId,
+                               uint16_t jobIdLength,
+                               uint32_t versionNumber,
+                               const char * document,
+                               size_t documentLength,
+                               const char ** outDocument,
+                               size_t * outDocumentLength )
+{
+    uint32_t hash;
+    uint32_t * slot = NULL;
+    size_t recordLength = 1U + ( size_t ) jobIdLength + documentLength;
+    uint32_t offset;
+    char * record;
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkStore() && checkKey() && ( document != NULL ) )
+    {
+        ret = ( recordLength <= store->dataSize ) ? JobsSuccess : JobsBufferTooSmall;
+    }
+
+    if( ret == JobsSuccess )
+    {
+        hash = hashDocument( jobId, jobIdLength, versionNumber );
+        slot = findDocument( store, jobId, jobIdLength, versionNumber, hash );
+
+        if( slot[ SLOT_HASH ] == 0U )
+        {
+            if( ( recordLength > ( store->dataSize - store->pHeader[ HEADER_APPEND ] ) ) ||
+                ( store->pHeader[ HEADER_COUNT ] >= MAX_DOCUMENTS( store->slotMask + 1U ) ) )
+            {
+                clearDocuments( store );
+                slot = findDocument( store, jobId, jobIdLength, versionNumber, hash );
+            }
+
+            /* Write the record before the slot refers to it, so a store
+             * left by a process crash never refers to unwritten data. */
+            offset = store->pHeader[ HEADER_APPEND ];
+            record = &store->pData[ offset ];
+            record[ 0 ] = ( char ) jobIdLength;
+            ( void ) memcpy( &record[ 1 ], jobId, jobIdLength );
+            ( void ) memcpy( &record[ 1U + jobIdLength ], document, documentLength );
+            store->pHeader[ HEADER_APPEND ] = offset + ( uint32_t ) recordLength;
+            slot[ SLOT_VERSION ] = versionNumber;
+            slot[ SLOT_OFFSET ] = offset;
+            slot[ SLOT_LENGTH ] = ( uint32_t ) documentLength;
+            slot[ SLOT_HASH ] = hash;
+            store->pHeader[ HEADER_COUNT ]++;
+        }
+    }
+
+    if( ( ret == JobsSuccess ) && ( outDocument != NULL ) )
+    {
+        *outDocument = &store->pData[ slot[ SLOT_OFFSET ] + 1U + jobIdLength ];
+    }
+
+    if( ( ret == JobsSuccess ) && ( outDocumentLength != NULL ) )
+    {
+        *outDocumentLength = slot[ SLOT_LENGTH ];
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_docstore.h for docs.
+ *
+ * @brief Look up the document of a job execution.
+ */
+JobsStatus_t Jobs_DocStoreGet( const JobsDocStore_t * store,
+                               const char * jobId,
+                               uint16_t jobIdLength,
+                               uint32_t versionNumber,
+                               const char ** outDocument,
+                               size_t * outDocumentLength )
+{
+    const uint32_t * slot;
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkStore() && checkKey() && ( outDocument != NULL ) && ( outDocumentLength != NULL ) )
+    {
+        slot = findDocument( store, jobId, jobIdLength, versionNumber,
+                             hashDocument( jobId, jobIdLength, versionNumber ) );
+        ret = JobsNoMatch;
+
+        if( slot[ SLOT_HASH ] != 0U )
+        {
+            *outDocument = &store->pData[ slot[ SLOT_OFFSET ] + 1U + jobIdLength ];
+            *outDocumentLength = slot[ SLOT_LENGTH ];
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_docstore.h for docs.
+ *
+ * @brief Remove every document from the store.
+ */
+JobsStatus_t Jobs_DocStoreClear( JobsDocStore_t * store )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkStore() )
+    {
+        clearDocuments( store );
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+#if defined( __linux__ )
+
+/**
+ * See jobs_docstore.h for docs.
+ *
+ * @brief Map a file as a shared region for a store.
+ */
+    JobsStatus_t Jobs_DocStoreMapFile( const char * path,
+                                       size_t regionSize,
+                                       uint32_t ** outRegion )
+    {
+        struct stat status;
+        void * region = MAP_FAILED;
+        int fd = -1;
+        JobsStatus_t ret = JobsBadParameter;
+
+        if( ( path != NULL ) && ( regionSize > 0U ) && ( outRegion != NULL ) )
+        {
+            ret = JobsError;
+            fd = open( path, O_RDWR | O_CREAT, 0600 );
+        }
+
+        if( ( fd >= 0 ) && ( fstat( fd, &status ) == 0 ) &&
+            ( ( ( size_t ) status.st_size >= regionSize ) ||
+              ( ftruncate( fd, ( off_t ) regionSize ) == 0 ) ) )
+        {
+            region = mmap( NULL, regionSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+        }
+
+        if( region != MAP_FAILED )
+        {
+            *outRegion = region;
+            ret = JobsSuccess;
+        }
+
+        if( fd >= 0 )
+        {
+            ( void ) close( fd );
+        }
+
+        return ret;
+    }
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_docstore.h for docs.
+ *
+ * @brief Unmap a region mapped by Jobs_DocStoreMapFile.
+ */
+    JobsStatus_t Jobs_DocStoreUnmapFile( uint32_t * region,
+                                         size_t regionSize )
+    {
+        JobsStatus_t ret = JobsBadParameter;
+
+        if( ( region != NULL ) && ( regionSize > 0U ) )
+        {
+            ret = ( munmap( region, regionSize ) == 0 ) ? JobsSuccess : JobsError;
+        }
+
+        return ret;
+    }
+
+#else /* if defined( __linux__ ) */
+
+/**
+ * See jobs_docstore.h for docs.
+ *
+ * @brief Stub, files cannot be mapped on this platform.
+ */
+    JobsStatus_t Jobs_DocStoreMapFile( const char * path,
+                                       size_t regionSize,
+                                       uint32_t ** outRegion )
+    {
+        ( void ) path;
+        ( void ) regionSize;
+        ( void ) outRegion;
+
+        return JobsError;
+    }
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_docstore.h for docs.
+ *
+ * @brief Stub, files cannot be mapped on this platform.
+ */
+    JobsStatus_t Jobs_DocStoreUnmapFile( uint32_t * region,
+                                         size_t regionSize )
+    {
+        ( void ) region;
+        ( void ) regionSize;
+
+        return JobsError;
+    }
+
+#endif /* if defined( __linux__ ) */
@@ -0,0 +1,794 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_execution.c
+ * @brief Implementation of the APIs from jobs_execution.h.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Internal Includes */
+#include "jobs_execution.h"
+#include "jobs_internal.h"
+#include "jobs_trace.h"
+/* External Dependencies */
+#include "core_json.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief Get the length of a string literal.
+ */
+#define CONST_STRLEN( x )     ( sizeof( ( x ) ) - 1U )
+
+/**
+ * @brief Execution fields read from a message.
+ */
+typedef struct
+{
+    uint32_t jobIdHash;        /**< @brief Hash of the job ID. */
+    uint32_t versionNumber;    /**< @brief The version number. */
+    uint32_t executionNumber;  /**< @brief The execution number. */
+    JobCurrentStatus_t status; /**< @brief The status, when known. */
+    bool hasJobId;             /**< @brief Whether the job ID was found. */
+    bool hasStatus;            /**< @brief Whether a valid status was found. */
+    bool hasVersion;           /**< @brief Whether the version number was found. */
+    bool hasExecutionNumber;   /**< @brief Whether the execution number was found. */
+    bool isOver;               /**< @brief Whether the status is terminal, or not a #JobCurrentStatus_t. */
+} ExecutionFields_t;
+
+/**
+ * @brief Read an unsigned integer member of a JSON object.
+ *
+ * @param[in] object  The JSON object.
+ * @param[in] objectLength  The length of the object.
+ * @param[in] key  The member key.
+ * @param[in] keyLength  The length of the key.
+ * @param[out] outValue  The value.
+ *
+ * @return true if the member is an unsigned 32-bit integer;
+ * false otherwise
+ */
+static bool readUint( const char * object,
+                      size_t objectLength,
+                      const char * key,
+                      size_t keyLength,
+                      uint32_t * outValue )
+{
+    const char * value = NULL;
+    size_t valueLength = 0U;
+    JSONTypes_t type = JSONInvalid;
+
+    return ( ( JOBS_TRACE_JSON_SEARCH( object, objectLength, key, keyLength,
+                                       &value, &valueLength, &type ) == JSONSuccess ) &&
+             ( type == JSONNumber ) &&
+             ( Jobs_StringToUint( value, valueLength, outValue ) == JobsSuccess ) ) ? true : false;
+}
+
+/**
+ * @brief Read the execution fields of a message.
+ *
+ * @param[in] message  The message payload, valid JSON.
+ * @param[in] messageLength  The length of the message payload.
+ * @param[in] key  The key of the execution object.
+ * @param[in] keyLength  The length of the key.
+ * @param[out] outFields  The fields found.
+ *
+ * @return true if the message has the execution object;
+ * false otherwise
+ */
+static bool readExecution( const char * message,
+                           size_t messageLength,
+                           const char * key,
+                           size_t keyLength,
+                           ExecutionFields_t * outFields )
+{
+    bool ret = false;
+    const char * object = NULL;
+    size_t objectLength = 0U;
+    const char * value = NULL;
+    size_t valueLength = 0U;
+    JSONTypes_t type = JSONInvalid;
+
+    outFields->hasJobId = false;
+    outFields->hasStatus = false;
+    outFields->isOver = false;
+
+    if( ( JOBS_TRACE_JSON_SEARCH( message, messageLength, key, keyLength,
+                                  &object, &objectLength, &type ) == JSONSuccess ) &&
+        ( type == JSONObject ) )
+    {
+        ret = true;
+
+        if( JOBS_TRACE_JSON_SEARCH( object, objectLength, "jobId", CONST_STRLEN( "jobId" ),
+                                    &value, &valueLength, NULL ) == JSONSuccess )
+        {
+            outFields->jobIdHash = Jobs_Fnv1a( JOBS_FNV1A_OFFSET_BASIS, value, valueLength );
+            outFields->hasJobId = true;
+        }
+
+        if( JOBS_TRACE_JSON_SEARCH( object, objectLength, "status", CONST_STRLEN( "status" ),
+                                    &value, &valueLength, NULL ) == JSONSuccess )
+        {
+            outFields->hasStatus = ( Jobs_StatusFromString( value, valueLength, &outFields->status ) == JobsSuccess ) ? true : false;
+
+            /* CANCELED, TIMED_OUT and REMOVED also end the execution. */
+            outFields->isOver = ( ( outFields->hasStatus == false ) ||
+                                  ( Jobs_IsTerminalStatus( outFields->status ) == true ) ) ? true : false;
+        }
+
+        outFields->hasVersion = readUint( object, objectLength, "versionNumber",
+                                          CONST_STRLEN( "versionNumber" ), &outFields->versionNumber );
+        outFields->hasExecutionNumber = readUint( object, objectLength, "executionNumber",
+                                                  CONST_STRLEN( "executionNumber" ), &outFields->executionNumber );
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Predicate returns true for a rejected response with the
+ * VersionMismatch error code.
+ *
+ * @param[in] message  The message payload, valid JSON.
+ * @param[in] messageLength  The length of the message payload.
+ *
+ * @return true if the code is VersionMismatch;
+ * false otherwise
+ */
+static bool isVersionMismatch( const char * message,
+                               size_t messageLength )
+{
+    const char * value = NULL;
+    size_t valueLength = 0U;
+
+    return ( ( JOBS_TRACE_JSON_SEARCH( message, messageLength, "code", CONST_STRLEN( "code" ),
+                                       &value, &valueLength, NULL ) == JSONSuccess ) &&
+             ( valueLength == CONST_STRLEN( "VersionMismatch" ) ) &&
+             ( memcmp( value, "VersionMismatch", valueLength ) == 0 ) ) ? true : false;
+}
+
+/**
+ * @brief Count a rejected update, and drop the reported status once
+ * #JOBS_EXECUTION_MAX_RETRIES updates were rejected.
+ *
+ * @param[in] execution  The record.
+ *
+ * @return true if the update may be sent again;
+ * false if the status known to the service must be kept.
+ */
+static bool countRejection( JobsExecution_t * execution )
+{
+    bool ret = true;
+
+    if( execution->retries < JOBS_EXECUTION_MAX_RETRIES )
+    {
+        execution->retries++;
+    }
+    else
+    {
+        /* Past the limit, a describe keeps the status it reads too. */
+        execution->retries = ( uint8_t ) ( JOBS_EXECUTION_MAX_RETRIES + 1U );
+        execution->pendingStatus = execution->status;
+        execution->dirty = 0U;
+        ret = false;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Move to a state that waits for a response.
+ *
+ * @param[in] execution  The record.
+ * @param[in] state  The next state.
+ * @param[in] api  The request to publish.
+ * @param[in] nowMs  The current time in milliseconds.
+ * @param[out] outAction  The request to publish.
+ */
+static void sendRequest( JobsExecution_t * execution,
+                         JobsExecutionState_t state,
+                         JobsApi_t api,
+                         uint32_t nowMs,
+                         JobsExecutionAction_t * outAction )
+{
+    execution->state = ( uint8_t ) state;
+    execution->deadlineMs = nowMs + JOBS_EXECUTION_RESPONSE_TIMEOUT_MS;
+    outAction->api = api;
+    outAction->status = ( JobCurrentStatus_t ) execution->pendingStatus;
+}
+
+/**
+ * @brief End the current job and ask for the next one.
+ *
+ * @param[in] execution  The record.
+ * @param[in] nowMs  The current time in milliseconds.
+ * @param[out] outAction  The request to publish.
+ */
+static void finishJob( JobsExecution_t * execution,
+                       uint32_t nowMs,
+                       JobsExecutionAction_t * outAction )
+{
+    execution->jobIdHash = 0U;
+    execution->dirty = 0U;
+    execution->retries = 0U;
+    sendRequest( execution, JobsExecutionStarting, JobsApiStartNext, nowMs, outAction );
+}
+
+/**
+ * @brief Send the pending status, or settle in the running state.
+ *
+ * @param[in] execution  The record.
+ * @param[in] nowMs  The current time in milliseconds.
+ * @param[out] outAction  The request to publish, if any.
+ */
+static void settle( JobsExecution_t * execution,
+                    uint32_t nowMs,
+                    JobsExecutionAction_t * outAction )
+{
+    if( Jobs_IsTerminalStatus( ( JobCurrentStatus_t ) execution->status ) == true )
+    {
+        finishJob( execution, nowMs, outAction );
+    }
+    else if( ( execution->dirty != 0U ) || ( execution->pendingStatus != execution->status ) )
+    {
+        execution->dirty = 0U;
+        sendRequest( execution, JobsExecutionUpdating, JobsApiUpdate, nowMs, outAction );
+    }
+    else
+    {
+        execution->state = ( uint8_t ) JobsExecutionRunning;
+    }
+}
+
+/**
+ * @brief Handle a message in the starting state.
+ *
+ * @return #JobsSuccess if the message caused a transition;
+ * #JobsNoMatch otherwise.
+ */
+static JobsStatus_t handleStarting( JobsExecution_t * execution,
+                                    JobsTopic_t topic,
+                                    const char * message,
+                                    size_t messageLength )
+{
+    JobsStatus_t ret = JobsNoMatch;
+    ExecutionFields_t fields = { 0 };
+
+    if( topic == JobsStartNextSuccess )
+    {
+        execution->state = ( uint8_t ) JobsExecutionIdle;
+
+        if( ( readExecution( message, messageLength, "execution", CONST_STRLEN( "execution" ), &fields ) == true ) &&
+            ( fields.hasJobId == true ) && ( fields.isOver == false ) )
+        {
+            /* Start-next moves a QUEUED execution to IN_PROGRESS.  Numbers
+             * missing from the response are left for a VersionMismatch or
+             * a describe to correct. */
+            execution->jobIdHash = fields.jobIdHash;
+
+            if( fields.hasVersion == true )
+            {
+                execution->versionNumber = fields.versionNumber;
+            }
+
+            if( fields.hasExecutionNumber == true )
+            {
+                execution->executionNumber = fields.executionNumber;
+            }
+
+            execution->retries = 0U;
+            execution->status = ( uint8_t ) InProgress;
+            execution->pendingStatus = ( uint8_t ) InProgress;
+            execution->state = ( uint8_t ) JobsExecutionRunning;
+        }
+
+        ret = JobsSuccess;
+    }
+    else if( topic == JobsStartNextFailed )
+    {
+        execution->state = ( uint8_t ) JobsExecutionIdle;
+        ret = JobsSuccess;
+    }
+    else
+    {
+        /* MISRA Empty Body */
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Take the execution state of a rejected update, or describe the
+ * job execution when the response has none.
+ *
+ * @param[in] execution  The record.
+ * @param[in] hasState  Whether the response has an execution state.
+ * @param[in] fields  The fields of the execution state.
+ * @param[in] nowMs  The current time in milliseconds.
+ * @param[out] outAction  The request to publish, if any.
+ */
+static void handleRejected( JobsExecution_t * execution,
+                            bool hasState,
+                            const ExecutionFields_t * fields,
+                            uint32_t nowMs,
+                            JobsExecutionAction_t * outAction )
+{
+    if( ( hasState == true ) && ( fields->hasStatus == true ) )
+    {
+        execution->status = ( uint8_t ) fields->status;
+
+        /* A report held back is still sent; otherwise drop the refused one. */
+        if( execution->dirty == 0U )
+        {
+            execution->pendingStatus = execution->status;
+        }
+
+        settle( execution, nowMs, outAction );
+    }
+    else
+    {
+        sendRequest( execution, JobsExecutionSyncing, JobsApiDescribe, nowMs, outAction );
+    }
+}
+
+/**
+ * @brief Handle an UpdateJobExecution response for the current job.
+ *
+ * @return #JobsSuccess if the message caused a transition;
+ * #JobsNoMatch otherwise.
+ */
+static JobsStatus_t handleUpdating( JobsExecution_t * execution,
+                                    JobsTopic_t topic,
+                                    const char * message,
+                                    size_t messageLength,
+                                    uint32_t nowMs,
+                                    JobsExecutionAction_t * outAction )
+{
+    JobsStatus_t ret = JobsSuccess;
+    ExecutionFields_t fields = { 0 };
+    bool hasState = readExecution( message, messageLength, "executionState",
+                                   CONST_STRLEN( "executionState" ), &fields );
+
+    if( topic == JobsUpdateSuccess )
+    {
+        /* The service increments the version on every accepted update. */
+        execution->versionNumber = ( ( hasState == true ) && ( fields.hasVersion == true ) ) ?
+                                   fields.versionNumber : ( execution->versionNumber + 1U );
+
+        /* With a report held back, the status applied is not known here. */
+        if( execution->dirty == 0U )
+        {
+            execution->status = execution->pendingStatus;
+        }
+
+        execution->retries = 0U;
+        settle( execution, nowMs, outAction );
+    }
+    else if( topic == JobsUpdateFailed )
+    {
+        if( ( hasState == true ) && ( fields.hasVersion == true ) )
+        {
+            execution->versionNumber = fields.versionNumber;
+        }
+
+        if( ( hasState == true ) && ( fields.isOver == true ) )
+        {
+            /* TerminalStateReached, or the job was canceled. */
+            finishJob( execution, nowMs, outAction );
+        }
+        else if( countRejection( execution ) == false )
+        {
+            handleRejected( execution, hasState, &fields, nowMs, outAction );
+        }
+        else if( ( hasState == true ) && ( fields.hasVersion == true ) &&
+                 ( isVersionMismatch( message, messageLength ) == true ) )
+        {
+            /* Only a stale expected version is fixed by sending the
+             * same update again. */
+            sendRequest( execution, JobsExecutionUpdating, JobsApiUpdate, nowMs, outAction );
+        }
+        else
+        {
+            /* InvalidStateTransition and other errors: the status was
+             * refused, so take the one known to the service. */
+            handleRejected( execution, hasState, &fields, nowMs, outAction );
+        }
+    }
+    else
+    {
+        ret = JobsNoMatch;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Handle a DescribeJobExecution response for the current job.
+ *
+ * @return #JobsSuccess if the message caused a transition;
+ * #JobsNoMatch otherwise.
+ */
+static JobsStatus_t handleSyncing( JobsExecution_t * execution,
+                                   JobsTopic_t topic,
+                                   const char * message,
+                                   size_t messageLength,
+                                   uint32_t nowMs,
+                                   JobsExecutionAction_t * outAction )
+{
+    JobsStatus_t ret = JobsSuccess;
+    ExecutionFields_t fields = { 0 };
+
+    if( ( topic == JobsDescribeSuccess ) &&
+        ( readExecution( message, messageLength, "execution", CONST_STRLEN( "execution" ), &fields ) == true ) )
+    {
+        if( fields.hasVersion == true )
+        {
+            execution->versionNumber = fields.versionNumber;
+        }
+
+        if( fields.isOver == true )
+        {
+            finishJob( execution, nowMs, outAction );
+        }
+        else
+        {
+            if( fields.hasStatus == true )
+            {
+                execution->status = ( uint8_t ) fields.status;
+            }
+
+            /* After too many rejected updates, keep the service's status. */
+            if( execution->retries > JOBS_EXECUTION_MAX_RETRIES )
+            {
+                execution->pendingStatus = execution->status;
+                execution->dirty = 0U;
+            }
+
+            settle( execution, nowMs, outAction );
+        }
+    }
+    else if( ( topic == JobsDescribeSuccess ) || ( topic == JobsDescribeFailed ) )
+    {
+        finishJob( execution, nowMs, outAction );
+    }
+    else
+    {
+        ret = JobsNoMatch;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Handle a NextJobExecutionChanged notification.
+ *
+ * @return #JobsSuccess if the message caused a transition;
+ * #JobsNoMatch otherwise.
+ */
+static JobsStatus_t handleNextJobChanged( JobsExecution_t * execution,
+                                          const char * message,
+                                          size_t messageLength,
+                                          uint32_t nowMs,
+                                          JobsExecutionAction_t * outAction )
+{
+    JobsStatus_t ret = JobsNoMatch;
+    ExecutionFields_t fields = { 0 };
+    bool hasExecution = readExecution( message, messageLength, "execution",
+                                       CONST_STRLEN( "execution" ), &fields );
+
+    if( ( execution->state == ( uint8_t ) JobsExecutionIdle ) && ( hasExecution == true ) )
+    {
+        sendRequest( execution, JobsExecutionStarting, JobsApiStartNext, nowMs, outAction );
+        ret = JobsSuccess;
+    }
+    else if( ( execution->state == ( uint8_t ) JobsExecutionRunning ) && ( hasExecution == false ) )
+    {
+        /* The current job was canceled or removed and nothing is pending. */
+        execution->jobIdHash = 0U;
+        execution->state = ( uint8_t ) JobsExecutionIdle;
+        ret = JobsSuccess;
+    }
+    else if( ( execution->state == ( uint8_t ) JobsExecutionRunning ) &&
+             ( fields.hasJobId == true ) && ( fields.jobIdHash != execution->jobIdHash ) )
+    {
+        /* An in progress execution is always next, so the current job
+         * is no longer active. */
+        finishJob( execution, nowMs, outAction );
+        ret = JobsSuccess;
+    }
+    else
+    {
+        /* MISRA Empty Body */
+    }
+
+    return ret;
+}
+
+#define checkExecution() \
+    ( ( execution != NULL ) && ( outAction != NULL ) )
+
+/** @endcond */
+
+/**
+ * See jobs_execution.h for docs.
+ *
+ * @brief Initialize a job execution record in the idle state.
+ */
+JobsStatus_t Jobs_ExecutionInit( JobsExecution_t * execution )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( execution != NULL )
+    {
+        execution->jobIdHash = 0U;
+        execution->versionNumber = 0U;
+        execution->executionNumber = 0U;
+        execution->deadlineMs = 0U;
+        execution->state = ( uint8_t ) JobsExecutionIdle;
+        execution->status = ( uint8_t ) Queued;
+        execution->pendingStatus = ( uint8_t ) Queued;
+        execution->dirty = 0U;
+        execution->retries = 0U;
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_execution.h for docs.
+ *
+ * @brief Ask for the next pending job execution.
+ */
+JobsStatus_t Jobs_ExecutionStart( JobsExecution_t * execution,
+                                  uint32_t nowMs,
+                                  JobsExecutionAction_t * outAction )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkExecution() )
+    {
+        outAction->api = JobsInvalidApi;
+        ret = JobsNoMatch;
+
+        if( execution->state == ( uint8_t ) JobsExecutionIdle )
+        {
+            sendRequest( execution, JobsExecutionStarting, JobsApiStartNext, nowMs, outAction );
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_execution.h for docs.
+ *
+ * @brief Report a new status of the current job from the application.
+ */
+JobsStatus_t Jobs_ExecutionReport( JobsExecution_t * execution,
+                                   JobCurrentStatus_t status,
+                                   uint32_t nowMs,
+                                   JobsExecutionAction_t * outAction )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    /* Only the service moves an execution to QUEUED. */
+    if( checkExecution() && ( status != Queued ) && ( ( size_t ) status <= ( size_t ) Rejected ) )
+    {
+        outAction->api = JobsInvalidApi;
+        execution->retries = 0U;
+        ret = JobsSuccess;
+
+        if( execution->state == ( uint8_t ) JobsExecutionRunning )
+        {
+            execution->pendingStatus = ( uint8_t ) status;
+            sendRequest( execution, JobsExecutionUpdating, JobsApiUpdate, nowMs, outAction );
+        }
+        else if( ( execution->state == ( uint8_t ) JobsExecutionUpdating ) ||
+                 ( execution->state == ( uint8_t ) JobsExecutionSyncing ) )
+        {
+            execution->pendingStatus = ( uint8_t ) status;
+            execution->dirty = 1U;
+        }
+        else
+        {
+            ret = JobsNoMatch;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_execution.h for docs.
+ *
+ * @brief Handle a matched Jobs message.
+ */
+JobsStatus_t Jobs_ExecutionHandle( JobsExecution_t * execution,
+                                   JobsTopic_t topic,
+                                   const char * jobId,
+                                   uint16_t jobIdLength,
+                                   const char * message,
+                                   size_t messageLength,
+                                   uint32_t nowMs,
+                                   JobsExecutionAction_t * outAction )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    bool forJob;
+
+    if( checkExecution() && ( message != NULL ) && ( messageLength > 0U ) )
+    {
+        outAction->api = JobsInvalidApi;
+        ret = JobsNoMatch;
+
+        /* Responses to Update and Describe name the job in the topic. */
+        forJob = ( ( jobId != NULL ) &&
+                   ( Jobs_Fnv1a( JOBS_FNV1A_OFFSET_BASIS, jobId, jobIdLength ) == execution->jobIdHash ) ) ? true : false;
+
+        if( JOBS_TRACE_JSON_VALIDATE( message, messageLength ) == JSONSuccess )
+        {
+            if( topic == JobsNextJobChanged )
+            {
+                ret = handleNextJobChanged( execution, message, messageLength, nowMs, outAction );
+            }
+            else if( execution->state == ( uint8_t ) JobsExecutionStarting )
+            {
+                ret = handleStarting( execution, topic, message, messageLength );
+            }
+            else if( ( execution->state == ( uint8_t ) JobsExecutionUpdating ) && ( forJob == true ) )
+            {
+                ret = handleUpdating( execution, topic, message, messageLength, nowMs, outAction );
+            }
+            else if( ( execution->state == ( uint8_t ) JobsExecutionSyncing ) && ( forJob == true ) )
+            {
+                ret = handleSyncing( execution, topic, message, messageLength, nowMs, outAction );
+            }
+            else
+            {
+                /* MISRA Empty Body */
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_execution.h for docs.
+ *
+ * @brief Retry the request in flight once its response is overdue.
+ */
+JobsStatus_t Jobs_ExecutionTick( JobsExecution_t * execution,
+                                 uint32_t nowMs,
+                                 JobsExecutionAction_t * outAction )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    bool overdue;
+
+    if( checkExecution() )
+    {
+        outAction->api = JobsInvalidApi;
+        ret = JobsNoMatch;
+        overdue = Jobs_IsDeadlineReached( nowMs, execution->deadlineMs );
+
+        if( overdue == true )
+        {
+            ret = JobsSuccess;
+
+            if( execution->state == ( uint8_t ) JobsExecutionStarting )
+            {
+                sendRequest( execution, JobsExecutionStarting, JobsApiStartNext, nowMs, outAction );
+            }
+            else if( ( execution->state == ( uint8_t ) JobsExecutionUpdating ) ||
+                     ( execution->state == ( uint8_t ) JobsExecutionSyncing ) )
+            {
+                sendRequest( execution, JobsExecutionSyncing, JobsApiDescribe, nowMs, outAction );
+            }
+            else
+            {
+                ret = JobsNoMatch;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_execution.h for docs.
+ *
+ * @brief Populate the message string of a request produced by an event.
+ */
+size_t Jobs_ExecutionMsg( const JobsExecution_t * execution,
+                          const JobsExecutionAction_t * action,
+                          const char * statusDetails,
+                          size_t statusDetailsLength,
+                          char * buffer,
+                          size_t bufferSize )
+{
+    size_t ret = 0U;
+    char expectedVersion[ JOBS_UINT32_STRING_MAX_LENGTH ];
+    JobsUpdateRequest_t update = { 0 };
+    JobsUpdateOptions_t options = { 0 };
+    JobsStartNextRequest_t startNext = { 0 };
+    JobsDescribeRequest_t describe = { 0 };
+
+    if( ( execution != NULL ) && ( action != NULL ) )
+    {
+        switch( action->api )
+        {
+            case JobsApiStartNext:
+                ret = Jobs_StartNextMsgWithOptions( &startNext, buffer, bufferSize );
+                break;
+
+            case JobsApiDescribe:
+                describe.executionNumber = execution->executionNumber;
+                describe.includeJobDocument = JobsOptionFalse;
+                ret = Jobs_DescribeMsg( &describe, buffer, bufferSize );
+                break;
+
+            case JobsApiUpdate:
+                update.status = action->status;
+                update.expectedVersion = expectedVersion;
+                update.expectedVersionLength = Jobs_UintToString( execution->versionNumber,
+                                                                  expectedVersion,
+                                                                  sizeof( expectedVersion ) );
+                update.statusDetails = statusDetails;
+                update.statusDetailsLength = statusDetailsLength;
+                options.executionNumber = execution->executionNumber;
+                options.includeJobExecutionState = JobsOptionFalse;
+                options.includeJobDocument = JobsOptionFalse;
+                ret = Jobs_UpdateMsgWithOptions( update, &options, buffer, bufferSize );
+                break;
+
+            default:
+                /* No message for this action. */
+                break;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_execution.h for docs.
+ *
+ * @brief Checks if a record follows a job.
+ */
+bool Jobs_ExecutionIsJob( const JobsExecution_t * execution,
+                          const char * jobId,
+                          size_t jobIdLength )
+{
+    return ( ( execution != NULL ) && ( jobId != NULL ) &&
+             ( execution->state != ( uint8_t ) JobsExecutionIdle ) &&
+             ( execution->state != ( uint8_t ) JobsExecutionStarting ) &&
+             ( Jobs_Fnv1a( JOBS_FNV1A_OFFSET_BASIS, jobId, jobIdLength ) == execution->jobIdHash ) ) ? true : false;
+}
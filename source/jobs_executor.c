@@ -0,0 +1,411 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_executor.c
+ * @brief Implementation of the APIs from jobs_executor.h.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Internal Includes */
+#include "jobs_executor.h"
+#include "jobs_atomic.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief Acquire a spin lock, backing off while it is taken.
+ *
+ * @param[in] lock  The lock word.
+ */
+static void acquire( uint32_t * lock )
+{
+    uint32_t expected = 0U;
+    uint32_t pauses = 1U;
+    uint32_t i;
+
+    while( JOBS_ATOMIC_COMPARE_EXCHANGE( lock, &expected, 1U ) == false )
+    {
+        if( pauses <= JOBS_EXECUTOR_BACKOFF_LIMIT )
+        {
+            for( i = 0U; i < pauses; i++ )
+            {
+                JOBS_EXECUTOR_PAUSE();
+            }
+
+            pauses *= 2U;
+        }
+        else
+        {
+            JOBS_EXECUTOR_YIELD();
+        }
+
+        expected = 0U;
+    }
+}
+
+/**
+ * @brief Release a spin lock.
+ *
+ * @param[in] lock  The lock word.
+ */
+static void release( uint32_t * lock )
+{
+    JOBS_ATOMIC_STORE_RELEASE( lock, 0U );
+}
+
+/**
+ * @brief Append a list of things to the queue of a worker.
+ *
+ * @param[in] worker  The worker.
+ * @param[in] first  The first thing of the list.
+ * @param[in] last  The last thing of the list, its pNext is NULL.
+ * @param[in] count  The number of things in the list.
+ */
+static void appendThings( JobsWorker_t * worker,
+                          JobsThingTasks_t * first,
+                          JobsThingTasks_t * last,
+                          uint32_t count )
+{
+    acquire( &worker->lock );
+
+    if( worker->pTail == NULL )
+    {
+        worker->pHead = first;
+    }
+    else
+    {
+        worker->pTail->pNext = first;
+    }
+
+    worker->pTail = last;
+    worker->count += count;
+
+    release( &worker->lock );
+}
+
+/**
+ * @brief Append a thing to the queue of a worker.
+ *
+ * @param[in] worker  The worker.
+ * @param[in] thing  The thing.
+ */
+static void pushThing( JobsWorker_t * worker,
+                       JobsThingTasks_t * thing )
+{
+    thing->pNext = NULL;
+    appendThings( worker, thing, thing, 1U );
+}
+
+/**
+ * @brief Remove the first thing from the queue of a worker.
+ *
+ * @param[in] worker  The worker.
+ *
+ * @return The thing, or NULL if the queue is empty.
+ */
+static JobsThingTasks_t * popThing( JobsWorker_t * worker )
+{
+    JobsThingTasks_t * thing;
+
+    acquire( &worker->lock );
+
+    thing = worker->pHead;
+
+    if( thing != NULL )
+    {
+        worker->pHead = thing->pNext;
+        worker->count--;
+
+        if( worker->pHead == NULL )
+        {
+            worker->pTail = NULL;
+        }
+    }
+
+    release( &worker->lock );
+
+    return thing;
+}
+
+/**
+ * @brief Move the newer half of the queue of a victim to the queue of a
+ * thief.
+ *
+ * The owner takes things from the head of its queue, so taking them from
+ * the tail leaves it the things it runs next.  Only one lock is held at a
+ * time, and the stolen things stay in order.
+ *
+ * @param[in] thief  The worker stealing.
+ * @param[in] victim  The worker stolen from.
+ *
+ * @return true if at least one thing was stolen;
+ * false if the queue of the victim is empty.
+ */
+static bool stealThings( JobsWorker_t * thief,
+                         JobsWorker_t * victim )
+{
+    JobsThingTasks_t * first = NULL;
+    JobsThingTasks_t * last = NULL;
+    JobsThingTasks_t * split;
+    uint32_t stolen = 0U;
+    uint32_t i;
+
+    acquire( &victim->lock );
+
+    if( victim->count > 0U )
+    {
+        stolen = ( victim->count + 1U ) / 2U;
+        last = victim->pTail;
+
+        if( stolen == victim->count )
+        {
+            first = victim->pHead;
+            victim->pHead = NULL;
+            victim->pTail = NULL;
+        }
+        else
+        {
+            split = victim->pHead;
+
+            for( i = 1U; i < ( victim->count - stolen ); i++ )
+            {
+                split = split->pNext;
+            }
+
+            first = split->pNext;
+            split->pNext = NULL;
+            victim->pTail = split;
+        }
+
+        victim->count -= stolen;
+    }
+
+    release( &victim->lock );
+
+    if( stolen > 0U )
+    {
+        appendThings( thief, first, last, stolen );
+    }
+
+    return ( stolen > 0U ) ? true : false;
+}
+
+/**
+ * @brief Take a thing from the queue of a worker, stealing if it is empty.
+ *
+ * @param[in] executor  The executor.
+ * @param[in] workerIndex  The index of the calling worker.
+ *
+ * @return The thing, or NULL if every queue is empty.
+ */
+static JobsThingTasks_t * takeThing( JobsExecutor_t * executor,
+                                     uint32_t workerIndex )
+{
+    JobsWorker_t * worker = &executor->pWorkers[ workerIndex ];
+    JobsThingTasks_t * thing = popThing( worker );
+    uint32_t i;
+
+    /* Another thief may empty the queue between the steal and the pop,
+     * then the next victim is tried. */
+    for( i = 1U; ( i < executor->workerCount ) && ( thing == NULL ); i++ )
+    {
+        if( stealThings( worker, &executor->pWorkers[ ( workerIndex + i ) % executor->workerCount ] ) == true )
+        {
+            thing = popThing( worker );
+        }
+    }
+
+    return thing;
+}
+
+/** @endcond */
+
+/**
+ * See jobs_executor.h for docs.
+ *
+ * @brief Initialize an executor over caller provided storage.
+ */
+JobsStatus_t Jobs_ExecutorInit( JobsExecutor_t * executor,
+                                JobsWorker_t * workers,
+                                size_t workerCount,
+                                JobsThingTasks_t * things,
+                                size_t thingCount,
+                                JobsTaskCompletion_t completion,
+                                void * pContext )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    size_t i;
+
+    if( ( executor != NULL ) && ( workers != NULL ) && ( workerCount > 0U ) &&
+        ( workerCount <= UINT32_MAX ) && ( things != NULL ) && ( thingCount > 0U ) &&
+        ( thingCount <= UINT32_MAX ) && ( completion != NULL ) )
+    {
+        for( i = 0U; i < workerCount; i++ )
+        {
+            workers[ i ].pHead = NULL;
+            workers[ i ].pTail = NULL;
+            workers[ i ].count = 0U;
+            workers[ i ].lock = 0U;
+        }
+
+        for( i = 0U; i < thingCount; i++ )
+        {
+            things[ i ].pHead = NULL;
+            things[ i ].pTail = NULL;
+            things[ i ].pNext = NULL;
+            things[ i ].lock = 0U;
+            things[ i ].scheduled = false;
+        }
+
+        executor->pWorkers = workers;
+        executor->workerCount = ( uint32_t ) workerCount;
+        executor->pThings = things;
+        executor->thingCount = ( uint32_t ) thingCount;
+        executor->completion = completion;
+        executor->pCompletionContext = pContext;
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_executor.h for docs.
+ *
+ * @brief Submit a task.
+ */
+JobsStatus_t Jobs_ExecutorSubmit( JobsExecutor_t * executor,
+                                  JobsTask_t * task,
+                                  uint32_t workerHint )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    JobsThingTasks_t * thing;
+    bool wasIdle;
+
+    if( ( executor != NULL ) && ( task != NULL ) && ( task->function != NULL ) &&
+        ( task->thingIndex < executor->thingCount ) )
+    {
+        thing = &executor->pThings[ task->thingIndex ];
+        task->pNext = NULL;
+
+        acquire( &thing->lock );
+
+        if( thing->pTail == NULL )
+        {
+            thing->pHead = task;
+        }
+        else
+        {
+            thing->pTail->pNext = task;
+        }
+
+        thing->pTail = task;
+        wasIdle = ( thing->scheduled == false ) ? true : false;
+        thing->scheduled = true;
+
+        release( &thing->lock );
+
+        /* A scheduled thing is queued or running; the worker running it
+         * queues it again if tasks remain. */
+        if( wasIdle == true )
+        {
+            pushThing( &executor->pWorkers[ workerHint % executor->workerCount ], thing );
+        }
+
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_executor.h for docs.
+ *
+ * @brief Run one task on a worker.
+ */
+JobsStatus_t Jobs_ExecutorRun( JobsExecutor_t * executor,
+                               uint32_t workerIndex )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    JobsThingTasks_t * thing;
+    JobsTask_t * task;
+    JobsWorker_t * worker;
+    JobsUpdateRequest_t request = { 0 };
+    size_t messageLength;
+    bool more;
+
+    if( ( executor != NULL ) && ( workerIndex < executor->workerCount ) )
+    {
+        ret = JobsNoMatch;
+        worker = &executor->pWorkers[ workerIndex ];
+        thing = takeThing( executor, workerIndex );
+
+        if( thing != NULL )
+        {
+            acquire( &thing->lock );
+            task = thing->pHead;
+            thing->pHead = task->pNext;
+
+            if( thing->pHead == NULL )
+            {
+                thing->pTail = NULL;
+            }
+
+            release( &thing->lock );
+
+            task->status = Failed;
+            task->statusDetails = NULL;
+            task->statusDetailsLength = 0U;
+            task->function( task );
+
+            request.status = task->status;
+            request.statusDetails = task->statusDetails;
+            request.statusDetailsLength = task->statusDetailsLength;
+            messageLength = Jobs_UpdateMsg( request, worker->message, sizeof( worker->message ) );
+
+            /* Completions of one thing are delivered in order, before its
+             * next task can start. */
+            executor->completion( task, worker->message, messageLength, executor->pCompletionContext );
+
+            acquire( &thing->lock );
+            more = ( thing->pHead != NULL ) ? true : false;
+            thing->scheduled = more;
+            release( &thing->lock );
+
+            if( more == true )
+            {
+                pushThing( worker, thing );
+            }
+
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
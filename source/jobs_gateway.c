@@ -0,0 +1,400 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_gateway.c
+ * @brief Implementation of the APIs from jobs_gateway.h.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Internal Includes */
+#include "jobs_gateway.h"
+#include "jobs_internal.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief Status of a thing without a current job.
+ */
+#define NO_JOB              0xFFU
+
+#define checkThing() \
+    ( ( gateway != NULL ) && ( index < gateway->count ) )
+
+/**
+ * @brief Number of slots of the name index, twice the capacity so that
+ * it is never more than half full.
+ */
+#define INDEX_SLOTS( gateway )    ( 2U * ( size_t ) ( gateway )->capacity )
+
+/**
+ * @brief Get the slot of the name index following a slot.
+ */
+#define NEXT_SLOT( gateway, slot ) \
+    ( ( ( ( slot ) + 1U ) < INDEX_SLOTS( gateway ) ) ? ( ( slot ) + 1U ) : 0U )
+
+/** @endcond */
+
+/**
+ * See jobs_gateway.h for docs.
+ *
+ * @brief Compute the arena size needed for a gateway table.
+ */
+size_t Jobs_GatewayArenaSize( uint32_t thingCount,
+                              size_t namesSize )
+{
+    size_t ret = 0U;
+
+    if( ( size_t ) thingCount <= ( ( SIZE_MAX - namesSize ) / JOBS_GATEWAY_THING_SIZE ) )
+    {
+        ret = ( ( size_t ) thingCount * JOBS_GATEWAY_THING_SIZE ) + namesSize;
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_gateway.h for docs.
+ *
+ * @brief Initialize a gateway table over a caller provided arena.
+ */
+JobsStatus_t Jobs_GatewayInit( JobsGateway_t * gateway,
+                               uint32_t * arena,
+                               size_t arenaSize,
+                               uint32_t thingCount )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    size_t required = Jobs_GatewayArenaSize( thingCount, 0U );
+    uint8_t * bytes;
+
+    if( ( gateway != NULL ) && ( arena != NULL ) && ( thingCount > 0U ) )
+    {
+        ret = JobsBufferTooSmall;
+
+        if( ( required > 0U ) && ( arenaSize >= required ) )
+        {
+            /* The uint32_t arrays come first to keep them aligned. */
+            gateway->pNameHash = arena;
+            gateway->pNameOffset = &gateway->pNameHash[ thingCount ];
+            gateway->pJobIdHash = &gateway->pNameOffset[ thingCount ];
+            gateway->pDeadlineMs = &gateway->pJobIdHash[ thingCount ];
+            gateway->pIndex = &gateway->pDeadlineMs[ thingCount ];
+            bytes = ( uint8_t * ) &gateway->pIndex[ 2U * ( size_t ) thingCount ];
+            gateway->pNameLength = bytes;
+            gateway->pStatus = &bytes[ thingCount ];
+            gateway->pNames = ( char * ) &bytes[ 2U * ( size_t ) thingCount ];
+            gateway->namesSize = arenaSize - required;
+            gateway->namesUsed = 0U;
+            gateway->capacity = thingCount;
+            gateway->count = 0U;
+            ( void ) memset( gateway->pIndex, 0, INDEX_SLOTS( gateway ) * sizeof( uint32_t ) );
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_gateway.h for docs.
+ *
+ * @brief Add a child thing to a gateway table.
+ */
+JobsStatus_t Jobs_GatewayAdd( JobsGateway_t * gateway,
+                              const char * thingName,
+                              uint16_t thingNameLength,
+                              uint32_t * outIndex )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    uint32_t index;
+    uint32_t hash;
+    size_t slot;
+
+    if( ( gateway != NULL ) && ( outIndex != NULL ) &&
+        ( Jobs_IsValidThingName( thingName, thingNameLength ) == true ) )
+    {
+        ret = JobsBufferTooSmall;
+
+        if( ( gateway->count < gateway->capacity ) &&
+            ( ( gateway->namesSize - gateway->namesUsed ) >= thingNameLength ) )
+        {
+            index = gateway->count;
+            hash = Jobs_Fnv1a( JOBS_FNV1A_OFFSET_BASIS, thingName, thingNameLength );
+            slot = ( size_t ) hash % INDEX_SLOTS( gateway );
+
+            /* The index is at most half full, so a free slot is found. */
+            while( gateway->pIndex[ slot ] != 0U )
+            {
+                slot = NEXT_SLOT( gateway, slot );
+            }
+
+            gateway->pIndex[ slot ] = index + 1U;
+            ( void ) memcpy( &gateway->pNames[ gateway->namesUsed ], thingName, thingNameLength );
+            gateway->pNameHash[ index ] = hash;
+            gateway->pNameOffset[ index ] = ( uint32_t ) gateway->namesUsed;
+            gateway->pNameLength[ index ] = ( uint8_t ) thingNameLength;
+            gateway->pJobIdHash[ index ] = 0U;
+            gateway->pDeadlineMs[ index ] = 0U;
+            gateway->pStatus[ index ] = NO_JOB;
+            gateway->namesUsed += thingNameLength;
+            gateway->count++;
+            *outIndex = index;
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_gateway.h for docs.
+ *
+ * @brief Find the index of a child thing by name.
+ */
+JobsStatus_t Jobs_GatewayFind( const JobsGateway_t * gateway,
+                               const char * thingName,
+                               uint16_t thingNameLength,
+                               uint32_t * outIndex )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    uint32_t hash;
+    uint32_t i;
+    size_t slot;
+
+    if( ( gateway != NULL ) && ( thingName != NULL ) && ( outIndex != NULL ) )
+    {
+        ret = JobsNoMatch;
+        hash = Jobs_Fnv1a( JOBS_FNV1A_OFFSET_BASIS, thingName, thingNameLength );
+        slot = ( size_t ) hash % INDEX_SLOTS( gateway );
+
+        /* Things are never removed, so the probe ends at the first free
+         * slot.  Duplicate names were added in order along the probe, so
+         * the first one added is found. */
+        while( ( ret == JobsNoMatch ) && ( gateway->pIndex[ slot ] != 0U ) )
+        {
+            i = gateway->pIndex[ slot ] - 1U;
+
+            if( ( gateway->pNameHash[ i ] == hash ) &&
+                ( gateway->pNameLength[ i ] == thingNameLength ) &&
+                ( memcmp( &gateway->pNames[ gateway->pNameOffset[ i ] ], thingName, thingNameLength ) == 0 ) )
+            {
+                *outIndex = i;
+                ret = JobsSuccess;
+            }
+
+            slot = NEXT_SLOT( gateway, slot );
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_gateway.h for docs.
+ *
+ * @brief Get the name of a child thing.
+ */
+JobsStatus_t Jobs_GatewayThingName( const JobsGateway_t * gateway,
+                                    uint32_t index,
+                                    const char ** outThingName,
+                                    uint16_t * outThingNameLength )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkThing() && ( outThingName != NULL ) && ( outThingNameLength != NULL ) )
+    {
+        *outThingName = &gateway->pNames[ gateway->pNameOffset[ index ] ];
+        *outThingNameLength = gateway->pNameLength[ index ];
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_gateway.h for docs.
+ *
+ * @brief Set the current job of a child thing.
+ */
+JobsStatus_t Jobs_GatewaySetJob( JobsGateway_t * gateway,
+                                 uint32_t index,
+                                 const char * jobId,
+                                 uint16_t jobIdLength,
+                                 JobCurrentStatus_t status,
+                                 uint32_t deadlineMs )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkThing() && ( Jobs_IsValidJobId( jobId, jobIdLength ) == true ) &&
+        ( ( size_t ) status <= ( size_t ) Rejected ) )
+    {
+        gateway->pJobIdHash[ index ] = Jobs_Fnv1a( JOBS_FNV1A_OFFSET_BASIS, jobId, jobIdLength );
+        gateway->pDeadlineMs[ index ] = deadlineMs;
+        gateway->pStatus[ index ] = ( uint8_t ) status;
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_gateway.h for docs.
+ *
+ * @brief Update the status and deadline of the current job of a child thing.
+ */
+JobsStatus_t Jobs_GatewayUpdateJob( JobsGateway_t * gateway,
+                                    uint32_t index,
+                                    JobCurrentStatus_t status,
+                                    uint32_t deadlineMs )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkThing() && ( ( size_t ) status <= ( size_t ) Rejected ) )
+    {
+        ret = JobsNoMatch;
+
+        if( gateway->pStatus[ index ] != NO_JOB )
+        {
+            gateway->pDeadlineMs[ index ] = deadlineMs;
+            gateway->pStatus[ index ] = ( uint8_t ) status;
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_gateway.h for docs.
+ *
+ * @brief Clear the current job of a child thing.
+ */
+JobsStatus_t Jobs_GatewayClearJob( JobsGateway_t * gateway,
+                                   uint32_t index )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkThing() )
+    {
+        ret = JobsNoMatch;
+
+        if( gateway->pStatus[ index ] != NO_JOB )
+        {
+            gateway->pJobIdHash[ index ] = 0U;
+            gateway->pStatus[ index ] = NO_JOB;
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_gateway.h for docs.
+ *
+ * @brief Get the status and deadline of the current job of a child thing.
+ */
+JobsStatus_t Jobs_GatewayGetJob( const JobsGateway_t * gateway,
+                                 uint32_t index,
+                                 JobCurrentStatus_t * outStatus,
+                                 uint32_t * outDeadlineMs )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkThing() && ( outStatus != NULL ) )
+    {
+        ret = JobsNoMatch;
+
+        if( gateway->pStatus[ index ] != NO_JOB )
+        {
+            *outStatus = ( JobCurrentStatus_t ) gateway->pStatus[ index ];
+
+            if( outDeadlineMs != NULL )
+            {
+                *outDeadlineMs = gateway->pDeadlineMs[ index ];
+            }
+
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_gateway.h for docs.
+ *
+ * @brief Checks if the current job of a child thing has a job ID.
+ */
+bool Jobs_GatewayIsJob( const JobsGateway_t * gateway,
+                        uint32_t index,
+                        const char * jobId,
+                        uint16_t jobIdLength )
+{
+    return ( checkThing() && ( jobId != NULL ) &&
+             ( gateway->pStatus[ index ] != NO_JOB ) &&
+             ( gateway->pJobIdHash[ index ] == Jobs_Fnv1a( JOBS_FNV1A_OFFSET_BASIS, jobId, jobIdLength ) ) ) ? true : false;
+}
+
+/**
+ * See jobs_gateway.h for docs.
+ *
+ * @brief Collect the things whose current job deadline has passed.
+ */
+JobsStatus_t Jobs_GatewayExpired( const JobsGateway_t * gateway,
+                                  uint32_t nowMs,
+                                  uint32_t * cursor,
+                                  uint32_t * indices,
+                                  size_t maxIndices,
+                                  size_t * outCount )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    uint32_t i;
+    size_t count = 0U;
+
+    if( ( gateway != NULL ) && ( cursor != NULL ) && ( indices != NULL ) &&
+        ( maxIndices > 0U ) && ( outCount != NULL ) )
+    {
+        for( i = *cursor; ( i < gateway->count ) && ( count < maxIndices ); i++ )
+        {
+            if( ( gateway->pStatus[ i ] != NO_JOB ) &&
+                ( Jobs_IsDeadlineReached( nowMs, gateway->pDeadlineMs[ i ] ) == true ) )
+            {
+                indices[ count ] = i;
+                count++;
+            }
+        }
+
+        *cursor = i;
+        *outCount = count;
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
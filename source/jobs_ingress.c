@@ -0,0 +1,154 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_ingress.c
+ * @brief Implementation of the APIs from jobs_ingress.h.
+ *
+ * The ring follows the slot protocol of jobs_ring.h.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Internal Includes */
+#include "jobs_ingress.h"
+#include "jobs_ring.h"
+
+/**
+ * See jobs_ingress.h for docs.
+ *
+ * @brief Initialize an ingress ring over caller provided slots.
+ */
+JobsStatus_t Jobs_IngressInit( JobsIngressQueue_t * queue,
+                               JobsIngressSlot_t * slots,
+                               size_t slotCount,
+                               bool multiProducer )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( ( queue != NULL ) && ( slots != NULL ) && ( slotCount >= 2U ) &&
+        ( slotCount <= JOBS_RING_MAX_SLOTS ) && ( ( slotCount & ( slotCount - 1U ) ) == 0U ) )
+    {
+        Jobs_RingInit( slots, sizeof( JobsIngressSlot_t ), slotCount );
+        queue->pSlots = slots;
+        queue->mask = ( uint32_t ) ( slotCount - 1U );
+        queue->multiProducer = multiProducer;
+        queue->head = 0U;
+        queue->tail = 0U;
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_ingress.h for docs.
+ *
+ * @brief Classify an incoming message and push its descriptor.
+ */
+JobsStatus_t Jobs_IngressPush( JobsIngressQueue_t * queue,
+                               char * topic,
+                               size_t topicLength,
+                               const char * thingName,
+                               uint16_t thingNameLength,
+                               void * pPayload,
+                               size_t payloadLength )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    JobsTopic_t api = JobsInvalidTopic;
+    char * jobId = NULL;
+    uint16_t jobIdLength = 0U;
+    uint32_t position = 0U;
+    JobsIngressSlot_t * slot;
+
+    if( queue != NULL )
+    {
+        ret = Jobs_MatchTopic( topic, topicLength, thingName, thingNameLength,
+                               &api, &jobId, &jobIdLength );
+    }
+
+    if( ( ret == JobsSuccess ) && ( jobIdLength > JOBID_MAX_LENGTH ) )
+    {
+        ret = JobsNoMatch;
+    }
+
+    if( ret == JobsSuccess )
+    {
+        ret = JobsBufferTooSmall;
+
+        if( Jobs_RingReserve( &queue->head, queue->pSlots, sizeof( JobsIngressSlot_t ),
+                              queue->mask, queue->multiProducer, &position ) == true )
+        {
+            slot = &queue->pSlots[ position & queue->mask ];
+            slot->item.pPayload = pPayload;
+            slot->item.payloadLength = payloadLength;
+            slot->item.topic = api;
+            slot->item.jobIdLength = jobIdLength;
+
+            if( jobIdLength > 0U )
+            {
+                ( void ) memcpy( slot->item.jobId, jobId, jobIdLength );
+            }
+
+            Jobs_RingPublish( &slot->sequence, position );
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_ingress.h for docs.
+ *
+ * @brief Pop the oldest descriptor.
+ */
+JobsStatus_t Jobs_IngressPop( JobsIngressQueue_t * queue,
+                              JobsIngressItem_t * outItem )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    uint32_t position;
+    JobsIngressSlot_t * slot;
+
+    if( ( queue != NULL ) && ( outItem != NULL ) )
+    {
+        ret = JobsNoMatch;
+        position = queue->tail;
+        slot = &queue->pSlots[ position & queue->mask ];
+
+        if( Jobs_RingIsPublished( &slot->sequence, position ) == true )
+        {
+            *outItem = slot->item;
+            queue->tail = position + 1U;
+            Jobs_RingRelease( &slot->sequence, position, queue->mask );
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
@@ -0,0 +1,728 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_journal.c
+ * @brief Implementation of the APIs from jobs_journal.h.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Internal Includes */
+#include "jobs_journal.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief Record kinds.
+ */
+#define KIND_HEADER           0U
+#define KIND_JOB              1U
+
+/**
+ * @brief Offsets of the fields of a record.
+ *
+ * Multi-byte fields are little endian, so the journal is portable
+ * between builds.
+ */
+#define OFFSET_GENERATION     0U
+#define OFFSET_KIND           4U
+#define OFFSET_STATUS         5U
+#define OFFSET_JOBID_LENGTH   6U
+#define OFFSET_DOC_LENGTH     8U
+#define OFFSET_VERSION        12U
+#define OFFSET_PROGRESS       16U
+#define OFFSET_JOBID          20U
+#define OFFSET_DOCUMENT       ( OFFSET_JOBID + JOBID_MAX_LENGTH )
+#define OFFSET_CRC            ( JOBS_JOURNAL_RECORD_SIZE - 4U )
+
+/**
+ * @brief Half the range of a generation count.
+ */
+#define HALF_RANGE            0x80000000U
+
+/**
+ * @brief Reflected CRC-32 (IEEE 802.3) polynomial.
+ */
+#define CRC32_POLYNOMIAL      0xEDB88320U
+
+/**
+ * @brief Number of records that fit in a segment.
+ */
+#define RECORDS_PER_SEGMENT( journal ) \
+    ( ( journal )->segmentSize / JOBS_JOURNAL_RECORD_SIZE )
+
+/**
+ * @brief Offset of the first record of the active segment.
+ *
+ * The append offset is always past the segment header, and equals the
+ * segment size when the first segment is full.
+ */
+#define ACTIVE_BASE( journal ) \
+    ( ( ( journal )->appendOffset > ( journal )->segmentSize ) ? ( journal )->segmentSize : 0U )
+
+/**
+ * @brief Check common parameters.
+ */
+#define checkJournal() \
+    ( ( journal != NULL ) && ( journal->pEntries != NULL ) )
+
+/**
+ * @brief Store a value in little endian order.
+ *
+ * @param[out] buffer  Where to store the value.
+ * @param[in] value  The value.
+ * @param[in] size  Number of bytes of the value to store.
+ */
+static void putLE( uint8_t * buffer,
+                   uint32_t value,
+                   size_t size )
+{
+    size_t i;
+
+    for( i = 0U; i < size; i++ )
+    {
+        buffer[ i ] = ( uint8_t ) ( value >> ( 8U * i ) );
+    }
+}
+
+/**
+ * @brief Load a value stored in little endian order.
+ *
+ * @param[in] buffer  Where the value is stored.
+ * @param[in] size  Number of bytes of the value.
+ *
+ * @return The value.
+ */
+static uint32_t getLE( const uint8_t * buffer,
+                       size_t size )
+{
+    uint32_t value = 0U;
+    size_t i;
+
+    for( i = 0U; i < size; i++ )
+    {
+        value |= ( ( uint32_t ) buffer[ i ] ) << ( 8U * i );
+    }
+
+    return value;
+}
+
+/**
+ * @brief Compute the CRC-32 of a record, excluding its CRC field.
+ *
+ * @param[in] record  The encoded record.
+ *
+ * @return The CRC.
+ */
+static uint32_t crc32( const uint8_t * record )
+{
+    uint32_t crc = 0xFFFFFFFFU;
+    size_t i;
+    size_t bit;
+
+    for( i = 0U; i < OFFSET_CRC; i++ )
+    {
+        crc ^= record[ i ];
+
+        for( bit = 0U; bit < 8U; bit++ )
+        {
+            crc = ( ( crc & 1U ) != 0U ) ? ( ( crc >> 1 ) ^ CRC32_POLYNOMIAL ) : ( crc >> 1 );
+        }
+    }
+
+    return crc ^ 0xFFFFFFFFU;
+}
+
+/**
+ * @brief Encode a record into the journal encoding buffer.
+ *
+ * @param[in] journal  The journal.
+ * @param[in] generation  The generation of the segment written to.
+ * @param[in] kind  The record kind.
+ * @param[in] update  The record content, for a header only versionNumber,
+ * the live job count, is used.
+ */
+static void encode( JobsJournal_t * journal,
+                    uint32_t generation,
+                    uint8_t kind,
+                    const JobsJournalUpdate_t * update )
+{
+    uint8_t * record = journal->record;
+
+    ( void ) memset( record, 0, JOBS_JOURNAL_RECORD_SIZE );
+    putLE( &record[ OFFSET_GENERATION ], generation, 4U );
+    record[ OFFSET_KIND ] = kind;
+    putLE( &record[ OFFSET_VERSION ], update->versionNumber, 4U );
+
+    if( kind == KIND_JOB )
+    {
+        record[ OFFSET_STATUS ] = ( uint8_t ) update->status;
+        record[ OFFSET_JOBID_LENGTH ] = ( uint8_t ) update->jobIdLength;
+        putLE( &record[ OFFSET_DOC_LENGTH ], ( uint32_t ) update->documentLength, 2U );
+        putLE( &record[ OFFSET_PROGRESS ], update->progress, 4U );
+        ( void ) memcpy( &record[ OFFSET_JOBID ], update->jobId, update->jobIdLength );
+
+        if( update->documentLength > 0U )
+        {
+            ( void ) memcpy( &record[ OFFSET_DOCUMENT ], update->document, update->documentLength );
+        }
+    }
+
+    putLE( &record[ OFFSET_CRC ], crc32( record ), 4U );
+}
+
+/**
+ * @brief Read and decode the record at an offset.
+ *
+ * @param[in] journal  The journal.
+ * @param[in] offset  Offset of the record in storage.
+ * @param[out] outGeneration  The generation of the record.
+ * @param[out] outKind  The record kind.
+ * @param[out] outUpdate  The record content, pointing into the journal
+ * encoding buffer.
+ *
+ * @return true if the record is complete and well formed;
+ * false otherwise.
+ */
+static bool decode( JobsJournal_t * journal,
+                    size_t offset,
+                    uint32_t * outGeneration,
+                    uint8_t * outKind,
+                    JobsJournalUpdate_t * outUpdate )
+{
+    const uint8_t * record = journal->record;
+    bool ret = false;
+
+    if( journal->store.read( journal->store.pContext, offset, journal->record,
+                             JOBS_JOURNAL_RECORD_SIZE ) == JOBS_JOURNAL_RECORD_SIZE )
+    {
+        ret = ( getLE( &record[ OFFSET_CRC ], 4U ) == crc32( record ) ) ? true : false;
+    }
+
+    if( ret == true )
+    {
+        *outGeneration = getLE( &record[ OFFSET_GENERATION ], 4U );
+        *outKind = record[ OFFSET_KIND ];
+        outUpdate->jobId = ( const char * ) &record[ OFFSET_JOBID ];
+        outUpdate->jobIdLength = record[ OFFSET_JOBID_LENGTH ];
+        outUpdate->status = ( JobCurrentStatus_t ) record[ OFFSET_STATUS ];
+        outUpdate->versionNumber = getLE( &record[ OFFSET_VERSION ], 4U );
+        outUpdate->progress = getLE( &record[ OFFSET_PROGRESS ], 4U );
+        outUpdate->document = ( const char * ) &record[ OFFSET_DOCUMENT ];
+        outUpdate->documentLength = getLE( &record[ OFFSET_DOC_LENGTH ], 2U );
+
+        if( *outKind == KIND_JOB )
+        {
+            ret = ( ( outUpdate->jobIdLength > 0U ) &&
+                    ( outUpdate->jobIdLength <= JOBID_MAX_LENGTH ) &&
+                    ( outUpdate->status <= Rejected ) &&
+                    ( outUpdate->documentLength <= JOBS_JOURNAL_DOCUMENT_MAX_LENGTH ) ) ? true : false;
+        }
+        else
+        {
+            ret = ( *outKind == KIND_HEADER ) ? true : false;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Find the entry holding a job.
+ *
+ * @param[in] journal  The journal.
+ * @param[in] jobId  The job ID.
+ * @param[in] jobIdLength  The length of the job ID.
+ * @param[out] outFree  A free entry, or NULL if none.
+ *
+ * @return The entry, or NULL if the job has none.
+ */
+static JobsJournalEntry_t * findJournalEntry( JobsJournal_t * journal,
+                                              const char * jobId,
+                                              uint16_t jobIdLength,
+                                              JobsJournalEntry_t ** outFree )
+{
+    JobsJournalEntry_t * ret = NULL;
+    size_t i;
+
+    *outFree = NULL;
+
+    for( i = 0U; ( i < journal->entryCount ) && ( ret == NULL ); i++ )
+    {
+        JobsJournalEntry_t * entry = &journal->pEntries[ i ];
+
+        if( entry->inUse == false )
+        {
+            if( *outFree == NULL )
+            {
+                *outFree = entry;
+            }
+        }
+        else if( ( entry->jobIdLength == jobIdLength ) &&
+                 ( memcmp( entry->jobId, jobId, jobIdLength ) == 0 ) )
+        {
+            ret = entry;
+        }
+        else
+        {
+            /* MISRA Empty Body */
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Apply a change to the live state.
+ *
+ * @param[in] entry  The entry holding the job, or NULL if it has none.
+ * @param[in] freeEntry  A free entry, or NULL if none.
+ * @param[in] update  The change.
+ *
+ * @return #JobsSuccess if the change was applied;
+ * #JobsBufferTooSmall if the job is new and there is no free entry.
+ */
+static JobsStatus_t apply( JobsJournalEntry_t * entry,
+                           JobsJournalEntry_t * freeEntry,
+                           const JobsJournalUpdate_t * update )
+{
+    JobsJournalEntry_t * target = entry;
+    JobsStatus_t ret = JobsSuccess;
+
+    if( Jobs_IsTerminalStatus( update->status ) == true )
+    {
+        if( target != NULL )
+        {
+            target->inUse = false;
+        }
+    }
+    else
+    {
+        if( target == NULL )
+        {
+            target = freeEntry;
+
+            if( target != NULL )
+            {
+                ( void ) memcpy( target->jobId, update->jobId, update->jobIdLength );
+                target->jobIdLength = update->jobIdLength;
+                target->documentLength = 0U;
+                target->inUse = true;
+            }
+            else
+            {
+                ret = JobsBufferTooSmall;
+            }
+        }
+
+        if( target != NULL )
+        {
+            target->status = update->status;
+            target->versionNumber = update->versionNumber;
+            target->progress = update->progress;
+
+            if( update->document != NULL )
+            {
+                ( void ) memcpy( target->document, update->document, update->documentLength );
+                target->documentLength = ( uint16_t ) update->documentLength;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Count the live jobs.
+ *
+ * @param[in] journal  The journal.
+ *
+ * @return The number of entries in use.
+ */
+static uint32_t liveCount( const JobsJournal_t * journal )
+{
+    uint32_t count = 0U;
+    size_t i;
+
+    for( i = 0U; i < journal->entryCount; i++ )
+    {
+        if( journal->pEntries[ i ].inUse == true )
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Free every entry.
+ *
+ * @param[in] journal  The journal.
+ */
+static void clearEntries( JobsJournal_t * journal )
+{
+    size_t i;
+
+    for( i = 0U; i < journal->entryCount; i++ )
+    {
+        journal->pEntries[ i ].inUse = false;
+    }
+}
+
+/**
+ * @brief Write the encoded record to storage.
+ *
+ * @param[in] journal  The journal.
+ * @param[in] offset  Offset of the record in storage.
+ *
+ * @return true if the whole record was written;
+ * false otherwise.
+ */
+static bool writeRecord( JobsJournal_t * journal,
+                         size_t offset )
+{
+    return ( journal->store.write( journal->store.pContext, offset, journal->record,
+                                   JOBS_JOURNAL_RECORD_SIZE ) == JOBS_JOURNAL_RECORD_SIZE ) ? true : false;
+}
+
+/**
+ * @brief Replay a segment into the live state.
+ *
+ * The replay ends at the first record that is torn or belongs to another
+ * generation.
+ *
+ * @param[in] journal  The journal, with entries cleared.
+ * @param[in] base  Offset of the segment.
+ * @param[in] generation  Generation from the segment header.
+ * @param[in] snapshotCount  Live job count from the segment header.
+ * @param[out] outOverflow  Set if a job was dropped for lack of entries.
+ *
+ * @return true if the segment snapshot is complete, with appendOffset
+ * set past the last record;
+ * false otherwise.
+ */
+static bool replay( JobsJournal_t * journal,
+                    size_t base,
+                    uint32_t generation,
+                    uint32_t snapshotCount,
+                    bool * outOverflow )
+{
+    JobsJournalUpdate_t update = { 0 };
+    JobsJournalEntry_t * entry;
+    JobsJournalEntry_t * freeEntry;
+    uint32_t recordGeneration = 0U;
+    uint8_t kind = KIND_HEADER;
+    size_t records = 1U;
+    bool valid = true;
+
+    while( ( valid == true ) && ( records < RECORDS_PER_SEGMENT( journal ) ) )
+    {
+        valid = decode( journal, base + ( records * JOBS_JOURNAL_RECORD_SIZE ),
+                        &recordGeneration, &kind, &update );
+        valid = ( ( valid == true ) && ( recordGeneration == generation ) &&
+                  ( kind == KIND_JOB ) ) ? true : false;
+
+        if( valid == true )
+        {
+            entry = findJournalEntry( journal, update.jobId, update.jobIdLength, &freeEntry );
+
+            if( apply( entry, freeEntry, &update ) != JobsSuccess )
+            {
+                *outOverflow = true;
+            }
+
+            records++;
+        }
+    }
+
+    journal->appendOffset = base + ( records * JOBS_JOURNAL_RECORD_SIZE );
+
+    return ( ( records - 1U ) >= snapshotCount ) ? true : false;
+}
+
+/** @endcond */
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_journal.h for docs.
+ *
+ * @brief Initialize a journal.
+ */
+JobsStatus_t Jobs_JournalInit( JobsJournal_t * journal,
+                               const JobsJournalStore_t * store,
+                               size_t segmentSize,
+                               JobsJournalEntry_t * entries,
+                               size_t entryCount )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( ( journal != NULL ) && ( store != NULL ) && ( store->read != NULL ) &&
+        ( store->write != NULL ) && ( entries != NULL ) && ( entryCount > 0U ) &&
+        ( ( segmentSize / JOBS_JOURNAL_RECORD_SIZE ) >= ( entryCount + 2U ) ) )
+    {
+        journal->store = *store;
+        journal->pEntries = entries;
+        journal->entryCount = entryCount;
+        journal->segmentSize = segmentSize;
+        journal->appendOffset = 0U;
+        journal->generation = 0U;
+        journal->lastGeneration = 0U;
+        clearEntries( journal );
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_journal.h for docs.
+ *
+ * @brief Restore the live job state from storage.
+ */
+JobsStatus_t Jobs_JournalRestore( JobsJournal_t * journal )
+{
+    JobsJournalUpdate_t header[ 2 ] = { { 0 } };
+    uint32_t generation[ 2 ] = { 0U, 0U };
+    bool valid[ 2 ] = { false, false };
+    bool restored = false;
+    bool overflow = false;
+    uint8_t kind = KIND_JOB;
+    size_t first = 0U;
+    size_t i;
+    size_t segment;
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkJournal() )
+    {
+        journal->lastGeneration = 0U;
+
+        for( i = 0U; i < 2U; i++ )
+        {
+            valid[ i ] = ( ( decode( journal, i * journal->segmentSize, &generation[ i ],
+                                     &kind, &header[ i ] ) == true ) &&
+                           ( kind == KIND_HEADER ) ) ? true : false;
+
+            /* A header is written before its snapshot, so its generation is
+             * never reused even when the snapshot is torn. */
+            if( ( valid[ i ] == true ) &&
+                ( ( uint32_t ) ( generation[ i ] - journal->lastGeneration ) < HALF_RANGE ) )
+            {
+                journal->lastGeneration = generation[ i ];
+            }
+        }
+
+        if( ( valid[ 0 ] == true ) && ( valid[ 1 ] == true ) &&
+            ( ( uint32_t ) ( generation[ 1 ] - generation[ 0 ] ) < HALF_RANGE ) )
+        {
+            first = 1U;
+        }
+
+        for( i = 0U; ( i < 2U ) && ( restored == false ); i++ )
+        {
+            segment = ( first + i ) % 2U;
+
+            if( valid[ segment ] == true )
+            {
+                clearEntries( journal );
+                overflow = false;
+                restored = replay( journal, segment * journal->segmentSize, generation[ segment ],
+                                   header[ segment ].versionNumber, &overflow );
+                journal->generation = generation[ segment ];
+            }
+        }
+
+        if( restored == true )
+        {
+            ret = ( overflow == true ) ? JobsBufferTooSmall : JobsSuccess;
+        }
+        else
+        {
+            clearEntries( journal );
+            journal->appendOffset = 0U;
+            ret = Jobs_JournalCompact( journal );
+        }
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_journal.h for docs.
+ *
+ * @brief Append a change to the journal and apply it to the live state.
+ */
+JobsStatus_t Jobs_JournalRecord( JobsJournal_t * journal,
+                                 const JobsJournalUpdate_t * update )
+{
+    JobsJournalUpdate_t record;
+    JobsJournalEntry_t * entry = NULL;
+    JobsJournalEntry_t * freeEntry = NULL;
+    size_t base;
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkJournal() && ( update != NULL ) &&
+        ( Jobs_IsValidJobId( update->jobId, update->jobIdLength ) == true ) &&
+        ( update->status <= Rejected ) &&
+        ( ( update->document != NULL ) || ( update->documentLength == 0U ) ) &&
+        ( update->documentLength <= JOBS_JOURNAL_DOCUMENT_MAX_LENGTH ) )
+    {
+        record = *update;
+        entry = findJournalEntry( journal, update->jobId, update->jobIdLength, &freeEntry );
+        ret = JobsSuccess;
+
+        if( ( entry == NULL ) && ( Jobs_IsTerminalStatus( update->status ) == true ) )
+        {
+            /* Nothing is journaled for a job that is not live. */
+            ret = JobsNoMatch;
+        }
+        else if( ( entry == NULL ) && ( freeEntry == NULL ) )
+        {
+            ret = JobsBufferTooSmall;
+        }
+        else if( ( record.document == NULL ) && ( entry != NULL ) )
+        {
+            record.document = entry->document;
+            record.documentLength = entry->documentLength;
+        }
+        else
+        {
+            /* MISRA Empty Body */
+        }
+    }
+
+    if( ret == JobsSuccess )
+    {
+        base = ACTIVE_BASE( journal );
+
+        if( ( journal->appendOffset + JOBS_JOURNAL_RECORD_SIZE ) >
+            ( base + ( RECORDS_PER_SEGMENT( journal ) * JOBS_JOURNAL_RECORD_SIZE ) ) )
+        {
+            ret = Jobs_JournalCompact( journal );
+        }
+    }
+
+    if( ret == JobsSuccess )
+    {
+        encode( journal, journal->generation, KIND_JOB, &record );
+
+        if( writeRecord( journal, journal->appendOffset ) == true )
+        {
+            journal->appendOffset += JOBS_JOURNAL_RECORD_SIZE;
+            ( void ) apply( entry, freeEntry, &record );
+        }
+        else
+        {
+            ret = JobsError;
+        }
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_journal.h for docs.
+ *
+ * @brief Write a snapshot of the live jobs to the other segment.
+ */
+JobsStatus_t Jobs_JournalCompact( JobsJournal_t * journal )
+{
+    JobsJournalUpdate_t record = { 0 };
+    const JobsJournalEntry_t * entry;
+    uint32_t generation;
+    size_t offset;
+    size_t i;
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkJournal() )
+    {
+        generation = journal->lastGeneration + 1U;
+        offset = ( ACTIVE_BASE( journal ) == 0U ) ? journal->segmentSize : 0U;
+        record.versionNumber = liveCount( journal );
+        encode( journal, generation, KIND_HEADER, &record );
+        journal->lastGeneration = generation;
+        ret = ( writeRecord( journal, offset ) == true ) ? JobsSuccess : JobsError;
+
+        for( i = 0U; ( i < journal->entryCount ) && ( ret == JobsSuccess ); i++ )
+        {
+            entry = &journal->pEntries[ i ];
+
+            if( entry->inUse == true )
+            {
+                record.jobId = entry->jobId;
+                record.jobIdLength = entry->jobIdLength;
+                record.status = entry->status;
+                record.versionNumber = entry->versionNumber;
+                record.progress = entry->progress;
+                record.document = entry->document;
+                record.documentLength = entry->documentLength;
+                offset += JOBS_JOURNAL_RECORD_SIZE;
+                encode( journal, generation, KIND_JOB, &record );
+                ret = ( writeRecord( journal, offset ) == true ) ? JobsSuccess : JobsError;
+            }
+        }
+
+        if( ret == JobsSuccess )
+        {
+            journal->generation = generation;
+            journal->appendOffset = offset + JOBS_JOURNAL_RECORD_SIZE;
+        }
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_journal.h for docs.
+ *
+ * @brief Get a live job entry by index.
+ */
+JobsStatus_t Jobs_JournalEntry( const JobsJournal_t * journal,
+                                size_t index,
+                                const JobsJournalEntry_t ** outEntry )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkJournal() && ( outEntry != NULL ) && ( index < journal->entryCount ) )
+    {
+        *outEntry = &journal->pEntries[ index ];
+        ret = ( journal->pEntries[ index ].inUse == true ) ? JobsSuccess : JobsNoMatch;
+    }
+
+    return ret;
+}
@@ -0,0 +1,572 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_latency.c
+ * @brief Implementation of the APIs from jobs_latency.h.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Internal Includes */
+#include "jobs_latency.h"
+#include "jobs_internal.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief Get the length of a string literal.
+ */
+#define CONST_STRLEN( x )             ( sizeof( ( x ) ) - 1U )
+
+/**
+ * @brief Number of linear sub-buckets per power of two.
+ */
+#define LATENCY_SUB_BUCKETS           4U
+
+/**
+ * @brief Member names of the phases in a serialized record.
+ */
+static const char * const phaseName[] =
+{
+    "queued",
+    "firstUpdate",
+    "updateInterval",
+    "updateAck",
+    "running",
+    "total"
+};
+
+/**
+ * @brief Find the bucket of a duration.
+ *
+ * @param[in] durationMs  The duration.
+ *
+ * @return The bucket index.
+ */
+static size_t bucketOfDuration( uint32_t durationMs )
+{
+    uint32_t exponent = 0U;
+    uint32_t rest = durationMs;
+    size_t ret = ( size_t ) durationMs;
+
+    if( durationMs >= LATENCY_SUB_BUCKETS )
+    {
+        while( rest > 1U )
+        {
+            rest >>= 1;
+            exponent++;
+        }
+
+        /* The two bits below the highest bit select the sub-bucket. */
+        ret = ( size_t ) ( ( LATENCY_SUB_BUCKETS * ( exponent - 1U ) ) +
+                           ( ( durationMs >> ( exponent - 2U ) ) & ( LATENCY_SUB_BUCKETS - 1U ) ) );
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Find the largest duration of a bucket.
+ *
+ * @param[in] bucket  The bucket index.
+ *
+ * @return The duration in milliseconds.
+ */
+static uint32_t bucketUpperBound( size_t bucket )
+{
+    uint32_t exponent;
+    uint32_t ret = ( uint32_t ) bucket;
+
+    if( bucket >= LATENCY_SUB_BUCKETS )
+    {
+        exponent = ( ( uint32_t ) bucket / LATENCY_SUB_BUCKETS ) + 1U;
+        ret = ( ( LATENCY_SUB_BUCKETS + ( ( uint32_t ) bucket % LATENCY_SUB_BUCKETS ) ) << ( exponent - 2U ) ) +
+              ( ( ( uint32_t ) 1U << ( exponent - 2U ) ) - 1U );
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Count a duration in the histogram of a phase.
+ *
+ * @param[in] latency  The record.
+ * @param[in] phase  The phase.
+ * @param[in] sinceMs  When the phase began.
+ * @param[in] nowMs  When the phase ended.
+ */
+static void recordDuration( JobsLatency_t * latency,
+                            JobsLatencyPhase_t phase,
+                            uint32_t sinceMs,
+                            uint32_t nowMs )
+{
+    uint16_t * count = &latency->phases[ phase ].counts[ bucketOfDuration( nowMs - sinceMs ) ];
+
+    if( *count < UINT16_MAX )
+    {
+        ( *count )++;
+    }
+}
+
+/**
+ * @brief Predicate returns true if a stored job ID equals a job ID.
+ *
+ * @param[in] stored  The stored job ID.
+ * @param[in] storedLength  The length of the stored job ID.
+ * @param[in] jobId  The job ID.
+ * @param[in] jobIdLength  The length of the job ID.
+ *
+ * @return true if the job IDs are equal;
+ * false otherwise
+ */
+static bool isSameJobId( const char * stored,
+                         uint16_t storedLength,
+                         const char * jobId,
+                         size_t jobIdLength )
+{
+    return ( ( storedLength == jobIdLength ) &&
+             ( memcmp( stored, jobId, jobIdLength ) == 0 ) ) ? true : false;
+}
+
+/**
+ * @brief Handle a NextJobExecutionChanged notification.
+ *
+ * @return #JobsSuccess if the notified job was timestamped;
+ * #JobsNoMatch otherwise.
+ */
+static JobsStatus_t handleNotify( JobsLatency_t * latency,
+                                  const char * message,
+                                  size_t messageLength,
+                                  uint32_t nowMs )
+{
+    JobsStatus_t ret = JobsNoMatch;
+    const char * jobId = NULL;
+    size_t jobIdLength = Jobs_GetJobId( message, messageLength, &jobId );
+
+    if( jobIdLength > 0U )
+    {
+        /* The current job is notified again until it ends, and the same
+         * next job until it starts. */
+        if( ( jobIdLength <= JOBS_JOBID_MAX_LENGTH ) &&
+            ( ( latency->hasJob == false ) ||
+              ( isSameJobId( latency->jobId, latency->jobIdLength, jobId, jobIdLength ) == false ) ) &&
+            ( ( latency->hasNext == false ) ||
+              ( isSameJobId( latency->nextJobId, latency->nextJobIdLength, jobId, jobIdLength ) == false ) ) )
+        {
+            ( void ) memcpy( latency->nextJobId, jobId, jobIdLength );
+            latency->nextJobIdLength = ( uint16_t ) jobIdLength;
+            latency->nextNotifyMs = nowMs;
+            latency->hasNext = true;
+            ret = JobsSuccess;
+        }
+    }
+    else
+    {
+        /* Nothing is pending. */
+        latency->hasNext = false;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Handle an accepted StartNextPendingJobExecution response.
+ *
+ * @return #JobsSuccess if a job was started;
+ * #JobsNoMatch otherwise.
+ */
+static JobsStatus_t handleStarted( JobsLatency_t * latency,
+                                   const char * message,
+                                   size_t messageLength,
+                                   uint32_t nowMs )
+{
+    JobsStatus_t ret = JobsNoMatch;
+    const char * jobId = NULL;
+    size_t jobIdLength = Jobs_GetJobId( message, messageLength, &jobId );
+
+    if( ( jobIdLength > 0U ) && ( jobIdLength <= JOBS_JOBID_MAX_LENGTH ) )
+    {
+        if( ( latency->hasJob == false ) ||
+            ( isSameJobId( latency->jobId, latency->jobIdLength, jobId, jobIdLength ) == false ) )
+        {
+            latency->hasNotify = ( ( latency->hasNext == true ) &&
+                                   ( isSameJobId( latency->nextJobId, latency->nextJobIdLength,
+                                                  jobId, jobIdLength ) == true ) ) ? true : false;
+
+            if( latency->hasNotify == true )
+            {
+                latency->notifyMs = latency->nextNotifyMs;
+                latency->hasNext = false;
+                recordDuration( latency, JobsLatencyQueued, latency->notifyMs, nowMs );
+            }
+
+            ( void ) memcpy( latency->jobId, jobId, jobIdLength );
+            latency->jobIdLength = ( uint16_t ) jobIdLength;
+            latency->startMs = nowMs;
+            latency->hasJob = true;
+            latency->hasUpdate = false;
+            latency->isPending = false;
+            latency->isTerminal = false;
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Handle an accepted UpdateJobExecution response.
+ *
+ * @return #JobsSuccess if the update of the current job was timestamped;
+ * #JobsNoMatch otherwise.
+ */
+static JobsStatus_t handleUpdated( JobsLatency_t * latency,
+                                   const char * jobId,
+                                   uint16_t jobIdLength,
+                                   uint32_t nowMs )
+{
+    JobsStatus_t ret = JobsNoMatch;
+
+    if( ( jobId != NULL ) && ( latency->hasJob == true ) && ( latency->isPending == true ) &&
+        ( isSameJobId( latency->jobId, latency->jobIdLength, jobId, jobIdLength ) == true ) )
+    {
+        recordDuration( latency, JobsLatencyUpdateAck, latency->updateMs, nowMs );
+
+        if( latency->isTerminal == true )
+        {
+            recordDuration( latency, JobsLatencyRunning, latency->startMs, nowMs );
+
+            if( latency->hasNotify == true )
+            {
+                recordDuration( latency, JobsLatencyTotal, latency->notifyMs, nowMs );
+            }
+
+            latency->hasJob = false;
+        }
+
+        /* A retried update is accepted once. */
+        latency->isPending = false;
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Append characters to a buffer, or only count them once the
+ * buffer is full.
+ *
+ * @param[in] buffer  The buffer to be written.
+ * @param[in] bufferSize  The size of the buffer.
+ * @param[in,out] start  The offset to write at, advanced by valueLength.
+ * @param[in] value  The characters to append.
+ * @param[in] valueLength  The number of characters.
+ */
+static void appendLatencyChars( char * buffer,
+                                size_t bufferSize,
+                                size_t * start,
+                                const char * value,
+                                size_t valueLength )
+{
+    if( ( *start <= bufferSize ) && ( valueLength <= ( bufferSize - *start ) ) )
+    {
+        ( void ) memcpy( &buffer[ *start ], value, valueLength );
+    }
+
+    *start += valueLength;
+}
+
+/**
+ * @brief Append the decimal characters of an unsigned integer.
+ *
+ * @param[in] buffer  The buffer to be written.
+ * @param[in] bufferSize  The size of the buffer.
+ * @param[in,out] start  The offset to write at.
+ * @param[in] value  The value.
+ */
+static void appendLatencyUint( char * buffer,
+                               size_t bufferSize,
+                               size_t * start,
+                               uint32_t value )
+{
+    char digits[ JOBS_UINT32_STRING_MAX_LENGTH ];
+    size_t digitsLength = Jobs_UintToString( value, digits, sizeof( digits ) );
+
+    appendLatencyChars( buffer, bufferSize, start, digits, digitsLength );
+}
+
+/**
+ * @brief Append the member of a phase with durations.
+ *
+ * @param[in] histogram  The histogram of the phase.
+ * @param[in] name  The member name.
+ * @param[in] buffer  The buffer to be written.
+ * @param[in] bufferSize  The size of the buffer.
+ * @param[in,out] start  The offset to write at.
+ * @param[in,out] first  Whether no member was written yet.
+ */
+static void appendPhase( const JobsLatencyHistogram_t * histogram,
+                         const char * name,
+                         char * buffer,
+                         size_t bufferSize,
+                         size_t * start,
+                         bool * first )
+{
+    size_t bucket;
+    bool firstBucket = true;
+
+    for( bucket = 0U; bucket < JOBS_LATENCY_HISTOGRAM_BUCKETS; bucket++ )
+    {
+        if( histogram->counts[ bucket ] > 0U )
+        {
+            if( firstBucket == true )
+            {
+                appendLatencyChars( buffer, bufferSize, start, ( *first == true ) ? "\"" : ",\"",
+                                    ( *first == true ) ? CONST_STRLEN( "\"" ) : CONST_STRLEN( ",\"" ) );
+                appendLatencyChars( buffer, bufferSize, start, name, strlen( name ) );
+                appendLatencyChars( buffer, bufferSize, start, "\":\"", CONST_STRLEN( "\":\"" ) );
+                firstBucket = false;
+                *first = false;
+            }
+            else
+            {
+                appendLatencyChars( buffer, bufferSize, start, ",", CONST_STRLEN( "," ) );
+            }
+
+            appendLatencyUint( buffer, bufferSize, start, ( uint32_t ) bucket );
+            appendLatencyChars( buffer, bufferSize, start, ":", CONST_STRLEN( ":" ) );
+            appendLatencyUint( buffer, bufferSize, start, histogram->counts[ bucket ] );
+        }
+    }
+
+    if( firstBucket == false )
+    {
+        appendLatencyChars( buffer, bufferSize, start, "\"", CONST_STRLEN( "\"" ) );
+    }
+}
+
+/** @endcond */
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_latency.h for docs.
+ *
+ * @brief Initialize a latency record with empty histograms and no job.
+ */
+JobsStatus_t Jobs_LatencyInit( JobsLatency_t * latency )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( latency != NULL )
+    {
+        ( void ) memset( latency, 0, sizeof( *latency ) );
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_latency.h for docs.
+ *
+ * @brief Timestamp a matched Jobs message.
+ */
+JobsStatus_t Jobs_LatencyHandle( JobsLatency_t * latency,
+                                 JobsTopic_t topic,
+                                 const char * jobId,
+                                 uint16_t jobIdLength,
+                                 const char * message,
+                                 size_t messageLength,
+                                 uint32_t nowMs )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( ( latency != NULL ) && ( message != NULL ) && ( messageLength > 0U ) )
+    {
+        ret = JobsNoMatch;
+
+        if( topic == JobsNextJobChanged )
+        {
+            ret = handleNotify( latency, message, messageLength, nowMs );
+        }
+        else if( topic == JobsStartNextSuccess )
+        {
+            ret = handleStarted( latency, message, messageLength, nowMs );
+        }
+        else if( topic == JobsUpdateSuccess )
+        {
+            ret = handleUpdated( latency, jobId, jobIdLength, nowMs );
+        }
+        else
+        {
+            /* MISRA Empty Body */
+        }
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_latency.h for docs.
+ *
+ * @brief Timestamp an UpdateJobExecution message built for a job.
+ */
+JobsStatus_t Jobs_LatencyUpdateBuilt( JobsLatency_t * latency,
+                                      const char * jobId,
+                                      size_t jobIdLength,
+                                      JobCurrentStatus_t status,
+                                      uint32_t nowMs )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( ( latency != NULL ) && ( jobId != NULL ) && ( jobIdLength > 0U ) &&
+        ( status >= Queued ) && ( status <= Rejected ) )
+    {
+        ret = JobsNoMatch;
+
+        if( ( latency->hasJob == true ) &&
+            ( isSameJobId( latency->jobId, latency->jobIdLength, jobId, jobIdLength ) == true ) )
+        {
+            if( latency->hasUpdate == true )
+            {
+                recordDuration( latency, JobsLatencyUpdateInterval, latency->updateMs, nowMs );
+            }
+            else
+            {
+                recordDuration( latency, JobsLatencyFirstUpdate, latency->startMs, nowMs );
+            }
+
+            latency->updateMs = nowMs;
+            latency->hasUpdate = true;
+            latency->isPending = true;
+            latency->isTerminal = Jobs_IsTerminalStatus( status );
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_latency.h for docs.
+ *
+ * @brief Estimate a percentile of the durations of a phase.
+ */
+uint32_t Jobs_LatencyPercentile( const JobsLatency_t * latency,
+                                 JobsLatencyPhase_t phase,
+                                 uint32_t percent )
+{
+    const JobsLatencyHistogram_t * histogram;
+    uint32_t total = 0U;
+    uint32_t rank;
+    uint32_t seen = 0U;
+    size_t bucket = 0U;
+    uint32_t ret = 0U;
+
+    if( ( latency != NULL ) && ( phase >= JobsLatencyQueued ) && ( phase < JobsLatencyMaxPhase ) &&
+        ( percent > 0U ) && ( percent <= 100U ) )
+    {
+        histogram = &latency->phases[ phase ];
+
+        for( bucket = 0U; bucket < JOBS_LATENCY_HISTOGRAM_BUCKETS; bucket++ )
+        {
+            total += histogram->counts[ bucket ];
+        }
+
+        /* Round the rank up so the 100th percentile is the largest. */
+        rank = ( uint32_t ) ( ( ( ( uint64_t ) total * percent ) + 99U ) / 100U );
+        bucket = 0U;
+
+        while( ( total > 0U ) && ( seen < rank ) )
+        {
+            seen += histogram->counts[ bucket ];
+            bucket++;
+        }
+
+        ret = ( total > 0U ) ? bucketUpperBound( bucket - 1U ) : 0U;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_latency.h for docs.
+ *
+ * @brief Serialize the histograms to a JSON object.
+ */
+JobsStatus_t Jobs_LatencySerialize( const JobsLatency_t * latency,
+                                    char * buffer,
+                                    size_t bufferSize,
+                                    size_t * outLength )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    size_t start = 0U;
+    size_t phase;
+    bool first = true;
+
+    if( ( latency != NULL ) && ( buffer != NULL ) && ( outLength != NULL ) )
+    {
+        appendLatencyChars( buffer, bufferSize, &start, "{", CONST_STRLEN( "{" ) );
+
+        for( phase = 0U; phase < ( size_t ) JobsLatencyMaxPhase; phase++ )
+        {
+            appendPhase( &latency->phases[ phase ], phaseName[ phase ], buffer, bufferSize, &start, &first );
+        }
+
+        appendLatencyChars( buffer, bufferSize, &start, "}", CONST_STRLEN( "}" ) );
+
+        *outLength = start;
+        ret = ( start <= bufferSize ) ? JobsSuccess : JobsBufferTooSmall;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_latency.h for docs.
+ *
+ * @brief Empty the histograms, keeping the timestamps of the current job.
+ */
+void Jobs_LatencyClear( JobsLatency_t * latency )
+{
+    if( latency != NULL )
+    {
+        ( void ) memset( latency->phases, 0, sizeof( latency->phases ) );
+    }
+}
@@ -0,0 +1,317 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_log.c
+ * @brief Implementation of the APIs from jobs_log.h.
+ *
+ * The ring follows the slot protocol of jobs_ring.h, shared with the
+ * ingress ring.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Internal Includes */
+#include "jobs_log.h"
+#include "jobs_ring.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief The registered ring.
+ */
+static JobsLogRing_t * logRing = NULL;
+
+/**
+ * @brief Write a little endian integer.
+ *
+ * @param[out] buffer  The buffer to write to.
+ * @param[in] value  The value.
+ * @param[in] size  The number of bytes.
+ */
+static void writeLittleEndian( uint8_t * buffer,
+                               uint32_t value,
+                               size_t size )
+{
+    size_t i;
+
+    for( i = 0U; i < size; i++ )
+    {
+        buffer[ i ] = ( uint8_t ) ( value >> ( 8U * i ) );
+    }
+}
+
+/**
+ * @brief Read a little endian integer.
+ *
+ * @param[in] buffer  The buffer to read from.
+ * @param[in] size  The number of bytes.
+ *
+ * @return The value.
+ */
+static uint32_t readLittleEndian( const uint8_t * buffer,
+                                  size_t size )
+{
+    uint32_t value = 0U;
+    size_t i;
+
+    for( i = 0U; i < size; i++ )
+    {
+        value |= ( uint32_t ) buffer[ i ] << ( 8U * i );
+    }
+
+    return value;
+}
+
+/** @endcond */
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_log.h for docs.
+ *
+ * @brief Initialize a log ring and register it.
+ */
+JobsStatus_t Jobs_LogInit( JobsLogRing_t * ring,
+                           JobsLogSlot_t * slots,
+                           size_t slotCount )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( ring == NULL )
+    {
+        logRing = NULL;
+        ret = JobsSuccess;
+    }
+    else if( ( slots != NULL ) && ( slotCount >= 2U ) &&
+             ( slotCount <= JOBS_RING_MAX_SLOTS ) && ( ( slotCount & ( slotCount - 1U ) ) == 0U ) )
+    {
+        Jobs_RingInit( slots, sizeof( JobsLogSlot_t ), slotCount );
+        ring->pSlots = slots;
+        ring->mask = ( uint32_t ) ( slotCount - 1U );
+        ring->head = 0U;
+        ring->tail = 0U;
+        ring->dropped = 0U;
+        logRing = ring;
+        ret = JobsSuccess;
+    }
+    else
+    {
+        /* MISRA Empty Body */
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_log.h for docs.
+ *
+ * @brief Write a record to the registered ring.
+ */
+void Jobs_LogWrite( uint32_t level,
+                    JobsLogId_t id,
+                    uint32_t arg0,
+                    uint32_t arg1 )
+{
+    JobsLogRing_t * ring = logRing;
+    uint32_t position = 0U;
+    uint32_t dropped;
+    JobsLogSlot_t * slot;
+
+    if( ring != NULL )
+    {
+        if( Jobs_RingReserve( &ring->head, ring->pSlots, sizeof( JobsLogSlot_t ),
+                              ring->mask, true, &position ) == true )
+        {
+            slot = &ring->pSlots[ position & ring->mask ];
+            slot->record.timestamp = JOBS_LOG_TIMESTAMP();
+            slot->record.args[ 0 ] = arg0;
+            slot->record.args[ 1 ] = arg1;
+            slot->record.id = ( uint16_t ) id;
+            slot->record.level = ( uint8_t ) level;
+
+            Jobs_RingPublish( &slot->sequence, position );
+        }
+        else
+        {
+            dropped = JOBS_ATOMIC_LOAD_RELAXED( &ring->dropped );
+
+            while( JOBS_ATOMIC_COMPARE_EXCHANGE( &ring->dropped, &dropped, dropped + 1U ) == false )
+            {
+                /* Another writer counted a drop, retry with its count. */
+            }
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_log.h for docs.
+ *
+ * @brief Write a record for a failed call.
+ */
+void Jobs_LogStatus( JobsLogId_t id,
+                     JobsStatus_t status,
+                     uint32_t arg )
+{
+    uint32_t level = JOBS_LOG_LEVEL_NONE;
+
+    if( ( status == JobsBadParameter ) || ( status == JobsError ) )
+    {
+        level = JOBS_LOG_LEVEL_ERROR;
+    }
+    else if( status == JobsBufferTooSmall )
+    {
+        level = JOBS_LOG_LEVEL_WARN;
+    }
+    else if( status == JobsNoMatch )
+    {
+        level = JOBS_LOG_LEVEL_DEBUG;
+    }
+    else
+    {
+        /* MISRA Empty Body */
+    }
+
+    if( ( level != JOBS_LOG_LEVEL_NONE ) && ( level <= JOBS_LOG_LEVEL ) )
+    {
+        Jobs_LogWrite( level, id, ( uint32_t ) status, arg );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_log.h for docs.
+ *
+ * @brief Read the oldest record of the registered ring.
+ */
+JobsStatus_t Jobs_LogRead( JobsLogRecord_t * outRecord )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    JobsLogRing_t * ring = logRing;
+    uint32_t position;
+    JobsLogSlot_t * slot;
+
+    if( outRecord != NULL )
+    {
+        ret = JobsNoMatch;
+
+        if( ring != NULL )
+        {
+            position = ring->tail;
+            slot = &ring->pSlots[ position & ring->mask ];
+
+            if( Jobs_RingIsPublished( &slot->sequence, position ) == true )
+            {
+                *outRecord = slot->record;
+                ring->tail = position + 1U;
+                Jobs_RingRelease( &slot->sequence, position, ring->mask );
+                ret = JobsSuccess;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_log.h for docs.
+ *
+ * @brief Get the number of records dropped because the ring was full.
+ */
+uint32_t Jobs_LogDropped( void )
+{
+    JobsLogRing_t * ring = logRing;
+
+    return ( ring != NULL ) ? JOBS_ATOMIC_LOAD_RELAXED( &ring->dropped ) : 0U;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_log.h for docs.
+ *
+ * @brief Encode a record in little endian bytes.
+ */
+size_t Jobs_LogEncode( const JobsLogRecord_t * record,
+                       uint8_t * buffer,
+                       size_t bufferSize )
+{
+    size_t ret = 0U;
+
+    if( ( record != NULL ) && ( buffer != NULL ) && ( bufferSize >= JOBS_LOG_RECORD_SIZE ) )
+    {
+        writeLittleEndian( buffer, record->id, 2U );
+        buffer[ 2 ] = record->level;
+        buffer[ 3 ] = 0U;
+        writeLittleEndian( &buffer[ 4 ], record->timestamp, 4U );
+        writeLittleEndian( &buffer[ 8 ], record->args[ 0 ], 4U );
+        writeLittleEndian( &buffer[ 12 ], record->args[ 1 ], 4U );
+        ret = JOBS_LOG_RECORD_SIZE;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_log.h for docs.
+ *
+ * @brief Decode a record encoded by Jobs_LogEncode.
+ */
+JobsStatus_t Jobs_LogDecode( const uint8_t * buffer,
+                             size_t bufferSize,
+                             JobsLogRecord_t * outRecord )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    uint32_t id;
+
+    if( ( buffer != NULL ) && ( bufferSize >= JOBS_LOG_RECORD_SIZE ) && ( outRecord != NULL ) )
+    {
+        ret = JobsNoMatch;
+        id = readLittleEndian( buffer, 2U );
+
+        if( ( id < ( uint32_t ) JobsLogMaxId ) && ( buffer[ 2 ] >= JOBS_LOG_LEVEL_ERROR ) &&
+            ( buffer[ 2 ] <= JOBS_LOG_LEVEL_DEBUG ) && ( buffer[ 3 ] == 0U ) )
+        {
+            outRecord->id = ( uint16_t ) id;
+            outRecord->level = buffer[ 2 ];
+            outRecord->timestamp = readLittleEndian( &buffer[ 4 ], 4U );
+            outRecord->args[ 0 ] = readLittleEndian( &buffer[ 8 ], 4U );
+            outRecord->args[ 1 ] = readLittleEndian( &buffer[ 12 ], 4U );
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
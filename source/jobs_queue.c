@@ -0,0 +1,316 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_queue.c
+ * @brief Implementation of the APIs from jobs_queue.h.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Internal Includes */
+#include "jobs_queue.h"
+#include "jobs_trace.h"
+/* External Dependencies */
+#include "core_json.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief Get the entry at a position of the queue.
+ *
+ * @param[in] queue  The update queue.
+ * @param[in] position  The position, 0 for the oldest update.
+ *
+ * @return The entry.
+ */
+static JobsQueuedUpdate_t * entryAt( const JobsUpdateQueue_t * queue,
+                                     size_t position )
+{
+    assert( position < queue->capacity );
+
+    return &queue->pEntries[ ( queue->head + position ) % queue->capacity ];
+}
+
+/**
+ * @brief Find the queued non-terminal update of a job.
+ *
+ * Only the newest update of the job is considered, so an update queued
+ * after a terminal one is never merged into an earlier update.
+ *
+ * @param[in] queue  The update queue.
+ * @param[in] jobId  The job ID.
+ * @param[in] jobIdLength  The length of the job ID.
+ *
+ * @return The entry to merge into, or NULL if there is none.
+ */
+static JobsQueuedUpdate_t * findMergeable( const JobsUpdateQueue_t * queue,
+                                           const char * jobId,
+                                           uint16_t jobIdLength )
+{
+    JobsQueuedUpdate_t * ret = NULL;
+    JobsQueuedUpdate_t * entry = NULL;
+    size_t i;
+    bool found = false;
+
+    for( i = queue->count; ( found == false ) && ( i > 0U ); i-- )
+    {
+        entry = entryAt( queue, i - 1U );
+
+        if( ( entry->jobIdLength == jobIdLength ) &&
+            ( memcmp( entry->jobId, jobId, jobIdLength ) == 0 ) )
+        {
+            found = true;
+
+            if( Jobs_IsTerminalStatus( entry->status ) == false )
+            {
+                ret = entry;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Build the request of a queued update.
+ *
+ * @param[in] entry  The queued update.
+ *
+ * @return The update request.
+ */
+static JobsUpdateRequest_t queuedRequest( const JobsQueuedUpdate_t * entry )
+{
+    JobsUpdateRequest_t request = { 0 };
+
+    request.status = entry->status;
+    request.statusDetails = entry->statusDetails;
+    request.statusDetailsLength = entry->statusDetailsLength;
+
+    return request;
+}
+
+/**
+ * @brief Build the topic and payload of one queued update.
+ *
+ * @param[in] entry  The queued update.
+ * @param[in] thingName  The thing name.
+ * @param[in] thingNameLength  The length of the thing name.
+ * @param[out] message  The message to fill.
+ * @param[in] buffer  Storage for the topic and payload.
+ * @param[in] bufferSize  The size of the storage.
+ * @param[out] outUsed  The number of characters used.
+ *
+ * @return #JobsSuccess if the message was built;
+ * #JobsBadParameter if the thing name is invalid;
+ * #JobsBufferTooSmall if the storage is too small.
+ */
+static JobsStatus_t buildMessage( const JobsQueuedUpdate_t * entry,
+                                  const char * thingName,
+                                  uint16_t thingNameLength,
+                                  JobsOutboundMessage_t * message,
+                                  char * buffer,
+                                  size_t bufferSize,
+                                  size_t * outUsed )
+{
+    JobsStatus_t ret = JobsBufferTooSmall;
+    JobsUpdateRequest_t request = queuedRequest( entry );
+    size_t topicLength = 0U;
+    size_t payloadLength = Jobs_UpdateMsgWithOptions( request, NULL, NULL, 0U );
+
+    if( bufferSize > 0U )
+    {
+        ret = Jobs_Update( buffer, bufferSize, thingName, thingNameLength,
+                           entry->jobId, entry->jobIdLength, &topicLength );
+    }
+
+    if( ret == JobsSuccess )
+    {
+        /* The topic is NUL terminated, the payload follows the NUL. */
+        if( ( bufferSize - ( topicLength + 1U ) ) < payloadLength )
+        {
+            ret = JobsBufferTooSmall;
+        }
+        else
+        {
+            message->pTopic = buffer;
+            message->topicLength = topicLength;
+            message->pPayload = &buffer[ topicLength + 1U ];
+            message->payloadLength = Jobs_UpdateMsgWithOptions( request, NULL,
+                                                                &buffer[ topicLength + 1U ],
+                                                                payloadLength );
+            *outUsed = topicLength + 1U + payloadLength;
+        }
+    }
+
+    return ret;
+}
+
+#define checkQueue() \
+    ( ( queue != NULL ) && ( queue->pEntries != NULL ) )
+
+/** @endcond */
+
+/**
+ * See jobs_queue.h for docs.
+ *
+ * @brief Initialize an update queue over caller provided entries.
+ */
+JobsStatus_t Jobs_QueueInit( JobsUpdateQueue_t * queue,
+                             JobsQueuedUpdate_t * entries,
+                             size_t entryCount )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( ( queue != NULL ) && ( entries != NULL ) && ( entryCount > 0U ) )
+    {
+        queue->pEntries = entries;
+        queue->capacity = entryCount;
+        queue->head = 0U;
+        queue->count = 0U;
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_queue.h for docs.
+ *
+ * @brief Queue an update for a job.
+ */
+JobsStatus_t Jobs_QueueUpdate( JobsUpdateQueue_t * queue,
+                               const char * jobId,
+                               uint16_t jobIdLength,
+                               JobsUpdateRequest_t request )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    JobsQueuedUpdate_t * entry = NULL;
+    size_t detailsLength = ( request.statusDetails != NULL ) ? request.statusDetailsLength : 0U;
+
+    if( checkQueue() && ( Jobs_IsValidJobId( jobId, jobIdLength ) == true ) &&
+        ( ( size_t ) request.status <= ( size_t ) Rejected ) &&
+        ( ( detailsLength == 0U ) ||
+          ( JOBS_TRACE_JSON_VALIDATE( request.statusDetails, detailsLength ) == JSONSuccess ) ) )
+    {
+        ret = JobsBufferTooSmall;
+
+        if( detailsLength <= JOBS_QUEUE_STATUS_DETAILS_MAX_LENGTH )
+        {
+            entry = findMergeable( queue, jobId, jobIdLength );
+
+            if( ( entry == NULL ) && ( queue->count < queue->capacity ) )
+            {
+                entry = entryAt( queue, queue->count );
+                ( void ) memcpy( entry->jobId, jobId, jobIdLength );
+                entry->jobIdLength = jobIdLength;
+                queue->count++;
+            }
+        }
+
+        if( entry != NULL )
+        {
+            entry->status = request.status;
+
+            if( detailsLength > 0U )
+            {
+                ( void ) memcpy( entry->statusDetails, request.statusDetails, detailsLength );
+            }
+
+            entry->statusDetailsLength = detailsLength;
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_queue.h for docs.
+ *
+ * @brief Build the oldest queued updates as topic and payload pairs.
+ */
+JobsStatus_t Jobs_QueueGetBatch( const JobsUpdateQueue_t * queue,
+                                 const char * thingName,
+                                 uint16_t thingNameLength,
+                                 JobsOutboundMessage_t * messages,
+                                 size_t messageCount,
+                                 char * buffer,
+                                 size_t bufferSize,
+                                 size_t * outCount )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    JobsStatus_t built = JobsSuccess;
+    size_t count = 0U;
+    size_t used = 0U;
+    size_t entryUsed = 0U;
+
+    if( checkQueue() && ( thingName != NULL ) && ( thingNameLength > 0U ) &&
+        ( messages != NULL ) && ( messageCount > 0U ) &&
+        ( buffer != NULL ) && ( outCount != NULL ) )
+    {
+        while( ( built == JobsSuccess ) && ( count < queue->count ) && ( count < messageCount ) )
+        {
+            built = buildMessage( entryAt( queue, count ), thingName, thingNameLength,
+                                  &messages[ count ], &buffer[ used ], bufferSize - used,
+                                  &entryUsed );
+
+            if( built == JobsSuccess )
+            {
+                used += entryUsed;
+                count++;
+            }
+        }
+
+        /* A full buffer ends the batch once it holds at least one update. */
+        ret = ( ( built == JobsBufferTooSmall ) && ( count > 0U ) ) ? JobsSuccess : built;
+        *outCount = count;
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_queue.h for docs.
+ *
+ * @brief Remove the oldest updates from the queue after publishing.
+ */
+JobsStatus_t Jobs_QueueConsume( JobsUpdateQueue_t * queue,
+                                size_t count )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkQueue() && ( count <= queue->count ) )
+    {
+        queue->head = ( queue->head + count ) % queue->capacity;
+        queue->count -= count;
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
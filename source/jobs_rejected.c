@@ -0,0 +1,287 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_rejected.c
+ * @brief Implementation of the APIs from jobs_rejected.h.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Internal Includes */
+#include "jobs_rejected.h"
+#include "jobs_internal.h"
+#include "jobs_trace.h"
+/* External Dependencies */
+#include "core_json.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief Get the length of a string literal.
+ */
+#define CONST_STRLEN( x )    ( sizeof( ( x ) ) - 1U )
+
+/**
+ * @brief An error code known to the library.
+ */
+typedef struct
+{
+    const char * string;     /**< @brief The error code as sent, NULL for an empty slot. */
+    size_t length;           /**< @brief The length of the error code. */
+    JobsRejectedCode_t code; /**< @brief The error code. */
+} CodeEntry_t;
+
+/* Generated by tools/codehash/jobs_codehash.c, do not edit. */
+
+/**
+ * @brief Number of slots of the error code table, a power of 2.
+ */
+#define CODE_SLOTS           16U
+
+/**
+ * @brief Length of the shortest error code, the hash reads 3 characters
+ * from the end.
+ */
+#define CODE_MIN_LENGTH      3U
+
+/**
+ * @brief Hash an error code to its slot of the error code table.
+ *
+ * The multiplier and the characters read were found by searching for a
+ * function without collisions between the known error codes, so a code
+ * is classified with one comparison.
+ */
+#define hashCode( code, length )                                  \
+    ( ( ( ( length ) * 7U ) + ( size_t ) ( uint8_t ) ( code )[ 0 ] + \
+        ( size_t ) ( uint8_t ) ( code )[ ( length ) - 3U ] ) & ( CODE_SLOTS - 1U ) )
+
+/**
+ * @brief Error codes indexed by #hashCode.
+ */
+static const CodeEntry_t codeTable[ CODE_SLOTS ] =
+{
+    { "InvalidRequest",         CONST_STRLEN( "InvalidRequest" ),         JobsRejectedInvalidRequest         }, /* 0 */
+    { NULL,                     0U,                                       JobsRejectedUnknown                },
+    { "ThrottlingException",    CONST_STRLEN( "ThrottlingException" ),    JobsRejectedRequestThrottled       }, /* 2 */
+    { "VersionMismatch",        CONST_STRLEN( "VersionMismatch" ),        JobsRejectedVersionMismatch        }, /* 3 */
+    { NULL,                     0U,                                       JobsRejectedUnknown                },
+    { NULL,                     0U,                                       JobsRejectedUnknown                },
+    { "InternalError",          CONST_STRLEN( "InternalError" ),          JobsRejectedInternalError          }, /* 6 */
+    { "ResourceNotFound",       CONST_STRLEN( "ResourceNotFound" ),       JobsRejectedResourceNotFound       }, /* 7 */
+    { "TerminalStateReached",   CONST_STRLEN( "TerminalStateReached" ),   JobsRejectedTerminalStateReached   }, /* 8 */
+    { "InvalidJson",            CONST_STRLEN( "InvalidJson" ),            JobsRejectedInvalidJson            }, /* 9 */
+    { NULL,                     0U,                                       JobsRejectedUnknown                },
+    { NULL,                     0U,                                       JobsRejectedUnknown                },
+    { "InvalidStateTransition", CONST_STRLEN( "InvalidStateTransition" ), JobsRejectedInvalidStateTransition }, /* 12 */
+    { "InvalidTopic",           CONST_STRLEN( "InvalidTopic" ),           JobsRejectedInvalidTopic           }, /* 13 */
+    { "RequestThrottled",       CONST_STRLEN( "RequestThrottled" ),       JobsRejectedRequestThrottled       }, /* 14 */
+    { NULL,                     0U,                                       JobsRejectedUnknown                },
+};
+
+/* End of generated code. */
+
+/**
+ * @brief Compare a key to a string literal.
+ */
+#define isKey( pair, literal )                             \
+    ( ( ( pair ).keyLength == CONST_STRLEN( literal ) ) && \
+      ( strncmp( ( pair ).key, ( literal ), CONST_STRLEN( literal ) ) == 0 ) )
+
+/**
+ * @brief Read the execution state of a rejected response in one pass.
+ *
+ * @param[in] state  The executionState object.
+ * @param[in] stateLength  The length of the object.
+ * @param[out] outRejected  The fields of the response.
+ */
+static void readExecutionState( const char * state,
+                                size_t stateLength,
+                                JobsRejected_t * outRejected )
+{
+    JSONPair_t pair = { 0 };
+    size_t start = 0U;
+    size_t next = 0U;
+
+    while( JSON_Iterate( state, stateLength, &start, &next, &pair ) == JSONSuccess )
+    {
+        if( isKey( pair, "status" ) && ( pair.jsonType == JSONString ) )
+        {
+            outRejected->hasExecutionState =
+                ( Jobs_StatusFromString( pair.value, pair.valueLength,
+                                         &outRejected->status ) == JobsSuccess ) ? true : false;
+        }
+        else if( isKey( pair, "versionNumber" ) && ( pair.jsonType == JSONNumber ) )
+        {
+            ( void ) Jobs_StringToUint( pair.value, pair.valueLength, &outRejected->versionNumber );
+        }
+        else if( isKey( pair, "statusDetails" ) && ( pair.jsonType == JSONObject ) )
+        {
+            outRejected->statusDetails = pair.value;
+            outRejected->statusDetailsLength = pair.valueLength;
+        }
+        else
+        {
+            /* MISRA Empty Body */
+        }
+    }
+}
+
+/** @endcond */
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_rejected.h for docs.
+ *
+ * @brief Classify an error code string.
+ */
+JobsRejectedCode_t Jobs_RejectedCode( const char * code,
+                                      size_t codeLength )
+{
+    const CodeEntry_t * entry;
+    JobsRejectedCode_t ret = JobsRejectedUnknown;
+
+    if( ( code != NULL ) && ( codeLength >= CODE_MIN_LENGTH ) )
+    {
+        entry = &codeTable[ hashCode( code, codeLength ) ];
+
+        if( ( entry->length == codeLength ) &&
+            ( strncmp( entry->string, code, codeLength ) == 0 ) )
+        {
+            ret = entry->code;
+        }
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_rejected.h for docs.
+ *
+ * @brief Decode the payload of a rejected response.
+ */
+JobsStatus_t Jobs_RejectedDecode( JobsTopic_t topic,
+                                  const char * message,
+                                  size_t messageLength,
+                                  JobsRejected_t * outRejected )
+{
+    JSONPair_t pair = { 0 };
+    size_t start = 0U;
+    size_t next = 0U;
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( ( message == NULL ) || ( outRejected == NULL ) )
+    {
+        /* MISRA Empty Body */
+    }
+    else if( ( topic != JobsGetPendingFailed ) && ( topic != JobsStartNextFailed ) &&
+             ( topic != JobsDescribeFailed ) && ( topic != JobsUpdateFailed ) )
+    {
+        ret = JobsNoMatch;
+    }
+    else if( ( JOBS_TRACE_JSON_VALIDATE( message, messageLength ) == JSONSuccess ) &&
+             ( messageLength > 0U ) && ( message[ 0 ] == '{' ) )
+    {
+        ( void ) memset( outRejected, 0, sizeof( *outRejected ) );
+        outRejected->code = JobsRejectedUnknown;
+
+        while( JSON_Iterate( message, messageLength, &start, &next, &pair ) == JSONSuccess )
+        {
+            if( isKey( pair, "executionState" ) && ( pair.jsonType == JSONObject ) )
+            {
+                readExecutionState( pair.value, pair.valueLength, outRejected );
+            }
+            else if( pair.jsonType != JSONString )
+            {
+                /* MISRA Empty Body */
+            }
+            else if( isKey( pair, "code" ) )
+            {
+                outRejected->codeString = pair.value;
+                outRejected->codeStringLength = pair.valueLength;
+                outRejected->code = Jobs_RejectedCode( pair.value, pair.valueLength );
+            }
+            else if( isKey( pair, "message" ) )
+            {
+                outRejected->message = pair.value;
+                outRejected->messageLength = pair.valueLength;
+            }
+            else if( isKey( pair, "clientToken" ) )
+            {
+                outRejected->clientToken = pair.value;
+                outRejected->clientTokenLength = pair.valueLength;
+            }
+            else
+            {
+                /* MISRA Empty Body */
+            }
+        }
+
+        ret = JobsSuccess;
+    }
+    else
+    {
+        /* MISRA Empty Body */
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_rejected.h for docs.
+ *
+ * @brief Get how to handle a request rejected with an error code.
+ */
+JobsRejectedAction_t Jobs_RejectedAction( JobsRejectedCode_t code )
+{
+    JobsRejectedAction_t ret;
+
+    switch( code )
+    {
+        case JobsRejectedRequestThrottled:
+        case JobsRejectedInternalError:
+            ret = JobsRejectedBackoff;
+            break;
+
+        case JobsRejectedVersionMismatch:
+        case JobsRejectedInvalidStateTransition:
+            ret = JobsRejectedResync;
+            break;
+
+        default:
+            ret = JobsRejectedGiveUp;
+            break;
+    }
+
+    return ret;
+}
@@ -0,0 +1,173 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+/**
+ * @file jobs_ring.c
+ * @brief Implementation of the slot protocol from jobs_ring.h.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Internal Includes */
+#include "jobs_ring.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief Get the sequence of the slot at an index.
+ *
+ * @param[in] pSlots  The slots.
+ * @param[in] slotSize  Size of one slot.
+ * @param[in] index  The index of the slot.
+ *
+ * @return The sequence, the first member of the slot.
+ */
+static uint32_t * slotSequence( void * pSlots,
+                                size_t slotSize,
+                                size_t index )
+{
+    /* The sequence is the first member of every slot type. */
+    return ( uint32_t * ) &( ( uint8_t * ) pSlots )[ index * slotSize ];
+}
+
+/** @endcond */
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_ring.h for docs.
+ *
+ * @brief Mark every slot of a ring free for the first lap.
+ */
+void Jobs_RingInit( void * pSlots,
+                    size_t slotSize,
+                    size_t slotCount )
+{
+    size_t i;
+
+    for( i = 0U; i < slotCount; i++ )
+    {
+        *slotSequence( pSlots, slotSize, i ) = ( uint32_t ) i;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_ring.h for docs.
+ *
+ * @brief Reserve the slot for the next position.
+ */
+bool Jobs_RingReserve( uint32_t * pHead,
+                       void * pSlots,
+                       size_t slotSize,
+                       uint32_t mask,
+                       bool multiProducer,
+                       uint32_t * outPosition )
+{
+    bool ret = false;
+    bool done = false;
+    uint32_t position = JOBS_ATOMIC_LOAD_RELAXED( pHead );
+    uint32_t sequence;
+
+    while( done == false )
+    {
+        sequence = JOBS_ATOMIC_LOAD_ACQUIRE( slotSequence( pSlots, slotSize, position & mask ) );
+
+        if( sequence == position )
+        {
+            if( multiProducer == false )
+            {
+                JOBS_ATOMIC_STORE_RELEASE( pHead, position + 1U );
+                ret = true;
+                done = true;
+            }
+            else if( JOBS_ATOMIC_COMPARE_EXCHANGE( pHead, &position, position + 1U ) == true )
+            {
+                ret = true;
+                done = true;
+            }
+            else
+            {
+                /* Another producer took the position, retry with the new head. */
+            }
+        }
+        else if( ( uint32_t ) ( position - sequence ) < JOBS_RING_MAX_SLOTS )
+        {
+            /* The slot still holds the item from the previous lap. */
+            done = true;
+        }
+        else
+        {
+            position = JOBS_ATOMIC_LOAD_RELAXED( pHead );
+        }
+    }
+
+    *outPosition = position;
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_ring.h for docs.
+ *
+ * @brief Hand a filled slot to the consumer.
+ */
+void Jobs_RingPublish( uint32_t * pSequence,
+                       uint32_t position )
+{
+    JOBS_ATOMIC_STORE_RELEASE( pSequence, position + 1U );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_ring.h for docs.
+ *
+ * @brief Check whether the slot at a position holds an item.
+ */
+bool Jobs_RingIsPublished( const uint32_t * pSequence,
+                           uint32_t position )
+{
+    return ( JOBS_ATOMIC_LOAD_ACQUIRE( pSequence ) == ( position + 1U ) ) ? true : false;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_ring.h for docs.
+ *
+ * @brief Hand a consumed slot back to the producers for the next lap.
+ */
+void Jobs_RingRelease( uint32_t * pSequence,
+                       uint32_t position,
+                       uint32_t mask )
+{
+    JOBS_ATOMIC_STORE_RELEASE( pSequence, position + mask + 1U );
+}
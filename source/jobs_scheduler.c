@@ -0,0 +1,360 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_scheduler.c
+ * @brief Implementation of the APIs from jobs_scheduler.h.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Internal Includes */
+#include "jobs_scheduler.h"
+#include "jobs_internal.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief Golden ratio constant, separates the jitter of each attempt.
+ */
+#define JITTER_STEP         0x9E3779B9U
+
+/**
+ * @brief Check common parameters.
+ */
+#define checkScheduler() \
+    ( ( scheduler != NULL ) && ( scheduler->config.bucketSize > 0U ) )
+
+/**
+ * @brief Check an API parameter.
+ */
+#define checkApi() \
+    ( ( api > JobsInvalidApi ) && ( api < JobsMaxApi ) )
+
+/**
+ * @brief Get the bit of an API in the wanted and inFlight sets.
+ */
+#define apiBit( x )         ( ( uint8_t ) ( 1U << ( uint32_t ) ( x ) ) )
+
+/**
+ * @brief Spread the bits of a hash, so nearby thing names get distant
+ * offsets.
+ *
+ * @param[in] value  The value to mix.
+ *
+ * @return The mixed value.
+ */
+static uint32_t mixHash( uint32_t value )
+{
+    uint32_t x = value;
+
+    x ^= x >> 16;
+    x *= 0x7FEB352DU;
+    x ^= x >> 15;
+    x *= 0x846CA68BU;
+    x ^= x >> 16;
+
+    return x;
+}
+
+/**
+ * @brief Add the tokens earned since the last refill to the bucket.
+ *
+ * @param[in] scheduler  The scheduler.
+ * @param[in] nowMs  The current time in milliseconds.
+ */
+static void refillBucket( JobsScheduler_t * scheduler,
+                          uint32_t nowMs )
+{
+    uint32_t earned = ( nowMs - scheduler->refillMs ) / scheduler->config.refillIntervalMs;
+
+    if( earned >= ( uint32_t ) scheduler->config.bucketSize - scheduler->tokens )
+    {
+        scheduler->tokens = scheduler->config.bucketSize;
+        scheduler->refillMs = nowMs;
+    }
+    else
+    {
+        scheduler->tokens += ( uint16_t ) earned;
+        scheduler->refillMs += earned * scheduler->config.refillIntervalMs;
+    }
+}
+
+/**
+ * @brief Get the time until the next request may be sent.
+ *
+ * @param[in] scheduler  The scheduler, with a refilled bucket.
+ * @param[in] nowMs  The current time in milliseconds.
+ *
+ * @return The wait in milliseconds, 0 if a request may be sent now.
+ */
+static uint32_t waitTime( const JobsScheduler_t * scheduler,
+                          uint32_t nowMs )
+{
+    uint32_t wait = 0U;
+    uint32_t refill;
+
+    /* Times are compared modulo 2^32. */
+    if( ( scheduler->notBeforeMs - nowMs ) <= ( uint32_t ) INT32_MAX )
+    {
+        wait = scheduler->notBeforeMs - nowMs;
+    }
+
+    if( scheduler->tokens == 0U )
+    {
+        refill = scheduler->config.refillIntervalMs - ( nowMs - scheduler->refillMs );
+        wait = ( refill > wait ) ? refill : wait;
+    }
+
+    return wait;
+}
+
+/** @endcond */
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_scheduler.h for docs.
+ *
+ * @brief Initialize the scheduler of a thing.
+ */
+JobsStatus_t Jobs_SchedulerInit( JobsScheduler_t * scheduler,
+                                 const JobsSchedulerConfig_t * config,
+                                 const char * thingName,
+                                 uint16_t thingNameLength )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( ( scheduler != NULL ) && ( config != NULL ) &&
+        ( config->refillIntervalMs > 0U ) && ( config->bucketSize > 0U ) &&
+        ( config->backoffBaseMs <= config->backoffMaxMs ) &&
+        ( config->backoffMaxMs <= ( uint32_t ) INT32_MAX ) &&
+        ( config->jitterWindowMs <= ( uint32_t ) INT32_MAX ) &&
+        ( Jobs_IsValidThingName( thingName, thingNameLength ) == true ) )
+    {
+        scheduler->config = *config;
+        scheduler->thingHash = Jobs_Fnv1a( JOBS_FNV1A_OFFSET_BASIS, thingName, thingNameLength );
+        scheduler->notBeforeMs = 0U;
+        scheduler->refillMs = 0U;
+        scheduler->tokens = config->bucketSize;
+        scheduler->attempts = 0U;
+        scheduler->wanted = 0U;
+        scheduler->inFlight = 0U;
+        scheduler->connected = false;
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_scheduler.h for docs.
+ *
+ * @brief Start pacing requests for a new connection.
+ */
+JobsStatus_t Jobs_SchedulerConnect( JobsScheduler_t * scheduler,
+                                    uint32_t nowMs )
+{
+    uint32_t offset = 0U;
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkScheduler() )
+    {
+        if( scheduler->config.jitterWindowMs > 0U )
+        {
+            offset = mixHash( scheduler->thingHash ) % scheduler->config.jitterWindowMs;
+        }
+
+        scheduler->notBeforeMs = nowMs + offset;
+        scheduler->refillMs = nowMs;
+        scheduler->tokens = scheduler->config.bucketSize;
+        scheduler->attempts = 0U;
+        scheduler->wanted |= scheduler->inFlight;
+        scheduler->inFlight = 0U;
+        scheduler->connected = true;
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_scheduler.h for docs.
+ *
+ * @brief Ask for a request to be sent.
+ */
+JobsStatus_t Jobs_SchedulerRequest( JobsScheduler_t * scheduler,
+                                    JobsApi_t api )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkScheduler() && checkApi() )
+    {
+        scheduler->wanted |= apiBit( api );
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_scheduler.h for docs.
+ *
+ * @brief Get the request to send now.
+ */
+JobsStatus_t Jobs_SchedulerPoll( JobsScheduler_t * scheduler,
+                                 uint32_t nowMs,
+                                 JobsApi_t * outApi,
+                                 uint32_t * outWaitMs )
+{
+    uint8_t ready;
+    uint32_t wait = JOBS_SCHEDULER_IDLE;
+    int32_t api;
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkScheduler() && ( outApi != NULL ) )
+    {
+        ret = JobsNoMatch;
+        ready = scheduler->wanted & ( uint8_t ) ~scheduler->inFlight;
+
+        if( ( scheduler->connected == true ) && ( ready != 0U ) )
+        {
+            refillBucket( scheduler, nowMs );
+            wait = waitTime( scheduler, nowMs );
+        }
+
+        if( wait == 0U )
+        {
+            api = 0;
+
+            while( ( ready & apiBit( api ) ) == 0U )
+            {
+                api++;
+            }
+
+            scheduler->tokens--;
+            scheduler->wanted &= ( uint8_t ) ~apiBit( api );
+            scheduler->inFlight |= apiBit( api );
+            *outApi = ( JobsApi_t ) api;
+            ret = JobsSuccess;
+        }
+
+        if( outWaitMs != NULL )
+        {
+            *outWaitMs = wait;
+        }
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_scheduler.h for docs.
+ *
+ * @brief Record the accepted response of a request.
+ */
+JobsStatus_t Jobs_SchedulerAccepted( JobsScheduler_t * scheduler,
+                                     JobsApi_t api )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkScheduler() && checkApi() )
+    {
+        ret = JobsNoMatch;
+
+        if( ( scheduler->inFlight & apiBit( api ) ) != 0U )
+        {
+            scheduler->inFlight &= ( uint8_t ) ~apiBit( api );
+            scheduler->attempts = 0U;
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_scheduler.h for docs.
+ *
+ * @brief Record the rejected response of a request.
+ */
+JobsStatus_t Jobs_SchedulerRejected( JobsScheduler_t * scheduler,
+                                     JobsApi_t api,
+                                     JobsRejectedCode_t code,
+                                     uint32_t nowMs )
+{
+    uint32_t delay;
+    uint32_t half;
+    uint8_t i;
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( checkScheduler() && checkApi() )
+    {
+        ret = JobsNoMatch;
+
+        if( ( scheduler->inFlight & apiBit( api ) ) != 0U )
+        {
+            scheduler->inFlight &= ( uint8_t ) ~apiBit( api );
+            ret = JobsSuccess;
+        }
+
+        if( ( ret == JobsSuccess ) && ( Jobs_RejectedAction( code ) == JobsRejectedBackoff ) )
+        {
+            if( scheduler->attempts < UINT8_MAX )
+            {
+                scheduler->attempts++;
+            }
+
+            delay = scheduler->config.backoffBaseMs;
+
+            for( i = 1U; ( i < scheduler->attempts ) && ( delay < scheduler->config.backoffMaxMs ); i++ )
+            {
+                delay = ( delay > ( scheduler->config.backoffMaxMs / 2U ) ) ?
+                        scheduler->config.backoffMaxMs : ( delay * 2U );
+            }
+
+            half = delay / 2U;
+            delay = half + ( mixHash( scheduler->thingHash ^ ( scheduler->attempts * JITTER_STEP ) ) %
+                             ( delay - half + 1U ) );
+
+            scheduler->notBeforeMs = nowMs + delay;
+            scheduler->wanted |= apiBit( api );
+        }
+    }
+
+    return ret;
+}
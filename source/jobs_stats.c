@@ -0,0 +1,258 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_stats.c
+ * @brief Implementation of the APIs from jobs_stats.h.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Internal Includes */
+#include "jobs_stats.h"
+#include "jobs_atomic.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief The registered shards.
+ */
+static JobsStatsShard_t * statsShards = NULL;
+
+/**
+ * @brief Number of registered shards.
+ */
+static size_t statsShardCount = 0U;
+
+#if defined( JOBS_STATS_SINGLE_SHARD )
+
+/**
+ * @brief Most shards, without a shard index to choose between them.
+ */
+    #define MAX_SHARDS    1U
+#else
+    #define MAX_SHARDS    SIZE_MAX
+#endif
+
+#if defined( JOBS_STATS_THREAD_SHARDS )
+
+/**
+ * @brief Shard index of the calling thread plus one, 0 until assigned.
+ */
+    static __thread uint32_t threadShard = 0U;
+
+/**
+ * @brief Number of threads assigned a shard index.
+ */
+    static uint32_t threadCount = 0U;
+#endif
+
+/** @endcond */
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_stats.h for docs.
+ *
+ * @brief Register the shards counting for the library, and zero them.
+ */
+JobsStatus_t Jobs_StatsInit( JobsStatsShard_t * shards,
+                             size_t shardCount )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( shards == NULL )
+    {
+        statsShards = NULL;
+        statsShardCount = 0U;
+        ret = JobsSuccess;
+    }
+    else if( ( shardCount > 0U ) && ( shardCount <= MAX_SHARDS ) &&
+             ( ( ( uintptr_t ) shards % JOBS_STATS_CACHE_LINE_SIZE ) == 0U ) )
+    {
+        ( void ) memset( shards, 0, shardCount * sizeof( JobsStatsShard_t ) );
+        statsShardCount = shardCount;
+        statsShards = shards;
+        ret = JobsSuccess;
+    }
+    else
+    {
+        /* MISRA Empty Body */
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_stats.h for docs.
+ *
+ * @brief Add to a counter in the shard of the calling task.
+ */
+void Jobs_StatsAdd( JobsStatsCounter_t counter,
+                    uint32_t amount )
+{
+    uint32_t * pCounter;
+
+    if( ( statsShards != NULL ) && ( amount > 0U ) &&
+        ( counter >= JobsStatsMatchedJobsChanged ) && ( counter < JobsStatsMaxCounter ) )
+    {
+        /* Tasks may share a shard, when there are more tasks than shards,
+         * so the addition is atomic.  It is uncontended while each task
+         * has a shard of its own. */
+        pCounter = &statsShards[ ( size_t ) JOBS_STATS_SHARD_INDEX() % statsShardCount ].counters[ counter ];
+        ( void ) JOBS_ATOMIC_FETCH_ADD( pCounter, amount );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+#if defined( JOBS_STATS_THREAD_SHARDS )
+
+/**
+ * See jobs_stats.h for docs.
+ *
+ * @brief Get the shard index of the calling thread.
+ */
+    size_t Jobs_StatsShardIndex( void )
+    {
+        if( threadShard == 0U )
+        {
+            threadShard = JOBS_ATOMIC_FETCH_ADD( &threadCount, 1U ) + 1U;
+        }
+
+        return ( size_t ) threadShard - 1U;
+    }
+
+/*-----------------------------------------------------------*/
+#endif /* if defined( JOBS_STATS_THREAD_SHARDS ) */
+
+/**
+ * See jobs_stats.h for docs.
+ *
+ * @brief Count the result of a topic function.
+ */
+void Jobs_StatsTopic( JobsStatus_t status,
+                      JobsTopic_t topic )
+{
+    if( status == JobsNoMatch )
+    {
+        Jobs_StatsAdd( JobsStatsNoMatch, 1U );
+    }
+    else if( status == JobsBadParameter )
+    {
+        Jobs_StatsAdd( JobsStatsBadParameter, 1U );
+    }
+    else if( status == JobsBufferTooSmall )
+    {
+        Jobs_StatsAdd( JobsStatsBufferTooSmall, 1U );
+    }
+    else if( ( status == JobsSuccess ) && ( topic > JobsInvalidTopic ) && ( topic < JobsMaxTopic ) )
+    {
+        /* The matched counters follow the order of JobsTopic_t. */
+        Jobs_StatsAdd( ( JobsStatsCounter_t ) ( ( int32_t ) JobsStatsMatchedJobsChanged + ( int32_t ) topic ), 1U );
+    }
+    else
+    {
+        /* MISRA Empty Body */
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_stats.h for docs.
+ *
+ * @brief JSON_SearchConst counting the bytes it scanned.
+ */
+JSONStatus_t Jobs_StatsJsonSearch( const char * buf,
+                                   size_t max,
+                                   const char * query,
+                                   size_t queryLength,
+                                   const char ** outValue,
+                                   size_t * outValueLength,
+                                   JSONTypes_t * outType )
+{
+    JSONStatus_t ret;
+    size_t bytes = max;
+
+    ret = JSON_SearchConst( buf, max, query, queryLength, outValue, outValueLength, outType );
+
+    if( ( ret == JSONSuccess ) && ( outValue != NULL ) && ( outValueLength != NULL ) )
+    {
+        bytes = ( size_t ) ( &( *outValue )[ *outValueLength ] - buf );
+    }
+
+    Jobs_StatsAdd( JobsStatsJsonBytes, ( uint32_t ) bytes );
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_stats.h for docs.
+ *
+ * @brief JSON_Validate counting the bytes it scanned.
+ */
+JSONStatus_t Jobs_StatsJsonValidate( const char * buf,
+                                     size_t max )
+{
+    Jobs_StatsAdd( JobsStatsJsonBytes, ( uint32_t ) max );
+
+    return JSON_Validate( buf, max );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_stats.h for docs.
+ *
+ * @brief Sum the counters of every shard.
+ */
+JobsStatus_t Jobs_StatsRead( JobsStatsSnapshot_t * snapshot )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    size_t shard;
+    size_t counter;
+
+    if( snapshot != NULL )
+    {
+        ( void ) memset( snapshot, 0, sizeof( *snapshot ) );
+        ret = ( statsShards != NULL ) ? JobsSuccess : JobsNoMatch;
+
+        for( shard = 0U; shard < statsShardCount; shard++ )
+        {
+            for( counter = 0U; counter < ( size_t ) JobsStatsMaxCounter; counter++ )
+            {
+                snapshot->counters[ counter ] += JOBS_ATOMIC_LOAD_RELAXED( &statsShards[ shard ].counters[ counter ] );
+            }
+        }
+    }
+
+    return ret;
+}
@@ -0,0 +1,246 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_summary.c
+ * @brief Implementation of the APIs from jobs_summary.h.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Internal Includes */
+#include "jobs_summary.h"
+#include "jobs_internal.h"
+#include "jobs_trace.h"
+/* External Dependencies */
+#include "core_json.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief Get the length of a string literal.
+ */
+#define CONST_STRLEN( x )    ( sizeof( ( x ) ) - 1U )
+
+/**
+ * @brief Number of job lists in a message.
+ */
+#define LIST_COUNT           2U
+
+/**
+ * @brief A job list of a message.
+ */
+typedef struct
+{
+    const char * query;        /**< @brief Query of the list. */
+    size_t queryLength;        /**< @brief Length of the query. */
+    JobCurrentStatus_t status; /**< @brief Status of the jobs in the list. */
+} JobList_t;
+
+/**
+ * @brief The job lists of a JobExecutionsChanged notification.
+ */
+static const JobList_t changedLists[ LIST_COUNT ] =
+{
+    { "jobs.IN_PROGRESS", CONST_STRLEN( "jobs.IN_PROGRESS" ), InProgress },
+    { "jobs.QUEUED",      CONST_STRLEN( "jobs.QUEUED" ),      Queued     },
+};
+
+/**
+ * @brief The job lists of a GetPendingJobExecutions response.
+ */
+static const JobList_t pendingLists[ LIST_COUNT ] =
+{
+    { "inProgressJobs", CONST_STRLEN( "inProgressJobs" ), InProgress },
+    { "queuedJobs",     CONST_STRLEN( "queuedJobs" ),     Queued     },
+};
+
+/**
+ * @brief Compare a key to a string literal.
+ */
+#define isKey( pair, literal )                           \
+    ( ( ( pair ).keyLength == CONST_STRLEN( literal ) ) && \
+      ( strncmp( ( pair ).key, ( literal ), CONST_STRLEN( literal ) ) == 0 ) )
+
+/**
+ * @brief Read a job summary from a list entry in one pass.
+ *
+ * @param[in] entry  The list entry, a JSON object.
+ * @param[in] entryLength  The length of the entry.
+ * @param[out] outSummary  The job summary.
+ *
+ * @return true if the entry has a valid job ID;
+ * false otherwise.
+ */
+static bool readSummary( const char * entry,
+                         size_t entryLength,
+                         JobsJobSummary_t * outSummary )
+{
+    JSONPair_t pair = { 0 };
+    size_t start = 0U;
+    size_t next = 0U;
+    uint32_t * number;
+
+    outSummary->jobId = NULL;
+    outSummary->jobIdLength = 0U;
+    outSummary->queuedAt = 0U;
+    outSummary->lastUpdatedAt = 0U;
+    outSummary->executionNumber = 0U;
+    outSummary->versionNumber = 0U;
+
+    while( JSON_Iterate( entry, entryLength, &start, &next, &pair ) == JSONSuccess )
+    {
+        number = NULL;
+
+        if( isKey( pair, "jobId" ) && ( pair.jsonType == JSONString ) )
+        {
+            outSummary->jobId = pair.value;
+            outSummary->jobIdLength = pair.valueLength;
+        }
+        else if( isKey( pair, "queuedAt" ) )
+        {
+            number = &outSummary->queuedAt;
+        }
+        else if( isKey( pair, "lastUpdatedAt" ) )
+        {
+            number = &outSummary->lastUpdatedAt;
+        }
+        else if( isKey( pair, "executionNumber" ) )
+        {
+            number = &outSummary->executionNumber;
+        }
+        else if( isKey( pair, "versionNumber" ) )
+        {
+            number = &outSummary->versionNumber;
+        }
+        else
+        {
+            /* MISRA Empty Body */
+        }
+
+        if( ( number != NULL ) && ( pair.jsonType == JSONNumber ) )
+        {
+            ( void ) Jobs_StringToUint( pair.value, pair.valueLength, number );
+        }
+    }
+
+    return ( ( outSummary->jobId != NULL ) && ( outSummary->jobIdLength <= JOBID_MAX_LENGTH ) &&
+             ( Jobs_IsValidJobId( outSummary->jobId, ( uint16_t ) outSummary->jobIdLength ) == true ) ) ? true : false;
+}
+
+/** @endcond */
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_summary.h for docs.
+ *
+ * @brief Start iterating over the job summaries of a message.
+ */
+JobsStatus_t Jobs_SummaryInit( JobsSummaryIterator_t * iterator,
+                               JobsTopic_t topic,
+                               const char * message,
+                               size_t messageLength )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( ( iterator != NULL ) && ( message != NULL ) &&
+        ( ( topic == JobsJobsChanged ) || ( topic == JobsGetPendingSuccess ) ) &&
+        ( JOBS_TRACE_JSON_VALIDATE( message, messageLength ) == JSONSuccess ) )
+    {
+        iterator->message = message;
+        iterator->messageLength = messageLength;
+        iterator->list = NULL;
+        iterator->listLength = 0U;
+        iterator->start = 0U;
+        iterator->next = 0U;
+        iterator->lists = 0U;
+        iterator->getPending = ( topic == JobsGetPendingSuccess ) ? true : false;
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_summary.h for docs.
+ *
+ * @brief Get the next job summary of a message.
+ */
+JobsStatus_t Jobs_SummaryNext( JobsSummaryIterator_t * iterator,
+                               JobsJobSummary_t * outSummary )
+{
+    const JobList_t * lists;
+    JSONPair_t pair = { 0 };
+    JSONTypes_t type = JSONInvalid;
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( ( iterator != NULL ) && ( iterator->message != NULL ) && ( outSummary != NULL ) )
+    {
+        lists = ( iterator->getPending == true ) ? pendingLists : changedLists;
+        ret = JobsNoMatch;
+
+        while( ( ret == JobsNoMatch ) &&
+               ( ( iterator->list != NULL ) || ( iterator->lists < LIST_COUNT ) ) )
+        {
+            if( iterator->list == NULL )
+            {
+                if( ( JOBS_TRACE_JSON_SEARCH( iterator->message, iterator->messageLength,
+                                              lists[ iterator->lists ].query, lists[ iterator->lists ].queryLength,
+                                              &iterator->list, &iterator->listLength, &type ) != JSONSuccess ) ||
+                    ( type != JSONArray ) )
+                {
+                    iterator->list = NULL;
+                }
+
+                iterator->start = 0U;
+                iterator->next = 0U;
+                iterator->lists++;
+            }
+            else if( JSON_Iterate( iterator->list, iterator->listLength, &iterator->start,
+                                   &iterator->next, &pair ) != JSONSuccess )
+            {
+                iterator->list = NULL;
+            }
+            else if( ( pair.jsonType == JSONObject ) &&
+                     ( readSummary( pair.value, pair.valueLength, outSummary ) == true ) )
+            {
+                outSummary->status = lists[ iterator->lists - 1U ].status;
+                ret = JobsSuccess;
+            }
+            else
+            {
+                /* MISRA Empty Body */
+            }
+        }
+    }
+
+    return ret;
+}
@@ -0,0 +1,369 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_timer.c
+ * @brief Implementation of the APIs from jobs_timer.h.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Internal Includes */
+#include "jobs_timer.h"
+#include "jobs_internal.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief Get the length of a string literal.
+ */
+#define CONST_STRLEN( x )    ( sizeof( ( x ) ) - 1U )
+
+/**
+ * @brief Number of tick bits covered by one level.
+ */
+#define SLOT_BITS            6U
+
+/**
+ * @brief Mask of the slot index bits of a level.
+ */
+#define SLOT_MASK            ( JOBS_TIMER_SLOTS - 1U )
+
+/**
+ * @brief Largest number of ticks the levels cover.
+ */
+#define MAX_TICKS            ( ( 1UL << ( SLOT_BITS * JOBS_TIMER_LEVELS ) ) - 1UL )
+
+/**
+ * @brief Half the range of a tick or millisecond count.
+ */
+#define HALF_RANGE           0x80000000U
+
+/**
+ * @brief Link a timer into the slot matching its expiry tick.
+ *
+ * Timers further out than the levels cover are placed in the farthest
+ * slot, and placed again when they reach the lowest level.
+ *
+ * @param[in] wheel  The wheel.
+ * @param[in] timer  The timer.
+ */
+static void place( JobsTimerWheel_t * wheel,
+                   JobsTimer_t * timer )
+{
+    uint32_t delta = timer->expiryTick - wheel->currentTick;
+    uint32_t tick = timer->expiryTick;
+    uint32_t level = 0U;
+    uint32_t slot;
+
+    if( delta >= HALF_RANGE )
+    {
+        /* Already due, expire on the tick being processed. */
+        delta = 0U;
+        tick = wheel->currentTick;
+    }
+    else if( delta > MAX_TICKS )
+    {
+        delta = MAX_TICKS;
+        tick = wheel->currentTick + MAX_TICKS;
+    }
+    else
+    {
+        /* MISRA Empty Body */
+    }
+
+    while( ( level < ( JOBS_TIMER_LEVELS - 1U ) ) &&
+           ( delta >= ( 1UL << ( SLOT_BITS * ( level + 1U ) ) ) ) )
+    {
+        level++;
+    }
+
+    slot = ( tick >> ( SLOT_BITS * level ) ) & SLOT_MASK;
+
+    timer->level = ( uint8_t ) level;
+    timer->slot = ( uint8_t ) slot;
+    timer->pPrev = NULL;
+    timer->pNext = wheel->pSlots[ level ][ slot ];
+
+    if( timer->pNext != NULL )
+    {
+        timer->pNext->pPrev = timer;
+    }
+
+    wheel->pSlots[ level ][ slot ] = timer;
+}
+
+/**
+ * @brief Unlink an armed timer from its slot.
+ *
+ * @param[in] wheel  The wheel.
+ * @param[in] timer  The timer.
+ */
+static void unlinkTimer( JobsTimerWheel_t * wheel,
+                         JobsTimer_t * timer )
+{
+    if( timer->pPrev == NULL )
+    {
+        wheel->pSlots[ timer->level ][ timer->slot ] = timer->pNext;
+    }
+    else
+    {
+        timer->pPrev->pNext = timer->pNext;
+    }
+
+    if( timer->pNext != NULL )
+    {
+        timer->pNext->pPrev = timer->pPrev;
+    }
+}
+
+/**
+ * @brief Build the update of an expired timer and call the callback.
+ *
+ * @param[in] timer  The expired timer.
+ * @param[in] nowMs  The current time in milliseconds.
+ * @param[out] buffer  The buffer to build the message in.
+ * @param[in] bufferSize  The size of the buffer.
+ * @param[in] callback  The expiry callback.
+ * @param[in] pContext  Context passed to the callback.
+ */
+static void expire( JobsTimer_t * timer,
+                    uint32_t nowMs,
+                    char * buffer,
+                    size_t bufferSize,
+                    JobsTimerExpired_t callback,
+                    void * pContext )
+{
+    JobsExecutionAction_t action = { 0 };
+    JobsUpdateRequest_t request = { 0 };
+    size_t messageLength = 0U;
+
+    if( timer->pExecution != NULL )
+    {
+        if( ( Jobs_ExecutionReport( timer->pExecution, Failed, nowMs, &action ) == JobsSuccess ) &&
+            ( action.api == JobsApiUpdate ) )
+        {
+            messageLength = Jobs_ExecutionMsg( timer->pExecution, &action, JOBS_TIMER_STATUS_DETAILS,
+                                               CONST_STRLEN( JOBS_TIMER_STATUS_DETAILS ), buffer, bufferSize );
+        }
+    }
+    else
+    {
+        request.status = Failed;
+        request.statusDetails = JOBS_TIMER_STATUS_DETAILS;
+        request.statusDetailsLength = CONST_STRLEN( JOBS_TIMER_STATUS_DETAILS );
+        messageLength = Jobs_UpdateMsg( request, buffer, bufferSize );
+    }
+
+    callback( timer, buffer, messageLength, pContext );
+}
+
+/** @endcond */
+
+/**
+ * See jobs_timer.h for docs.
+ *
+ * @brief Initialize a timing wheel.
+ */
+JobsStatus_t Jobs_TimerInit( JobsTimerWheel_t * wheel,
+                             uint32_t nowMs,
+                             uint32_t tickMs )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    size_t level;
+    size_t slot;
+
+    if( ( wheel != NULL ) && ( tickMs > 0U ) )
+    {
+        for( level = 0U; level < JOBS_TIMER_LEVELS; level++ )
+        {
+            for( slot = 0U; slot < JOBS_TIMER_SLOTS; slot++ )
+            {
+                wheel->pSlots[ level ][ slot ] = NULL;
+            }
+        }
+
+        wheel->currentTick = 0U;
+        wheel->currentMs = nowMs;
+        wheel->tickMs = tickMs;
+        wheel->count = 0U;
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_timer.h for docs.
+ *
+ * @brief Arm a timer, or move an armed timer to a new deadline.
+ */
+JobsStatus_t Jobs_TimerArm( JobsTimerWheel_t * wheel,
+                            JobsTimer_t * timer,
+                            uint32_t deadlineMs )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    uint32_t delay;
+    uint32_t ticks = 1U;
+
+    if( ( wheel != NULL ) && ( timer != NULL ) )
+    {
+        if( timer->armed == true )
+        {
+            unlinkTimer( wheel, timer );
+        }
+        else
+        {
+            timer->armed = true;
+            wheel->count++;
+        }
+
+        delay = deadlineMs - wheel->currentMs;
+
+        /* A deadline already passed expires on the next tick. */
+        if( ( delay > 0U ) && ( delay < HALF_RANGE ) )
+        {
+            ticks = ( delay / wheel->tickMs ) + ( ( ( delay % wheel->tickMs ) != 0U ) ? 1U : 0U );
+        }
+
+        timer->expiryTick = wheel->currentTick + ticks;
+        place( wheel, timer );
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_timer.h for docs.
+ *
+ * @brief Cancel a timer.
+ */
+JobsStatus_t Jobs_TimerCancel( JobsTimerWheel_t * wheel,
+                               JobsTimer_t * timer )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( ( wheel != NULL ) && ( timer != NULL ) )
+    {
+        ret = JobsNoMatch;
+
+        if( timer->armed == true )
+        {
+            unlinkTimer( wheel, timer );
+            timer->armed = false;
+            wheel->count--;
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_timer.h for docs.
+ *
+ * @brief Advance the wheel to the current time and expire due timers.
+ */
+JobsStatus_t Jobs_TimerAdvance( JobsTimerWheel_t * wheel,
+                                uint32_t nowMs,
+                                char * buffer,
+                                size_t bufferSize,
+                                JobsTimerExpired_t callback,
+                                void * pContext )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    uint32_t elapsed;
+    uint32_t ticks;
+    uint32_t level;
+    uint32_t slot;
+    JobsTimer_t * timer;
+
+    if( ( wheel != NULL ) && ( buffer != NULL ) && ( callback != NULL ) )
+    {
+        elapsed = nowMs - wheel->currentMs;
+        ticks = ( elapsed < HALF_RANGE ) ? ( elapsed / wheel->tickMs ) : 0U;
+
+        if( wheel->count == 0U )
+        {
+            /* Nothing to expire, skip the ticks. */
+            wheel->currentTick += ticks;
+            wheel->currentMs += ticks * wheel->tickMs;
+            ticks = 0U;
+        }
+
+        for( ; ticks > 0U; ticks-- )
+        {
+            wheel->currentTick++;
+            wheel->currentMs += wheel->tickMs;
+
+            /* When the slots of a level wrap, move the next slot of the
+             * level above down. */
+            for( level = 1U; level < JOBS_TIMER_LEVELS; level++ )
+            {
+                if( ( ( wheel->currentTick >> ( SLOT_BITS * ( level - 1U ) ) ) & SLOT_MASK ) != 0U )
+                {
+                    break;
+                }
+
+                slot = ( wheel->currentTick >> ( SLOT_BITS * level ) ) & SLOT_MASK;
+
+                while( wheel->pSlots[ level ][ slot ] != NULL )
+                {
+                    timer = wheel->pSlots[ level ][ slot ];
+                    unlinkTimer( wheel, timer );
+                    place( wheel, timer );
+                }
+            }
+
+            /* Take one timer at a time, the callback may cancel others. */
+            slot = wheel->currentTick & SLOT_MASK;
+
+            while( wheel->pSlots[ 0 ][ slot ] != NULL )
+            {
+                timer = wheel->pSlots[ 0 ][ slot ];
+                unlinkTimer( wheel, timer );
+
+                if( Jobs_IsDeadlineReached( wheel->currentTick, timer->expiryTick ) == true )
+                {
+                    timer->armed = false;
+                    wheel->count--;
+                    expire( timer, nowMs, buffer, bufferSize, callback, pContext );
+                }
+                else
+                {
+                    /* Beyond the range of the levels when armed. */
+                    place( wheel, timer );
+                }
+            }
+        }
+
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
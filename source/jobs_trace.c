@@ -0,0 +1,222 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_trace.c
+ * @brief Implementation of the APIs from jobs_trace.h.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Internal Includes */
+#include "jobs_trace.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief The registered sink.
+ */
+static JobsTraceSink_t traceSink = NULL;
+
+/**
+ * @brief The context of the registered sink.
+ */
+static void * traceContext = NULL;
+
+/**
+ * @brief Find the histogram bucket of a cycle count.
+ *
+ * @param[in] cycles  The cycle count.
+ *
+ * @return The index of the highest bit set, 0 for 0.
+ */
+static uint32_t bucketOf( uint32_t cycles )
+{
+    uint32_t rest = cycles;
+    uint32_t bucket = 0U;
+
+    while( rest > 1U )
+    {
+        rest >>= 1;
+        bucket++;
+    }
+
+    return bucket;
+}
+
+/** @endcond */
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_trace.h for docs.
+ *
+ * @brief Register the sink receiving events.
+ */
+void Jobs_TraceSetSink( JobsTraceSink_t sink,
+                        void * pContext )
+{
+    traceSink = sink;
+    traceContext = pContext;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_trace.h for docs.
+ *
+ * @brief Report an event to the registered sink.
+ */
+void Jobs_TraceEmit( JobsTracePoint_t point,
+                     uint32_t cycles,
+                     size_t bytes,
+                     int32_t result )
+{
+    JobsTraceEvent_t event;
+
+    if( traceSink != NULL )
+    {
+        event.point = point;
+        event.cycles = cycles;
+        event.bytes = bytes;
+        event.result = result;
+        traceSink( traceContext, &event );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_trace.h for docs.
+ *
+ * @brief JSON_SearchConst reporting an event.
+ */
+JSONStatus_t Jobs_TraceJsonSearch( const char * buf,
+                                   size_t max,
+                                   const char * query,
+                                   size_t queryLength,
+                                   const char ** outValue,
+                                   size_t * outValueLength,
+                                   JSONTypes_t * outType )
+{
+    const uint32_t start = JOBS_TRACE_CYCLES();
+    JSONStatus_t ret;
+    size_t bytes = max;
+
+    ret = JSON_SearchConst( buf, max, query, queryLength, outValue, outValueLength, outType );
+
+    if( ( ret == JSONSuccess ) && ( outValue != NULL ) && ( outValueLength != NULL ) )
+    {
+        bytes = ( size_t ) ( &( *outValue )[ *outValueLength ] - buf );
+    }
+
+    Jobs_TraceEmit( JobsTraceJsonSearch, JOBS_TRACE_CYCLES() - start, bytes, ( int32_t ) ret );
+    JOBS_STATS_ADD( JobsStatsJsonBytes, bytes );
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_trace.h for docs.
+ *
+ * @brief JSON_Validate reporting an event.
+ */
+JSONStatus_t Jobs_TraceJsonValidate( const char * buf,
+                                     size_t max )
+{
+    const uint32_t start = JOBS_TRACE_CYCLES();
+    JSONStatus_t ret;
+
+    ret = JSON_Validate( buf, max );
+    Jobs_TraceEmit( JobsTraceJsonValidate, JOBS_TRACE_CYCLES() - start, max, ( int32_t ) ret );
+    JOBS_STATS_ADD( JobsStatsJsonBytes, max );
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_trace.h for docs.
+ *
+ * @brief A sink accumulating per function statistics.
+ */
+void Jobs_TraceHistogramSink( void * pContext,
+                              const JobsTraceEvent_t * event )
+{
+    JobsTraceHistogram_t * histogram = pContext;
+    JobsTraceStats_t * stats;
+
+    if( ( histogram != NULL ) && ( event != NULL ) &&
+        ( event->point >= JobsTraceGetTopic ) && ( event->point < JobsTraceMaxPoint ) )
+    {
+        stats = &histogram->points[ event->point ];
+        stats->count++;
+        stats->maxCycles = ( event->cycles > stats->maxCycles ) ? event->cycles : stats->maxCycles;
+        stats->totalCycles += event->cycles;
+        stats->totalBytes += event->bytes;
+        stats->buckets[ bucketOf( event->cycles ) ]++;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * See jobs_trace.h for docs.
+ *
+ * @brief Estimate a percentile of the cycles of a function.
+ */
+uint32_t Jobs_TraceHistogramPercentile( const JobsTraceHistogram_t * histogram,
+                                        JobsTracePoint_t point,
+                                        uint32_t percent )
+{
+    const JobsTraceStats_t * stats;
+    uint64_t rank;
+    uint64_t seen = 0U;
+    uint32_t bucket = 0U;
+    uint32_t ret = 0U;
+
+    if( ( histogram != NULL ) && ( point >= JobsTraceGetTopic ) && ( point < JobsTraceMaxPoint ) &&
+        ( percent > 0U ) && ( percent <= 100U ) && ( histogram->points[ point ].count > 0U ) )
+    {
+        stats = &histogram->points[ point ];
+
+        /* The rank of the percentile, rounded up. */
+        rank = ( ( ( uint64_t ) stats->count * percent ) + 99U ) / 100U;
+
+        while( ( bucket < ( JOBS_TRACE_HISTOGRAM_BUCKETS - 1U ) ) && ( ( seen + stats->buckets[ bucket ] ) < rank ) )
+        {
+            seen += stats->buckets[ bucket ];
+            bucket++;
+        }
+
+        ret = ( bucket < 31U ) ? ( ( ( uint32_t ) 2U << bucket ) - 1U ) : UINT32_MAX;
+        ret = ( ret < stats->maxCycles ) ? ret : stats->maxCycles;
+    }
+
+    return ret;
+}
@@ -0,0 +1,522 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_version.c
+ * @brief Implementation of the APIs from jobs_version.h.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Internal Includes */
+#include "jobs_version.h"
+#include "jobs_internal.h"
+#include "jobs_trace.h"
+/* External Dependencies */
+#include "core_json.h"
+
+/** @cond DO_NOT_DOCUMENT */
+
+/**
+ * @brief Get the length of a string literal.
+ */
+#define CONST_STRLEN( x )    ( sizeof( ( x ) ) - 1U )
+
+/**
+ * @brief Parse a JSON number as a version.
+ *
+ * @param[in] value  The number characters.
+ * @param[in] valueLength  The length of the number.
+ * @param[in] type  The JSON type of the value.
+ * @param[out] outVersion  The version.
+ *
+ * @return true if the value is an unsigned 32-bit integer;
+ * false otherwise
+ */
+static bool parseVersion( const char * value,
+                          size_t valueLength,
+                          JSONTypes_t type,
+                          uint32_t * outVersion )
+{
+    return ( ( type == JSONNumber ) &&
+             ( Jobs_StringToUint( value, valueLength, outVersion ) == JobsSuccess ) ) ? true : false;
+}
+
+/**
+ * @brief Predicate returns true for a job ID that fits an entry.
+ *
+ * @param[in] jobId  The job ID.
+ * @param[in] jobIdLength  The length of the job ID.
+ *
+ * @return true if the job ID can be cached;
+ * false otherwise
+ */
+static bool isCacheableJobId( const char * jobId,
+                              size_t jobIdLength )
+{
+    return ( ( jobId != NULL ) && ( jobIdLength > 0U ) &&
+             ( jobIdLength <= JOBS_JOBID_MAX_LENGTH ) ) ? true : false;
+}
+
+/**
+ * @brief Mark an entry as the most recently used.
+ *
+ * @param[in] cache  The version cache.
+ * @param[in] entry  The entry used.
+ */
+static void touchEntry( JobsVersionCache_t * cache,
+                        JobsVersionEntry_t * entry )
+{
+    cache->useCount++;
+    entry->lastUsed = cache->useCount;
+}
+
+/**
+ * @brief Find the entry of a job.
+ *
+ * @param[in] cache  The version cache.
+ * @param[in] jobId  The job ID.
+ * @param[in] jobIdLength  The length of the job ID.
+ *
+ * @return The entry, or NULL if the job has none.
+ */
+static JobsVersionEntry_t * findVersionEntry( const JobsVersionCache_t * cache,
+                                              const char * jobId,
+                                              size_t jobIdLength )
+{
+    JobsVersionEntry_t * ret = NULL;
+    size_t i;
+
+    for( i = 0U; ( ret == NULL ) && ( i < cache->entryCount ); i++ )
+    {
+        JobsVersionEntry_t * entry = &cache->pEntries[ i ];
+
+        if( ( entry->jobIdLength == jobIdLength ) &&
+            ( memcmp( entry->jobId, jobId, jobIdLength ) == 0 ) )
+        {
+            ret = entry;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Record the version of a job, replacing the least recently used
+ * entry when the cache is full.
+ *
+ * @param[in] cache  The version cache.
+ * @param[in] jobId  The job ID.
+ * @param[in] jobIdLength  The length of the job ID.
+ * @param[in] version  The version reported by the service.
+ *
+ * @return true if the version was recorded;
+ * false if the job ID cannot be cached
+ */
+static bool recordVersion( JobsVersionCache_t * cache,
+                           const char * jobId,
+                           size_t jobIdLength,
+                           uint32_t version )
+{
+    bool ret = isCacheableJobId( jobId, jobIdLength );
+    JobsVersionEntry_t * entry = NULL;
+    size_t i;
+
+    if( ret == true )
+    {
+        entry = findVersionEntry( cache, jobId, jobIdLength );
+    }
+
+    for( i = 0U; ( ret == true ) && ( entry == NULL ) && ( i < cache->entryCount ); i++ )
+    {
+        if( cache->pEntries[ i ].jobIdLength == 0U )
+        {
+            entry = &cache->pEntries[ i ];
+        }
+    }
+
+    if( ( ret == true ) && ( entry == NULL ) )
+    {
+        entry = &cache->pEntries[ 0 ];
+
+        /* Ages are unsigned differences, so the use count may wrap. */
+        for( i = 1U; i < cache->entryCount; i++ )
+        {
+            if( ( cache->useCount - cache->pEntries[ i ].lastUsed ) >
+                ( cache->useCount - entry->lastUsed ) )
+            {
+                entry = &cache->pEntries[ i ];
+            }
+        }
+    }
+
+    if( ret == true )
+    {
+        ( void ) memcpy( entry->jobId, jobId, jobIdLength );
+        entry->jobIdLength = ( uint16_t ) jobIdLength;
+        entry->versionNumber = version;
+        touchEntry( cache, entry );
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Record the version of a job execution or job summary object.
+ *
+ * @param[in] cache  The version cache.
+ * @param[in] object  A JSON object with jobId and versionNumber members.
+ * @param[in] objectLength  The length of the object.
+ *
+ * @return true if a version was recorded;
+ * false otherwise
+ */
+static bool recordObject( JobsVersionCache_t * cache,
+                          const char * object,
+                          size_t objectLength )
+{
+    bool ret = false;
+    const char * jobId = NULL;
+    size_t jobIdLength = 0U;
+    const char * value = NULL;
+    size_t valueLength = 0U;
+    JSONTypes_t type = JSONInvalid;
+    uint32_t version = 0U;
+
+    if( ( JOBS_TRACE_JSON_SEARCH( object, objectLength, "jobId", CONST_STRLEN( "jobId" ),
+                                  &jobId, &jobIdLength, NULL ) == JSONSuccess ) &&
+        ( JOBS_TRACE_JSON_SEARCH( object, objectLength, "versionNumber", CONST_STRLEN( "versionNumber" ),
+                                  &value, &valueLength, &type ) == JSONSuccess ) &&
+        ( parseVersion( value, valueLength, type, &version ) == true ) )
+    {
+        ret = recordVersion( cache, jobId, jobIdLength, version );
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Record the versions of an array of job summaries.
+ *
+ * @param[in] cache  The version cache.
+ * @param[in] message  The message payload.
+ * @param[in] messageLength  The length of the message payload.
+ * @param[in] query  The key of the array.
+ * @param[in] queryLength  The length of the key.
+ *
+ * @return true if at least one version was recorded;
+ * false otherwise
+ */
+static bool recordSummaries( JobsVersionCache_t * cache,
+                             const char * message,
+                             size_t messageLength,
+                             const char * query,
+                             size_t queryLength )
+{
+    bool ret = false;
+    const char * summaries = NULL;
+    size_t summariesLength = 0U;
+    JSONTypes_t type = JSONInvalid;
+    size_t start = 0U;
+    size_t next = 0U;
+    JSONPair_t pair = { 0 };
+
+    if( ( JOBS_TRACE_JSON_SEARCH( message, messageLength, query, queryLength,
+                                  &summaries, &summariesLength, &type ) == JSONSuccess ) &&
+        ( type == JSONArray ) )
+    {
+        while( JSON_Iterate( summaries, summariesLength, &start, &next, &pair ) == JSONSuccess )
+        {
+            if( ( pair.jsonType == JSONObject ) &&
+                ( recordObject( cache, pair.value, pair.valueLength ) == true ) )
+            {
+                ret = true;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Record the version of an UpdateJobExecution response.
+ *
+ * @param[in] cache  The version cache.
+ * @param[in] topic  The matched topic.
+ * @param[in] jobId  The job ID from the topic.
+ * @param[in] jobIdLength  The length of the job ID.
+ * @param[in] message  The message payload.
+ * @param[in] messageLength  The length of the message payload.
+ *
+ * @return true if a version was recorded;
+ * false otherwise
+ */
+static bool recordUpdate( JobsVersionCache_t * cache,
+                          JobsTopic_t topic,
+                          const char * jobId,
+                          size_t jobIdLength,
+                          const char * message,
+                          size_t messageLength )
+{
+    bool ret = false;
+    const char * value = NULL;
+    size_t valueLength = 0U;
+    JSONTypes_t type = JSONInvalid;
+    uint32_t version = 0U;
+    JobsVersionEntry_t * entry = NULL;
+
+    if( isCacheableJobId( jobId, jobIdLength ) == true )
+    {
+        if( JOBS_TRACE_JSON_SEARCH( message, messageLength,
+                                    "executionState.versionNumber",
+                                    CONST_STRLEN( "executionState.versionNumber" ),
+                                    &value, &valueLength, &type ) == JSONSuccess )
+        {
+            if( parseVersion( value, valueLength, type, &version ) == true )
+            {
+                ret = recordVersion( cache, jobId, jobIdLength, version );
+            }
+        }
+        else if( topic == JobsUpdateSuccess )
+        {
+            entry = findVersionEntry( cache, jobId, jobIdLength );
+
+            if( entry != NULL )
+            {
+                entry->versionNumber++;
+                touchEntry( cache, entry );
+                ret = true;
+            }
+        }
+        else
+        {
+            /* MISRA Empty Body */
+        }
+    }
+
+    return ret;
+}
+
+#define checkCache() \
+    ( ( cache != NULL ) && ( cache->pEntries != NULL ) )
+
+/** @endcond */
+
+/**
+ * See jobs_version.h for docs.
+ *
+ * @brief Initialize a version cache over caller provided entries.
+ */
+JobsStatus_t Jobs_VersionCacheInit( JobsVersionCache_t * cache,
+                                    JobsVersionEntry_t * entries,
+                                    size_t entryCount )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    size_t i;
+
+    if( ( cache != NULL ) && ( entries != NULL ) && ( entryCount > 0U ) )
+    {
+        cache->pEntries = entries;
+        cache->entryCount = entryCount;
+        cache->useCount = 0U;
+
+        for( i = 0U; i < entryCount; i++ )
+        {
+            entries[ i ].jobIdLength = 0U;
+            entries[ i ].versionNumber = 0U;
+            entries[ i ].lastUsed = 0U;
+        }
+
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_version.h for docs.
+ *
+ * @brief Record the versions reported in a matched Jobs message.
+ */
+JobsStatus_t Jobs_VersionCacheObserve( JobsVersionCache_t * cache,
+                                       JobsTopic_t topic,
+                                       const char * jobId,
+                                       uint16_t jobIdLength,
+                                       const char * message,
+                                       size_t messageLength )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    const char * execution = NULL;
+    size_t executionLength = 0U;
+    bool recorded = false;
+
+    if( checkCache() && ( message != NULL ) && ( messageLength > 0U ) )
+    {
+        ret = JobsNoMatch;
+
+        if( JOBS_TRACE_JSON_VALIDATE( message, messageLength ) == JSONSuccess )
+        {
+            switch( topic )
+            {
+                case JobsStartNextSuccess:
+                case JobsDescribeSuccess:
+                case JobsNextJobChanged:
+
+                    /* The execution object names its job, which the topic
+                     * does not for $next and notify-next. */
+                    if( JOBS_TRACE_JSON_SEARCH( message, messageLength, "execution", CONST_STRLEN( "execution" ),
+                                                &execution, &executionLength, NULL ) == JSONSuccess )
+                    {
+                        recorded = recordObject( cache, execution, executionLength );
+                    }
+
+                    break;
+
+                case JobsUpdateSuccess:
+                case JobsUpdateFailed:
+                    recorded = recordUpdate( cache, topic, jobId, jobIdLength, message, messageLength );
+                    break;
+
+                case JobsGetPendingSuccess:
+                    recorded = recordSummaries( cache, message, messageLength,
+                                                "inProgressJobs", CONST_STRLEN( "inProgressJobs" ) );
+                    recorded = recordSummaries( cache, message, messageLength,
+                                                "queuedJobs", CONST_STRLEN( "queuedJobs" ) ) || recorded;
+                    break;
+
+                case JobsJobsChanged:
+                    recorded = recordSummaries( cache, message, messageLength,
+                                                "jobs.IN_PROGRESS", CONST_STRLEN( "jobs.IN_PROGRESS" ) );
+                    recorded = recordSummaries( cache, message, messageLength,
+                                                "jobs.QUEUED", CONST_STRLEN( "jobs.QUEUED" ) ) || recorded;
+                    break;
+
+                default:
+                    /* Other messages do not report a version. */
+                    break;
+            }
+        }
+
+        if( recorded == true )
+        {
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_version.h for docs.
+ *
+ * @brief Look up the last known version of a job execution.
+ */
+JobsStatus_t Jobs_VersionCacheGet( JobsVersionCache_t * cache,
+                                   const char * jobId,
+                                   uint16_t jobIdLength,
+                                   uint32_t * outVersion )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    JobsVersionEntry_t * entry = NULL;
+
+    if( checkCache() && ( isCacheableJobId( jobId, jobIdLength ) == true ) && ( outVersion != NULL ) )
+    {
+        ret = JobsNoMatch;
+        entry = findVersionEntry( cache, jobId, jobIdLength );
+
+        if( entry != NULL )
+        {
+            touchEntry( cache, entry );
+            *outVersion = entry->versionNumber;
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_version.h for docs.
+ *
+ * @brief Forget the version of a job execution.
+ */
+JobsStatus_t Jobs_VersionCacheRemove( JobsVersionCache_t * cache,
+                                      const char * jobId,
+                                      uint16_t jobIdLength )
+{
+    JobsStatus_t ret = JobsBadParameter;
+    JobsVersionEntry_t * entry = NULL;
+
+    if( checkCache() && ( isCacheableJobId( jobId, jobIdLength ) == true ) )
+    {
+        ret = JobsNoMatch;
+        entry = findVersionEntry( cache, jobId, jobIdLength );
+
+        if( entry != NULL )
+        {
+            entry->jobIdLength = 0U;
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * See jobs_version.h for docs.
+ *
+ * @brief Populate a message string for an UpdateJobExecution request,
+ * filling expectedVersion from the cache.
+ */
+size_t Jobs_VersionCacheUpdateMsg( JobsVersionCache_t * cache,
+                                   const char * jobId,
+                                   uint16_t jobIdLength,
+                                   JobsUpdateRequest_t request,
+                                   const JobsUpdateOptions_t * options,
+                                   char * buffer,
+                                   size_t bufferSize )
+{
+    size_t ret = 0U;
+    char expectedVersion[ JOBS_UINT32_STRING_MAX_LENGTH ];
+    uint32_t version = 0U;
+    JobsUpdateRequest_t update = request;
+
+    if( checkCache() && ( isCacheableJobId( jobId, jobIdLength ) == true ) )
+    {
+        if( ( ( update.expectedVersion == NULL ) || ( update.expectedVersionLength == 0U ) ) &&
+            ( Jobs_VersionCacheGet( cache, jobId, jobIdLength, &version ) == JobsSuccess ) )
+        {
+            update.expectedVersion = expectedVersion;
+            update.expectedVersionLength = Jobs_UintToString( version, expectedVersion, sizeof( expectedVersion ) );
+        }
+
+        ret = Jobs_UpdateMsgWithOptions( update, options, buffer, bufferSize );
+    }
+
+    return ret;
+}
@@ -0,0 +1,146 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. and its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License. See the LICENSE accompanying this file
+ * for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#ifndef OTA_JOB_CACHE_H
+#define OTA_JOB_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "job_parser.h"
+
+/**
+ * @brief Number of string fields of an OTA job document kept by the cache.
+ */
+#define OTA_JOB_CACHE_STRING_FIELDS    5U
+
+/**
+ * @ingroup jobs_structs
+ * @brief An OTA job document file parsed before.
+ *
+ * String fields are kept as offsets into the job document, so they can be
+ * applied to any later delivery of the same document.
+ */
+typedef struct
+{
+    /** @brief Hash of the document, file index and protocol, zero if unused */
+    uint64_t key;
+
+    /** @brief Length of the document */
+    uint32_t jobDocLength;
+
+    /** @brief Offsets of the string fields, UINT32_MAX for NULL */
+    uint32_t offsets[ OTA_JOB_CACHE_STRING_FIELDS ];
+
+    /** @brief Lengths of the string fields */
+    uint32_t lengths[ OTA_JOB_CACHE_STRING_FIELDS ];
+
+    /** @brief File ID */
+    uint32_t fileId;
+
+    /** @brief Size of the OTA Update */
+    uint32_t fileSize;
+
+    /** @brief File Type */
+    uint32_t fileType;
+
+    /** @brief The next file index returned by the parse */
+    int8_t nextFileIndex;
+} OtaJobCacheEntry_t;
+
+/**
+ * @ingroup jobs_structs
+ * @brief A fixed capacity cache of parsed OTA job document files.
+ *
+ * @note Members are private, initialize with #otaParser_cacheInit.
+ */
+typedef struct
+{
+    /** @brief Caller provided entries */
+    OtaJobCacheEntry_t * pEntries;
+
+    /** @brief Number of entries */
+    size_t capacity;
+
+    /** @brief Entry replaced by the next parse that misses */
+    size_t next;
+} OtaJobCache_t;
+
+/**
+ * @brief Initialize a cache of parsed OTA job document files
+ *
+ * @param cache The cache to initialize
+ * @param entries Storage for the cache entries
+ * @param entryCount Number of elements in entries
+ * @return true The cache was initialized
+ * @return false Invalid parameters were passed
+ */
+/* @[declare_otaparser_cacheinit] */
+bool otaParser_cacheInit( OtaJobCache_t * cache,
+                          OtaJobCacheEntry_t * entries,
+                          size_t entryCount );
+/* @[declare_otaparser_cacheinit] */
+
+/**
+ * @brief Parse a file of an OTA job document, reusing the result of an
+ * earlier parse of the same document
+ *
+ * The same document arrives in notify-next, start-next accepted and
+ * describe responses.  A repeat delivery is matched by a hash of its
+ * content, so it costs a hash and no JSON parsing.  Members of fields
+ * absent from the document, and all members on error, are set to NULL or
+ * zero.
+ *
+ * @param cache The cache
+ * @param jobDoc The job document contained in the AWS IoT Job
+ * @param jobDocLength The length of the job document
+ * @param fileIndex The index of the file to use properties of
+ * @param protocol The protocol to use
+ * @param protocolLength The length of the protocol
+ * @param fields A pointer to an job document fields structure populated by call
+ * @return int8_t The next file index in the job. Returns 0 if no additional files are available. Returns -1 if error.
+ *
+ * <b>Example</b>
+ * @code{c}
+ *
+ * // The following example parses every file of a received job document,
+ * // which is only parsed the first time the document is received.
+ *
+ * static OtaJobCacheEntry_t entries[ 4 ];
+ * static OtaJobCache_t cache;
+ * int8_t fileIndex = 0;
+ * AfrOtaJobDocumentFields_t fields;
+ *
+ * ( void ) otaParser_cacheInit( &cache, entries, 4U );
+ *
+ * do
+ * {
+ *     fileIndex = otaParser_parseJobDocFileCached( &cache,
+ *                                                  jobDoc,
+ *                                                  jobDocLength,
+ *                                                  fileIndex,
+ *                                                  "MQTT",
+ *                                                  4U,
+ *                                                  &fields );
+ * } while( fileIndex > 0 );
+ * @endcode
+ */
+/* @[declare_otaparser_parsejobdocfilecached] */
+int8_t otaParser_parseJobDocFileCached( OtaJobCache_t * cache,
+                                        const char * jobDoc,
+                                        const size_t jobDocLength,
+                                        const uint8_t fileIndex,
+                                        const char * protocol,
+                                        const size_t protocolLength,
+                                        AfrOtaJobDocumentFields_t * fields );
+/* @[declare_otaparser_parsejobdocfilecached] */
+
+#endif /* OTA_JOB_CACHE_H */
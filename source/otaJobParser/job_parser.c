@@ -15,6 +15,8 @@
 
 #include "core_json.h"
 #include "job_parser.h"
+#include "jobs_trace.h"
+#include "jobs_log.h"
 
 /**
  * @brief Populates common job document fields in result
@@ -156,11 +158,14 @@ bool populateJobDocFields( const char * jobDoc,
     bool populatedJobDocFields = false;
     JSONStatus_t jsonResult = JSONNotFound;
 
+    JOBS_TRACE_ENTER();
+
     /* TODO - Add assertions for NULL job docs or 0 length documents*/
     jsonResult = populateCommonFields( jobDoc, jobDocLength, fileIndex, result );
 
     if( ( jsonResult == JSONSuccess ) && ( protocolLength == 0U ) )
     {
+        JOBS_LOG_ERROR( JobsLogOtaNoProtocol, 0U, 0U );
         jsonResult = JSONBadParameter;
     }
 
@@ -169,12 +174,12 @@ bool populateJobDocFields( const char * jobDoc,
         /* Get the protocols array */
         const char * protocolsArray = NULL;
         size_t protocolsArrayLength = 0U;
-        jsonResult = JSON_SearchConst( jobDoc,
-                                       jobDocLength,
-                                       "afr_ota.protocols",
-                                       17U,
-                                       &protocolsArray,
-                                       &protocolsArrayLength, NULL );
+        jsonResult = JOBS_TRACE_JSON_SEARCH( jobDoc,
+                                             jobDocLength,
+                                             "afr_ota.protocols",
+                                             17U,
+                                             &protocolsArray,
+                                             &protocolsArrayLength, NULL );
 
         /* Iterate through the protocols array and find the matching protocol */
         if( ( jsonResult == JSONSuccess ) && ( protocolsArrayLength > 0U ) )
@@ -193,6 +198,12 @@ bool populateJobDocFields( const char * jobDoc,
                 }
             }
         }
+
+        if( jsonResult != JSONSuccess )
+        {
+            JOBS_STATS_ADD( JobsStatsOtaBadProtocol, 1U );
+            JOBS_LOG_WARN( JobsLogOtaProtocol, protocolLength, jsonResult );
+        }
     }
 
     /* Determine if the supported protocol is MQTT or HTTP */
@@ -214,6 +225,7 @@ bool populateJobDocFields( const char * jobDoc,
     }
 
     populatedJobDocFields = ( jsonResult == JSONSuccess );
+    JOBS_TRACE_EXIT( JobsTracePopulateJobDocFields, jobDocLength, populatedJobDocFields );
 
     /* Should this nullify the fields which have been populated before
      * returning? */
@@ -243,9 +255,16 @@ static JSONStatus_t populateCommonFields( const char * jobDoc,
                                       queryString,
                                       queryStringLength,
                                       &( result->fileSize ) );
+
+        if( jsonResult != JSONSuccess )
+        {
+            JOBS_STATS_ADD( JobsStatsOtaBadFileSize, 1U );
+            JOBS_LOG_WARN( JobsLogOtaFileSize, fileIndex, jsonResult );
+        }
     }
     else
     {
+        JOBS_LOG_ERROR( JobsLogOtaFileIndex, fileIndex, 0U );
         jsonResult = JSONIllegalDocument;
     }
 
@@ -261,6 +280,12 @@ static JSONStatus_t populateCommonFields( const char * jobDoc,
                                       queryString,
                                       queryStringLength,
                                       &( result->fileId ) );
+
+        if( jsonResult != JSONSuccess )
+        {
+            JOBS_STATS_ADD( JobsStatsOtaBadFileId, 1U );
+            JOBS_LOG_WARN( JobsLogOtaFileId, fileIndex, jsonResult );
+        }
     }
 
     if( jsonResult == JSONSuccess )
@@ -270,15 +295,21 @@ static JSONStatus_t populateCommonFields( const char * jobDoc,
                                      8U,
                                      queryString,
                                      &queryStringLength );
-        jsonResult = JSON_SearchConst( jobDoc,
-                                       jobDocLength,
-                                       queryString,
-                                       queryStringLength,
-                                       &jsonValue,
-                                       &jsonValueLength,
-                                       NULL );
+        jsonResult = JOBS_TRACE_JSON_SEARCH( jobDoc,
+                                             jobDocLength,
+                                             queryString,
+                                             queryStringLength,
+                                             &jsonValue,
+                                             &jsonValueLength,
+                                             NULL );
         result->filepath = jsonValue;
         result->filepathLen = ( uint32_t ) jsonValueLength;
+
+        if( jsonResult != JSONSuccess )
+        {
+            JOBS_STATS_ADD( JobsStatsOtaBadFilePath, 1U );
+            JOBS_LOG_WARN( JobsLogOtaFilePath, fileIndex, jsonResult );
+        }
     }
 
     if( jsonResult == JSONSuccess )
@@ -288,15 +319,21 @@ static JSONStatus_t populateCommonFields( const char * jobDoc,
                                      8U,
                                      queryString,
                                      &queryStringLength );
-        jsonResult = JSON_SearchConst( jobDoc,
-                                       jobDocLength,
-                                       queryString,
-                                       queryStringLength,
-                                       &jsonValue,
-                                       &jsonValueLength,
-                                       NULL );
+        jsonResult = JOBS_TRACE_JSON_SEARCH( jobDoc,
+                                             jobDocLength,
+                                             queryString,
+                                             queryStringLength,
+                                             &jsonValue,
+                                             &jsonValueLength,
+                                             NULL );
         result->certfile = jsonValue;
         result->certfileLen = ( uint32_t ) jsonValueLength;
+
+        if( jsonResult != JSONSuccess )
+        {
+            JOBS_STATS_ADD( JobsStatsOtaBadCertFile, 1U );
+            JOBS_LOG_WARN( JobsLogOtaCertFile, fileIndex, jsonResult );
+        }
     }
 
     if( jsonResult == JSONSuccess )
@@ -306,15 +343,21 @@ static JSONStatus_t populateCommonFields( const char * jobDoc,
                                      16U,
                                      queryString,
                                      &queryStringLength );
-        jsonResult = JSON_SearchConst( jobDoc,
-                                       jobDocLength,
-                                       queryString,
-                                       queryStringLength,
-                                       &jsonValue,
-                                       &jsonValueLength,
-                                       NULL );
+        jsonResult = JOBS_TRACE_JSON_SEARCH( jobDoc,
+                                             jobDocLength,
+                                             queryString,
+                                             queryStringLength,
+                                             &jsonValue,
+                                             &jsonValueLength,
+                                             NULL );
         result->signature = jsonValue;
         result->signatureLen = ( uint32_t ) jsonValueLength;
+
+        if( jsonResult != JSONSuccess )
+        {
+            JOBS_STATS_ADD( JobsStatsOtaBadSignature, 1U );
+            JOBS_LOG_WARN( JobsLogOtaSignature, fileIndex, jsonResult );
+        }
     }
 
     if( jsonResult == JSONSuccess )
@@ -348,6 +391,12 @@ static JSONStatus_t populateOptionalCommonFields( const char * jobDoc,
                                   queryStringLength,
                                   &( result->fileType ) );
 
+    if( jsonResult == JSONBadParameter )
+    {
+        JOBS_STATS_ADD( JobsStatsOtaBadFileType, 1U );
+        JOBS_LOG_WARN( JobsLogOtaFileType, fileIndex, 0U );
+    }
+
     return ( jsonResult == JSONBadParameter ) ? jsonResult : JSONSuccess;
 }
 
@@ -359,13 +408,13 @@ static JSONStatus_t populateMqttStreamingFields( const char * jobDoc,
     const char * jsonValue = NULL;
     size_t jsonValueLength = 0U;
 
-    jsonResult = JSON_SearchConst( jobDoc,
-                                   jobDocLength,
-                                   "afr_ota.streamname",
-                                   18U,
-                                   &jsonValue,
-                                   &jsonValueLength,
-                                   NULL );
+    jsonResult = JOBS_TRACE_JSON_SEARCH( jobDoc,
+                                         jobDocLength,
+                                         "afr_ota.streamname",
+                                         18U,
+                                         &jsonValue,
+                                         &jsonValueLength,
+                                         NULL );
     result->imageRef = jsonValue;
     result->imageRefLen = ( uint32_t ) jsonValueLength;
 
@@ -375,6 +424,12 @@ static JSONStatus_t populateMqttStreamingFields( const char * jobDoc,
         jsonResult = JSONNotFound;
     }
 
+    if( jsonResult != JSONSuccess )
+    {
+        JOBS_STATS_ADD( JobsStatsOtaBadStreamName, 1U );
+        JOBS_LOG_WARN( JobsLogOtaStreamName, jsonResult, 0U );
+    }
+
     return jsonResult;
 }
 
@@ -394,16 +449,22 @@ static JSONStatus_t populateHttpStreamingFields( const char * jobDoc,
                                  11U,
                                  queryString,
                                  &queryStringLength );
-    jsonResult = JSON_SearchConst( jobDoc,
-                                   jobDocLength,
-                                   queryString,
-                                   queryStringLength,
-                                   &jsonValue,
-                                   &jsonValueLength,
-                                   NULL );
+    jsonResult = JOBS_TRACE_JSON_SEARCH( jobDoc,
+                                         jobDocLength,
+                                         queryString,
+                                         queryStringLength,
+                                         &jsonValue,
+                                         &jsonValueLength,
+                                         NULL );
     result->authScheme = jsonValue;
     result->authSchemeLen = ( uint32_t ) jsonValueLength;
 
+    if( jsonResult != JSONSuccess )
+    {
+        JOBS_STATS_ADD( JobsStatsOtaBadAuthScheme, 1U );
+        JOBS_LOG_WARN( JobsLogOtaAuthScheme, fileIndex, jsonResult );
+    }
+
     if( jsonResult == JSONSuccess )
     {
         buildIndexedFileQueryString( fileIndex,
@@ -411,13 +472,13 @@ static JSONStatus_t populateHttpStreamingFields( const char * jobDoc,
                                      15U,
                                      queryString,
                                      &queryStringLength );
-        jsonResult = JSON_SearchConst( jobDoc,
-                                       jobDocLength,
-                                       queryString,
-                                       queryStringLength,
-                                       &jsonValue,
-                                       &jsonValueLength,
-                                       NULL );
+        jsonResult = JOBS_TRACE_JSON_SEARCH( jobDoc,
+                                             jobDocLength,
+                                             queryString,
+                                             queryStringLength,
+                                             &jsonValue,
+                                             &jsonValueLength,
+                                             NULL );
         result->imageRef = jsonValue;
         result->imageRefLen = ( uint32_t ) jsonValueLength;
 
@@ -426,6 +487,12 @@ static JSONStatus_t populateHttpStreamingFields( const char * jobDoc,
         {
             jsonResult = JSONNotFound;
         }
+
+        if( jsonResult != JSONSuccess )
+        {
+            JOBS_STATS_ADD( JobsStatsOtaBadUpdateDataUrl, 1U );
+            JOBS_LOG_WARN( JobsLogOtaUpdateDataUrl, fileIndex, jsonResult );
+        }
     }
 
     return jsonResult;
@@ -458,13 +525,13 @@ static JSONStatus_t searchUintValue( const char * jobDoc,
     const char * jsonValue = NULL;
     size_t jsonValueLength = 0U;
 
-    jsonResult = JSON_SearchConst( jobDoc,
-                                   jobDocLength,
-                                   query,
-                                   queryLength,
-                                   &jsonValue,
-                                   &jsonValueLength,
-                                   NULL );
+    jsonResult = JOBS_TRACE_JSON_SEARCH( jobDoc,
+                                         jobDocLength,
+                                         query,
+                                         queryLength,
+                                         &jsonValue,
+                                         &jsonValueLength,
+                                         NULL );
 
     if( jsonResult == JSONSuccess )
     {
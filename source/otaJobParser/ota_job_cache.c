@@ -0,0 +1,247 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. and its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License. See the LICENSE accompanying this file
+ * for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "ota_job_cache.h"
+#include "ota_job_processor.h"
+#include "jobs_internal.h"
+
+/**
+ * @brief Offset marking a NULL string field
+ */
+#define NULL_OFFSET    UINT32_MAX
+
+/**
+ * @brief Hashes a job document with the file index and protocol parsed
+ * from it, using 64-bit FNV-1a
+ *
+ * @param jobDoc The job document
+ * @param jobDocLength The length of the job document
+ * @param fileIndex The file index
+ * @param protocol The protocol
+ * @param protocolLength The length of the protocol
+ * @return uint64_t The hash, never zero
+ */
+static uint64_t hashJobDoc( const char * jobDoc,
+                            const size_t jobDocLength,
+                            const uint8_t fileIndex,
+                            const char * protocol,
+                            const size_t protocolLength );
+
+/**
+ * @brief Stores a string field of a parse as an offset into the document
+ *
+ * @param jobDoc The job document
+ * @param jobDocLength The length of the job document
+ * @param value The string field
+ * @param valueLength The length of the string field
+ * @param offset The offset, NULL_OFFSET for a NULL field
+ * @param length The length
+ * @return true If the field lies in the document
+ * @return false If the field cannot be kept
+ */
+static bool saveString( const char * jobDoc,
+                        const size_t jobDocLength,
+                        const char * value,
+                        const size_t valueLength,
+                        uint32_t * offset,
+                        uint32_t * length );
+
+/**
+ * @brief Restores a string field kept as an offset
+ *
+ * @param jobDoc The job document
+ * @param offset The offset, NULL_OFFSET for a NULL field
+ * @param length The length
+ * @param value The string field
+ * @param valueLength The length of the string field
+ */
+static void loadString( const char * jobDoc,
+                        const uint32_t offset,
+                        const uint32_t length,
+                        const char ** value,
+                        size_t * valueLength );
+
+bool otaParser_cacheInit( OtaJobCache_t * cache,
+                          OtaJobCacheEntry_t * entries,
+                          size_t entryCount )
+{
+    bool initialized = false;
+
+    if( ( cache != NULL ) && ( entries != NULL ) && ( entryCount > 0U ) )
+    {
+        ( void ) memset( entries, 0, entryCount * sizeof( OtaJobCacheEntry_t ) );
+        cache->pEntries = entries;
+        cache->capacity = entryCount;
+        cache->next = 0U;
+        initialized = true;
+    }
+
+    return initialized;
+}
+
+int8_t otaParser_parseJobDocFileCached( OtaJobCache_t * cache,
+                                        const char * jobDoc,
+                                        const size_t jobDocLength,
+                                        const uint8_t fileIndex,
+                                        const char * protocol,
+                                        const size_t protocolLength,
+                                        AfrOtaJobDocumentFields_t * fields )
+{
+    /* String fields in the order they are kept in a cache entry. */
+    const char ** values[ OTA_JOB_CACHE_STRING_FIELDS ] = { NULL };
+    size_t * lengths[ OTA_JOB_CACHE_STRING_FIELDS ] = { NULL };
+    OtaJobCacheEntry_t * entry = NULL;
+    uint64_t key = 0U;
+    int8_t nextFileIndex = -1;
+    size_t i;
+    bool saved = false;
+
+    if( ( cache != NULL ) && ( cache->pEntries != NULL ) && ( jobDoc != NULL ) &&
+        ( jobDocLength > 0U ) && ( jobDocLength < NULL_OFFSET ) &&
+        ( ( protocol != NULL ) || ( protocolLength == 0U ) ) && ( fields != NULL ) )
+    {
+        values[ 0 ] = &fields->signature;
+        lengths[ 0 ] = &fields->signatureLen;
+        values[ 1 ] = &fields->filepath;
+        lengths[ 1 ] = &fields->filepathLen;
+        values[ 2 ] = &fields->certfile;
+        lengths[ 2 ] = &fields->certfileLen;
+        values[ 3 ] = &fields->authScheme;
+        lengths[ 3 ] = &fields->authSchemeLen;
+        values[ 4 ] = &fields->imageRef;
+        lengths[ 4 ] = &fields->imageRefLen;
+        key = hashJobDoc( jobDoc, jobDocLength, fileIndex, protocol, protocolLength );
+
+        for( i = 0U; ( i < cache->capacity ) && ( entry == NULL ); i++ )
+        {
+            if( ( cache->pEntries[ i ].key == key ) &&
+                ( cache->pEntries[ i ].jobDocLength == ( uint32_t ) jobDocLength ) )
+            {
+                entry = &cache->pEntries[ i ];
+            }
+        }
+
+        ( void ) memset( fields, 0, sizeof( AfrOtaJobDocumentFields_t ) );
+
+        if( entry != NULL )
+        {
+            for( i = 0U; i < OTA_JOB_CACHE_STRING_FIELDS; i++ )
+            {
+                loadString( jobDoc, entry->offsets[ i ], entry->lengths[ i ], values[ i ], lengths[ i ] );
+            }
+
+            fields->fileId = entry->fileId;
+            fields->fileSize = entry->fileSize;
+            fields->fileType = entry->fileType;
+            nextFileIndex = entry->nextFileIndex;
+        }
+        else
+        {
+            nextFileIndex = otaParser_parseJobDocFile( jobDoc, jobDocLength, fileIndex,
+                                                       protocol, protocolLength, fields );
+
+            /* Failures are kept too, as documents of other jobs than OTA
+             * updates are delivered as often. */
+            if( nextFileIndex < 0 )
+            {
+                ( void ) memset( fields, 0, sizeof( AfrOtaJobDocumentFields_t ) );
+            }
+
+            saved = true;
+        }
+    }
+
+    if( ( entry == NULL ) && saved )
+    {
+        entry = &cache->pEntries[ cache->next ];
+        saved = true;
+
+        for( i = 0U; ( i < OTA_JOB_CACHE_STRING_FIELDS ) && saved; i++ )
+        {
+            saved = saveString( jobDoc, jobDocLength, *values[ i ], *lengths[ i ],
+                                &entry->offsets[ i ], &entry->lengths[ i ] );
+        }
+
+        entry->key = 0U;
+
+        if( saved )
+        {
+            entry->key = key;
+            entry->jobDocLength = ( uint32_t ) jobDocLength;
+            entry->fileId = fields->fileId;
+            entry->fileSize = fields->fileSize;
+            entry->fileType = fields->fileType;
+            entry->nextFileIndex = nextFileIndex;
+            cache->next = ( cache->next + 1U ) % cache->capacity;
+        }
+    }
+
+    return nextFileIndex;
+}
+
+static uint64_t hashJobDoc( const char * jobDoc,
+                            const size_t jobDocLength,
+                            const uint8_t fileIndex,
+                            const char * protocol,
+                            const size_t protocolLength )
+{
+    uint64_t hash;
+
+    hash = Jobs_Fnv1a64( JOBS_FNV1A64_OFFSET_BASIS, jobDoc, jobDocLength );
+    hash = Jobs_Fnv1a64( hash, &fileIndex, sizeof( fileIndex ) );
+    hash = Jobs_Fnv1a64( hash, protocol, protocolLength );
+
+    return ( hash == 0U ) ? 1U : hash;
+}
+
+static bool saveString( const char * jobDoc,
+                        const size_t jobDocLength,
+                        const char * value,
+                        const size_t valueLength,
+                        uint32_t * offset,
+                        uint32_t * length )
+{
+    bool saved = true;
+
+    *offset = NULL_OFFSET;
+    *length = 0U;
+
+    if( value != NULL )
+    {
+        saved = ( ( value >= jobDoc ) &&
+                  ( ( size_t ) ( value - jobDoc ) <= jobDocLength ) &&
+                  ( valueLength <= ( jobDocLength - ( size_t ) ( value - jobDoc ) ) ) );
+
+        if( saved )
+        {
+            *offset = ( uint32_t ) ( value - jobDoc );
+            *length = ( uint32_t ) valueLength;
+        }
+    }
+
+    return saved;
+}
+
+static void loadString( const char * jobDoc,
+                        const uint32_t offset,
+                        const uint32_t length,
+                        const char ** value,
+                        size_t * valueLength )
+{
+    if( offset != NULL_OFFSET )
+    {
+        *value = &jobDoc[ offset ];
+        *valueLength = length;
+    }
+}
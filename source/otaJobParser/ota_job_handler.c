@@ -15,6 +15,8 @@
 #include "core_json.h"
 
 #include "job_parser.h"
+#include "jobs_trace.h"
+#include "jobs_log.h"
 #include "ota_job_processor.h"
 
 static bool isFreeRTOSOtaJob( const char * jobDoc,
@@ -41,6 +43,8 @@ int8_t otaParser_parseJobDocFile( const char * jobDoc,
     bool fieldsPopulated = false;
     int8_t nextFileIndex = -1;
 
+    JOBS_TRACE_ENTER();
+
     if( ( jobDoc != NULL ) && ( jobDocLength > 0U ) )
     {
         if( isFreeRTOSOtaJob( jobDoc, jobDocLength ) && isJobFileIndexValid( jobDoc, jobDocLength, fileIndex ) )
@@ -52,13 +56,21 @@ int8_t otaParser_parseJobDocFile( const char * jobDoc,
                                                     protocolLength,
                                                     fields );
         }
+        else
+        {
+            JOBS_LOG_WARN( JobsLogOtaNotOtaJob, jobDocLength, fileIndex );
+        }
 
         if( fieldsPopulated )
         {
             nextFileIndex = ( isJobFileIndexValid( jobDoc, jobDocLength, fileIndex + 1U ) ) ? ( int8_t ) ( ( int8_t ) fileIndex + 1 ) : ( int8_t ) 0;
+            JOBS_LOG_INFO( JobsLogOtaParsed, fileIndex, nextFileIndex );
         }
     }
 
+    JOBS_STATS_ADD( ( nextFileIndex >= 0 ) ? JobsStatsOtaParsed : JobsStatsOtaFailed, 1U );
+    JOBS_TRACE_EXIT( JobsTraceParseJobDocFile, jobDocLength, nextFileIndex );
+
     return nextFileIndex;
 }
 
@@ -71,13 +83,13 @@ static bool isFreeRTOSOtaJob( const char * jobDoc,
 
     /* FreeRTOS OTA updates have a top level "afr_ota" job document key.
     * Check for this to ensure the document is an FreeRTOS OTA update */
-    isFreeRTOSOta = JSON_SearchConst( jobDoc,
-                                      jobDocLength,
-                                      "afr_ota",
-                                      7U,
-                                      &afrOtaDocHeader,
-                                      &afrOtaDocHeaderLength,
-                                      NULL );
+    isFreeRTOSOta = JOBS_TRACE_JSON_SEARCH( jobDoc,
+                                            jobDocLength,
+                                            "afr_ota",
+                                            7U,
+                                            &afrOtaDocHeader,
+                                            &afrOtaDocHeaderLength,
+                                            NULL );
 
     return( JSONSuccess == isFreeRTOSOta );
 }
@@ -96,13 +108,13 @@ static bool isJobFileIndexValid( const char * jobDoc,
         int32_t index = ( ( int32_t ) '0' + ( int32_t ) fileIndex );
         file[ 14U ] = ( char ) index;
 
-        isFreeRTOSOta = JSON_SearchConst( jobDoc,
-                                          jobDocLength,
-                                          file,
-                                          16U,
-                                          &fileValue,
-                                          &fileValueLength,
-                                          NULL );
+        isFreeRTOSOta = JOBS_TRACE_JSON_SEARCH( jobDoc,
+                                                jobDocLength,
+                                                file,
+                                                16U,
+                                                &fileValue,
+                                                &fileValueLength,
+                                                NULL );
     }
 
     return( JSONSuccess == isFreeRTOSOta );
@@ -0,0 +1,130 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+/**
+ * @file jobs_ring.h
+ * @brief Slot protocol shared by the bounded rings of the Jobs modules.
+ *
+ * The ingress ring and the log ring follow the bounded queue design where
+ * each slot carries a sequence number: a slot at position pos is free for
+ * a producer when its sequence equals pos, and holds an item for the
+ * consumer when its sequence equals pos + 1.  These functions implement
+ * that protocol over any slot type whose first member is the uint32_t
+ * sequence.  They are internal to the library.
+ */
+
+#ifndef JOBS_RING_H_
+#define JOBS_RING_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs_atomic.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * @brief Largest slot count of a ring.
+ */
+#define JOBS_RING_MAX_SLOTS    0x80000000U
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Mark every slot of a ring free for the first lap.
+ *
+ * @param[in] pSlots  The slots.
+ * @param[in] slotSize  Size of one slot.
+ * @param[in] slotCount  Number of slots, a power of 2 up to
+ * #JOBS_RING_MAX_SLOTS.
+ */
+void Jobs_RingInit( void * pSlots,
+                    size_t slotSize,
+                    size_t slotCount );
+
+/**
+ * @brief Reserve the slot for the next position.
+ *
+ * @param[in] pHead  The next position to reserve.
+ * @param[in] pSlots  The slots.
+ * @param[in] slotSize  Size of one slot.
+ * @param[in] mask  Slot count minus one.
+ * @param[in] multiProducer  Whether several tasks reserve slots.
+ * @param[out] outPosition  The reserved position.
+ *
+ * @return true if a slot was reserved;
+ * false if the ring is full
+ */
+bool Jobs_RingReserve( uint32_t * pHead,
+                       void * pSlots,
+                       size_t slotSize,
+                       uint32_t mask,
+                       bool multiProducer,
+                       uint32_t * outPosition );
+
+/**
+ * @brief Hand a filled slot to the consumer.
+ *
+ * @param[in] pSequence  The sequence of the slot.
+ * @param[in] position  The position reserved for the slot.
+ */
+void Jobs_RingPublish( uint32_t * pSequence,
+                       uint32_t position );
+
+/**
+ * @brief Check whether the slot at a position holds an item.
+ *
+ * @param[in] pSequence  The sequence of the slot.
+ * @param[in] position  The position to consume.
+ *
+ * @return true if the item was published;
+ * false if the slot is still free
+ */
+bool Jobs_RingIsPublished( const uint32_t * pSequence,
+                           uint32_t position );
+
+/**
+ * @brief Hand a consumed slot back to the producers for the next lap.
+ *
+ * @param[in] pSequence  The sequence of the slot.
+ * @param[in] position  The position consumed.
+ * @param[in] mask  Slot count minus one.
+ */
+void Jobs_RingRelease( uint32_t * pSequence,
+                       uint32_t position,
+                       uint32_t mask );
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ifndef JOBS_RING_H_ */
@@ -0,0 +1,270 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_capture_utest.c
+ * @brief Unit tests for the capture and replay of Jobs messages.
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "jobs_capture.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+#define THING_TOPIC    "$aws/things/thing/jobs/"
+
+static uint8_t sinkBuffer[ 4096 ];
+static size_t sinkLength;
+static size_t sinkLimit;
+
+static JobsCapture_t capture;
+static JobsReplay_t replay;
+static JobsCaptureRecord_t record;
+
+/**
+ * @brief A sink appending to sinkBuffer, taking at most sinkLimit bytes.
+ */
+static size_t writeBuffer( void * pContext,
+                           const uint8_t * buffer,
+                           size_t length )
+{
+    size_t taken = length;
+
+    TEST_ASSERT_EQUAL_PTR( &sinkLength, pContext );
+
+    if( ( sinkLength + taken ) > sinkLimit )
+    {
+        taken = sinkLimit - sinkLength;
+    }
+
+    ( void ) memcpy( &sinkBuffer[ sinkLength ], buffer, taken );
+    sinkLength += taken;
+
+    return taken;
+}
+
+static const JobsCaptureSink_t sink = { writeBuffer, &sinkLength };
+
+/**
+ * @brief Record a message on a topic under the thing.
+ */
+static JobsStatus_t recordMessage( uint32_t timestampMs,
+                                   const char * topic,
+                                   const char * payload )
+{
+    return Jobs_CaptureRecord( &capture, timestampMs, topic, strlen( topic ),
+                               payload, ( payload == NULL ) ? 0U : strlen( payload ) );
+}
+
+/**
+ * @brief Check the next message of the replay.
+ */
+static void assertNext( uint32_t timestampMs,
+                        const char * topic,
+                        const char * payload )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ReplayNext( &replay, &record ) );
+    TEST_ASSERT_EQUAL_UINT32( timestampMs, record.timestampMs );
+    TEST_ASSERT_EQUAL( strlen( topic ), record.topicLength );
+    TEST_ASSERT_EQUAL_MEMORY( topic, record.topic, record.topicLength );
+    TEST_ASSERT_EQUAL( strlen( payload ), record.payloadLength );
+
+    if( record.payloadLength > 0U )
+    {
+        TEST_ASSERT_EQUAL_MEMORY( payload, record.payload, record.payloadLength );
+    }
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    sinkLength = 0U;
+    sinkLimit = sizeof( sinkBuffer );
+    memset( &capture, 0, sizeof( capture ) );
+    memset( &replay, 0, sizeof( replay ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_capture_rejectsBadParameters( void )
+{
+    JobsCaptureSink_t noWrite = { NULL, NULL };
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CaptureInit( NULL, &sink ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CaptureInit( &capture, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CaptureInit( &capture, &noWrite ) );
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CaptureRecord( NULL, 0U, THING_TOPIC "notify", 29U, "{}", 2U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CaptureRecord( &capture, 0U, THING_TOPIC "notify", 29U, "{}", 2U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CaptureInit( &capture, &sink ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CaptureRecord( &capture, 0U, NULL, 29U, "{}", 2U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CaptureRecord( &capture, 0U, THING_TOPIC "notify", 29U, NULL, 2U ) );
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ReplayInit( NULL, sinkBuffer, sinkLength ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ReplayInit( &replay, NULL, sinkLength ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ReplayNext( NULL, &record ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ReplayNext( &replay, &record ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ReplayInit( &replay, sinkBuffer, sinkLength ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ReplayNext( &replay, NULL ) );
+}
+
+void test_capture_roundTripsJobsMessages( void )
+{
+    const char * startNext = "{\"execution\":{\"jobId\":\"job1\",\"jobDocument\":{\"op\":\"reboot\"}}}";
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CaptureInit( &capture, &sink ) );
+    TEST_ASSERT_EQUAL( JOBS_CAPTURE_HEADER_SIZE, sinkLength );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, recordMessage( 1000U, THING_TOPIC "notify-next", "{\"timestamp\":1}" ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, recordMessage( 1250U, THING_TOPIC "start-next/accepted", startNext ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, recordMessage( 1250U, THING_TOPIC "job1/update/accepted", NULL ) );
+
+    /* Other topics of the device are left out. */
+    TEST_ASSERT_EQUAL( JobsNoMatch, recordMessage( 1300U, "$aws/things/thing/shadow/update", "{}" ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, recordMessage( 1300U, "$aws/things/", "{}" ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, recordMessage( 1300U, "$aws/things//jobs/notify", "{}" ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, recordMessage( 1300U, "$aws/things/thing-without-slash", "{}" ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, recordMessage( 1300U, "$aws/things/thing/jobs/", "{}" ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, recordMessage( 1300U, "$aws/thing/x/jobs/notify", "{}" ) );
+    TEST_ASSERT_EQUAL( 3U, capture.recordCount );
+
+    /* Timestamps wrap modulo 2^32. */
+    TEST_ASSERT_EQUAL( JobsSuccess, recordMessage( 5U, THING_TOPIC "notify", "{}" ) );
+
+    /* A small record adds 3 bytes to its message. */
+    TEST_ASSERT_EQUAL( JOBS_CAPTURE_HEADER_SIZE + ( 4U * 3U ) + 2U /* delta >= 128 */ +
+                       4U /* wrapped delta */ +
+                       strlen( THING_TOPIC "notify-next{\"timestamp\":1}" ) +
+                       strlen( THING_TOPIC "start-next/accepted" ) + strlen( startNext ) +
+                       strlen( THING_TOPIC "job1/update/accepted" ) +
+                       strlen( THING_TOPIC "notify{}" ), sinkLength );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ReplayInit( &replay, sinkBuffer, sinkLength ) );
+    assertNext( 1000U, THING_TOPIC "notify-next", "{\"timestamp\":1}" );
+    assertNext( 1250U, THING_TOPIC "start-next/accepted", startNext );
+    assertNext( 1250U, THING_TOPIC "job1/update/accepted", "" );
+    assertNext( 5U, THING_TOPIC "notify", "{}" );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_ReplayNext( &replay, &record ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_ReplayNext( &replay, &record ) );
+}
+
+void test_capture_encodesLargeLengths( void )
+{
+    static char payload[ 3000 ];
+
+    memset( payload, 'x', sizeof( payload ) - 1U );
+    payload[ sizeof( payload ) - 1U ] = '\0';
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CaptureInit( &capture, &sink ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, recordMessage( UINT32_MAX, THING_TOPIC "notify", payload ) );
+    TEST_ASSERT_EQUAL( JOBS_CAPTURE_HEADER_SIZE + 5U + 1U + 2U + strlen( THING_TOPIC "notify" ) + strlen( payload ),
+                       sinkLength );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ReplayInit( &replay, sinkBuffer, sinkLength ) );
+    assertNext( UINT32_MAX, THING_TOPIC "notify", payload );
+}
+
+void test_capture_reportsShortWrites( void )
+{
+    sinkLimit = JOBS_CAPTURE_HEADER_SIZE - 1U;
+    TEST_ASSERT_EQUAL( JobsError, Jobs_CaptureInit( &capture, &sink ) );
+
+    /* Fail on the header, topic and payload of a record in turn. */
+    sinkLength = 0U;
+    sinkLimit = JOBS_CAPTURE_HEADER_SIZE + 2U;
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CaptureInit( &capture, &sink ) );
+    TEST_ASSERT_EQUAL( JobsError, recordMessage( 1U, THING_TOPIC "notify", "{}" ) );
+
+    sinkLength = JOBS_CAPTURE_HEADER_SIZE;
+    sinkLimit = JOBS_CAPTURE_HEADER_SIZE + 3U + 4U;
+    TEST_ASSERT_EQUAL( JobsError, recordMessage( 2U, THING_TOPIC "notify", "{}" ) );
+
+    sinkLength = JOBS_CAPTURE_HEADER_SIZE;
+    sinkLimit = JOBS_CAPTURE_HEADER_SIZE + 3U + strlen( THING_TOPIC "notify" ) + 1U;
+    TEST_ASSERT_EQUAL( JobsError, recordMessage( 3U, THING_TOPIC "notify", "{}" ) );
+
+    /* The truncated capture replays up to its last whole record. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ReplayInit( &replay, sinkBuffer, sinkLength ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_ReplayNext( &replay, &record ) );
+}
+
+void test_replay_rejectsCorruptCaptures( void )
+{
+    uint8_t data[ 32 ];
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CaptureInit( &capture, &sink ) );
+    memcpy( data, sinkBuffer, JOBS_CAPTURE_HEADER_SIZE );
+
+    /* Short, foreign or future version headers. */
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ReplayInit( &replay, data, JOBS_CAPTURE_HEADER_SIZE - 1U ) );
+    data[ 0 ] = ( uint8_t ) 'X';
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ReplayInit( &replay, data, JOBS_CAPTURE_HEADER_SIZE ) );
+    data[ 0 ] = ( uint8_t ) 'J';
+    data[ 4 ] = 2U;
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ReplayInit( &replay, data, JOBS_CAPTURE_HEADER_SIZE ) );
+    data[ 4 ] = 1U;
+
+    /* A delta running over 5 bytes. */
+    memset( &data[ JOBS_CAPTURE_HEADER_SIZE ], 0x80, 6U );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ReplayInit( &replay, data, JOBS_CAPTURE_HEADER_SIZE + 6U ) );
+    TEST_ASSERT_EQUAL( JobsError, Jobs_ReplayNext( &replay, &record ) );
+
+    /* A delta over 32 bits. */
+    data[ JOBS_CAPTURE_HEADER_SIZE + 4U ] = 0x10U;
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ReplayInit( &replay, data, JOBS_CAPTURE_HEADER_SIZE + 5U ) );
+    TEST_ASSERT_EQUAL( JobsError, Jobs_ReplayNext( &replay, &record ) );
+
+    /* A capture ending inside a length, then inside the topic. */
+    data[ JOBS_CAPTURE_HEADER_SIZE ] = 0U;
+    data[ JOBS_CAPTURE_HEADER_SIZE + 1U ] = 0x85U;
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ReplayInit( &replay, data, JOBS_CAPTURE_HEADER_SIZE + 2U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_ReplayNext( &replay, &record ) );
+
+    data[ JOBS_CAPTURE_HEADER_SIZE + 1U ] = 4U;
+    data[ JOBS_CAPTURE_HEADER_SIZE + 2U ] = 0U;
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ReplayInit( &replay, data, JOBS_CAPTURE_HEADER_SIZE + 6U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_ReplayNext( &replay, &record ) );
+    TEST_ASSERT_EQUAL( JOBS_CAPTURE_HEADER_SIZE, replay.offset );
+}
@@ -0,0 +1,249 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_coalesce_utest.c
+ * @brief Unit tests for the jobs progress update coalescer.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "unity.h"
+
+#include "jobs_coalesce.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+#define JOB_COUNT      2U
+#define INTERVAL_MS    1000U
+
+static JobsCoalescedJob_t jobs[ JOB_COUNT ];
+static JobsCoalescer_t coalescer;
+static char message[ 512 ];
+static size_t messageLength;
+static const char * jobId;
+static uint16_t jobIdLength;
+
+/**
+ * @brief Submit an update with optional status details.
+ */
+static JobsStatus_t submit( const char * id,
+                            JobCurrentStatus_t status,
+                            const char * statusDetails )
+{
+    JobsUpdateRequest_t request = { 0 };
+
+    request.status = status;
+    request.statusDetails = statusDetails;
+    request.statusDetailsLength = ( statusDetails != NULL ) ? strlen( statusDetails ) : 0U;
+
+    return Jobs_CoalescerSubmit( &coalescer, id, ( uint16_t ) strlen( id ), request );
+}
+
+/**
+ * @brief Take the next due update at a time.
+ */
+static JobsStatus_t next( uint32_t nowMs )
+{
+    memset( message, 0, sizeof( message ) );
+
+    return Jobs_CoalescerNext( &coalescer, nowMs, &jobId, &jobIdLength,
+                               message, sizeof( message ), &messageLength );
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CoalescerInit( &coalescer, jobs, JOB_COUNT, INTERVAL_MS ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_coalescer_rejectsBadParameters( void )
+{
+    JobsUpdateRequest_t request = { 0 };
+    uint32_t delay = 0U;
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CoalescerInit( NULL, jobs, JOB_COUNT, INTERVAL_MS ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CoalescerInit( &coalescer, jobs, 0U, INTERVAL_MS ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CoalescerSubmit( NULL, "a", 1U, request ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, submit( "a/b", InProgress, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, submit( "a", InProgress, "[1]" ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, submit( "a", InProgress, "{\"a\":" ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CoalescerNext( &coalescer, 0U, NULL, &jobIdLength,
+                                                             message, sizeof( message ), &messageLength ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CoalescerNextDelay( &coalescer, 0U, NULL ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_CoalescerNextDelay( &coalescer, 0U, &delay ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, next( 0U ) );
+}
+
+void test_coalescer_mergesStatusDetails( void )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, submit( "a", InProgress, "{\"step\":\"1\",\"of\":\"3\"}" ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, next( 0U ) );
+    TEST_ASSERT_EQUAL_STRING_LEN( "a", jobId, jobIdLength );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, submit( "a", InProgress, "{\"step\":\"2\",\"phase\":\"copy\"}" ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, submit( "a", InProgress, "{\"step\":\"3\"}" ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, next( 999U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, next( 1000U ) );
+    TEST_ASSERT_EQUAL_STRING( "{\"status\":\"IN_PROGRESS\",\"statusDetails\":"
+                              "{\"step\":\"3\",\"of\":\"3\",\"phase\":\"copy\"}}", message );
+    TEST_ASSERT_EQUAL( strlen( message ), messageLength );
+}
+
+void test_coalescer_flushesStatusTransitions( void )
+{
+    uint32_t delay = 0U;
+
+    TEST_ASSERT_EQUAL( JobsSuccess, submit( "a", InProgress, NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, next( 0U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, submit( "a", InProgress, "{\"pct\":\"50\"}" ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CoalescerNextDelay( &coalescer, 400U, &delay ) );
+    TEST_ASSERT_EQUAL( 600U, delay );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, submit( "a", Succeeded, "{\"pct\":\"100\"}" ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CoalescerNextDelay( &coalescer, 400U, &delay ) );
+    TEST_ASSERT_EQUAL( 0U, delay );
+    TEST_ASSERT_EQUAL( JobsSuccess, next( 400U ) );
+    TEST_ASSERT_EQUAL_STRING( "{\"status\":\"SUCCEEDED\",\"statusDetails\":{\"pct\":\"100\"}}", message );
+    TEST_ASSERT_EQUAL_STRING_LEN( "a", jobId, jobIdLength );
+
+    /* The terminal update released the entry of the job. */
+    TEST_ASSERT_EQUAL( JobsSuccess, submit( "b", InProgress, NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, submit( "c", InProgress, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, submit( "d", InProgress, NULL ) );
+}
+
+void test_coalescer_keepsPendingTerminalStatus( void )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, submit( "a", InProgress, NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, next( 0U ) );
+
+    /* A later progress update only adds its status details. */
+    TEST_ASSERT_EQUAL( JobsSuccess, submit( "a", Succeeded, "{\"pct\":\"100\"}" ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, submit( "a", InProgress, "{\"pct\":\"90\",\"phase\":\"done\"}" ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, submit( "a", Failed, NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, next( 0U ) );
+    TEST_ASSERT_EQUAL_STRING( "{\"status\":\"SUCCEEDED\",\"statusDetails\":"
+                              "{\"pct\":\"90\",\"phase\":\"done\"}}", message );
+    TEST_ASSERT_EQUAL( JobsNoMatch, next( INTERVAL_MS ) );
+}
+
+void test_coalescer_keepsUpdateWhenBufferTooSmall( void )
+{
+    char small[ 8 ];
+    char details[ JOBS_COALESCE_STATUS_DETAILS_MAX_LENGTH + 16U ];
+    int length;
+
+    TEST_ASSERT_EQUAL( JobsSuccess, submit( "a", InProgress, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, Jobs_CoalescerNext( &coalescer, 0U, &jobId, &jobIdLength,
+                                                               small, sizeof( small ), &messageLength ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, next( 0U ) );
+
+    length = snprintf( details, sizeof( details ), "{\"log\":\"%0*d\"}",
+                       ( int ) JOBS_COALESCE_STATUS_DETAILS_MAX_LENGTH, 0 );
+    TEST_ASSERT_GREATER_THAN( 0, length );
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, submit( "a", InProgress, details ) );
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, submit( "b", InProgress, details ) );
+
+    /* The refused update of a new job did not claim an entry. */
+    TEST_ASSERT_EQUAL( JobsSuccess, submit( "c", InProgress, NULL ) );
+}
+
+/**
+ * @brief Simulate two jobs reporting progress every 10 ms for 10 s with a
+ * fake clock, and check the publish rate and the final update.
+ */
+void test_coalescer_simulatedProgress( void )
+{
+    char details[ 64 ];
+    size_t emitted[ JOB_COUNT ] = { 0 };
+    uint32_t lastEmitMs[ JOB_COUNT ] = { 0 };
+    uint32_t nowMs;
+    uint32_t completeMs = 0U;
+    size_t i;
+
+    for( nowMs = 0U; nowMs <= 10000U; nowMs += 10U )
+    {
+        ( void ) snprintf( details, sizeof( details ), "{\"tick\":\"%u\"}", ( unsigned ) nowMs );
+        TEST_ASSERT_EQUAL( JobsSuccess, submit( "a", InProgress, details ) );
+
+        if( nowMs < 5000U )
+        {
+            TEST_ASSERT_EQUAL( JobsSuccess, submit( "b", InProgress, details ) );
+        }
+        else if( nowMs == 5000U )
+        {
+            TEST_ASSERT_EQUAL( JobsSuccess, submit( "b", Failed, details ) );
+        }
+        else
+        {
+            /* Job b is complete. */
+        }
+
+        while( next( nowMs ) == JobsSuccess )
+        {
+            i = ( size_t ) ( jobId[ 0 ] - 'a' );
+
+            if( emitted[ i ] > 0U )
+            {
+                TEST_ASSERT_TRUE( ( ( nowMs - lastEmitMs[ i ] ) >= INTERVAL_MS ) ||
+                                  ( strstr( message, "FAILED" ) != NULL ) );
+            }
+
+            if( strstr( message, "FAILED" ) != NULL )
+            {
+                completeMs = nowMs;
+            }
+
+            emitted[ i ]++;
+            lastEmitMs[ i ] = nowMs;
+        }
+    }
+
+    /* 1000 progress ticks per job collapse to one update per interval. */
+    TEST_ASSERT_EQUAL( 11U, emitted[ 0 ] );
+    TEST_ASSERT_EQUAL( 6U, emitted[ 1 ] );
+    TEST_ASSERT_EQUAL( 5000U, completeMs );
+}
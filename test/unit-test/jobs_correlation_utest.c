@@ -0,0 +1,285 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_correlation_utest.c
+ * @brief Unit tests for the jobs correlation table.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "unity.h"
+
+#include "jobs_correlation.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+#define SLOT_COUNT    4U
+
+static JobsPendingRequest_t slots[ SLOT_COUNT ];
+static JobsCorrelationTable_t table;
+static char token[ JOBS_CLIENT_TOKEN_LENGTH ];
+static char message[ 128 ];
+
+/**
+ * @brief Build a response payload carrying a client token.
+ */
+static size_t makeResponse( const char * clientToken )
+{
+    int length = snprintf( message, sizeof( message ),
+                           "{\"timestamp\":1,\"clientToken\":\"%.*s\"}",
+                           ( int ) JOBS_CLIENT_TOKEN_LENGTH, clientToken );
+
+    return ( size_t ) length;
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationInit( &table, slots, SLOT_COUNT ) );
+    memset( token, 0, sizeof( token ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+/**
+ * @brief Test that all parameters are checked for illegal values.
+ */
+void test_Correlation_bad_parameters( void )
+{
+    JobsCorrelationTable_t uninitialized = { 0 };
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CorrelationInit( NULL, slots, SLOT_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CorrelationInit( &table, NULL, SLOT_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CorrelationInit( &table, slots, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CorrelationInit( &table, slots, JOBS_CORRELATION_MAX_REQUESTS + 1U ) );
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CorrelationAdd( NULL, JobsApiUpdate, 0U, 0U, token, sizeof( token ) ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CorrelationAdd( &uninitialized, JobsApiUpdate, 0U, 0U, token, sizeof( token ) ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CorrelationAdd( &table, JobsApiUpdate, 0U, 0U, NULL, sizeof( token ) ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CorrelationAdd( &table, JobsInvalidApi, 0U, 0U, token, sizeof( token ) ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CorrelationAdd( &table, JobsMaxApi, 0U, 0U, token, sizeof( token ) ) );
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CorrelationResolve( NULL, JobsUpdateSuccess, "{}", 2U, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CorrelationResolve( &table, JobsUpdateSuccess, NULL, 2U, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CorrelationResolve( &table, JobsUpdateSuccess, "{}", 0U, NULL ) );
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CorrelationRemove( NULL, token, sizeof( token ) ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CorrelationRemove( &table, NULL, sizeof( token ) ) );
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CorrelationExpire( NULL, 0U, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_CorrelationExpire( &uninitialized, 0U, NULL ) );
+}
+
+/**
+ * @brief Test that a response resolves to the request holding its token.
+ */
+void test_Correlation_resolves_response( void )
+{
+    JobsPendingRequest_t completed = { 0 };
+    size_t length;
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationAdd( &table, JobsApiDescribe, 100U, 7U, token, sizeof( token ) ) );
+    TEST_ASSERT_EQUAL( 1U, table.count );
+
+    length = makeResponse( token );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationResolve( &table, JobsDescribeFailed, message, length, &completed ) );
+    TEST_ASSERT_EQUAL( JobsApiDescribe, completed.api );
+    TEST_ASSERT_EQUAL( 7U, completed.userData );
+    TEST_ASSERT_EQUAL( 100U, completed.deadlineMs );
+    TEST_ASSERT_EQUAL( 0U, table.count );
+
+    /* A response is only resolved once. */
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_CorrelationResolve( &table, JobsDescribeSuccess, message, length, NULL ) );
+}
+
+/**
+ * @brief Test that pipelined requests resolve independently and out of order.
+ */
+void test_Correlation_pipelined_requests( void )
+{
+    char tokens[ SLOT_COUNT ][ JOBS_CLIENT_TOKEN_LENGTH ];
+    JobsPendingRequest_t completed = { 0 };
+    uint32_t i;
+
+    for( i = 0U; i < SLOT_COUNT; i++ )
+    {
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationAdd( &table, JobsApiUpdate, 100U, i, tokens[ i ], JOBS_CLIENT_TOKEN_LENGTH ) );
+    }
+
+    /* The table is full. */
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, Jobs_CorrelationAdd( &table, JobsApiUpdate, 100U, 0U, token, sizeof( token ) ) );
+
+    for( i = SLOT_COUNT; i > 0U; i-- )
+    {
+        size_t length = makeResponse( tokens[ i - 1U ] );
+
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationResolve( &table, JobsUpdateSuccess, message, length, &completed ) );
+        TEST_ASSERT_EQUAL( i - 1U, completed.userData );
+    }
+
+    TEST_ASSERT_EQUAL( 0U, table.count );
+}
+
+/**
+ * @brief Test that a reused slot does not resolve a stale token.
+ */
+void test_Correlation_stale_token( void )
+{
+    char stale[ JOBS_CLIENT_TOKEN_LENGTH ];
+    size_t length;
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationAdd( &table, JobsApiStartNext, 100U, 0U, stale, sizeof( stale ) ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationRemove( &table, stale, sizeof( stale ) ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_CorrelationRemove( &table, stale, sizeof( stale ) ) );
+
+    /* The freed slot is reused with a new generation. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationAdd( &table, JobsApiStartNext, 100U, 0U, token, sizeof( token ) ) );
+    TEST_ASSERT_TRUE( memcmp( stale, token, sizeof( token ) ) != 0 );
+
+    length = makeResponse( stale );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_CorrelationResolve( &table, JobsStartNextSuccess, message, length, NULL ) );
+
+    length = makeResponse( token );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationResolve( &table, JobsStartNextSuccess, message, length, NULL ) );
+}
+
+/**
+ * @brief Test responses that must not resolve a request.
+ */
+void test_Correlation_no_match( void )
+{
+    size_t length;
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationAdd( &table, JobsApiGetPending, 100U, 0U, token, sizeof( token ) ) );
+    length = makeResponse( token );
+
+    /* Notifications carry no client token. */
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_CorrelationResolve( &table, JobsNextJobChanged, message, length, NULL ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_CorrelationResolve( &table, JobsJobsChanged, message, length, NULL ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_CorrelationResolve( &table, JobsInvalidTopic, message, length, NULL ) );
+
+    /* The response is for a different API. */
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_CorrelationResolve( &table, JobsUpdateSuccess, message, length, NULL ) );
+
+    /* Missing and malformed tokens. */
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_CorrelationResolve( &table, JobsGetPendingSuccess, "{\"timestamp\":1}", 15U, NULL ) );
+    length = makeResponse( "0000000G" );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_CorrelationResolve( &table, JobsGetPendingSuccess, message, length, NULL ) );
+    length = makeResponse( "0000FFFF" );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_CorrelationResolve( &table, JobsGetPendingSuccess, message, length, NULL ) );
+    length = makeResponse( "0000ffff" );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_CorrelationResolve( &table, JobsGetPendingSuccess, message, length, NULL ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_CorrelationRemove( &table, token, sizeof( token ) - 1U ) );
+
+    TEST_ASSERT_EQUAL( 1U, table.count );
+}
+
+/**
+ * @brief Test that a token buffer too small for a token is rejected.
+ */
+void test_Correlation_token_buffer_too_small( void )
+{
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, Jobs_CorrelationAdd( &table, JobsApiUpdate, 0U, 0U, token, sizeof( token ) - 1U ) );
+    TEST_ASSERT_EQUAL( 0U, table.count );
+}
+
+/**
+ * @brief Test that requests expire once their deadline is reached.
+ */
+void test_Correlation_expire( void )
+{
+    JobsPendingRequest_t expired = { 0 };
+
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_CorrelationExpire( &table, 0U, &expired ) );
+
+    /* The second deadline wraps around 2^32. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationAdd( &table, JobsApiUpdate, 0xFFFFFFF0U, 1U, token, sizeof( token ) ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationAdd( &table, JobsApiUpdate, 0x00000010U, 2U, token, sizeof( token ) ) );
+
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_CorrelationExpire( &table, 0xFFFFFFE0U, &expired ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationExpire( &table, 0xFFFFFFF0U, &expired ) );
+    TEST_ASSERT_EQUAL( 1U, expired.userData );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_CorrelationExpire( &table, 0x00000000U, &expired ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationExpire( &table, 0x00000020U, NULL ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_CorrelationExpire( &table, 0x00000020U, NULL ) );
+    TEST_ASSERT_EQUAL( 0U, table.count );
+}
+
+/**
+ * @brief Test that expiring resumes after the last released slot, and
+ * still finds requests in slots before it.
+ */
+void test_Correlation_expire_resumes_scan( void )
+{
+    JobsPendingRequest_t expired = { 0 };
+    uint32_t i;
+
+    for( i = 0U; i < SLOT_COUNT; i++ )
+    {
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationAdd( &table, JobsApiUpdate, 100U, i, token, sizeof( token ) ) );
+    }
+
+    /* Drain two, then make the first slot due again behind the cursor. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationExpire( &table, 100U, &expired ) );
+    TEST_ASSERT_EQUAL( 0U, expired.userData );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationExpire( &table, 100U, &expired ) );
+    TEST_ASSERT_EQUAL( 1U, expired.userData );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationAdd( &table, JobsApiUpdate, 50U, 4U, token, sizeof( token ) ) );
+
+    for( i = 2U; i <= SLOT_COUNT; i++ )
+    {
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationExpire( &table, 100U, &expired ) );
+        TEST_ASSERT_EQUAL( i, expired.userData );
+    }
+
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_CorrelationExpire( &table, 100U, &expired ) );
+    TEST_ASSERT_EQUAL( 0U, table.count );
+
+    /* Requests not yet due keep their slots. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_CorrelationAdd( &table, JobsApiUpdate, 200U, 5U, token, sizeof( token ) ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_CorrelationExpire( &table, 100U, &expired ) );
+    TEST_ASSERT_EQUAL( 1U, table.count );
+}
@@ -0,0 +1,178 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_dedup_utest.c
+ * @brief Unit tests for the repeated notification filter.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "unity.h"
+
+#include "jobs_dedup.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+#define WINDOW    4U
+
+static JobsDedupEntry_t entries[ WINDOW ];
+static JobsDedupFilter_t filter;
+static char message[ 256 ];
+
+/**
+ * @brief Check a message describing an execution against the filter.
+ */
+static bool isRepeat( const char * jobId,
+                      uint32_t versionNumber,
+                      uint32_t executionNumber )
+{
+    int length = snprintf( message, sizeof( message ),
+                           "{\"timestamp\":1,\"execution\":{\"jobId\":\"%s\",\"status\":\"QUEUED\","
+                           "\"versionNumber\":%u,\"executionNumber\":%u,"
+                           "\"jobDocument\":{\"versionNumber\":99,\"executionNumber\":99}}}",
+                           jobId, ( unsigned ) versionNumber, ( unsigned ) executionNumber );
+
+    return Jobs_DedupIsRepeat( &filter, message, ( size_t ) length );
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DedupInit( &filter, entries, WINDOW ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_dedup_rejectsBadParameters( void )
+{
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DedupInit( NULL, entries, WINDOW ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DedupInit( &filter, NULL, WINDOW ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DedupInit( &filter, entries, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DedupReset( NULL ) );
+    TEST_ASSERT_FALSE( Jobs_DedupIsRepeat( NULL, "{}", 2U ) );
+    TEST_ASSERT_FALSE( Jobs_DedupIsRepeat( &filter, NULL, 2U ) );
+    TEST_ASSERT_FALSE( Jobs_DedupIsRepeat( &filter, "{}", 0U ) );
+}
+
+void test_dedup_dropsRepeatedExecutions( void )
+{
+    TEST_ASSERT_FALSE( isRepeat( "job1", 1U, 1U ) );
+    TEST_ASSERT_TRUE( isRepeat( "job1", 1U, 1U ) );
+
+    /* Any change of the key is a new execution state. */
+    TEST_ASSERT_FALSE( isRepeat( "job1", 2U, 1U ) );
+    TEST_ASSERT_FALSE( isRepeat( "job1", 2U, 2U ) );
+    TEST_ASSERT_FALSE( isRepeat( "job2", 2U, 2U ) );
+    TEST_ASSERT_TRUE( isRepeat( "job1", 1U, 1U ) );
+    TEST_ASSERT_TRUE( isRepeat( "job2", 2U, 2U ) );
+
+    /* Reset forgets every execution. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DedupReset( &filter ) );
+    TEST_ASSERT_FALSE( isRepeat( "job1", 1U, 1U ) );
+}
+
+void test_dedup_passesMessagesWithoutExecution( void )
+{
+    const char * empty = "{\"timestamp\":1}";
+    const char * noExecutionNumber = "{\"execution\":{\"jobId\":\"job1\",\"versionNumber\":1}}";
+    const char * numericJobId = "{\"execution\":{\"jobId\":1,\"versionNumber\":1,\"executionNumber\":1}}";
+    const char * negativeVersion = "{\"execution\":{\"jobId\":\"job1\",\"versionNumber\":-1,\"executionNumber\":1}}";
+    size_t i;
+
+    for( i = 0U; i < 2U; i++ )
+    {
+        TEST_ASSERT_FALSE( Jobs_DedupIsRepeat( &filter, empty, strlen( empty ) ) );
+        TEST_ASSERT_FALSE( Jobs_DedupIsRepeat( &filter, noExecutionNumber, strlen( noExecutionNumber ) ) );
+        TEST_ASSERT_FALSE( Jobs_DedupIsRepeat( &filter, numericJobId, strlen( numericJobId ) ) );
+        TEST_ASSERT_FALSE( Jobs_DedupIsRepeat( &filter, negativeVersion, strlen( negativeVersion ) ) );
+    }
+}
+
+void test_dedup_remembersWindowOfExecutions( void )
+{
+    uint32_t i;
+
+    for( i = 0U; i < WINDOW; i++ )
+    {
+        TEST_ASSERT_FALSE( isRepeat( "job", i, 1U ) );
+    }
+
+    for( i = 0U; i < WINDOW; i++ )
+    {
+        TEST_ASSERT_TRUE( isRepeat( "job", i, 1U ) );
+    }
+
+    /* A new execution replaces the oldest. */
+    TEST_ASSERT_FALSE( isRepeat( "job", WINDOW, 1U ) );
+    TEST_ASSERT_FALSE( isRepeat( "job", 0U, 1U ) );
+    TEST_ASSERT_TRUE( isRepeat( "job", WINDOW, 1U ) );
+}
+
+void test_dedup_comparesWholeJobIds( void )
+{
+    char longJobId[ JOBID_MAX_LENGTH + 2U ];
+
+    /* These pairs share a 32-bit FNV-1a hash. */
+    TEST_ASSERT_FALSE( isRepeat( "costarring", 1U, 1U ) );
+    TEST_ASSERT_FALSE( isRepeat( "liquid", 1U, 1U ) );
+    TEST_ASSERT_FALSE( isRepeat( "declinate", 1U, 1U ) );
+    TEST_ASSERT_FALSE( isRepeat( "macallums", 1U, 1U ) );
+    TEST_ASSERT_TRUE( isRepeat( "liquid", 1U, 1U ) );
+
+    /* A prefix is another job. */
+    TEST_ASSERT_FALSE( isRepeat( "liquids", 1U, 1U ) );
+
+    /* Job IDs that do not fit an entry, or are empty, are never repeats. */
+    memset( longJobId, 'a', sizeof( longJobId ) - 1U );
+    longJobId[ sizeof( longJobId ) - 1U ] = '\0';
+    TEST_ASSERT_FALSE( isRepeat( longJobId, 1U, 1U ) );
+    TEST_ASSERT_FALSE( isRepeat( longJobId, 1U, 1U ) );
+    TEST_ASSERT_FALSE( isRepeat( "", 0U, 0U ) );
+    TEST_ASSERT_FALSE( isRepeat( "", 0U, 0U ) );
+
+    /* The longest job ID is remembered. */
+    longJobId[ JOBID_MAX_LENGTH ] = '\0';
+    TEST_ASSERT_FALSE( isRepeat( longJobId, 1U, 1U ) );
+    TEST_ASSERT_TRUE( isRepeat( longJobId, 1U, 1U ) );
+}
@@ -0,0 +1,268 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_docstore_utest.c
+ * @brief Unit tests for the persistent job document store.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "unity.h"
+
+#include "jobs_docstore.h"
+#include "job_parser.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+#define SLOT_COUNT     16U
+#define REGION_SIZE    4096U
+#define STORE_FILE     "jobs_docstore_utest.db"
+
+static const char otaDocument[] = "{\"afr_ota\":{\"protocols\":[\"MQTT\"],"
+                                  "\"streamname\":\"AFR_OTA-streamname\",\"files\":[{"
+                                  "\"filepath\":\"/device\",\"filesize\":123456789,"
+                                  "\"fileid\":0,\"certfile\":\"certfile.cert\","
+                                  "\"sig-sha256-ecdsa\":\"signature_hash_239871\"}]}}";
+
+static uint32_t region[ REGION_SIZE / 4U ];
+static JobsDocStore_t store;
+static const char * document;
+static size_t documentLength;
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    memset( region, 0xA5, sizeof( region ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreInit( &store, region, sizeof( region ), SLOT_COUNT ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_docstore_rejectsBadParameters( void )
+{
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStoreInit( NULL, region, sizeof( region ), SLOT_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStoreInit( &store, NULL, sizeof( region ), SLOT_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStoreInit( &store, region, sizeof( region ), 12U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStoreInit( &store, region, sizeof( region ), 1U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStoreInit( &store, region,
+                                                            JOBS_DOCSTORE_HEADER_SIZE + ( SLOT_COUNT * JOBS_DOCSTORE_SLOT_SIZE ),
+                                                            SLOT_COUNT ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreInit( &store, region, sizeof( region ), SLOT_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStorePut( &store, "job", 3U, 1U, NULL, 0U, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStorePut( &store, "job!", 4U, 1U, "{}", 2U, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStorePut( NULL, "job", 3U, 1U, "{}", 2U, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, Jobs_DocStorePut( &store, "job", 3U, 1U, otaDocument, sizeof( region ), NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStoreGet( &store, "job", 3U, 1U, NULL, &documentLength ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStoreGet( &store, "", 0U, 1U, &document, &documentLength ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStoreClear( NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStoreMapFile( NULL, REGION_SIZE, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStoreUnmapFile( NULL, REGION_SIZE ) );
+}
+
+void test_docstore_rejectsNullPointersWithLengths( void )
+{
+    uint32_t * mapped = NULL;
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStoreInit( &store, NULL, REGION_SIZE, SLOT_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreInit( &store, region, sizeof( region ), SLOT_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStorePut( &store, NULL, 3U, 1U, "{}", 2U, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStorePut( &store, "job", 3U, 1U, NULL, 2U, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStorePut( &store, NULL, 3U, 1U, NULL, 2U, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStoreGet( &store, NULL, 3U, 1U, &document, &documentLength ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStoreGet( &store, "job", 3U, 1U, &document, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStoreMapFile( NULL, REGION_SIZE, &mapped ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_DocStoreMapFile( STORE_FILE, REGION_SIZE, NULL ) );
+    TEST_ASSERT_NULL( mapped );
+
+    /* Nothing was written. */
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_DocStoreGet( &store, "job", 3U, 1U, &document, &documentLength ) );
+}
+
+void test_docstore_returnsZeroCopySlices( void )
+{
+    AfrOtaJobDocumentFields_t fields = { 0 };
+    const char * stored;
+
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_DocStoreGet( &store, "ota-1", 5U, 3U, &document, &documentLength ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStorePut( &store, "ota-1", 5U, 3U, otaDocument,
+                                                      strlen( otaDocument ), &stored, NULL ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreGet( &store, "ota-1", 5U, 3U, &document, &documentLength ) );
+    TEST_ASSERT_EQUAL_PTR( stored, document );
+    TEST_ASSERT_TRUE( ( document > ( const char * ) region ) && ( document < ( const char * ) &region[ REGION_SIZE / 4U ] ) );
+    TEST_ASSERT_EQUAL( strlen( otaDocument ), documentLength );
+    TEST_ASSERT_EQUAL_MEMORY( otaDocument, document, documentLength );
+
+    /* The slice goes straight to the OTA job document parser. */
+    TEST_ASSERT_TRUE( populateJobDocFields( document, documentLength, 0, "MQTT", 4U, &fields ) );
+    TEST_ASSERT_EQUAL( 123456789U, fields.fileSize );
+
+    /* Another version is another document, the same version is kept. */
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_DocStoreGet( &store, "ota-1", 5U, 4U, &document, &documentLength ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_DocStoreGet( &store, "ota-2", 5U, 3U, &document, &documentLength ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStorePut( &store, "ota-1", 5U, 3U, "{}", 2U, &document, &documentLength ) );
+    TEST_ASSERT_EQUAL_PTR( stored, document );
+    TEST_ASSERT_EQUAL( strlen( otaDocument ), documentLength );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreClear( &store ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_DocStoreGet( &store, "ota-1", 5U, 3U, &document, &documentLength ) );
+}
+
+void test_docstore_emptiesWhenFull( void )
+{
+    char jobId[ 8 ];
+    uint32_t i;
+
+    /* Index full: three quarters of the slots. */
+    for( i = 0U; i < ( ( SLOT_COUNT * 3U ) / 4U ); i++ )
+    {
+        ( void ) snprintf( jobId, sizeof( jobId ), "job-%02u", ( unsigned ) i );
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStorePut( &store, jobId, 6U, 1U, "{}", 2U, NULL, NULL ) );
+    }
+
+    for( i = 0U; i < ( ( SLOT_COUNT * 3U ) / 4U ); i++ )
+    {
+        ( void ) snprintf( jobId, sizeof( jobId ), "job-%02u", ( unsigned ) i );
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreGet( &store, jobId, 6U, 1U, &document, &documentLength ) );
+    }
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStorePut( &store, "job-99", 6U, 1U, "{}", 2U, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_DocStoreGet( &store, "job-00", 6U, 1U, &document, &documentLength ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreGet( &store, "job-99", 6U, 1U, &document, &documentLength ) );
+
+    /* Data area full, with index slots to spare. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreInit( &store, region, sizeof( region ), SLOT_COUNT * 4U ) );
+
+    for( i = 0U; i < 20U; i++ )
+    {
+        ( void ) snprintf( jobId, sizeof( jobId ), "ota-%02u", ( unsigned ) i );
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStorePut( &store, jobId, 6U, 1U, otaDocument,
+                                                          strlen( otaDocument ), NULL, NULL ) );
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreGet( &store, jobId, 6U, 1U, &document, &documentLength ) );
+        TEST_ASSERT_EQUAL_MEMORY( otaDocument, document, documentLength );
+    }
+
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_DocStoreGet( &store, "ota-00", 6U, 1U, &document, &documentLength ) );
+}
+
+void test_docstore_keepsDocumentsWhenReopened( void )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStorePut( &store, "job", 3U, 7U, "{\"a\":1}", 7U, NULL, NULL ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreInit( &store, region, sizeof( region ), SLOT_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreGet( &store, "job", 3U, 7U, &document, &documentLength ) );
+    TEST_ASSERT_EQUAL_MEMORY( "{\"a\":1}", document, documentLength );
+
+    /* A different layout formats the region. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreInit( &store, region, sizeof( region ), SLOT_COUNT * 2U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_DocStoreGet( &store, "job", 3U, 7U, &document, &documentLength ) );
+}
+
+void test_docstore_formatsTornStore( void )
+{
+    uint32_t append;
+    size_t i;
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStorePut( &store, "job", 3U, 7U, "{\"a\":1}", 7U, NULL, NULL ) );
+    append = region[ 3 ];
+    TEST_ASSERT_EQUAL( 11U, append );
+
+    /* The slot reached the file, the append offset did not. */
+    region[ 3 ] = append - 1U;
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreInit( &store, region, sizeof( region ), SLOT_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_DocStoreGet( &store, "job", 3U, 7U, &document, &documentLength ) );
+
+    /* A slot refers to a record beyond the appended data. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStorePut( &store, "job", 3U, 7U, "{\"a\":1}", 7U, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStorePut( &store, "job", 3U, 8U, "{\"a\":2}", 7U, NULL, NULL ) );
+
+    for( i = JOBS_DOCSTORE_HEADER_SIZE / 4U; i < ( ( JOBS_DOCSTORE_HEADER_SIZE + ( SLOT_COUNT * JOBS_DOCSTORE_SLOT_SIZE ) ) / 4U ); i += 4U )
+    {
+        if( region[ i + 2U ] == append )
+        {
+            region[ i + 2U ] = 0xFFFFFFF0U;
+        }
+    }
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreInit( &store, region, sizeof( region ), SLOT_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_DocStoreGet( &store, "job", 3U, 7U, &document, &documentLength ) );
+
+    /* A length that runs past the appended data. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStorePut( &store, "job", 3U, 7U, "{\"a\":1}", 7U, NULL, NULL ) );
+
+    for( i = JOBS_DOCSTORE_HEADER_SIZE / 4U; i < ( ( JOBS_DOCSTORE_HEADER_SIZE + ( SLOT_COUNT * JOBS_DOCSTORE_SLOT_SIZE ) ) / 4U ); i += 4U )
+    {
+        if( region[ i ] != 0U )
+        {
+            region[ i + 3U ] = 0xFFFFFFFFU;
+        }
+    }
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreInit( &store, region, sizeof( region ), SLOT_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_DocStoreGet( &store, "job", 3U, 7U, &document, &documentLength ) );
+}
+
+void test_docstore_persistsInMappedFile( void )
+{
+    uint32_t * mapped = NULL;
+
+    ( void ) remove( STORE_FILE );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreMapFile( STORE_FILE, REGION_SIZE, &mapped ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreInit( &store, mapped, REGION_SIZE, SLOT_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStorePut( &store, "ota-1", 5U, 3U, otaDocument,
+                                                      strlen( otaDocument ), NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreUnmapFile( mapped, REGION_SIZE ) );
+
+    /* After a restart the document is served from the file. */
+    mapped = NULL;
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreMapFile( STORE_FILE, REGION_SIZE, &mapped ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreInit( &store, mapped, REGION_SIZE, SLOT_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreGet( &store, "ota-1", 5U, 3U, &document, &documentLength ) );
+    TEST_ASSERT_EQUAL_MEMORY( otaDocument, document, documentLength );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_DocStoreUnmapFile( mapped, REGION_SIZE ) );
+
+    TEST_ASSERT_EQUAL( 0, remove( STORE_FILE ) );
+    TEST_ASSERT_EQUAL( JobsError, Jobs_DocStoreMapFile( "/nonexistent/" STORE_FILE, REGION_SIZE, &mapped ) );
+}
@@ -0,0 +1,924 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_emulator.c
+ * @brief A local emulator of the service side of the AWS IoT Jobs MQTT API.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "jobs_emulator.h"
+#include "jobs_internal.h"
+
+#include "core_json.h"
+
+/**
+ * @brief Get the length of a string literal.
+ */
+#define EMU_STRLEN( x )    ( sizeof( ( x ) ) - 1U )
+
+/**
+ * @brief Status strings in JobCurrentStatus_t order.
+ */
+static const char * const emuStatusNames[] =
+{
+    "QUEUED",
+    "IN_PROGRESS",
+    "FAILED",
+    "SUCCEEDED",
+    "REJECTED",
+};
+
+/**
+ * @brief A payload being written.
+ */
+typedef struct
+{
+    char * buffer; /**< @brief The payload buffer. */
+    size_t size;   /**< @brief The size of the buffer. */
+    size_t length; /**< @brief The length written. */
+} EmuWriter_t;
+
+/**
+ * @brief A request of the client.
+ */
+typedef struct
+{
+    const char * api;         /**< @brief The topic after the jobs level, e.g. "start-next". */
+    size_t apiLength;         /**< @brief The length of api. */
+    const char * jobId;       /**< @brief The job ID of the topic, NULL if none. */
+    size_t jobIdLength;       /**< @brief The length of the job ID. */
+    const char * payload;     /**< @brief The payload. */
+    size_t payloadLength;     /**< @brief The length of the payload. */
+    const char * clientToken; /**< @brief The client token of the payload, NULL if none. */
+    size_t clientTokenLength; /**< @brief The length of the client token. */
+} EmuRequest_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Append formatted text to a payload.  A payload that overflows
+ * its buffer gets a length larger than the buffer.
+ */
+static void emuAppend( EmuWriter_t * writer,
+                       const char * format,
+                       ... )
+{
+    va_list args;
+    int written;
+    size_t space = ( writer->length < writer->size ) ? ( writer->size - writer->length ) : 0U;
+
+    va_start( args, format );
+    written = vsnprintf( ( space > 0U ) ? &writer->buffer[ writer->length ] : NULL, space, format, args );
+    va_end( args );
+
+    writer->length += ( written > 0 ) ? ( size_t ) written : 0U;
+}
+
+/**
+ * @brief Append text to the topic of a message.
+ *
+ * @return true if the text fit, false otherwise.
+ */
+static bool emuTopicAppend( EmulatorMessage_t * message,
+                            const char * text,
+                            size_t textLength )
+{
+    bool ret = false;
+
+    /* Keep one byte for the terminator. */
+    if( textLength < ( sizeof( message->topic ) - message->topicLength ) )
+    {
+        ( void ) memcpy( &message->topic[ message->topicLength ], text, textLength );
+        message->topicLength += textLength;
+        message->topic[ message->topicLength ] = '\0';
+        ret = true;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Start a message to the client on a topic of the thing.
+ *
+ * @return The message, NULL if the queue is full or the topic does
+ * not fit.
+ */
+static EmulatorMessage_t * emuBegin( Emulator_t * emulator,
+                                     const char * api,
+                                     size_t apiLength,
+                                     const char * suffix,
+                                     EmuWriter_t * writer )
+{
+    EmulatorMessage_t * message = NULL;
+    bool fits = false;
+
+    if( emulator->count < EMULATOR_QUEUE_LENGTH )
+    {
+        message = &emulator->queue[ ( emulator->head + emulator->count ) % EMULATOR_QUEUE_LENGTH ];
+        message->topicLength = 0U;
+        fits = ( emuTopicAppend( message, JOBS_API_PREFIX, JOBS_API_PREFIX_LENGTH ) == true ) &&
+               ( emuTopicAppend( message, emulator->thingName, emulator->thingNameLength ) == true ) &&
+               ( emuTopicAppend( message, JOBS_API_BRIDGE, JOBS_API_BRIDGE_LENGTH ) == true ) &&
+               ( emuTopicAppend( message, api, apiLength ) == true ) &&
+               ( emuTopicAppend( message, suffix, strlen( suffix ) ) == true );
+    }
+
+    if( fits == true )
+    {
+        writer->buffer = message->payload;
+        writer->size = sizeof( message->payload );
+        writer->length = 0U;
+    }
+    else
+    {
+        message = NULL;
+        emulator->dropped++;
+    }
+
+    return message;
+}
+
+/**
+ * @brief Queue a message started by #emuBegin, unless it overflowed.
+ */
+static void emuCommit( Emulator_t * emulator,
+                       EmulatorMessage_t * message,
+                       const EmuWriter_t * writer )
+{
+    if( writer->length < writer->size )
+    {
+        message->payloadLength = writer->length;
+        emulator->count++;
+    }
+    else
+    {
+        emulator->dropped++;
+    }
+}
+
+/**
+ * @brief Write the execution of a job.
+ */
+static void emuWriteExecution( const Emulator_t * emulator,
+                               EmuWriter_t * writer,
+                               const EmulatorJob_t * job,
+                               bool withDocument )
+{
+    emuAppend( writer, "{\"jobId\":\"%s\",\"thingName\":\"%s\",\"status\":\"%s\",",
+               job->jobId, emulator->thingName, emuStatusNames[ job->status ] );
+
+    if( job->statusDetails[ 0 ] != '\0' )
+    {
+        emuAppend( writer, "\"statusDetails\":%s,", job->statusDetails );
+    }
+
+    emuAppend( writer, "\"queuedAt\":%u,", ( unsigned ) job->queuedAt );
+
+    if( job->startedAt != 0U )
+    {
+        emuAppend( writer, "\"startedAt\":%u,", ( unsigned ) job->startedAt );
+    }
+
+    emuAppend( writer, "\"lastUpdatedAt\":%u,\"versionNumber\":%u,\"executionNumber\":%u",
+               ( unsigned ) job->lastUpdatedAt, ( unsigned ) job->versionNumber,
+               ( unsigned ) job->executionNumber );
+
+    if( withDocument == true )
+    {
+        emuAppend( writer, ",\"jobDocument\":%s", job->document );
+    }
+
+    emuAppend( writer, "}" );
+}
+
+/**
+ * @brief Write the execution state of a job.
+ */
+static void emuWriteState( EmuWriter_t * writer,
+                           const EmulatorJob_t * job )
+{
+    emuAppend( writer, "\"executionState\":{\"status\":\"%s\",", emuStatusNames[ job->status ] );
+
+    if( job->statusDetails[ 0 ] != '\0' )
+    {
+        emuAppend( writer, "\"statusDetails\":%s,", job->statusDetails );
+    }
+
+    emuAppend( writer, "\"versionNumber\":%u}", ( unsigned ) job->versionNumber );
+}
+
+/**
+ * @brief Write the summaries of the jobs in a status, in queue order.
+ *
+ * @return The number of summaries written.
+ */
+static size_t emuWriteSummaries( const Emulator_t * emulator,
+                                 EmuWriter_t * writer,
+                                 JobCurrentStatus_t status )
+{
+    const EmulatorJob_t * job;
+    uint32_t after = 0U;
+    size_t count = 0U;
+    size_t i;
+
+    emuAppend( writer, "[" );
+
+    do
+    {
+        job = NULL;
+
+        for( i = 0U; i < EMULATOR_MAX_JOBS; i++ )
+        {
+            if( ( emulator->jobs[ i ].used == true ) && ( emulator->jobs[ i ].status == status ) &&
+                ( emulator->jobs[ i ].sequence >= after ) &&
+                ( ( job == NULL ) || ( emulator->jobs[ i ].sequence < job->sequence ) ) )
+            {
+                job = &emulator->jobs[ i ];
+            }
+        }
+
+        if( job != NULL )
+        {
+            emuAppend( writer, "%s{\"jobId\":\"%s\",\"queuedAt\":%u,", ( count > 0U ) ? "," : "",
+                       job->jobId, ( unsigned ) job->queuedAt );
+
+            if( job->startedAt != 0U )
+            {
+                emuAppend( writer, "\"startedAt\":%u,", ( unsigned ) job->startedAt );
+            }
+
+            emuAppend( writer, "\"lastUpdatedAt\":%u,\"executionNumber\":%u,\"versionNumber\":%u}",
+                       ( unsigned ) job->lastUpdatedAt, ( unsigned ) job->executionNumber,
+                       ( unsigned ) job->versionNumber );
+            after = job->sequence + 1U;
+            count++;
+        }
+    } while( job != NULL );
+
+    emuAppend( writer, "]" );
+
+    return count;
+}
+
+/**
+ * @brief Get the next pending job: the oldest in progress job, else the
+ * oldest queued job.
+ */
+static EmulatorJob_t * emuNextJob( Emulator_t * emulator )
+{
+    EmulatorJob_t * next = NULL;
+    EmulatorJob_t * job;
+    size_t i;
+
+    for( i = 0U; i < EMULATOR_MAX_JOBS; i++ )
+    {
+        job = &emulator->jobs[ i ];
+
+        if( ( job->used == true ) && ( job->status <= InProgress ) &&
+            ( ( next == NULL ) || ( job->status > next->status ) ||
+              ( ( job->status == next->status ) && ( job->sequence < next->sequence ) ) ) )
+        {
+            next = job;
+        }
+    }
+
+    return next;
+}
+
+/**
+ * @brief Find a job by its ID.
+ */
+static EmulatorJob_t * emuFindJob( Emulator_t * emulator,
+                                   const char * jobId,
+                                   size_t jobIdLength )
+{
+    EmulatorJob_t * ret = NULL;
+    size_t i;
+
+    for( i = 0U; ( i < EMULATOR_MAX_JOBS ) && ( ret == NULL ); i++ )
+    {
+        if( ( emulator->jobs[ i ].used == true ) &&
+            ( strlen( emulator->jobs[ i ].jobId ) == jobIdLength ) &&
+            ( strncmp( emulator->jobs[ i ].jobId, jobId, jobIdLength ) == 0 ) )
+        {
+            ret = &emulator->jobs[ i ];
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Send the notifications of a change to the pending jobs.
+ *
+ * @param[in] emulator  The emulator.
+ * @param[in] previousNext  The next pending job before the change.
+ */
+static void emuFanOut( Emulator_t * emulator,
+                       const EmulatorJob_t * previousNext )
+{
+    const EmulatorJob_t * next = emuNextJob( emulator );
+    EmulatorMessage_t * message;
+    EmuWriter_t writer;
+
+    message = emuBegin( emulator, JOBS_API_JOBSCHANGED, JOBS_API_JOBSCHANGED_LENGTH, "", &writer );
+
+    if( message != NULL )
+    {
+        emuAppend( &writer, "{\"timestamp\":%u,\"jobs\":{\"IN_PROGRESS\":", ( unsigned ) emulator->clock );
+        ( void ) emuWriteSummaries( emulator, &writer, InProgress );
+        emuAppend( &writer, ",\"QUEUED\":" );
+        ( void ) emuWriteSummaries( emulator, &writer, Queued );
+        emuAppend( &writer, "}}" );
+        emuCommit( emulator, message, &writer );
+    }
+
+    if( next != previousNext )
+    {
+        message = emuBegin( emulator, JOBS_API_NEXTJOBCHANGED, JOBS_API_NEXTJOBCHANGED_LENGTH, "", &writer );
+
+        if( message != NULL )
+        {
+            emuAppend( &writer, "{\"timestamp\":%u", ( unsigned ) emulator->clock );
+
+            if( next != NULL )
+            {
+                emuAppend( &writer, ",\"execution\":" );
+                emuWriteExecution( emulator, &writer, next, true );
+            }
+
+            emuAppend( &writer, "}" );
+            emuCommit( emulator, message, &writer );
+        }
+    }
+}
+
+/**
+ * @brief Start the response to a request.
+ */
+static EmulatorMessage_t * emuRespond( Emulator_t * emulator,
+                                       const EmuRequest_t * request,
+                                       bool accepted,
+                                       EmuWriter_t * writer )
+{
+    EmulatorMessage_t * message;
+
+    message = emuBegin( emulator, request->api, request->apiLength,
+                        ( accepted == true ) ? JOBS_API_SUCCESS : JOBS_API_FAILURE, writer );
+
+    if( message != NULL )
+    {
+        emuAppend( writer, "{\"timestamp\":%u", ( unsigned ) emulator->clock );
+
+        if( request->clientToken != NULL )
+        {
+            emuAppend( writer, ",\"clientToken\":\"%.*s\"", ( int ) request->clientTokenLength,
+                       request->clientToken );
+        }
+    }
+
+    return message;
+}
+
+/**
+ * @brief Reject a request.
+ *
+ * @param[in] emulator  The emulator.
+ * @param[in] request  The request.
+ * @param[in] code  The error code.
+ * @param[in] job  The job whose execution state is reported, may be NULL.
+ */
+static void emuReject( Emulator_t * emulator,
+                       const EmuRequest_t * request,
+                       const char * code,
+                       const EmulatorJob_t * job )
+{
+    EmulatorMessage_t * message;
+    EmuWriter_t writer;
+
+    message = emuRespond( emulator, request, false, &writer );
+    emulator->rejected++;
+
+    if( message != NULL )
+    {
+        emuAppend( &writer, ",\"code\":\"%s\",\"message\":\"Request rejected with %s.\"", code, code );
+
+        if( job != NULL )
+        {
+            emuAppend( &writer, "," );
+            emuWriteState( &writer, job );
+        }
+
+        emuAppend( &writer, "}" );
+        emuCommit( emulator, message, &writer );
+    }
+}
+
+/**
+ * @brief Search a member of the request payload.
+ */
+static bool emuSearch( const EmuRequest_t * request,
+                       const char * query,
+                       size_t queryLength,
+                       JSONTypes_t type,
+                       const char ** outValue,
+                       size_t * outValueLength )
+{
+    JSONTypes_t found = JSONInvalid;
+
+    return ( ( JSON_SearchConst( request->payload, request->payloadLength, query, queryLength,
+                                 outValue, outValueLength, &found ) == JSONSuccess ) &&
+             ( found == type ) ) ? true : false;
+}
+
+/**
+ * @brief Check whether an optional boolean member of the request is set,
+ * taking its default otherwise.
+ */
+static bool emuFlag( const EmuRequest_t * request,
+                     const char * query,
+                     size_t queryLength,
+                     bool defaultValue )
+{
+    const char * value;
+    size_t valueLength;
+    bool ret = defaultValue;
+
+    if( emuSearch( request, query, queryLength, JSONTrue, &value, &valueLength ) == true )
+    {
+        ret = true;
+    }
+    else if( emuSearch( request, query, queryLength, JSONFalse, &value, &valueLength ) == true )
+    {
+        ret = false;
+    }
+    else
+    {
+        /* Default. */
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Copy the statusDetails of the request to a job.
+ *
+ * @return false if statusDetails is present but is not an object that fits.
+ */
+static bool emuCopyDetails( const EmuRequest_t * request,
+                            EmulatorJob_t * job )
+{
+    const char * value;
+    size_t valueLength;
+    JSONTypes_t type = JSONInvalid;
+    bool ret = true;
+
+    if( JSON_SearchConst( request->payload, request->payloadLength, "statusDetails",
+                          EMU_STRLEN( "statusDetails" ), &value, &valueLength, &type ) == JSONSuccess )
+    {
+        ret = ( ( type == JSONObject ) && ( valueLength < sizeof( job->statusDetails ) ) ) ? true : false;
+
+        if( ret == true )
+        {
+            ( void ) memcpy( job->statusDetails, value, valueLength );
+            job->statusDetails[ valueLength ] = '\0';
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Answer a GetPendingJobExecutions request.
+ */
+static void emuGetPending( Emulator_t * emulator,
+                           const EmuRequest_t * request )
+{
+    EmulatorMessage_t * message;
+    EmuWriter_t writer;
+
+    message = emuRespond( emulator, request, true, &writer );
+
+    if( message != NULL )
+    {
+        emuAppend( &writer, ",\"inProgressJobs\":" );
+        ( void ) emuWriteSummaries( emulator, &writer, InProgress );
+        emuAppend( &writer, ",\"queuedJobs\":" );
+        ( void ) emuWriteSummaries( emulator, &writer, Queued );
+        emuAppend( &writer, "}" );
+        emuCommit( emulator, message, &writer );
+    }
+}
+
+/**
+ * @brief Answer a StartNextPendingJobExecution request.
+ */
+static void emuStartNext( Emulator_t * emulator,
+                          const EmuRequest_t * request )
+{
+    EmulatorJob_t * next = emuNextJob( emulator );
+    EmulatorJob_t previous;
+    EmulatorMessage_t * message;
+    EmuWriter_t writer;
+    bool started = false;
+    bool valid = true;
+
+    if( ( next != NULL ) && ( next->status == Queued ) )
+    {
+        previous = *next;
+        valid = emuCopyDetails( request, next );
+
+        if( valid == false )
+        {
+            *next = previous;
+        }
+        else
+        {
+            next->status = InProgress;
+            next->startedAt = emulator->clock;
+            next->lastUpdatedAt = emulator->clock;
+            next->versionNumber++;
+            started = true;
+        }
+    }
+
+    if( valid == false )
+    {
+        emuReject( emulator, request, "InvalidRequest", NULL );
+    }
+    else
+    {
+        message = emuRespond( emulator, request, true, &writer );
+
+        if( message != NULL )
+        {
+            if( next != NULL )
+            {
+                emuAppend( &writer, ",\"execution\":" );
+                emuWriteExecution( emulator, &writer, next, true );
+            }
+
+            emuAppend( &writer, "}" );
+            emuCommit( emulator, message, &writer );
+        }
+    }
+
+    /* The next job is unchanged, only the job lists changed. */
+    if( started == true )
+    {
+        emuFanOut( emulator, next );
+    }
+}
+
+/**
+ * @brief Answer a DescribeJobExecution request.
+ */
+static void emuDescribe( Emulator_t * emulator,
+                         const EmuRequest_t * request )
+{
+    const EmulatorJob_t * job;
+    EmulatorMessage_t * message;
+    EmuWriter_t writer;
+    bool isNext;
+
+    isNext = ( ( request->jobIdLength == JOBS_API_JOBID_NEXT_LENGTH ) &&
+               ( strncmp( request->jobId, JOBS_API_JOBID_NEXT, JOBS_API_JOBID_NEXT_LENGTH ) == 0 ) ) ? true : false;
+    job = ( isNext == true ) ? emuNextJob( emulator ) : emuFindJob( emulator, request->jobId, request->jobIdLength );
+
+    if( ( job == NULL ) && ( isNext == false ) )
+    {
+        emuReject( emulator, request, "ResourceNotFound", NULL );
+    }
+    else
+    {
+        message = emuRespond( emulator, request, true, &writer );
+
+        if( message != NULL )
+        {
+            if( job != NULL )
+            {
+                emuAppend( &writer, ",\"execution\":" );
+                emuWriteExecution( emulator, &writer, job,
+                                   emuFlag( request, "includeJobDocument", EMU_STRLEN( "includeJobDocument" ), true ) );
+            }
+
+            emuAppend( &writer, "}" );
+            emuCommit( emulator, message, &writer );
+        }
+    }
+}
+
+/**
+ * @brief Answer an UpdateJobExecution request.
+ */
+static void emuUpdate( Emulator_t * emulator,
+                       const EmuRequest_t * request )
+{
+    EmulatorJob_t * job = emuFindJob( emulator, request->jobId, request->jobIdLength );
+    EmulatorJob_t * previousNext = emuNextJob( emulator );
+    EmulatorJob_t previous;
+    JobCurrentStatus_t status = Queued;
+    EmulatorMessage_t * message;
+    EmuWriter_t writer;
+    const char * value;
+    size_t valueLength = 0U;
+    uint32_t expected = 0U;
+
+    if( job == NULL )
+    {
+        emuReject( emulator, request, "ResourceNotFound", NULL );
+    }
+    else if( ( emuSearch( request, "status", EMU_STRLEN( "status" ), JSONString, &value, &valueLength ) == false ) ||
+             ( Jobs_StatusFromString( value, valueLength, &status ) != JobsSuccess ) )
+    {
+        emuReject( emulator, request, "InvalidRequest", NULL );
+    }
+    else if( ( ( emuSearch( request, "expectedVersion", EMU_STRLEN( "expectedVersion" ), JSONString, &value, &valueLength ) == true ) ||
+               ( emuSearch( request, "expectedVersion", EMU_STRLEN( "expectedVersion" ), JSONNumber, &value, &valueLength ) == true ) ) &&
+             ( ( Jobs_StringToUint( value, valueLength, &expected ) != JobsSuccess ) || ( expected != job->versionNumber ) ) )
+    {
+        emuReject( emulator, request, "VersionMismatch", job );
+    }
+    else if( ( Jobs_IsTerminalStatus( job->status ) == true ) || ( status == Queued ) )
+    {
+        emuReject( emulator, request, "InvalidStateTransition", job );
+    }
+    else
+    {
+        previous = *job;
+
+        if( emuCopyDetails( request, job ) == false )
+        {
+            *job = previous;
+            emuReject( emulator, request, "InvalidRequest", NULL );
+        }
+        else
+        {
+            job->status = status;
+            job->startedAt = ( job->startedAt == 0U ) ? emulator->clock : job->startedAt;
+            job->lastUpdatedAt = emulator->clock;
+            job->versionNumber++;
+
+            message = emuRespond( emulator, request, true, &writer );
+
+            if( message != NULL )
+            {
+                if( emuFlag( request, "includeJobExecutionState", EMU_STRLEN( "includeJobExecutionState" ), false ) == true )
+                {
+                    emuAppend( &writer, "," );
+                    emuWriteState( &writer, job );
+                }
+
+                if( emuFlag( request, "includeJobDocument", EMU_STRLEN( "includeJobDocument" ), false ) == true )
+                {
+                    emuAppend( &writer, ",\"jobDocument\":%s", job->document );
+                }
+
+                emuAppend( &writer, "}" );
+                emuCommit( emulator, message, &writer );
+            }
+
+            if( job->status != previous.status )
+            {
+                emuFanOut( emulator, previousNext );
+            }
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+JobsStatus_t Emulator_Init( Emulator_t * emulator,
+                            const char * thingName,
+                            uint16_t thingNameLength,
+                            EmulatorDeliver_t deliver,
+                            void * pContext )
+{
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( ( emulator != NULL ) && ( deliver != NULL ) &&
+        ( Jobs_IsValidThingName( thingName, thingNameLength ) == true ) )
+    {
+        ( void ) memset( emulator, 0, sizeof( *emulator ) );
+        ( void ) memcpy( emulator->thingName, thingName, thingNameLength );
+        emulator->thingNameLength = thingNameLength;
+        emulator->deliver = deliver;
+        emulator->pContext = pContext;
+        ret = JobsSuccess;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+JobsStatus_t Emulator_AddJob( Emulator_t * emulator,
+                              const char * jobId,
+                              const char * document )
+{
+    EmulatorJob_t * previousNext;
+    EmulatorJob_t * unused = NULL;
+    EmulatorJob_t * slot = NULL;
+    EmulatorJob_t * job;
+    size_t i;
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( ( emulator != NULL ) && ( jobId != NULL ) && ( document != NULL ) &&
+        ( strlen( jobId ) <= JOBID_MAX_LENGTH ) &&
+        ( Jobs_IsValidJobId( jobId, ( uint16_t ) strlen( jobId ) ) == true ) &&
+        ( strlen( document ) < EMULATOR_DOCUMENT_LENGTH ) &&
+        ( emuFindJob( emulator, jobId, strlen( jobId ) ) == NULL ) )
+    {
+        ret = JobsBufferTooSmall;
+
+        for( i = 0U; ( i < EMULATOR_MAX_JOBS ) && ( unused == NULL ); i++ )
+        {
+            unused = ( emulator->jobs[ i ].used == false ) ? &emulator->jobs[ i ] : NULL;
+        }
+
+        slot = unused;
+
+        for( i = 0U; ( i < EMULATOR_MAX_JOBS ) && ( unused == NULL ); i++ )
+        {
+            job = &emulator->jobs[ i ];
+
+            if( ( Jobs_IsTerminalStatus( job->status ) == true ) &&
+                ( ( slot == NULL ) || ( job->lastUpdatedAt < slot->lastUpdatedAt ) ) )
+            {
+                slot = job;
+            }
+        }
+
+        if( slot != NULL )
+        {
+            previousNext = emuNextJob( emulator );
+            ( void ) memset( slot, 0, sizeof( *slot ) );
+            ( void ) strcpy( slot->jobId, jobId );
+            ( void ) strcpy( slot->document, document );
+            slot->status = Queued;
+            slot->sequence = emulator->nextSequence++;
+            slot->queuedAt = emulator->clock;
+            slot->lastUpdatedAt = emulator->clock;
+            slot->versionNumber = 1U;
+            slot->executionNumber = 1U;
+            slot->used = true;
+            emuFanOut( emulator, previousNext );
+            ret = JobsSuccess;
+        }
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+JobsStatus_t Emulator_Publish( Emulator_t * emulator,
+                               const char * topic,
+                               size_t topicLength,
+                               const char * payload,
+                               size_t payloadLength )
+{
+    EmuRequest_t request = { 0 };
+    size_t prefixLength;
+    size_t i;
+    JobsStatus_t ret = JobsBadParameter;
+
+    if( ( emulator != NULL ) && ( topic != NULL ) && ( payload != NULL ) )
+    {
+        ret = JobsNoMatch;
+        prefixLength = JOBS_API_COMMON_LENGTH( emulator->thingNameLength );
+
+        if( ( topicLength > prefixLength ) &&
+            ( strncmp( topic, JOBS_API_PREFIX, JOBS_API_PREFIX_LENGTH ) == 0 ) &&
+            ( strncmp( &topic[ JOBS_API_PREFIX_LENGTH ], emulator->thingName, emulator->thingNameLength ) == 0 ) &&
+            ( strncmp( &topic[ JOBS_API_PREFIX_LENGTH + emulator->thingNameLength ], JOBS_API_BRIDGE,
+                       JOBS_API_BRIDGE_LENGTH ) == 0 ) )
+        {
+            request.api = &topic[ prefixLength ];
+            request.apiLength = topicLength - prefixLength;
+            request.payload = payload;
+            request.payloadLength = payloadLength;
+
+            i = 0U;
+
+            while( ( i < request.apiLength ) && ( request.api[ i ] != '/' ) )
+            {
+                i++;
+            }
+
+            if( i < request.apiLength )
+            {
+                request.jobId = request.api;
+                request.jobIdLength = i;
+            }
+
+            ret = JobsSuccess;
+        }
+    }
+
+    if( ret == JobsSuccess )
+    {
+        emulator->requests++;
+
+        if( JSON_Validate( payload, payloadLength ) != JSONSuccess )
+        {
+            emuReject( emulator, &request, "InvalidJson", NULL );
+        }
+        else
+        {
+            ( void ) emuSearch( &request, "clientToken", EMU_STRLEN( "clientToken" ), JSONString,
+                                &request.clientToken, &request.clientTokenLength );
+
+            if( ( request.jobId == NULL ) && ( request.apiLength == JOBS_API_GETPENDING_LENGTH ) &&
+                ( strncmp( request.api, JOBS_API_GETPENDING, JOBS_API_GETPENDING_LENGTH ) == 0 ) )
+            {
+                emuGetPending( emulator, &request );
+            }
+            else if( ( request.jobId == NULL ) && ( request.apiLength == JOBS_API_STARTNEXT_LENGTH ) &&
+                     ( strncmp( request.api, JOBS_API_STARTNEXT, JOBS_API_STARTNEXT_LENGTH ) == 0 ) )
+            {
+                emuStartNext( emulator, &request );
+            }
+            else if( ( request.jobId != NULL ) &&
+                     ( request.apiLength == request.jobIdLength + 1U + JOBS_API_DESCRIBE_LENGTH ) &&
+                     ( strncmp( &request.api[ request.jobIdLength + 1U ], JOBS_API_DESCRIBE, JOBS_API_DESCRIBE_LENGTH ) == 0 ) )
+            {
+                emuDescribe( emulator, &request );
+            }
+            else if( ( request.jobId != NULL ) &&
+                     ( request.apiLength == request.jobIdLength + 1U + JOBS_API_UPDATE_LENGTH ) &&
+                     ( strncmp( &request.api[ request.jobIdLength + 1U ], JOBS_API_UPDATE, JOBS_API_UPDATE_LENGTH ) == 0 ) )
+            {
+                emuUpdate( emulator, &request );
+            }
+            else
+            {
+                emuReject( emulator, &request, "InvalidTopic", NULL );
+            }
+        }
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+size_t Emulator_Deliver( Emulator_t * emulator )
+{
+    const EmulatorMessage_t * message;
+    size_t delivered = 0U;
+
+    while( ( emulator != NULL ) && ( emulator->count > 0U ) )
+    {
+        /* The message keeps its slot while the callback runs, since the
+         * callback may publish requests that queue new messages. */
+        message = &emulator->queue[ emulator->head ];
+        emulator->deliver( message->topic, message->topicLength,
+                           message->payload, message->payloadLength, emulator->pContext );
+        emulator->head = ( emulator->head + 1U ) % EMULATOR_QUEUE_LENGTH;
+        emulator->count--;
+        delivered++;
+    }
+
+    return delivered;
+}
+
+/*-----------------------------------------------------------*/
+
+const EmulatorJob_t * Emulator_FindJob( const Emulator_t * emulator,
+                                        const char * jobId )
+{
+    const EmulatorJob_t * ret = NULL;
+
+    if( ( emulator != NULL ) && ( jobId != NULL ) )
+    {
+        ret = emuFindJob( ( Emulator_t * ) emulator, jobId, strlen( jobId ) );
+    }
+
+    return ret;
+}
@@ -0,0 +1,226 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_emulator.h
+ * @brief A local emulator of the service side of the AWS IoT Jobs MQTT API.
+ *
+ * The emulator keeps the job executions of one thing and answers the
+ * GetPendingJobExecutions, StartNextPendingJobExecution,
+ * DescribeJobExecution and UpdateJobExecution requests published by a
+ * client, with version checks and state transitions as the service
+ * applies them.  Changes to the pending jobs fan out JobExecutionsChanged
+ * and NextJobExecutionChanged notifications.
+ *
+ * Messages to the client are queued and handed to a delivery callback by
+ * #Emulator_Deliver, so the callback may publish new requests.  The
+ * callback is an in-process transport; a bridge to an MQTT broker can be
+ * plugged in its place.
+ */
+
+#ifndef JOBS_EMULATOR_H_
+#define JOBS_EMULATOR_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jobs.h"
+
+/**
+ * @brief Number of job executions the emulator keeps.
+ */
+#define EMULATOR_MAX_JOBS          32U
+
+/**
+ * @brief Largest job document the emulator keeps.
+ */
+#define EMULATOR_DOCUMENT_LENGTH   256U
+
+/**
+ * @brief Largest statusDetails object the emulator keeps.
+ */
+#define EMULATOR_DETAILS_LENGTH    128U
+
+/**
+ * @brief Number of messages waiting to be delivered to the client.
+ */
+#define EMULATOR_QUEUE_LENGTH      16U
+
+/**
+ * @brief Largest topic of a message to the client.
+ */
+#define EMULATOR_TOPIC_LENGTH      JOBS_API_MAX_LENGTH( THINGNAME_MAX_LENGTH )
+
+/**
+ * @brief Largest payload of a message to the client.
+ */
+#define EMULATOR_PAYLOAD_LENGTH    4096U
+
+/**
+ * @brief Deliver a message to the client.
+ *
+ * @param[in] topic  The topic, NUL terminated.
+ * @param[in] topicLength  The length of the topic.
+ * @param[in] payload  The payload, NUL terminated.
+ * @param[in] payloadLength  The length of the payload.
+ * @param[in] pContext  The context given to #Emulator_Init.
+ */
+typedef void (* EmulatorDeliver_t)( const char * topic,
+                                    size_t topicLength,
+                                    const char * payload,
+                                    size_t payloadLength,
+                                    void * pContext );
+
+/**
+ * @brief A job execution of the emulated thing.
+ */
+typedef struct
+{
+    char jobId[ JOBID_MAX_LENGTH + 1U ];           /**< @brief The job ID. */
+    char document[ EMULATOR_DOCUMENT_LENGTH ];     /**< @brief The job document. */
+    char statusDetails[ EMULATOR_DETAILS_LENGTH ]; /**< @brief The statusDetails object, empty when not set. */
+    JobCurrentStatus_t status;                     /**< @brief The status of the execution. */
+    uint32_t sequence;                             /**< @brief Order the job was queued in. */
+    uint32_t queuedAt;                             /**< @brief Time the job was queued. */
+    uint32_t startedAt;                            /**< @brief Time the job was started, 0 if not started. */
+    uint32_t lastUpdatedAt;                        /**< @brief Time of the last update. */
+    uint32_t versionNumber;                        /**< @brief The version of the execution. */
+    uint32_t executionNumber;                      /**< @brief The execution number. */
+    bool used;                                     /**< @brief Whether the slot holds a job. */
+} EmulatorJob_t;
+
+/**
+ * @brief A message waiting to be delivered to the client.
+ */
+typedef struct
+{
+    char topic[ EMULATOR_TOPIC_LENGTH ];     /**< @brief The topic. */
+    char payload[ EMULATOR_PAYLOAD_LENGTH ]; /**< @brief The payload. */
+    size_t topicLength;                      /**< @brief The length of the topic. */
+    size_t payloadLength;                    /**< @brief The length of the payload. */
+} EmulatorMessage_t;
+
+/**
+ * @brief The emulated service of one thing.
+ *
+ * @note Members are private, except clock and the counters.
+ */
+typedef struct
+{
+    char thingName[ THINGNAME_MAX_LENGTH + 1U ];      /**< @brief The thing name. */
+    uint16_t thingNameLength;                         /**< @brief The length of the thing name. */
+    EmulatorJob_t jobs[ EMULATOR_MAX_JOBS ];          /**< @brief The job executions. */
+    EmulatorMessage_t queue[ EMULATOR_QUEUE_LENGTH ]; /**< @brief Messages to the client. */
+    size_t head;                                      /**< @brief Next message to deliver. */
+    size_t count;                                     /**< @brief Number of messages to deliver. */
+    EmulatorDeliver_t deliver;                        /**< @brief The delivery callback. */
+    void * pContext;                                  /**< @brief Context of the delivery callback. */
+    uint32_t nextSequence;                            /**< @brief Sequence of the next queued job. */
+    uint32_t clock;                                   /**< @brief Timestamp of messages, set by the caller. */
+    uint32_t requests;                                /**< @brief Number of requests answered. */
+    uint32_t rejected;                                /**< @brief Number of requests rejected. */
+    uint32_t dropped;                                 /**< @brief Number of messages that did not fit the queue. */
+} Emulator_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Initialize the emulator of a thing.
+ *
+ * @param[out] emulator  The emulator to initialize.
+ * @param[in] thingName  The thing name.
+ * @param[in] thingNameLength  The length of the thing name.
+ * @param[in] deliver  The delivery callback.
+ * @param[in] pContext  Context passed to the callback.
+ *
+ * @return #JobsSuccess if the emulator was initialized;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+JobsStatus_t Emulator_Init( Emulator_t * emulator,
+                            const char * thingName,
+                            uint16_t thingNameLength,
+                            EmulatorDeliver_t deliver,
+                            void * pContext );
+
+/**
+ * @brief Queue a job for the thing, as CreateJob does.
+ *
+ * When every slot is used, the oldest job in a terminal state is
+ * replaced.
+ *
+ * @param[in] emulator  The emulator.
+ * @param[in] jobId  The job ID, NUL terminated.
+ * @param[in] document  The job document, a JSON object, NUL terminated.
+ *
+ * @return #JobsSuccess if the job was queued;
+ * #JobsBadParameter if invalid parameters are passed, or the job exists;
+ * #JobsBufferTooSmall if no slot is free.
+ */
+JobsStatus_t Emulator_AddJob( Emulator_t * emulator,
+                              const char * jobId,
+                              const char * document );
+
+/**
+ * @brief Handle a message published by the client.
+ *
+ * @param[in] emulator  The emulator.
+ * @param[in] topic  The topic.
+ * @param[in] topicLength  The length of the topic.
+ * @param[in] payload  The payload.
+ * @param[in] payloadLength  The length of the payload.
+ *
+ * @return #JobsSuccess if the request was answered;
+ * #JobsNoMatch if the topic is not a Jobs request of the thing;
+ * #JobsBadParameter if invalid parameters are passed.
+ */
+JobsStatus_t Emulator_Publish( Emulator_t * emulator,
+                               const char * topic,
+                               size_t topicLength,
+                               const char * payload,
+                               size_t payloadLength );
+
+/**
+ * @brief Deliver the queued messages to the client.
+ *
+ * Messages queued by the callback are delivered too.
+ *
+ * @param[in] emulator  The emulator.
+ *
+ * @return The number of messages delivered.
+ */
+size_t Emulator_Deliver( Emulator_t * emulator );
+
+/**
+ * @brief Find a job execution.
+ *
+ * @param[in] emulator  The emulator.
+ * @param[in] jobId  The job ID, NUL terminated.
+ *
+ * @return The job execution, NULL if the thing has no such job.
+ */
+const EmulatorJob_t * Emulator_FindJob( const Emulator_t * emulator,
+                                        const char * jobId );
+
+#endif /* ifndef JOBS_EMULATOR_H_ */
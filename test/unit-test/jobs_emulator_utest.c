@@ -0,0 +1,570 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_emulator_utest.c
+ * @brief End to end tests of the library against the Jobs service emulator.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "unity.h"
+
+#include "jobs.h"
+#include "jobs_emulator.h"
+#include "jobs_rejected.h"
+#include "jobs_summary.h"
+#include "jobs_version.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+/**
+ * @brief Thing name of the tests.
+ */
+#define THING_NAME           "emulated-thing"
+
+/**
+ * @brief Length of the thing name.
+ */
+#define THING_NAME_LENGTH    ( sizeof( THING_NAME ) - 1U )
+
+/**
+ * @brief Document of the jobs queued by the tests.
+ */
+#define JOB_DOCUMENT         "{\"operation\":\"reboot\"}"
+
+/**
+ * @brief Number of messages kept by the capture callback.
+ */
+#define CAPTURE_LENGTH       8U
+
+/**
+ * @brief Number of jobs run one at a time by the benchmark.
+ */
+#define LATENCY_JOBS         2000U
+
+/**
+ * @brief Number of jobs queued at once by the benchmark.
+ */
+#define BATCH_JOBS           8U
+
+/**
+ * @brief Number of batches run by the benchmark.
+ */
+#define BATCH_COUNT          500U
+
+/**
+ * @brief A message delivered to the client.
+ */
+typedef struct
+{
+    char topic[ EMULATOR_TOPIC_LENGTH ];     /**< @brief The topic. */
+    char payload[ EMULATOR_PAYLOAD_LENGTH ]; /**< @brief The payload. */
+    size_t payloadLength;                    /**< @brief The length of the payload. */
+    JobsTopic_t api;                         /**< @brief The topic value from Jobs_MatchTopic. */
+} Captured_t;
+
+/**
+ * @brief A client that runs every job it is notified of to SUCCEEDED.
+ */
+typedef struct
+{
+    Emulator_t * emulator;            /**< @brief The service the client publishes to. */
+    JobsVersionCache_t versions;      /**< @brief Versions of the job executions. */
+    JobsVersionEntry_t entries[ 16 ]; /**< @brief Storage of the version cache. */
+    uint32_t tokens;                  /**< @brief Source of client tokens. */
+    uint32_t succeeded;               /**< @brief Number of accepted SUCCEEDED updates. */
+    uint32_t rejected;                /**< @brief Number of rejected requests. */
+} Client_t;
+
+static Emulator_t emulator;
+static Captured_t captured[ CAPTURE_LENGTH ];
+static size_t capturedCount;
+static Client_t client;
+static uint32_t latencyUs[ LATENCY_JOBS ];
+
+/**
+ * @brief Keep the messages delivered to the client.
+ */
+static void captureDeliver( const char * topic,
+                            size_t topicLength,
+                            const char * payload,
+                            size_t payloadLength,
+                            void * pContext )
+{
+    Captured_t * message = &captured[ capturedCount % CAPTURE_LENGTH ];
+
+    ( void ) pContext;
+
+    TEST_ASSERT_TRUE( topicLength < sizeof( message->topic ) );
+    TEST_ASSERT_EQUAL( strlen( topic ), topicLength );
+    TEST_ASSERT_EQUAL( strlen( payload ), payloadLength );
+    memcpy( message->topic, topic, topicLength + 1U );
+    memcpy( message->payload, payload, payloadLength + 1U );
+    message->payloadLength = payloadLength;
+    message->api = JobsInvalidTopic;
+    ( void ) Jobs_MatchTopic( message->topic, topicLength, THING_NAME, THING_NAME_LENGTH,
+                              &message->api, NULL, NULL );
+    capturedCount++;
+}
+
+/**
+ * @brief Publish a request of the thing to the emulator.
+ */
+static JobsStatus_t publish( const char * api,
+                             const char * payload )
+{
+    char topic[ EMULATOR_TOPIC_LENGTH ];
+    int length = snprintf( topic, sizeof( topic ), "%s%s%s%s",
+                           JOBS_API_PREFIX, THING_NAME, JOBS_API_BRIDGE, api );
+
+    return Emulator_Publish( &emulator, topic, ( size_t ) length, payload, strlen( payload ) );
+}
+
+/**
+ * @brief Deliver the queued messages and check the topic of each.
+ */
+static void assertDelivered( size_t count,
+                             const JobsTopic_t * apis )
+{
+    size_t i;
+
+    capturedCount = 0U;
+    TEST_ASSERT_EQUAL( count, Emulator_Deliver( &emulator ) );
+
+    for( i = 0U; i < count; i++ )
+    {
+        TEST_ASSERT_EQUAL( apis[ i ], captured[ i ].api );
+    }
+}
+
+/**
+ * @brief Check the job ID of the execution of a captured message.
+ */
+static void assertJobId( size_t index,
+                         const char * jobId )
+{
+    const char * value = NULL;
+    size_t length = Jobs_GetJobId( captured[ index ].payload, captured[ index ].payloadLength, &value );
+
+    TEST_ASSERT_EQUAL( strlen( jobId ), length );
+    TEST_ASSERT_EQUAL_MEMORY( jobId, value, length );
+}
+
+/**
+ * @brief Decode a captured rejected response and check its code.
+ */
+static void assertRejected( size_t index,
+                            JobsRejectedCode_t code,
+                            JobsRejected_t * outRejected )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_RejectedDecode( captured[ index ].api, captured[ index ].payload,
+                                                         captured[ index ].payloadLength, outRejected ) );
+    TEST_ASSERT_EQUAL( code, outRejected->code );
+}
+
+/**
+ * @brief Publish a request of the client.
+ */
+static void clientPublish( Client_t * pClient,
+                           const char * topic,
+                           size_t topicLength,
+                           const char * payload,
+                           size_t payloadLength )
+{
+    TEST_ASSERT_TRUE( ( topicLength > 0U ) && ( payloadLength > 0U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Emulator_Publish( pClient->emulator, topic, topicLength, payload, payloadLength ) );
+}
+
+/**
+ * @brief The MQTT callback of the client, built on the library only.
+ */
+static void clientDeliver( const char * topic,
+                           size_t topicLength,
+                           const char * payload,
+                           size_t payloadLength,
+                           void * pContext )
+{
+    Client_t * pClient = pContext;
+    char topicBuffer[ EMULATOR_TOPIC_LENGTH ];
+    char requestTopic[ JOBS_API_MAX_LENGTH( THING_NAME_LENGTH ) ];
+    char message[ 256 ];
+    char token[ 12 ];
+    JobsTopic_t api = JobsInvalidTopic;
+    JobsUpdateRequest_t request = { 0 };
+    char * topicJobId = NULL;
+    uint16_t topicJobIdLength = 0U;
+    const char * jobId = NULL;
+    const char * document = NULL;
+    size_t jobIdLength;
+    size_t requestTopicLength = 0U;
+    size_t messageLength;
+
+    memcpy( topicBuffer, topic, topicLength );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_MatchTopic( topicBuffer, topicLength, THING_NAME, THING_NAME_LENGTH,
+                                                     &api, &topicJobId, &topicJobIdLength ) );
+    ( void ) Jobs_VersionCacheObserve( &pClient->versions, api, topicJobId, topicJobIdLength,
+                                       payload, payloadLength );
+    jobIdLength = Jobs_GetJobId( payload, payloadLength, &jobId );
+
+    if( ( api == JobsNextJobChanged ) && ( jobIdLength > 0U ) )
+    {
+        ( void ) snprintf( token, sizeof( token ), "%u", ( unsigned ) pClient->tokens++ );
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_StartNext( requestTopic, sizeof( requestTopic ), THING_NAME,
+                                                        THING_NAME_LENGTH, &requestTopicLength ) );
+        messageLength = Jobs_StartNextMsg( token, strlen( token ), message, sizeof( message ) );
+        clientPublish( pClient, requestTopic, requestTopicLength, message, messageLength );
+    }
+    else if( ( api == JobsStartNextSuccess ) && ( jobIdLength > 0U ) &&
+             ( Jobs_GetJobDocument( payload, payloadLength, &document ) > 0U ) )
+    {
+        /* Run the job, then report its outcome. */
+        request.status = Succeeded;
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_Update( requestTopic, sizeof( requestTopic ), THING_NAME,
+                                                     THING_NAME_LENGTH, jobId, ( uint16_t ) jobIdLength,
+                                                     &requestTopicLength ) );
+        messageLength = Jobs_VersionCacheUpdateMsg( &pClient->versions, jobId, ( uint16_t ) jobIdLength,
+                                                    request, NULL, message, sizeof( message ) );
+        clientPublish( pClient, requestTopic, requestTopicLength, message, messageLength );
+    }
+    else if( api == JobsUpdateSuccess )
+    {
+        pClient->succeeded++;
+        ( void ) Jobs_VersionCacheRemove( &pClient->versions, topicJobId, topicJobIdLength );
+    }
+    else if( ( api == JobsStartNextFailed ) || ( api == JobsUpdateFailed ) )
+    {
+        pClient->rejected++;
+    }
+    else
+    {
+        /* Notifications of the job lists are not needed. */
+    }
+}
+
+/**
+ * @brief Get a monotonic time in microseconds.
+ */
+static uint64_t nowUs( void )
+{
+    struct timespec now;
+
+    ( void ) clock_gettime( CLOCK_MONOTONIC, &now );
+
+    return ( ( uint64_t ) now.tv_sec * 1000000U ) + ( ( uint64_t ) now.tv_nsec / 1000U );
+}
+
+/**
+ * @brief Sort comparison of unsigned values.
+ */
+static int compareUint( const void * a,
+                        const void * b )
+{
+    uint32_t x = *( const uint32_t * ) a;
+    uint32_t y = *( const uint32_t * ) b;
+
+    return ( x > y ) - ( x < y );
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Emulator_Init( &emulator, THING_NAME, THING_NAME_LENGTH, captureDeliver, NULL ) );
+    emulator.clock = 1700000000U;
+    capturedCount = 0U;
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_emulator_rejectsBadParameters( void )
+{
+    TEST_ASSERT_EQUAL( JobsBadParameter, Emulator_Init( NULL, THING_NAME, THING_NAME_LENGTH, captureDeliver, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Emulator_Init( &emulator, THING_NAME, 0U, captureDeliver, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Emulator_Init( &emulator, THING_NAME, THING_NAME_LENGTH, NULL, NULL ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Emulator_Init( &emulator, THING_NAME, THING_NAME_LENGTH, captureDeliver, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Emulator_AddJob( &emulator, "bad id", JOB_DOCUMENT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Emulator_AddJob( &emulator, "job-1", NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Emulator_AddJob( &emulator, "job-1", JOB_DOCUMENT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Emulator_AddJob( &emulator, "job-1", JOB_DOCUMENT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Emulator_Publish( &emulator, NULL, 0U, "{}", 2U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Emulator_Publish( &emulator, "$aws/things/other/jobs/get", 26U, "{}", 2U ) );
+    TEST_ASSERT_NULL( Emulator_FindJob( &emulator, "job-2" ) );
+    TEST_ASSERT_EQUAL( 0U, Emulator_Deliver( NULL ) );
+}
+
+void test_emulator_fansOutNotifications( void )
+{
+    const JobsTopic_t first[] = { JobsJobsChanged, JobsNextJobChanged };
+    const JobsTopic_t second[] = { JobsJobsChanged };
+    JobsSummaryIterator_t iterator;
+    JobsJobSummary_t summary;
+
+    /* The first job changes the job lists and the next job. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Emulator_AddJob( &emulator, "job-1", JOB_DOCUMENT ) );
+    assertDelivered( 2U, first );
+    assertJobId( 1U, "job-1" );
+
+    /* The second job only changes the job lists. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Emulator_AddJob( &emulator, "job-2", JOB_DOCUMENT ) );
+    assertDelivered( 1U, second );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SummaryInit( &iterator, JobsJobsChanged, captured[ 0 ].payload,
+                                                      captured[ 0 ].payloadLength ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SummaryNext( &iterator, &summary ) );
+    TEST_ASSERT_EQUAL_MEMORY( "job-1", summary.jobId, summary.jobIdLength );
+    TEST_ASSERT_EQUAL( Queued, summary.status );
+    TEST_ASSERT_EQUAL( 1U, summary.versionNumber );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SummaryNext( &iterator, &summary ) );
+    TEST_ASSERT_EQUAL_MEMORY( "job-2", summary.jobId, summary.jobIdLength );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_SummaryNext( &iterator, &summary ) );
+}
+
+void test_emulator_answersRequests( void )
+{
+    const JobsTopic_t pending[] = { JobsGetPendingSuccess };
+    const JobsTopic_t started[] = { JobsStartNextSuccess, JobsJobsChanged };
+    const JobsTopic_t described[] = { JobsDescribeSuccess };
+    const JobsTopic_t describeFailed[] = { JobsDescribeFailed };
+    const JobsTopic_t updated[] = { JobsUpdateSuccess, JobsJobsChanged, JobsNextJobChanged };
+    const JobsTopic_t updateFailed[] = { JobsUpdateFailed };
+    const JobsTopic_t emptyStart[] = { JobsStartNextSuccess };
+    const JobsTopic_t startFailed[] = { JobsStartNextFailed };
+    JobsRejected_t rejected;
+    JobsSummaryIterator_t iterator;
+    JobsJobSummary_t summary;
+    const char * document = NULL;
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Emulator_AddJob( &emulator, "job-1", JOB_DOCUMENT ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Emulator_AddJob( &emulator, "job-2", JOB_DOCUMENT ) );
+    ( void ) Emulator_Deliver( &emulator );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "get", "{\"clientToken\":\"t1\"}" ) );
+    assertDelivered( 1U, pending );
+    TEST_ASSERT_NOT_NULL( strstr( captured[ 0 ].payload, "\"clientToken\":\"t1\"" ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SummaryInit( &iterator, JobsGetPendingSuccess, captured[ 0 ].payload,
+                                                      captured[ 0 ].payloadLength ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SummaryNext( &iterator, &summary ) );
+    TEST_ASSERT_EQUAL_MEMORY( "job-1", summary.jobId, summary.jobIdLength );
+
+    /* A bad statusDetails leaves the job queued. */
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "start-next", "{\"statusDetails\":[]}" ) );
+    assertDelivered( 1U, startFailed );
+    assertRejected( 0U, JobsRejectedInvalidRequest, &rejected );
+    TEST_ASSERT_EQUAL( Queued, Emulator_FindJob( &emulator, "job-1" )->status );
+
+    /* Start-next moves the oldest job to IN_PROGRESS with a new version. */
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "start-next", "{\"statusDetails\":{\"step\":\"1\"}}" ) );
+    assertDelivered( 2U, started );
+    assertJobId( 0U, "job-1" );
+    TEST_ASSERT_EQUAL( strlen( JOB_DOCUMENT ), Jobs_GetJobDocument( captured[ 0 ].payload, captured[ 0 ].payloadLength,
+                                                                    &document ) );
+    TEST_ASSERT_EQUAL( InProgress, Emulator_FindJob( &emulator, "job-1" )->status );
+    TEST_ASSERT_EQUAL( 2U, Emulator_FindJob( &emulator, "job-1" )->versionNumber );
+    TEST_ASSERT_EQUAL_STRING( "{\"step\":\"1\"}", Emulator_FindJob( &emulator, "job-1" )->statusDetails );
+
+    /* Describe by ID, and of the next job. */
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "job-2/get", "{}" ) );
+    assertDelivered( 1U, described );
+    assertJobId( 0U, "job-2" );
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "$next/get", "{\"includeJobDocument\":false}" ) );
+    assertDelivered( 1U, described );
+    assertJobId( 0U, "job-1" );
+    TEST_ASSERT_NULL( strstr( captured[ 0 ].payload, "jobDocument" ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "job-9/get", "{\"clientToken\":\"t2\"}" ) );
+    assertDelivered( 1U, describeFailed );
+    assertRejected( 0U, JobsRejectedResourceNotFound, &rejected );
+    TEST_ASSERT_EQUAL_MEMORY( "t2", rejected.clientToken, rejected.clientTokenLength );
+
+    /* Updates check the expected version. */
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "job-1/update", "{\"status\":\"SUCCEEDED\",\"expectedVersion\":\"1\"}" ) );
+    assertDelivered( 1U, updateFailed );
+    assertRejected( 0U, JobsRejectedVersionMismatch, &rejected );
+    TEST_ASSERT_TRUE( rejected.hasExecutionState );
+    TEST_ASSERT_EQUAL( 2U, rejected.versionNumber );
+    TEST_ASSERT_EQUAL( InProgress, rejected.status );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "job-1/update", "{\"status\":\"SUCCEEDED\",\"expectedVersion\":\"2\","
+                                                             "\"includeJobExecutionState\":true}" ) );
+    assertDelivered( 3U, updated );
+    TEST_ASSERT_NOT_NULL( strstr( captured[ 0 ].payload, "\"executionState\":{\"status\":\"SUCCEEDED\"" ) );
+    assertJobId( 2U, "job-2" );
+    TEST_ASSERT_EQUAL( 3U, Emulator_FindJob( &emulator, "job-1" )->versionNumber );
+
+    /* Terminal jobs, unknown jobs and bad requests are rejected. */
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "job-1/update", "{\"status\":\"FAILED\"}" ) );
+    assertDelivered( 1U, updateFailed );
+    assertRejected( 0U, JobsRejectedInvalidStateTransition, &rejected );
+    TEST_ASSERT_EQUAL( Succeeded, rejected.status );
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "job-2/update", "{\"status\":\"QUEUED\"}" ) );
+    assertDelivered( 1U, updateFailed );
+    assertRejected( 0U, JobsRejectedInvalidStateTransition, &rejected );
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "job-2/update", "{\"status\":\"DONE\"}" ) );
+    assertDelivered( 1U, updateFailed );
+    assertRejected( 0U, JobsRejectedInvalidRequest, &rejected );
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "job-2/update", "{\"status\":\"IN_PROGRESS\",\"statusDetails\":1}" ) );
+    assertDelivered( 1U, updateFailed );
+    assertRejected( 0U, JobsRejectedInvalidRequest, &rejected );
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "job-9/update", "{\"status\":\"FAILED\"}" ) );
+    assertDelivered( 1U, updateFailed );
+    assertRejected( 0U, JobsRejectedResourceNotFound, &rejected );
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "job-2/update", "{\"status\":" ) );
+    assertDelivered( 1U, updateFailed );
+    assertRejected( 0U, JobsRejectedInvalidJson, &rejected );
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "job-2/cancel", "{}" ) );
+    capturedCount = 0U;
+    TEST_ASSERT_EQUAL( 1U, Emulator_Deliver( &emulator ) );
+    TEST_ASSERT_EQUAL( JobsInvalidTopic, captured[ 0 ].api );
+    TEST_ASSERT_NOT_NULL( strstr( captured[ 0 ].payload, "InvalidTopic" ) );
+
+    /* An IN_PROGRESS update of a queued job starts it. */
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "job-2/update", "{\"status\":\"IN_PROGRESS\",\"includeJobDocument\":true}" ) );
+    capturedCount = 0U;
+    ( void ) Emulator_Deliver( &emulator );
+    TEST_ASSERT_NOT_NULL( strstr( captured[ 0 ].payload, "\"jobDocument\":" JOB_DOCUMENT ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "job-2/update", "{\"status\":\"REJECTED\"}" ) );
+    ( void ) Emulator_Deliver( &emulator );
+
+    /* Start-next without pending jobs has no execution. */
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "start-next", "{}" ) );
+    assertDelivered( 1U, emptyStart );
+    TEST_ASSERT_EQUAL( 0U, Jobs_GetJobId( captured[ 0 ].payload, captured[ 0 ].payloadLength, &document ) );
+    TEST_ASSERT_EQUAL( 0U, emulator.dropped );
+}
+
+void test_emulator_replacesTerminalJobs( void )
+{
+    char jobId[ 16 ];
+    uint32_t i;
+
+    for( i = 0U; i < EMULATOR_MAX_JOBS; i++ )
+    {
+        ( void ) snprintf( jobId, sizeof( jobId ), "job-%u", ( unsigned ) i );
+        TEST_ASSERT_EQUAL( JobsSuccess, Emulator_AddJob( &emulator, jobId, JOB_DOCUMENT ) );
+        ( void ) Emulator_Deliver( &emulator );
+    }
+
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, Emulator_AddJob( &emulator, "job-extra", JOB_DOCUMENT ) );
+
+    /* Finishing a job frees its slot, the oldest finished job goes first. */
+    emulator.clock++;
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "job-7/update", "{\"status\":\"FAILED\"}" ) );
+    ( void ) Emulator_Deliver( &emulator );
+    emulator.clock--;
+    TEST_ASSERT_EQUAL( JobsSuccess, publish( "job-5/update", "{\"status\":\"FAILED\"}" ) );
+    ( void ) Emulator_Deliver( &emulator );
+    TEST_ASSERT_EQUAL( JobsSuccess, Emulator_AddJob( &emulator, "job-extra", JOB_DOCUMENT ) );
+    TEST_ASSERT_NULL( Emulator_FindJob( &emulator, "job-5" ) );
+    TEST_ASSERT_NOT_NULL( Emulator_FindJob( &emulator, "job-7" ) );
+    TEST_ASSERT_NOT_NULL( Emulator_FindJob( &emulator, "job-extra" ) );
+
+    /* A full queue drops messages instead of overwriting them. */
+    for( i = 0U; i < EMULATOR_QUEUE_LENGTH; i++ )
+    {
+        TEST_ASSERT_EQUAL( JobsSuccess, publish( "get", "{}" ) );
+    }
+
+    TEST_ASSERT_TRUE( emulator.dropped > 0U );
+}
+
+void test_emulator_clientBenchmark( void )
+{
+    char jobId[ 16 ];
+    char line[ 160 ];
+    uint64_t start;
+    uint64_t elapsed;
+    uint32_t jobs = 0U;
+    uint32_t i;
+    uint32_t j;
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Emulator_Init( &emulator, THING_NAME, THING_NAME_LENGTH, clientDeliver, &client ) );
+    memset( &client, 0, sizeof( client ) );
+    client.emulator = &emulator;
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_VersionCacheInit( &client.versions, client.entries, 16U ) );
+
+    /* Latency from the notification to the SUCCEEDED update, one job at a time. */
+    for( i = 0U; i < LATENCY_JOBS; i++ )
+    {
+        ( void ) snprintf( jobId, sizeof( jobId ), "job-%u", ( unsigned ) jobs++ );
+        emulator.clock++;
+        start = nowUs();
+        TEST_ASSERT_EQUAL( JobsSuccess, Emulator_AddJob( &emulator, jobId, JOB_DOCUMENT ) );
+        ( void ) Emulator_Deliver( &emulator );
+        latencyUs[ i ] = ( uint32_t ) ( nowUs() - start );
+        TEST_ASSERT_EQUAL( Succeeded, Emulator_FindJob( &emulator, jobId )->status );
+    }
+
+    qsort( latencyUs, LATENCY_JOBS, sizeof( latencyUs[ 0 ] ), compareUint );
+
+    /* Throughput with several jobs queued at once. */
+    start = nowUs();
+
+    for( i = 0U; i < BATCH_COUNT; i++ )
+    {
+        emulator.clock++;
+
+        for( j = 0U; j < BATCH_JOBS; j++ )
+        {
+            ( void ) snprintf( jobId, sizeof( jobId ), "job-%u", ( unsigned ) jobs++ );
+            TEST_ASSERT_EQUAL( JobsSuccess, Emulator_AddJob( &emulator, jobId, JOB_DOCUMENT ) );
+        }
+
+        ( void ) Emulator_Deliver( &emulator );
+    }
+
+    elapsed = nowUs() - start;
+
+    ( void ) snprintf( line, sizeof( line ), "notify to SUCCEEDED: p50 %u us, p99 %u us, max %u us; "
+                                             "%u jobs in %u us, %u jobs/s",
+                       ( unsigned ) latencyUs[ LATENCY_JOBS / 2U ], ( unsigned ) latencyUs[ ( LATENCY_JOBS * 99U ) / 100U ],
+                       ( unsigned ) latencyUs[ LATENCY_JOBS - 1U ], ( unsigned ) ( BATCH_COUNT * BATCH_JOBS ),
+                       ( unsigned ) elapsed,
+                       ( unsigned ) ( ( ( uint64_t ) BATCH_COUNT * BATCH_JOBS * 1000000U ) / ( elapsed + 1U ) ) );
+    TEST_MESSAGE( line );
+
+    TEST_ASSERT_EQUAL( jobs, client.succeeded );
+    TEST_ASSERT_EQUAL( 0U, client.rejected );
+    TEST_ASSERT_EQUAL( 0U, emulator.rejected );
+    TEST_ASSERT_EQUAL( 0U, emulator.dropped );
+}
@@ -0,0 +1,507 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_execution_utest.c
+ * @brief Unit tests for the job execution state machine.
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "jobs_execution.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+#define START_NEXT_ACCEPTED                                         \
+    "{\"execution\":{\"jobId\":\"job1\",\"status\":\"IN_PROGRESS\"," \
+    "\"versionNumber\":2,\"executionNumber\":1}}"
+
+static JobsExecution_t execution;
+static JobsExecutionAction_t action;
+static char message[ 256 ];
+
+/**
+ * @brief Handle a message for job1.
+ */
+static JobsStatus_t handle( JobsTopic_t topic,
+                            const char * payload,
+                            uint32_t nowMs )
+{
+    return Jobs_ExecutionHandle( &execution, topic, "job1", 4U,
+                                 payload, strlen( payload ), nowMs, &action );
+}
+
+/**
+ * @brief Build the message of the last action.
+ */
+static const char * actionMsg( void )
+{
+    size_t length;
+
+    memset( message, 0, sizeof( message ) );
+    length = Jobs_ExecutionMsg( &execution, &action, NULL, 0U, message, sizeof( message ) );
+    TEST_ASSERT_EQUAL( strlen( message ), length );
+
+    return message;
+}
+
+/**
+ * @brief Move the record to running job1 at version 2.
+ */
+static void startJob( void )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionStart( &execution, 0U, &action ) );
+    TEST_ASSERT_EQUAL( JobsApiStartNext, action.api );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsStartNextSuccess, START_NEXT_ACCEPTED, 10U ) );
+    TEST_ASSERT_EQUAL( JobsInvalidApi, action.api );
+    TEST_ASSERT_EQUAL( JobsExecutionRunning, execution.state );
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionInit( &execution ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_execution_rejectsBadParameters( void )
+{
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutionInit( NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutionStart( &execution, 0U, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutionReport( NULL, Succeeded, 0U, &action ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutionHandle( &execution, JobsNextJobChanged, NULL, 0U,
+                                                               NULL, 0U, 0U, &action ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutionTick( NULL, 0U, &action ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_ExecutionMsg( NULL, &action, NULL, 0U, message, sizeof( message ) ) );
+    TEST_ASSERT_FALSE( Jobs_ExecutionIsJob( NULL, "job1", 4U ) );
+
+    /* Only the service sets QUEUED. */
+    startJob();
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutionReport( &execution, Queued, 0U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionInit( &execution ) );
+
+    /* No job to report on, and nothing in flight. */
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_ExecutionReport( &execution, Succeeded, 0U, &action ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_ExecutionTick( &execution, 0U, &action ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, handle( JobsUpdateSuccess, "{}", 0U ) );
+}
+
+void test_execution_runsJobToCompletion( void )
+{
+    TEST_ASSERT_EQUAL( 24U, sizeof( JobsExecution_t ) );
+
+    startJob();
+    TEST_ASSERT_TRUE( Jobs_ExecutionIsJob( &execution, "job1", 4U ) );
+    TEST_ASSERT_FALSE( Jobs_ExecutionIsJob( &execution, "job2", 4U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_ExecutionStart( &execution, 0U, &action ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, Succeeded, 20U, &action ) );
+    TEST_ASSERT_EQUAL( JobsApiUpdate, action.api );
+    TEST_ASSERT_EQUAL_STRING( "{\"status\":\"SUCCEEDED\",\"expectedVersion\":\"2\","
+                              "\"executionNumber\":1,\"includeJobExecutionState\":false,"
+                              "\"includeJobDocument\":false}", actionMsg() );
+
+    /* A response for another job does not complete the update. */
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_ExecutionHandle( &execution, JobsUpdateSuccess, "job2", 4U,
+                                                          "{}", 2U, 30U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateSuccess, "{}", 30U ) );
+    TEST_ASSERT_EQUAL( JobsApiStartNext, action.api );
+    TEST_ASSERT_EQUAL_STRING( "{}", actionMsg() );
+    TEST_ASSERT_FALSE( Jobs_ExecutionIsJob( &execution, "job1", 4U ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsStartNextSuccess, "{}", 40U ) );
+    TEST_ASSERT_EQUAL( JobsExecutionIdle, execution.state );
+
+    /* A new job wakes the idle record. */
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsNextJobChanged, START_NEXT_ACCEPTED, 50U ) );
+    TEST_ASSERT_EQUAL( JobsApiStartNext, action.api );
+    TEST_ASSERT_EQUAL( JobsExecutionStarting, execution.state );
+}
+
+void test_execution_holdsReportsWhileUpdating( void )
+{
+    startJob();
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, InProgress, 20U, &action ) );
+    TEST_ASSERT_EQUAL( JobsApiUpdate, action.api );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, Failed, 25U, &action ) );
+    TEST_ASSERT_EQUAL( JobsInvalidApi, action.api );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateSuccess,
+                                            "{\"executionState\":{\"status\":\"IN_PROGRESS\",\"versionNumber\":3}}",
+                                            30U ) );
+    TEST_ASSERT_EQUAL( JobsApiUpdate, action.api );
+    TEST_ASSERT_EQUAL( Failed, action.status );
+    TEST_ASSERT_EQUAL( 3U, execution.versionNumber );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateSuccess, "{}", 40U ) );
+    TEST_ASSERT_EQUAL( JobsApiStartNext, action.api );
+}
+
+void test_execution_retriesWithServiceVersion( void )
+{
+    startJob();
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, InProgress, 20U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateFailed,
+                                            "{\"code\":\"VersionMismatch\",\"executionState\":"
+                                            "{\"status\":\"IN_PROGRESS\",\"versionNumber\":5}}", 30U ) );
+    TEST_ASSERT_EQUAL( JobsApiUpdate, action.api );
+    TEST_ASSERT_EQUAL( 5U, execution.versionNumber );
+
+    /* The job was canceled in the meantime. */
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateFailed,
+                                            "{\"code\":\"InvalidStateTransition\",\"executionState\":"
+                                            "{\"status\":\"CANCELED\",\"versionNumber\":6}}", 40U ) );
+    TEST_ASSERT_EQUAL( JobsApiStartNext, action.api );
+    TEST_ASSERT_EQUAL( JobsExecutionStarting, execution.state );
+}
+
+void test_execution_takesStateOfRefusedUpdate( void )
+{
+    startJob();
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, Failed, 20U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateFailed,
+                                            "{\"code\":\"InvalidStateTransition\",\"executionState\":"
+                                            "{\"status\":\"IN_PROGRESS\",\"versionNumber\":2}}", 30U ) );
+    TEST_ASSERT_EQUAL( JobsInvalidApi, action.api );
+    TEST_ASSERT_EQUAL( JobsExecutionRunning, execution.state );
+    TEST_ASSERT_EQUAL( InProgress, execution.pendingStatus );
+
+    /* A report held back is still sent. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, Succeeded, 40U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, Rejected, 45U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateFailed,
+                                            "{\"code\":\"InvalidStateTransition\",\"executionState\":"
+                                            "{\"status\":\"IN_PROGRESS\",\"versionNumber\":2}}", 50U ) );
+    TEST_ASSERT_EQUAL( JobsApiUpdate, action.api );
+    TEST_ASSERT_EQUAL( Rejected, action.status );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateFailed,
+                                            "{\"code\":\"TerminalStateReached\",\"executionState\":"
+                                            "{\"status\":\"SUCCEEDED\",\"versionNumber\":3}}", 60U ) );
+    TEST_ASSERT_EQUAL( JobsApiStartNext, action.api );
+}
+
+void test_execution_boundsRejectedUpdates( void )
+{
+    uint32_t i;
+
+    startJob();
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, Succeeded, 20U, &action ) );
+
+    for( i = 0U; i < JOBS_EXECUTION_MAX_RETRIES; i++ )
+    {
+        TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateFailed,
+                                                "{\"code\":\"VersionMismatch\",\"executionState\":"
+                                                "{\"status\":\"IN_PROGRESS\",\"versionNumber\":7}}", 30U ) );
+        TEST_ASSERT_EQUAL( JobsApiUpdate, action.api );
+        TEST_ASSERT_EQUAL( Succeeded, action.status );
+    }
+
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateFailed,
+                                            "{\"code\":\"VersionMismatch\",\"executionState\":"
+                                            "{\"status\":\"IN_PROGRESS\",\"versionNumber\":7}}", 40U ) );
+    TEST_ASSERT_EQUAL( JobsInvalidApi, action.api );
+    TEST_ASSERT_EQUAL( JobsExecutionRunning, execution.state );
+    TEST_ASSERT_EQUAL( InProgress, execution.pendingStatus );
+
+    /* Without an execution state, each rejection describes the job. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, Succeeded, 50U, &action ) );
+
+    for( i = 0U; i < JOBS_EXECUTION_MAX_RETRIES; i++ )
+    {
+        TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateFailed, "{\"code\":\"InvalidRequest\"}", 60U ) );
+        TEST_ASSERT_EQUAL( JobsApiDescribe, action.api );
+        TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsDescribeSuccess,
+                                                "{\"execution\":{\"jobId\":\"job1\",\"status\":\"IN_PROGRESS\"}}",
+                                                70U ) );
+        TEST_ASSERT_EQUAL( JobsApiUpdate, action.api );
+    }
+
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateFailed, "{\"code\":\"InvalidRequest\"}", 80U ) );
+    TEST_ASSERT_EQUAL( JobsApiDescribe, action.api );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsDescribeSuccess,
+                                            "{\"execution\":{\"jobId\":\"job1\",\"status\":\"IN_PROGRESS\"}}",
+                                            90U ) );
+    TEST_ASSERT_EQUAL( JobsInvalidApi, action.api );
+    TEST_ASSERT_EQUAL( JobsExecutionRunning, execution.state );
+}
+
+void test_execution_keepsNumbersMissingFromStartNext( void )
+{
+    startJob();
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, Succeeded, 20U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateSuccess,
+                                            "{\"executionState\":{\"status\":\"SUCCEEDED\",\"versionNumber\":3}}",
+                                            30U ) );
+    TEST_ASSERT_EQUAL( JobsApiStartNext, action.api );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsStartNextSuccess,
+                                            "{\"execution\":{\"jobId\":\"job2\",\"status\":\"IN_PROGRESS\"}}",
+                                            40U ) );
+    TEST_ASSERT_EQUAL( JobsExecutionRunning, execution.state );
+    TEST_ASSERT_EQUAL( 3U, execution.versionNumber );
+    TEST_ASSERT_EQUAL( 1U, execution.executionNumber );
+}
+
+void test_execution_describesAfterRejection( void )
+{
+    startJob();
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, Succeeded, 20U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateFailed, "{\"code\":\"Throttled\"}", 30U ) );
+    TEST_ASSERT_EQUAL( JobsApiDescribe, action.api );
+    TEST_ASSERT_EQUAL_STRING( "{\"executionNumber\":1,\"includeJobDocument\":false}", actionMsg() );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsDescribeSuccess,
+                                            "{\"execution\":{\"jobId\":\"job1\",\"status\":\"IN_PROGRESS\","
+                                            "\"versionNumber\":4}}", 40U ) );
+    TEST_ASSERT_EQUAL( JobsApiUpdate, action.api );
+    TEST_ASSERT_EQUAL( Succeeded, action.status );
+    TEST_ASSERT_EQUAL( 4U, execution.versionNumber );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateFailed, "{}", 50U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsDescribeFailed, "{\"code\":\"ResourceNotFound\"}", 60U ) );
+    TEST_ASSERT_EQUAL( JobsApiStartNext, action.api );
+}
+
+void test_execution_retriesOverdueRequests( void )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionStart( &execution, 0U, &action ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_ExecutionTick( &execution, JOBS_EXECUTION_RESPONSE_TIMEOUT_MS - 1U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionTick( &execution, JOBS_EXECUTION_RESPONSE_TIMEOUT_MS, &action ) );
+    TEST_ASSERT_EQUAL( JobsApiStartNext, action.api );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsStartNextSuccess, START_NEXT_ACCEPTED, 0U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, InProgress, 0xFFFFFF00U, &action ) );
+
+    /* The deadline wraps around. */
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_ExecutionTick( &execution, 0U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionTick( &execution, JOBS_EXECUTION_RESPONSE_TIMEOUT_MS, &action ) );
+    TEST_ASSERT_EQUAL( JobsApiDescribe, action.api );
+    TEST_ASSERT_EQUAL( JobsExecutionSyncing, execution.state );
+}
+
+void test_execution_followsNextJobChanges( void )
+{
+    startJob();
+    TEST_ASSERT_EQUAL( JobsNoMatch, handle( JobsNextJobChanged, START_NEXT_ACCEPTED, 20U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsNextJobChanged,
+                                            "{\"execution\":{\"jobId\":\"job2\",\"status\":\"QUEUED\"}}", 30U ) );
+    TEST_ASSERT_EQUAL( JobsApiStartNext, action.api );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsStartNextSuccess, START_NEXT_ACCEPTED, 40U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsNextJobChanged, "{\"timestamp\":1}", 50U ) );
+    TEST_ASSERT_EQUAL( JobsInvalidApi, action.api );
+    TEST_ASSERT_EQUAL( JobsExecutionIdle, execution.state );
+    TEST_ASSERT_EQUAL( JobsNoMatch, handle( JobsNextJobChanged, "not json", 60U ) );
+}
+
+void test_execution_rejectsNullParameters( void )
+{
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutionStart( NULL, 0U, &action ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutionReport( &execution, Succeeded, 0U, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutionReport( &execution, ( JobCurrentStatus_t ) ( Rejected + 1 ),
+                                                               0U, &action ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutionHandle( NULL, JobsNextJobChanged, NULL, 0U,
+                                                               "{}", 2U, 0U, &action ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutionHandle( &execution, JobsNextJobChanged, NULL, 0U,
+                                                               "{}", 2U, 0U, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutionHandle( &execution, JobsNextJobChanged, NULL, 0U,
+                                                               NULL, 2U, 0U, &action ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutionHandle( &execution, JobsNextJobChanged, NULL, 0U,
+                                                               "{}", 0U, 0U, &action ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutionTick( &execution, 0U, NULL ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_ExecutionMsg( &execution, NULL, NULL, 0U, message, sizeof( message ) ) );
+    TEST_ASSERT_FALSE( Jobs_ExecutionIsJob( &execution, NULL, 4U ) );
+
+    /* No message for an event without a request. */
+    action.api = JobsInvalidApi;
+    TEST_ASSERT_EQUAL( 0U, Jobs_ExecutionMsg( &execution, &action, NULL, 0U, message, sizeof( message ) ) );
+}
+
+void test_execution_ignoresInvalidTransitions( void )
+{
+    TEST_ASSERT_FALSE( Jobs_ExecutionIsJob( &execution, "job1", 4U ) );
+
+    /* While starting, only start-next responses and notifications count. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionStart( &execution, 0U, &action ) );
+    TEST_ASSERT_FALSE( Jobs_ExecutionIsJob( &execution, "job1", 4U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_ExecutionReport( &execution, Succeeded, 0U, &action ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, handle( JobsUpdateSuccess, "{}", 0U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, handle( JobsNextJobChanged, START_NEXT_ACCEPTED, 0U ) );
+    TEST_ASSERT_EQUAL( JobsExecutionStarting, execution.state );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsStartNextFailed, "{\"code\":\"Throttled\"}", 0U ) );
+    TEST_ASSERT_EQUAL( JobsExecutionIdle, execution.state );
+
+    /* An idle record waits for a notification with an execution. */
+    TEST_ASSERT_EQUAL( JobsNoMatch, handle( JobsNextJobChanged, "{\"timestamp\":1}", 0U ) );
+    TEST_ASSERT_EQUAL( JobsExecutionIdle, execution.state );
+
+    /* A running record has no response in flight. */
+    startJob();
+    TEST_ASSERT_EQUAL( JobsNoMatch, handle( JobsUpdateSuccess, "{}", 20U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_ExecutionTick( &execution, 20U + JOBS_EXECUTION_RESPONSE_TIMEOUT_MS, &action ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, handle( JobsNextJobChanged, "{\"execution\":{\"status\":\"QUEUED\"}}", 20U ) );
+    TEST_ASSERT_EQUAL( JobsExecutionRunning, execution.state );
+
+    /* Updating waits for an update response naming the job. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, InProgress, 30U, &action ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, handle( JobsDescribeSuccess, "{}", 30U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_ExecutionHandle( &execution, JobsUpdateSuccess, NULL, 0U,
+                                                          "{}", 2U, 30U, &action ) );
+    TEST_ASSERT_EQUAL( JobsExecutionUpdating, execution.state );
+
+    /* Syncing waits for a describe response naming the job. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionTick( &execution, 30U + JOBS_EXECUTION_RESPONSE_TIMEOUT_MS, &action ) );
+    TEST_ASSERT_EQUAL( JobsExecutionSyncing, execution.state );
+    TEST_ASSERT_EQUAL( JobsNoMatch, handle( JobsUpdateSuccess, "{}", 40U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_ExecutionHandle( &execution, JobsDescribeSuccess, "job2", 4U,
+                                                          "{}", 2U, 40U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, Succeeded, 40U, &action ) );
+    TEST_ASSERT_EQUAL( JobsInvalidApi, action.api );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionTick( &execution, 30U + ( 2U * JOBS_EXECUTION_RESPONSE_TIMEOUT_MS ), &action ) );
+    TEST_ASSERT_EQUAL( JobsApiDescribe, action.api );
+
+    /* The job ended while the describe was in flight. */
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsDescribeSuccess,
+                                            "{\"execution\":{\"jobId\":\"job1\",\"status\":\"CANCELED\","
+                                            "\"versionNumber\":9}}", 50U ) );
+    TEST_ASSERT_EQUAL( JobsApiStartNext, action.api );
+    TEST_ASSERT_EQUAL( 9U, execution.versionNumber );
+}
+
+void test_execution_readsPartialExecutionStates( void )
+{
+    /* Start-next responses without a usable execution leave it idle. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionStart( &execution, 0U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsStartNextSuccess, "{\"execution\":1}", 0U ) );
+    TEST_ASSERT_EQUAL( JobsExecutionIdle, execution.state );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionStart( &execution, 0U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsStartNextSuccess, "{\"execution\":{\"status\":\"QUEUED\"}}", 0U ) );
+    TEST_ASSERT_EQUAL( JobsExecutionIdle, execution.state );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionStart( &execution, 0U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsStartNextSuccess,
+                                            "{\"execution\":{\"jobId\":\"job1\",\"status\":\"SUCCEEDED\"}}", 0U ) );
+    TEST_ASSERT_EQUAL( JobsExecutionIdle, execution.state );
+
+    /* Numbers that are not unsigned 32-bit integers are ignored. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionStart( &execution, 0U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsStartNextSuccess,
+                                            "{\"execution\":{\"jobId\":\"job1\",\"versionNumber\":\"2\","
+                                            "\"executionNumber\":4294967296}}", 0U ) );
+    TEST_ASSERT_EQUAL( JobsExecutionRunning, execution.state );
+    TEST_ASSERT_EQUAL( 0U, execution.versionNumber );
+    TEST_ASSERT_EQUAL( 0U, execution.executionNumber );
+
+    /* An accepted update without a version increments it. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, InProgress, 10U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateSuccess, "{\"executionState\":{\"status\":\"IN_PROGRESS\"}}", 10U ) );
+    TEST_ASSERT_EQUAL( 1U, execution.versionNumber );
+
+    /* A refusal with a state but no version takes the service's status. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, Failed, 20U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateFailed,
+                                            "{\"code\":\"VersionMismatch\",\"executionState\":{\"status\":\"IN_PROGRESS\"}}",
+                                            20U ) );
+    TEST_ASSERT_EQUAL( JobsInvalidApi, action.api );
+    TEST_ASSERT_EQUAL( JobsExecutionRunning, execution.state );
+
+    /* Only the VersionMismatch code sends the same update again. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, Failed, 30U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateFailed,
+                                            "{\"code\":\"VersionMisXatch\",\"executionState\":"
+                                            "{\"status\":\"IN_PROGRESS\",\"versionNumber\":3}}", 30U ) );
+    TEST_ASSERT_EQUAL( JobsInvalidApi, action.api );
+    TEST_ASSERT_EQUAL( 3U, execution.versionNumber );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, Failed, 40U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateFailed,
+                                            "{\"executionState\":{\"status\":\"IN_PROGRESS\",\"versionNumber\":4}}",
+                                            40U ) );
+    TEST_ASSERT_EQUAL( JobsInvalidApi, action.api );
+
+    /* A state without a status is described. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, Failed, 50U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateFailed,
+                                            "{\"code\":\"InvalidRequest\",\"executionState\":{\"versionNumber\":5}}",
+                                            50U ) );
+    TEST_ASSERT_EQUAL( JobsApiDescribe, action.api );
+
+    /* A describe without a status keeps the known one and sends the report. */
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsDescribeSuccess, "{\"execution\":{\"jobId\":\"job1\"}}", 60U ) );
+    TEST_ASSERT_EQUAL( JobsApiUpdate, action.api );
+    TEST_ASSERT_EQUAL( Failed, action.status );
+    TEST_ASSERT_EQUAL( InProgress, execution.status );
+}
+
+void test_execution_exhaustsRetriesAcrossDescribes( void )
+{
+    uint32_t i;
+
+    startJob();
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, Succeeded, 20U, &action ) );
+
+    /* Refusals without a state describe the job; the last one gives up. */
+    for( i = 0U; i <= JOBS_EXECUTION_MAX_RETRIES; i++ )
+    {
+        TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateFailed, "{\"code\":\"InternalError\"}", 30U ) );
+        TEST_ASSERT_EQUAL( JobsApiDescribe, action.api );
+        TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsDescribeSuccess,
+                                                "{\"execution\":{\"jobId\":\"job1\",\"status\":\"IN_PROGRESS\"}}",
+                                                40U ) );
+    }
+
+    TEST_ASSERT_EQUAL( JobsInvalidApi, action.api );
+    TEST_ASSERT_EQUAL( InProgress, execution.pendingStatus );
+    TEST_ASSERT_EQUAL( JOBS_EXECUTION_MAX_RETRIES + 1U, execution.retries );
+
+    /* A new report starts counting again. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionReport( &execution, Succeeded, 50U, &action ) );
+    TEST_ASSERT_EQUAL( JobsApiUpdate, action.api );
+    TEST_ASSERT_EQUAL( 0U, execution.retries );
+
+    /* A describe without the execution means the job is gone. */
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsUpdateFailed, "{\"code\":\"InternalError\"}", 60U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, handle( JobsDescribeSuccess, "{\"timestamp\":1}", 70U ) );
+    TEST_ASSERT_EQUAL( JobsApiStartNext, action.api );
+}
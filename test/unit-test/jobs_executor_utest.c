@@ -0,0 +1,323 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_executor_utest.c
+ * @brief Unit tests for the work-stealing executor.
+ *
+ * The scaling tests use POSIX threads; build with -DSANITIZE_THREAD=ON to
+ * run them under ThreadSanitizer.
+ */
+
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "unity.h"
+
+#include "jobs_executor.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+#define MAX_WORKERS        32U
+#define THING_COUNT        64U
+#define TASKS_PER_THING    200U
+#define TASK_COUNT         ( THING_COUNT * TASKS_PER_THING )
+
+static JobsWorker_t workers[ MAX_WORKERS ];
+static JobsThingTasks_t things[ THING_COUNT ];
+static JobsExecutor_t executor;
+static JobsTask_t tasks[ TASK_COUNT ];
+static size_t sequence[ TASK_COUNT ];
+
+/* Per thing state, only touched by the running task of the thing. */
+static size_t nextSequence[ THING_COUNT ];
+static size_t outOfOrder[ THING_COUNT ];
+static uint32_t running[ THING_COUNT ];
+static size_t overlapping;
+
+static uint32_t completed;
+static size_t workerCount;
+static char lastMessage[ 128 ];
+
+/**
+ * @brief Check the task is the next one of its thing and report success,
+ * or failure for every tenth task.
+ */
+static void runTask( JobsTask_t * task )
+{
+    size_t index = ( size_t ) ( task - tasks );
+    uint32_t thing = task->thingIndex;
+
+    if( __atomic_exchange_n( &running[ thing ], 1U, __ATOMIC_ACQ_REL ) != 0U )
+    {
+        __atomic_fetch_add( &overlapping, 1U, __ATOMIC_RELAXED );
+    }
+
+    if( sequence[ index ] != nextSequence[ thing ] )
+    {
+        outOfOrder[ thing ]++;
+    }
+
+    nextSequence[ thing ]++;
+
+    task->status = ( ( sequence[ index ] % 10U ) == 9U ) ? Failed : InProgress;
+    task->statusDetails = ( task->status == Failed ) ? "{\"step\":\"verify\"}" : NULL;
+    task->statusDetailsLength = ( task->status == Failed ) ? strlen( task->statusDetails ) : 0U;
+
+    __atomic_store_n( &running[ thing ], 0U, __ATOMIC_RELEASE );
+}
+
+/**
+ * @brief Count completions, and keep the last message in single worker runs.
+ */
+static void complete( JobsTask_t * task,
+                      const char * message,
+                      size_t messageLength,
+                      void * pContext )
+{
+    ( void ) task;
+    ( void ) pContext;
+
+    if( ( workerCount == 1U ) && ( messageLength < sizeof( lastMessage ) ) )
+    {
+        memcpy( lastMessage, message, messageLength );
+        lastMessage[ messageLength ] = '\0';
+    }
+
+    __atomic_fetch_add( &completed, 1U, __ATOMIC_RELAXED );
+}
+
+/**
+ * @brief Run tasks until every task completed.
+ */
+static void * work( void * arg )
+{
+    uint32_t index = ( uint32_t ) ( ( uintptr_t ) arg );
+
+    while( __atomic_load_n( &completed, __ATOMIC_RELAXED ) < TASK_COUNT )
+    {
+        ( void ) Jobs_ExecutorRun( &executor, index );
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Submit the first task to worker 0 and flag the return.
+ */
+static void * submitFirst( void * arg )
+{
+    ( void ) Jobs_ExecutorSubmit( &executor, &tasks[ 0 ], 0U );
+    __atomic_store_n( ( uint32_t * ) arg, 1U, __ATOMIC_RELEASE );
+
+    return NULL;
+}
+
+/**
+ * @brief Submit every task of every thing, interleaved across things and
+ * spread across workers, while workerCount threads run them.
+ */
+static void runAll( size_t count )
+{
+    pthread_t threads[ MAX_WORKERS ];
+    size_t i;
+
+    workerCount = count;
+    memset( nextSequence, 0, sizeof( nextSequence ) );
+    memset( outOfOrder, 0, sizeof( outOfOrder ) );
+    overlapping = 0U;
+    completed = 0U;
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutorInit( &executor, workers, count, things, THING_COUNT,
+                                                       complete, NULL ) );
+
+    for( i = 0U; i < count; i++ )
+    {
+        TEST_ASSERT_EQUAL( 0, pthread_create( &threads[ i ], NULL, work, ( void * ) ( uintptr_t ) i ) );
+    }
+
+    for( i = 0U; i < TASK_COUNT; i++ )
+    {
+        tasks[ i ].function = runTask;
+        tasks[ i ].thingIndex = ( uint32_t ) ( i % THING_COUNT );
+        sequence[ i ] = i / THING_COUNT;
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutorSubmit( &executor, &tasks[ i ], ( uint32_t ) i ) );
+    }
+
+    for( i = 0U; i < count; i++ )
+    {
+        TEST_ASSERT_EQUAL( 0, pthread_join( threads[ i ], NULL ) );
+    }
+
+    TEST_ASSERT_EQUAL( TASK_COUNT, completed );
+    TEST_ASSERT_EQUAL( 0U, overlapping );
+
+    for( i = 0U; i < THING_COUNT; i++ )
+    {
+        TEST_ASSERT_EQUAL( TASKS_PER_THING, nextSequence[ i ] );
+        TEST_ASSERT_EQUAL( 0U, outOfOrder[ i ] );
+    }
+
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_ExecutorRun( &executor, 0U ) );
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    workerCount = 1U;
+    completed = 0U;
+    memset( nextSequence, 0, sizeof( nextSequence ) );
+    memset( sequence, 0, sizeof( sequence ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutorInit( &executor, workers, 2U, things, THING_COUNT,
+                                                       complete, NULL ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_executor_rejectsBadParameters( void )
+{
+    JobsTask_t task = { 0 };
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutorInit( NULL, workers, 1U, things, 1U, complete, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutorInit( &executor, workers, 0U, things, 1U, complete, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutorInit( &executor, workers, 1U, things, 1U, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutorSubmit( &executor, &task, 0U ) );
+    task.function = runTask;
+    task.thingIndex = THING_COUNT;
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutorSubmit( &executor, &task, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_ExecutorRun( &executor, 2U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_ExecutorRun( &executor, 0U ) );
+}
+
+void test_executor_runsTasksOfThingInOrder( void )
+{
+    size_t i;
+
+    for( i = 0U; i < 10U; i++ )
+    {
+        tasks[ i ].function = runTask;
+        tasks[ i ].thingIndex = 0U;
+        sequence[ i ] = i;
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutorSubmit( &executor, &tasks[ i ], 0U ) );
+    }
+
+    /* Worker 1 has an empty queue and steals the thing from worker 0. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutorRun( &executor, 1U ) );
+    TEST_ASSERT_EQUAL_STRING( "{\"status\":\"IN_PROGRESS\"}", lastMessage );
+
+    while( Jobs_ExecutorRun( &executor, 1U ) == JobsSuccess )
+    {
+    }
+
+    TEST_ASSERT_EQUAL( 10U, completed );
+    TEST_ASSERT_EQUAL( 10U, nextSequence[ 0 ] );
+    TEST_ASSERT_EQUAL( 0U, outOfOrder[ 0 ] );
+    TEST_ASSERT_EQUAL_STRING( "{\"status\":\"FAILED\",\"statusDetails\":{\"step\":\"verify\"}}", lastMessage );
+}
+
+void test_executor_scalesFrom1To32Workers( void )
+{
+    size_t count;
+
+    for( count = 1U; count <= MAX_WORKERS; count *= 2U )
+    {
+        runAll( count );
+    }
+}
+
+void test_executor_stealsNewerHalfOfQueue( void )
+{
+    size_t i;
+
+    for( i = 0U; i < 4U; i++ )
+    {
+        tasks[ i ].function = runTask;
+        tasks[ i ].thingIndex = ( uint32_t ) i;
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutorSubmit( &executor, &tasks[ i ], 0U ) );
+    }
+
+    /* Worker 1 takes things 2 and 3, and runs thing 2. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutorRun( &executor, 1U ) );
+    TEST_ASSERT_EQUAL( 1U, nextSequence[ 2 ] );
+    TEST_ASSERT_EQUAL( 2U, workers[ 0 ].count );
+    TEST_ASSERT_EQUAL_PTR( &things[ 0 ], workers[ 0 ].pHead );
+    TEST_ASSERT_EQUAL_PTR( &things[ 1 ], workers[ 0 ].pTail );
+    TEST_ASSERT_NULL( things[ 1 ].pNext );
+    TEST_ASSERT_EQUAL( 1U, workers[ 1 ].count );
+    TEST_ASSERT_EQUAL_PTR( &things[ 3 ], workers[ 1 ].pHead );
+
+    /* The owner keeps the oldest things. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutorRun( &executor, 0U ) );
+    TEST_ASSERT_EQUAL( 1U, nextSequence[ 0 ] );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutorRun( &executor, 1U ) );
+    TEST_ASSERT_EQUAL( 1U, nextSequence[ 3 ] );
+
+    /* A queue of one thing is stolen whole. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutorRun( &executor, 1U ) );
+    TEST_ASSERT_EQUAL( 1U, nextSequence[ 1 ] );
+    TEST_ASSERT_EQUAL( 0U, workers[ 0 ].count );
+    TEST_ASSERT_NULL( workers[ 0 ].pTail );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_ExecutorRun( &executor, 1U ) );
+    TEST_ASSERT_EQUAL( 4U, completed );
+}
+
+void test_executor_backsOffWhileLockIsHeld( void )
+{
+    pthread_t thread;
+    uint32_t submitted = 0U;
+
+    tasks[ 0 ].function = runTask;
+    tasks[ 0 ].thingIndex = 0U;
+
+    /* Hold the queue lock of worker 0 past the backoff limit. */
+    __atomic_store_n( &workers[ 0 ].lock, 1U, __ATOMIC_RELEASE );
+    TEST_ASSERT_EQUAL( 0, pthread_create( &thread, NULL, submitFirst, &submitted ) );
+    ( void ) usleep( 20000U );
+    TEST_ASSERT_EQUAL( 0U, __atomic_load_n( &submitted, __ATOMIC_ACQUIRE ) );
+
+    __atomic_store_n( &workers[ 0 ].lock, 0U, __ATOMIC_RELEASE );
+    TEST_ASSERT_EQUAL( 0, pthread_join( thread, NULL ) );
+    TEST_ASSERT_EQUAL( 1U, submitted );
+    TEST_ASSERT_EQUAL( 1U, workers[ 0 ].count );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutorRun( &executor, 0U ) );
+    TEST_ASSERT_EQUAL( 1U, completed );
+}
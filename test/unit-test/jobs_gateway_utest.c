@@ -0,0 +1,323 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_gateway_utest.c
+ * @brief Unit tests for the gateway child thing table.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "unity.h"
+
+#include "jobs_gateway.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+#define THING_COUNT       50000U
+#define NAME_LENGTH       11U
+#define TIMEOUT_MS        60000U
+
+static uint32_t arena[ ( ( THING_COUNT * ( JOBS_GATEWAY_THING_SIZE + NAME_LENGTH ) ) / sizeof( uint32_t ) ) + 1U ];
+static JobsGateway_t gateway;
+static uint32_t expired[ 64 ];
+
+/**
+ * @brief Add a thing named thing-<n> zero padded to NAME_LENGTH.
+ */
+static JobsStatus_t addThing( uint32_t n,
+                              uint32_t * outIndex )
+{
+    char name[ NAME_LENGTH + 1U ];
+
+    ( void ) snprintf( name, sizeof( name ), "thing-%05u", ( unsigned ) n );
+
+    return Jobs_GatewayAdd( &gateway, name, NAME_LENGTH, outIndex );
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayInit( &gateway, arena, sizeof( arena ), THING_COUNT ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_gateway_rejectsBadParameters( void )
+{
+    uint32_t index = 0U;
+    uint32_t cursor = 0U;
+    size_t count = 0U;
+    JobCurrentStatus_t status;
+
+    TEST_ASSERT_EQUAL( 0U, Jobs_GatewayArenaSize( UINT32_MAX, SIZE_MAX ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayInit( NULL, arena, sizeof( arena ), 1U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayInit( &gateway, arena, sizeof( arena ), 0U ) );
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, Jobs_GatewayInit( &gateway, arena, JOBS_GATEWAY_THING_SIZE - 1U, 1U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayAdd( &gateway, "a/b", 3U, &index ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayAdd( &gateway, "a", 1U, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewaySetJob( &gateway, 0U, "job", 3U, InProgress, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayClearJob( &gateway, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayGetJob( &gateway, 0U, &status, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayExpired( &gateway, 0U, &cursor, expired, 0U, &count ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayFind( NULL, "a", 1U, &index ) );
+    TEST_ASSERT_FALSE( Jobs_GatewayIsJob( &gateway, 0U, "job", 3U ) );
+}
+
+void test_gateway_rejectsNullAndOutOfRangeParameters( void )
+{
+    uint32_t index = 0U;
+    uint32_t cursor = 0U;
+    size_t count = 0U;
+    const char * name = NULL;
+    uint16_t nameLength = 0U;
+    JobCurrentStatus_t status;
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayInit( &gateway, NULL, sizeof( arena ), 1U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayInit( &gateway, arena, sizeof( arena ), THING_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayAdd( NULL, "a", 1U, &index ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayAdd( &gateway, "a", 1U, &index ) );
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayFind( &gateway, NULL, 1U, &index ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayFind( &gateway, "a", 1U, NULL ) );
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayThingName( NULL, 0U, &name, &nameLength ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayThingName( &gateway, 1U, &name, &nameLength ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayThingName( &gateway, 0U, NULL, &nameLength ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayThingName( &gateway, 0U, &name, NULL ) );
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewaySetJob( NULL, 0U, "job", 3U, InProgress, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewaySetJob( &gateway, 0U, NULL, 3U, InProgress, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewaySetJob( &gateway, 0U, "job", 3U, ( JobCurrentStatus_t ) ( Rejected + 1 ), 0U ) );
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayUpdateJob( NULL, 0U, InProgress, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayUpdateJob( &gateway, 1U, InProgress, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayUpdateJob( &gateway, 0U, ( JobCurrentStatus_t ) ( Rejected + 1 ), 0U ) );
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayClearJob( NULL, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayGetJob( NULL, 0U, &status, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayGetJob( &gateway, 0U, NULL, NULL ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewaySetJob( &gateway, 0U, "job", 3U, InProgress, 0U ) );
+    TEST_ASSERT_FALSE( Jobs_GatewayIsJob( NULL, 0U, "job", 3U ) );
+    TEST_ASSERT_FALSE( Jobs_GatewayIsJob( &gateway, 0U, NULL, 3U ) );
+    TEST_ASSERT_TRUE( Jobs_GatewayIsJob( &gateway, 0U, "job", 3U ) );
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayExpired( NULL, 0U, &cursor, expired, 1U, &count ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayExpired( &gateway, 0U, NULL, expired, 1U, &count ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayExpired( &gateway, 0U, &cursor, NULL, 1U, &count ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GatewayExpired( &gateway, 0U, &cursor, expired, 1U, NULL ) );
+}
+
+void test_gateway_findsThingsThroughCollisions( void )
+{
+    uint32_t index = 0U;
+
+    /* Two things have four index slots; t2 and t6 both hash to the last
+     * one, so t6 wraps to the first. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayInit( &gateway, arena, Jobs_GatewayArenaSize( 2U, 20U ), 2U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayAdd( &gateway, "t2", 2U, &index ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayAdd( &gateway, "t6", 2U, &index ) );
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, Jobs_GatewayAdd( &gateway, "t7", 2U, &index ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayFind( &gateway, "t6", 2U, &index ) );
+    TEST_ASSERT_EQUAL( 1U, index );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayFind( &gateway, "t2", 2U, &index ) );
+    TEST_ASSERT_EQUAL( 0U, index );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_GatewayFind( &gateway, "t13", 3U, &index ) );
+
+    /* Names with equal FNV-1a hashes are told apart by their length and
+     * bytes. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayInit( &gateway, arena, Jobs_GatewayArenaSize( 2U, 20U ), 2U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayAdd( &gateway, "costarring", 10U, &index ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayAdd( &gateway, "declinate", 9U, &index ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_GatewayFind( &gateway, "liquid", 6U, &index ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_GatewayFind( &gateway, "macallums", 9U, &index ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayFind( &gateway, "declinate", 9U, &index ) );
+    TEST_ASSERT_EQUAL( 1U, index );
+}
+
+void test_gateway_storesThingsAndJobs( void )
+{
+    uint32_t index = 0U;
+    uint32_t deadline = 0U;
+    const char * name = NULL;
+    uint16_t nameLength = 0U;
+    JobCurrentStatus_t status = Queued;
+
+    /* Names that do not fit are refused. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayInit( &gateway, arena, Jobs_GatewayArenaSize( 2U, 6U ), 2U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayAdd( &gateway, "left", 4U, &index ) );
+    TEST_ASSERT_EQUAL( 0U, index );
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, Jobs_GatewayAdd( &gateway, "right", 5U, &index ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayAdd( &gateway, "up", 2U, &index ) );
+    TEST_ASSERT_EQUAL( 1U, index );
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, Jobs_GatewayAdd( &gateway, "x", 1U, &index ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayFind( &gateway, "up", 2U, &index ) );
+    TEST_ASSERT_EQUAL( 1U, index );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_GatewayFind( &gateway, "down", 4U, &index ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayThingName( &gateway, 0U, &name, &nameLength ) );
+    TEST_ASSERT_EQUAL_STRING_LEN( "left", name, nameLength );
+
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_GatewayGetJob( &gateway, 1U, &status, NULL ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_GatewayUpdateJob( &gateway, 1U, Succeeded, 0U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewaySetJob( &gateway, 1U, "job", 3U, Queued, 100U ) );
+    TEST_ASSERT_TRUE( Jobs_GatewayIsJob( &gateway, 1U, "job", 3U ) );
+    TEST_ASSERT_FALSE( Jobs_GatewayIsJob( &gateway, 1U, "job2", 4U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayUpdateJob( &gateway, 1U, InProgress, 200U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayGetJob( &gateway, 1U, &status, &deadline ) );
+    TEST_ASSERT_EQUAL( InProgress, status );
+    TEST_ASSERT_EQUAL( 200U, deadline );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayClearJob( &gateway, 1U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_GatewayClearJob( &gateway, 1U ) );
+    TEST_ASSERT_FALSE( Jobs_GatewayIsJob( &gateway, 1U, "job", 3U ) );
+}
+
+void test_gateway_resumesExpiredScan( void )
+{
+    uint32_t index = 0U;
+    uint32_t cursor = 0U;
+    size_t count = 0U;
+    uint32_t n;
+
+    for( n = 0U; n < 10U; n++ )
+    {
+        TEST_ASSERT_EQUAL( JobsSuccess, addThing( n, &index ) );
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewaySetJob( &gateway, index, "job", 3U, InProgress,
+                                                            ( ( n % 2U ) == 0U ) ? 0xFFFFFFF0U : 100U ) );
+    }
+
+    /* Even things are due across the wrap, odd things are not. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayExpired( &gateway, 10U, &cursor, expired, 3U, &count ) );
+    TEST_ASSERT_EQUAL( 3U, count );
+    TEST_ASSERT_EQUAL( 4U, expired[ 2 ] );
+    TEST_ASSERT_EQUAL( 5U, cursor );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayExpired( &gateway, 10U, &cursor, expired, 3U, &count ) );
+    TEST_ASSERT_EQUAL( 2U, count );
+    TEST_ASSERT_EQUAL( 8U, expired[ 1 ] );
+    TEST_ASSERT_EQUAL( 10U, cursor );
+}
+
+/**
+ * @brief Drive 50000 things through a job lifecycle with a fake clock:
+ * every thing gets a job, things report progress and completion at
+ * different times, and deadline sweeps time out the silent ones.
+ */
+void test_gateway_simulatedLifecycles( void )
+{
+    uint32_t index = 0U;
+    uint32_t cursor;
+    uint32_t nowMs;
+    uint32_t n;
+    size_t count;
+    size_t i;
+    size_t timedOut = 0U;
+    size_t succeeded = 0U;
+    const char * name = NULL;
+    uint16_t nameLength = 0U;
+    JobCurrentStatus_t status;
+
+    for( n = 0U; n < THING_COUNT; n++ )
+    {
+        TEST_ASSERT_EQUAL( JobsSuccess, addThing( n, &index ) );
+        TEST_ASSERT_EQUAL( n, index );
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewaySetJob( &gateway, index, "ota-7", 5U, Queued, TIMEOUT_MS ) );
+    }
+
+    for( nowMs = 1000U; nowMs <= ( 2U * TIMEOUT_MS ); nowMs += 1000U )
+    {
+        /* Each second a slice of things reports progress, and fifty
+         * seconds later completes; every tenth thing never reports. */
+        for( n = ( ( nowMs / 1000U ) - 1U ) % 50U; n < THING_COUNT; n += 50U )
+        {
+            if( ( ( n % 10U ) != 9U ) && ( nowMs <= 50000U ) )
+            {
+                TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayUpdateJob( &gateway, n, InProgress, nowMs + TIMEOUT_MS ) );
+            }
+            else if( ( ( n % 10U ) != 9U ) && ( nowMs <= 100000U ) )
+            {
+                TEST_ASSERT_TRUE( Jobs_GatewayIsJob( &gateway, n, "ota-7", 5U ) );
+                TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayGetJob( &gateway, n, &status, NULL ) );
+                TEST_ASSERT_EQUAL( InProgress, status );
+                TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayClearJob( &gateway, n ) );
+                succeeded++;
+            }
+            else
+            {
+                /* Silent, or done. */
+            }
+        }
+
+        cursor = 0U;
+
+        while( cursor < THING_COUNT )
+        {
+            TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayExpired( &gateway, nowMs, &cursor, expired,
+                                                                 sizeof( expired ) / sizeof( expired[ 0 ] ), &count ) );
+
+            for( i = 0U; i < count; i++ )
+            {
+                TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayGetJob( &gateway, expired[ i ], &status, NULL ) );
+                TEST_ASSERT_EQUAL( Queued, status );
+                TEST_ASSERT_EQUAL( 9U, expired[ i ] % 10U );
+                TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayClearJob( &gateway, expired[ i ] ) );
+                timedOut++;
+            }
+        }
+    }
+
+    for( n = 0U; n < THING_COUNT; n++ )
+    {
+        TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_GatewayGetJob( &gateway, n, &status, NULL ) );
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayThingName( &gateway, n, &name, &nameLength ) );
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayFind( &gateway, name, nameLength, &index ) );
+        TEST_ASSERT_EQUAL( n, index );
+    }
+
+    TEST_ASSERT_EQUAL( THING_COUNT / 10U, timedOut );
+    TEST_ASSERT_EQUAL( THING_COUNT - ( THING_COUNT / 10U ), succeeded );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayFind( &gateway, "thing-49999", NAME_LENGTH, &index ) );
+    TEST_ASSERT_EQUAL( 49999U, index );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GatewayThingName( &gateway, 12345U, &name, &nameLength ) );
+    TEST_ASSERT_EQUAL_STRING_LEN( "thing-12345", name, nameLength );
+}
@@ -0,0 +1,225 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_ingress_utest.c
+ * @brief Unit tests for the jobs ingress ring.
+ *
+ * The stress tests use POSIX threads; build with -DSANITIZE_THREAD=ON to
+ * run them under ThreadSanitizer.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+
+#include "unity.h"
+
+#include "jobs_ingress.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+#define THING_NAME            "thing"
+#define THING_NAME_LENGTH     ( sizeof( THING_NAME ) - 1U )
+#define UPDATE_TOPIC          "$aws/things/" THING_NAME "/jobs/job-1/update/accepted"
+#define NEXT_TOPIC            "$aws/things/" THING_NAME "/jobs/notify-next"
+
+#define SLOT_COUNT            8U
+#define PRODUCER_COUNT        4U
+#define ITEMS_PER_PRODUCER    100000U
+
+static JobsIngressSlot_t slots[ SLOT_COUNT ];
+static JobsIngressQueue_t queue;
+
+/**
+ * @brief Push a topic with a payload length as the payload tag.
+ */
+static JobsStatus_t push( const char * topic,
+                          size_t tag )
+{
+    char buffer[ 128 ];
+
+    ( void ) strncpy( buffer, topic, sizeof( buffer ) );
+
+    return Jobs_IngressPush( &queue, buffer, strlen( topic ), THING_NAME, THING_NAME_LENGTH, NULL, tag );
+}
+
+/**
+ * @brief Push ITEMS_PER_PRODUCER descriptors tagged with the producer
+ * number in the high byte and a sequence number in the low bytes.
+ */
+static void * produce( void * arg )
+{
+    size_t producer = ( size_t ) ( ( uintptr_t ) arg );
+    size_t i;
+
+    for( i = 0U; i < ITEMS_PER_PRODUCER; i++ )
+    {
+        while( push( UPDATE_TOPIC, ( producer << 24 ) | i ) == JobsBufferTooSmall )
+        {
+            ( void ) sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Run producers against one consumer, and check every descriptor
+ * arrives once and in order per producer.
+ */
+static void stress( size_t producerCount )
+{
+    pthread_t threads[ PRODUCER_COUNT ];
+    size_t next[ PRODUCER_COUNT ] = { 0 };
+    size_t received = 0U;
+    size_t errors = 0U;
+    size_t producer;
+    JobsIngressItem_t item;
+    size_t i;
+
+    for( i = 0U; i < producerCount; i++ )
+    {
+        TEST_ASSERT_EQUAL( 0, pthread_create( &threads[ i ], NULL, produce, ( void * ) ( uintptr_t ) i ) );
+    }
+
+    while( received < ( producerCount * ITEMS_PER_PRODUCER ) )
+    {
+        if( Jobs_IngressPop( &queue, &item ) == JobsSuccess )
+        {
+            producer = item.payloadLength >> 24;
+
+            if( ( producer >= producerCount ) || ( ( item.payloadLength & 0xFFFFFFU ) != next[ producer ] ) ||
+                ( item.topic != JobsUpdateSuccess ) || ( item.jobIdLength != 5U ) ||
+                ( memcmp( item.jobId, "job-1", 5U ) != 0 ) )
+            {
+                errors++;
+            }
+            else
+            {
+                next[ producer ]++;
+            }
+
+            received++;
+        }
+        else
+        {
+            ( void ) sched_yield();
+        }
+    }
+
+    for( i = 0U; i < producerCount; i++ )
+    {
+        TEST_ASSERT_EQUAL( 0, pthread_join( threads[ i ], NULL ) );
+        TEST_ASSERT_EQUAL( ITEMS_PER_PRODUCER, next[ i ] );
+    }
+
+    TEST_ASSERT_EQUAL( 0U, errors );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_IngressPop( &queue, &item ) );
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_IngressInit( &queue, slots, SLOT_COUNT, false ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_ingress_rejectsBadParameters( void )
+{
+    JobsIngressItem_t item;
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_IngressInit( NULL, slots, SLOT_COUNT, false ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_IngressInit( &queue, slots, 1U, false ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_IngressInit( &queue, slots, 6U, false ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_IngressPush( NULL, NULL, 0U, THING_NAME, THING_NAME_LENGTH, NULL, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_IngressPop( &queue, NULL ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_IngressPop( &queue, &item ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, push( "$aws/things/other/jobs/notify-next", 0U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, push( "sensors/temperature", 0U ) );
+}
+
+void test_ingress_pushesClassifiedDescriptors( void )
+{
+    JobsIngressItem_t item;
+    size_t i;
+
+    TEST_ASSERT_EQUAL( JobsSuccess, push( UPDATE_TOPIC, 10U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, push( NEXT_TOPIC, 11U ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_IngressPop( &queue, &item ) );
+    TEST_ASSERT_EQUAL( JobsUpdateSuccess, item.topic );
+    TEST_ASSERT_EQUAL_STRING_LEN( "job-1", item.jobId, item.jobIdLength );
+    TEST_ASSERT_EQUAL( 10U, item.payloadLength );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_IngressPop( &queue, &item ) );
+    TEST_ASSERT_EQUAL( JobsNextJobChanged, item.topic );
+    TEST_ASSERT_EQUAL( 0U, item.jobIdLength );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_IngressPop( &queue, &item ) );
+
+    /* Fill the ring across the wrap of the slot index. */
+    for( i = 0U; i < SLOT_COUNT; i++ )
+    {
+        TEST_ASSERT_EQUAL( JobsSuccess, push( NEXT_TOPIC, i ) );
+    }
+
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, push( NEXT_TOPIC, 0U ) );
+
+    for( i = 0U; i < SLOT_COUNT; i++ )
+    {
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_IngressPop( &queue, &item ) );
+        TEST_ASSERT_EQUAL( i, item.payloadLength );
+    }
+
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_IngressPop( &queue, &item ) );
+}
+
+void test_ingress_singleProducerStress( void )
+{
+    stress( 1U );
+}
+
+void test_ingress_multiProducerStress( void )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_IngressInit( &queue, slots, SLOT_COUNT, true ) );
+    stress( PRODUCER_COUNT );
+}
@@ -0,0 +1,386 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_journal_utest.c
+ * @brief Unit tests for the job execution state journal.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "unity.h"
+
+#include "jobs_journal.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+#define ENTRY_COUNT     3U
+#define SEGMENT_SIZE    ( ( ENTRY_COUNT + 3U ) * JOBS_JOURNAL_RECORD_SIZE )
+#define STEP_COUNT      40U
+#define NO_CUT          SIZE_MAX
+
+/**
+ * @brief A file-backed store that loses power after a number of bytes.
+ */
+typedef struct
+{
+    FILE * file;
+    size_t budget;
+    bool powerLost;
+} FileStore_t;
+
+static FileStore_t fileStore;
+static JobsJournalStore_t store;
+static JobsJournal_t journal;
+static JobsJournalEntry_t entries[ ENTRY_COUNT ];
+static JobsJournalEntry_t expected[ ENTRY_COUNT ];
+static char jobIds[ ENTRY_COUNT ][ 8 ];
+
+static size_t fileRead( void * pContext,
+                        size_t offset,
+                        uint8_t * buffer,
+                        size_t length )
+{
+    FileStore_t * pStore = pContext;
+
+    ( void ) fseek( pStore->file, ( long ) offset, SEEK_SET );
+
+    return fread( buffer, 1U, length, pStore->file );
+}
+
+/**
+ * @brief Write through to the file, tearing the write that exhausts the
+ * budget and failing every write after it.
+ */
+static size_t fileWrite( void * pContext,
+                         size_t offset,
+                         const uint8_t * buffer,
+                         size_t length )
+{
+    FileStore_t * pStore = pContext;
+    size_t written = 0U;
+
+    if( pStore->powerLost == false )
+    {
+        written = ( length < pStore->budget ) ? length : pStore->budget;
+        pStore->budget -= ( pStore->budget == NO_CUT ) ? 0U : written;
+        pStore->powerLost = ( written < length ) ? true : false;
+        ( void ) fseek( pStore->file, ( long ) offset, SEEK_SET );
+        written = fwrite( buffer, 1U, written, pStore->file );
+        ( void ) fflush( pStore->file );
+    }
+
+    return written;
+}
+
+/**
+ * @brief Power up: initialize and restore a journal over the file.
+ */
+static JobsStatus_t reboot( size_t budget )
+{
+    fileStore.budget = budget;
+    fileStore.powerLost = false;
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_JournalInit( &journal, &store, SEGMENT_SIZE, entries, ENTRY_COUNT ) );
+
+    return Jobs_JournalRestore( &journal );
+}
+
+/**
+ * @brief Journal one scripted change to the jobs.
+ */
+static JobsStatus_t step( size_t n )
+{
+    static char document[ 32 ];
+    JobsJournalUpdate_t update = { 0 };
+
+    update.jobId = jobIds[ n % ENTRY_COUNT ];
+    update.jobIdLength = ( uint16_t ) strlen( update.jobId );
+    update.status = ( ( n % 7U ) == 6U ) ? Succeeded : InProgress;
+    update.versionNumber = ( uint32_t ) n + 1U;
+    update.progress = ( uint32_t ) n * 1000U;
+
+    if( ( n % 4U ) == 0U )
+    {
+        update.documentLength = ( size_t ) snprintf( document, sizeof( document ), "{\"step\":%u}", ( unsigned ) n );
+        update.document = document;
+    }
+
+    return Jobs_JournalRecord( &journal, &update );
+}
+
+/**
+ * @brief Check the live jobs match the expected ones, in any order.
+ */
+static void assertRestored( void )
+{
+    const JobsJournalEntry_t * entry;
+    size_t i;
+    size_t j;
+    size_t live = 0U;
+    size_t found;
+
+    for( i = 0U; i < ENTRY_COUNT; i++ )
+    {
+        if( Jobs_JournalEntry( &journal, i, &entry ) == JobsSuccess )
+        {
+            live++;
+        }
+
+        if( expected[ i ].inUse == true )
+        {
+            found = 0U;
+
+            for( j = 0U; j < ENTRY_COUNT; j++ )
+            {
+                entry = &entries[ j ];
+
+                if( ( entry->inUse == true ) && ( entry->jobIdLength == expected[ i ].jobIdLength ) &&
+                    ( memcmp( entry->jobId, expected[ i ].jobId, entry->jobIdLength ) == 0 ) )
+                {
+                    TEST_ASSERT_EQUAL( expected[ i ].status, entry->status );
+                    TEST_ASSERT_EQUAL( expected[ i ].versionNumber, entry->versionNumber );
+                    TEST_ASSERT_EQUAL( expected[ i ].progress, entry->progress );
+                    TEST_ASSERT_EQUAL( expected[ i ].documentLength, entry->documentLength );
+                    TEST_ASSERT_EQUAL_MEMORY( expected[ i ].document, entry->document, entry->documentLength );
+                    found++;
+                }
+            }
+
+            TEST_ASSERT_EQUAL( 1U, found );
+            live--;
+        }
+    }
+
+    TEST_ASSERT_EQUAL( 0U, live );
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    size_t i;
+
+    for( i = 0U; i < ENTRY_COUNT; i++ )
+    {
+        ( void ) snprintf( jobIds[ i ], sizeof( jobIds[ i ] ), "job-%u", ( unsigned ) i );
+    }
+
+    fileStore.file = tmpfile();
+    TEST_ASSERT_NOT_NULL( fileStore.file );
+    store.read = fileRead;
+    store.write = fileWrite;
+    store.pContext = &fileStore;
+    memset( expected, 0, sizeof( expected ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+    ( void ) fclose( fileStore.file );
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_journal_rejectsBadParameters( void )
+{
+    JobsJournalUpdate_t update = { 0 };
+    const JobsJournalEntry_t * entry;
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_JournalInit( NULL, &store, SEGMENT_SIZE, entries, ENTRY_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_JournalInit( &journal, NULL, SEGMENT_SIZE, entries, ENTRY_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_JournalInit( &journal, &store, SEGMENT_SIZE, NULL, ENTRY_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_JournalInit( &journal, &store, SEGMENT_SIZE, entries, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_JournalInit( &journal, &store,
+                                                           ( ENTRY_COUNT + 1U ) * JOBS_JOURNAL_RECORD_SIZE,
+                                                           entries, ENTRY_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_JournalRestore( NULL ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, reboot( NO_CUT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_JournalRecord( &journal, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_JournalRecord( &journal, &update ) );
+    update.jobId = "job-0";
+    update.jobIdLength = 5U;
+    update.documentLength = 1U;
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_JournalRecord( &journal, &update ) );
+    update.document = "{}";
+    update.documentLength = JOBS_JOURNAL_DOCUMENT_MAX_LENGTH + 1U;
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_JournalRecord( &journal, &update ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_JournalCompact( NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_JournalEntry( &journal, ENTRY_COUNT, &entry ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_JournalEntry( &journal, 0U, NULL ) );
+}
+
+void test_journal_restoresAfterRestart( void )
+{
+    JobsJournalUpdate_t update = { 0 };
+    const JobsJournalEntry_t * entry;
+    size_t offset;
+
+    /* Empty storage is formatted. */
+    TEST_ASSERT_EQUAL( JobsSuccess, reboot( NO_CUT ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_JournalEntry( &journal, 0U, &entry ) );
+
+    update.jobId = "job-0";
+    update.jobIdLength = 5U;
+    update.status = InProgress;
+    update.versionNumber = 2U;
+    update.progress = 4096U;
+    update.document = "{\"url\":\"x\"}";
+    update.documentLength = strlen( update.document );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_JournalRecord( &journal, &update ) );
+
+    /* A NULL document keeps the journaled one. */
+    update.document = NULL;
+    update.documentLength = 0U;
+    update.versionNumber = 3U;
+    update.progress = 8192U;
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_JournalRecord( &journal, &update ) );
+
+    update.jobId = "job-1";
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_JournalRecord( &journal, &update ) );
+    update.status = Failed;
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_JournalRecord( &journal, &update ) );
+
+    /* Ending a job that is not live writes nothing. */
+    offset = journal.appendOffset;
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_JournalRecord( &journal, &update ) );
+    TEST_ASSERT_EQUAL( offset, journal.appendOffset );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, reboot( NO_CUT ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_JournalEntry( &journal, 0U, &entry ) );
+    TEST_ASSERT_EQUAL_MEMORY( "job-0", entry->jobId, 5U );
+    TEST_ASSERT_EQUAL( InProgress, entry->status );
+    TEST_ASSERT_EQUAL( 3U, entry->versionNumber );
+    TEST_ASSERT_EQUAL( 8192U, entry->progress );
+    TEST_ASSERT_EQUAL( strlen( "{\"url\":\"x\"}" ), entry->documentLength );
+    TEST_ASSERT_EQUAL_MEMORY( "{\"url\":\"x\"}", entry->document, entry->documentLength );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_JournalEntry( &journal, 1U, &entry ) );
+}
+
+void test_journal_compactsAndLimitsJobs( void )
+{
+    JobsJournalUpdate_t update = { 0 };
+    size_t i;
+
+    TEST_ASSERT_EQUAL( JobsSuccess, reboot( NO_CUT ) );
+
+    /* Many more records than a segment holds. */
+    for( i = 0U; i < STEP_COUNT; i++ )
+    {
+        TEST_ASSERT_EQUAL( JobsSuccess, step( i ) );
+    }
+
+    memcpy( expected, entries, sizeof( expected ) );
+    TEST_ASSERT_GREATER_THAN( 2U, journal.generation );
+    TEST_ASSERT_EQUAL( JobsSuccess, reboot( NO_CUT ) );
+    assertRestored();
+
+    /* Fill every entry, then a new job does not fit. */
+    for( i = 0U; i < ENTRY_COUNT; i++ )
+    {
+        update.jobId = jobIds[ i ];
+        update.jobIdLength = 5U;
+        update.status = Queued;
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_JournalRecord( &journal, &update ) );
+    }
+
+    update.jobId = "job-9";
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, Jobs_JournalRecord( &journal, &update ) );
+
+    /* Restoring into fewer entries drops the extra jobs. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_JournalInit( &journal, &store, SEGMENT_SIZE, entries, ENTRY_COUNT - 1U ) );
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, Jobs_JournalRestore( &journal ) );
+}
+
+/**
+ * @brief Cut the power at every point of a scripted run, including in
+ * the middle of compactions, and check that a restart restores the state
+ * of the last change that was reported durable, and that the journal
+ * keeps working after it.
+ */
+void test_journal_survivesPowerCuts( void )
+{
+    size_t cut;
+    size_t i;
+    size_t total = 0U;
+
+    /* Cut after every 37 bytes written until the run completes, so every
+     * field of a record is torn somewhere. */
+    for( cut = 0U; ; cut += 37U )
+    {
+        ( void ) fclose( fileStore.file );
+        fileStore.file = tmpfile();
+        TEST_ASSERT_NOT_NULL( fileStore.file );
+        memset( expected, 0, sizeof( expected ) );
+
+        if( reboot( cut ) == JobsSuccess )
+        {
+            for( i = 0U; i < STEP_COUNT; i++ )
+            {
+                if( step( i ) != JobsSuccess )
+                {
+                    break;
+                }
+
+                memcpy( expected, entries, sizeof( expected ) );
+            }
+
+            if( i == STEP_COUNT )
+            {
+                break;
+            }
+        }
+
+        TEST_ASSERT_TRUE( fileStore.powerLost );
+
+        TEST_ASSERT_EQUAL( JobsSuccess, reboot( NO_CUT ) );
+        assertRestored();
+
+        /* The journal keeps working after the restart. */
+        for( i = 0U; i < STEP_COUNT; i++ )
+        {
+            TEST_ASSERT_EQUAL( JobsSuccess, step( i ) );
+        }
+
+        memcpy( expected, entries, sizeof( expected ) );
+        TEST_ASSERT_EQUAL( JobsSuccess, reboot( NO_CUT ) );
+        assertRestored();
+        total++;
+    }
+
+    TEST_ASSERT_GREATER_THAN( 100U, total );
+}
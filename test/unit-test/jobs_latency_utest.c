@@ -0,0 +1,267 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_latency_utest.c
+ * @brief Unit tests for the job lifecycle latency histograms.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "unity.h"
+
+#include "jobs_latency.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+static JobsLatency_t latency;
+
+/**
+ * @brief Feed a message naming a job in its execution object.
+ */
+static JobsStatus_t executionMessage( JobsTopic_t topic,
+                                      const char * jobId,
+                                      uint32_t nowMs )
+{
+    char message[ 96 ];
+    int length = snprintf( message, sizeof( message ),
+                           "{\"timestamp\":1,\"execution\":{\"jobId\":\"%s\",\"status\":\"QUEUED\"}}", jobId );
+
+    return Jobs_LatencyHandle( &latency, topic, NULL, 0U, message, ( size_t ) length, nowMs );
+}
+
+/**
+ * @brief Feed an accepted UpdateJobExecution response.
+ */
+static JobsStatus_t updateAccepted( const char * jobId,
+                                    uint32_t nowMs )
+{
+    const char * message = "{\"timestamp\":1}";
+
+    return Jobs_LatencyHandle( &latency, JobsUpdateSuccess, jobId, ( uint16_t ) strlen( jobId ),
+                               message, strlen( message ), nowMs );
+}
+
+/**
+ * @brief Build an update of a job.
+ */
+static JobsStatus_t updateBuilt( const char * jobId,
+                                 JobCurrentStatus_t status,
+                                 uint32_t nowMs )
+{
+    return Jobs_LatencyUpdateBuilt( &latency, jobId, strlen( jobId ), status, nowMs );
+}
+
+/**
+ * @brief Check the serialized histograms.
+ */
+static void assertSerialized( const char * expected )
+{
+    char buffer[ 256 ];
+    size_t length = 0U;
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_LatencySerialize( &latency, buffer, sizeof( buffer ), &length ) );
+    TEST_ASSERT_EQUAL( strlen( expected ), length );
+    TEST_ASSERT_EQUAL_STRING_LEN( expected, buffer, length );
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_LatencyInit( &latency ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_latency_recordsEveryPhase( void )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, executionMessage( JobsNextJobChanged, "job1", 1000U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, executionMessage( JobsStartNextSuccess, "job1", 1100U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, updateBuilt( "job1", InProgress, 1150U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, updateAccepted( "job1", 1170U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, updateBuilt( "job1", Succeeded, 1400U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, updateAccepted( "job1", 1430U ) );
+
+    /* 100 ms is in bucket 22, from 96 to 111 ms. */
+    TEST_ASSERT_EQUAL( 111U, Jobs_LatencyPercentile( &latency, JobsLatencyQueued, 50U ) );
+    TEST_ASSERT_EQUAL( 55U, Jobs_LatencyPercentile( &latency, JobsLatencyFirstUpdate, 50U ) );
+    TEST_ASSERT_EQUAL( 255U, Jobs_LatencyPercentile( &latency, JobsLatencyUpdateInterval, 50U ) );
+    TEST_ASSERT_EQUAL( 23U, Jobs_LatencyPercentile( &latency, JobsLatencyUpdateAck, 50U ) );
+    TEST_ASSERT_EQUAL( 31U, Jobs_LatencyPercentile( &latency, JobsLatencyUpdateAck, 100U ) );
+    TEST_ASSERT_EQUAL( 383U, Jobs_LatencyPercentile( &latency, JobsLatencyRunning, 50U ) );
+    TEST_ASSERT_EQUAL( 447U, Jobs_LatencyPercentile( &latency, JobsLatencyTotal, 50U ) );
+
+    assertSerialized( "{\"queued\":\"22:1\",\"firstUpdate\":\"18:1\",\"updateInterval\":\"27:1\","
+                      "\"updateAck\":\"13:1,15:1\",\"running\":\"29:1\",\"total\":\"30:1\"}" );
+
+    /* The job is over. */
+    TEST_ASSERT_EQUAL( JobsNoMatch, updateBuilt( "job1", Succeeded, 1500U ) );
+}
+
+void test_latency_ignoresRepeatsAndOtherJobs( void )
+{
+    TEST_ASSERT_EQUAL( JobsNoMatch, updateBuilt( "job1", InProgress, 0U ) );
+
+    /* A job started without a notification has no Queued or Total. */
+    TEST_ASSERT_EQUAL( JobsSuccess, executionMessage( JobsStartNextSuccess, "job1", 0U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, executionMessage( JobsStartNextSuccess, "job1", 5U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, executionMessage( JobsNextJobChanged, "job1", 5U ) );
+
+    /* The next job is notified once; an empty notification forgets it. */
+    TEST_ASSERT_EQUAL( JobsSuccess, executionMessage( JobsNextJobChanged, "job2", 10U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, executionMessage( JobsNextJobChanged, "job2", 20U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_LatencyHandle( &latency, JobsNextJobChanged, NULL, 0U, "{\"timestamp\":1}", 15U, 30U ) );
+
+    TEST_ASSERT_EQUAL( JobsNoMatch, updateBuilt( "job2", InProgress, 40U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, updateAccepted( "job1", 40U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, updateBuilt( "job1", Failed, 50U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, updateAccepted( "job2", 60U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_LatencyHandle( &latency, JobsUpdateSuccess, NULL, 0U, "{}", 2U, 60U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_LatencyHandle( &latency, JobsDescribeSuccess, "job1", 4U, "{}", 2U, 60U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, updateAccepted( "job1", 70U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, updateAccepted( "job1", 80U ) );
+
+    /* job2 starts without its notification. */
+    TEST_ASSERT_EQUAL( JobsSuccess, executionMessage( JobsStartNextSuccess, "job2", 90U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_LatencyHandle( &latency, JobsStartNextSuccess, NULL, 0U, "{\"timestamp\":1}", 15U, 90U ) );
+
+    assertSerialized( "{\"firstUpdate\":\"18:1\",\"updateAck\":\"13:1\",\"running\":\"20:1\"}" );
+}
+
+void test_latency_tellsCollidingJobIdsApart( void )
+{
+    /* "costarring" and "liquid" share an FNV-1a hash, as do "declinate"
+     * and "macallums". */
+    TEST_ASSERT_EQUAL( JobsSuccess, executionMessage( JobsNextJobChanged, "costarring", 0U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, executionMessage( JobsStartNextSuccess, "liquid", 10U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, executionMessage( JobsStartNextSuccess, "declinate", 30U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, updateBuilt( "macallums", InProgress, 40U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, updateBuilt( "declinate", InProgress, 50U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, updateAccepted( "macallums", 60U ) );
+
+    assertSerialized( "{\"firstUpdate\":\"13:1\"}" );
+}
+
+void test_latency_ignoresJobIdsTooLongToStore( void )
+{
+    static const char tooLong[] = "{\"execution\":{\"jobId\":\""
+                                  "0123456789012345678901234567890123456789012345678901234567890123x\"}}";
+
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_LatencyHandle( &latency, JobsNextJobChanged, NULL, 0U,
+                                                        tooLong, sizeof( tooLong ) - 1U, 0U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_LatencyHandle( &latency, JobsStartNextSuccess, NULL, 0U,
+                                                        tooLong, sizeof( tooLong ) - 1U, 10U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, updateBuilt( "job1", InProgress, 20U ) );
+}
+
+void test_latency_bucketsCoverEveryDuration( void )
+{
+    static const uint32_t durations[] = { 0U, 1U, 3U, 4U, 7U, 8U, 9U, 10U, 1000U, 0xFFFFFFFFU };
+    static const uint32_t upper[] = { 0U, 1U, 3U, 4U, 7U, 9U, 9U, 11U, 1023U, 0xFFFFFFFFU };
+    char jobId[ 8 ];
+    size_t i;
+
+    for( i = 0U; i < ( sizeof( durations ) / sizeof( durations[ 0 ] ) ); i++ )
+    {
+        ( void ) snprintf( jobId, sizeof( jobId ), "job%u", ( unsigned ) i );
+        TEST_ASSERT_EQUAL( JobsSuccess, executionMessage( JobsStartNextSuccess, jobId, 5U ) );
+        TEST_ASSERT_EQUAL( JobsSuccess, updateBuilt( jobId, InProgress, 5U + durations[ i ] ) );
+        TEST_ASSERT_EQUAL( upper[ i ], Jobs_LatencyPercentile( &latency, JobsLatencyFirstUpdate, 100U ) );
+    }
+
+    TEST_ASSERT_EQUAL( 0U, Jobs_LatencyPercentile( &latency, JobsLatencyFirstUpdate, 1U ) );
+    TEST_ASSERT_EQUAL( 7U, Jobs_LatencyPercentile( &latency, JobsLatencyFirstUpdate, 50U ) );
+
+    /* Counts saturate. */
+    latency.phases[ JobsLatencyUpdateInterval ].counts[ 0 ] = UINT16_MAX;
+    TEST_ASSERT_EQUAL( JobsSuccess, updateBuilt( jobId, InProgress, 5U + durations[ i - 1U ] ) );
+    TEST_ASSERT_EQUAL( UINT16_MAX, latency.phases[ JobsLatencyUpdateInterval ].counts[ 0 ] );
+
+    /* Clearing keeps the current job. */
+    Jobs_LatencyClear( &latency );
+    Jobs_LatencyClear( NULL );
+    assertSerialized( "{}" );
+    TEST_ASSERT_EQUAL( JobsSuccess, updateBuilt( jobId, InProgress, 6U + durations[ i - 1U ] ) );
+    assertSerialized( "{\"updateInterval\":\"1:1\"}" );
+}
+
+void test_latency_serializeReportsTheLengthNeeded( void )
+{
+    char buffer[ 64 ];
+    size_t length = 0U;
+
+    TEST_ASSERT_EQUAL( JobsSuccess, executionMessage( JobsNextJobChanged, "job1", 0U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, executionMessage( JobsStartNextSuccess, "job1", 100U ) );
+
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, Jobs_LatencySerialize( &latency, buffer, 10U, &length ) );
+    TEST_ASSERT_EQUAL( 17U, length );
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, Jobs_LatencySerialize( &latency, buffer, 16U, &length ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_LatencySerialize( &latency, buffer, 17U, &length ) );
+    TEST_ASSERT_EQUAL_STRING_LEN( "{\"queued\":\"22:1\"}", buffer, length );
+}
+
+void test_latency_invalidParameters( void )
+{
+    char buffer[ 8 ];
+    size_t length;
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LatencyInit( NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LatencyHandle( NULL, JobsNextJobChanged, NULL, 0U, "{}", 2U, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LatencyHandle( &latency, JobsNextJobChanged, NULL, 0U, NULL, 2U, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LatencyHandle( &latency, JobsNextJobChanged, NULL, 0U, "{}", 0U, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LatencyUpdateBuilt( NULL, "job1", 4U, InProgress, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LatencyUpdateBuilt( &latency, NULL, 4U, InProgress, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LatencyUpdateBuilt( &latency, "job1", 0U, InProgress, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LatencyUpdateBuilt( &latency, "job1", 4U, ( JobCurrentStatus_t ) -1, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LatencyUpdateBuilt( &latency, "job1", 4U, ( JobCurrentStatus_t ) ( Rejected + 1 ), 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LatencySerialize( NULL, buffer, sizeof( buffer ), &length ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LatencySerialize( &latency, NULL, sizeof( buffer ), &length ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LatencySerialize( &latency, buffer, sizeof( buffer ), NULL ) );
+
+    TEST_ASSERT_EQUAL( 0U, Jobs_LatencyPercentile( NULL, JobsLatencyQueued, 50U ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_LatencyPercentile( &latency, JobsLatencyMaxPhase, 50U ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_LatencyPercentile( &latency, ( JobsLatencyPhase_t ) -1, 50U ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_LatencyPercentile( &latency, JobsLatencyQueued, 0U ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_LatencyPercentile( &latency, JobsLatencyQueued, 101U ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_LatencyPercentile( &latency, JobsLatencyQueued, 50U ) );
+}
@@ -0,0 +1,348 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_log_utest.c
+ * @brief Unit tests for the binary log, built with JOBS_LOG_LEVEL set to
+ * JOBS_LOG_LEVEL_DEBUG.
+ *
+ * The concurrent writer test uses POSIX threads; build with
+ * -DSANITIZE_THREAD=ON to run it under ThreadSanitizer.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+
+#include "unity.h"
+
+#include "core_json.h"
+#include "jobs.h"
+#include "jobs_internal.h"
+#include "jobs_log.h"
+#include "ota_job_processor.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+#define SLOT_COUNT            16U
+#define WRITER_COUNT          4U
+#define RECORDS_PER_WRITER    100000U
+
+#define OTA_DOCUMENT_NO_CERT                                                        \
+    "{\"afr_ota\":{\"protocols\":[\"MQTT\"],\"streamname\":\"stream\",\"files\":[{" \
+    "\"filepath\":\"/image.bin\",\"filesize\":1024,\"fileid\":0,"                  \
+    "\"sig-sha256-ecdsa\":\"c2ln\"}]}}"
+
+static JobsLogSlot_t slots[ SLOT_COUNT ];
+static JobsLogRing_t ring;
+
+/**
+ * @brief Read the next record and check its message and arguments.
+ */
+static void assertRecord( JobsLogId_t id,
+                          uint32_t level,
+                          uint32_t arg0,
+                          uint32_t arg1 )
+{
+    JobsLogRecord_t record;
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_LogRead( &record ) );
+    TEST_ASSERT_EQUAL( id, record.id );
+    TEST_ASSERT_EQUAL( level, record.level );
+    TEST_ASSERT_EQUAL( arg0, record.args[ 0 ] );
+    TEST_ASSERT_EQUAL( arg1, record.args[ 1 ] );
+}
+
+/**
+ * @brief Write RECORDS_PER_WRITER records tagged with the writer number
+ * and a sequence number.
+ */
+static void * writeRecords( void * arg )
+{
+    uint32_t writer = ( uint32_t ) ( ( uintptr_t ) arg );
+    uint32_t i;
+
+    for( i = 0U; i < RECORDS_PER_WRITER; i++ )
+    {
+        Jobs_LogWrite( JOBS_LOG_LEVEL_INFO, JobsLogOtaParsed, writer, i );
+    }
+
+    return NULL;
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_LogInit( &ring, slots, SLOT_COUNT ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_LogInit( NULL, NULL, 0U ) );
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_log_rejectsBadParameters( void )
+{
+    JobsLogRecord_t record;
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LogInit( &ring, NULL, SLOT_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LogInit( &ring, slots, 1U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LogInit( &ring, slots, 12U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LogInit( &ring, slots, ( size_t ) 0x100000000U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LogRead( NULL ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_LogRead( &record ) );
+
+    /* Without a ring nothing is written. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_LogInit( NULL, NULL, 0U ) );
+    Jobs_LogWrite( JOBS_LOG_LEVEL_ERROR, JobsLogGetTopic, 1U, 2U );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_LogRead( &record ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_LogDropped() );
+}
+
+void test_log_recordsFailuresOfTopicFunctions( void )
+{
+    char topic[] = "$aws/things/thing/shadow/update";
+    char buffer[ 64 ];
+    char small[ 20 ];
+    JobsTopic_t api;
+    uint32_t value;
+    JobCurrentStatus_t status;
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_GetTopic( buffer, sizeof( buffer ), "thing", 5U, JobsMaxTopic, NULL ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_MatchTopic( topic, strlen( topic ), "thing", 5U, &api, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, Jobs_StartNext( small, sizeof( small ), "thing", 5U, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_Update( buffer, sizeof( buffer ), "thing", 5U, NULL, 0U, NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GetPending( buffer, sizeof( buffer ), "thing", 5U, NULL ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_StringToUint( "12a", 3U, &value ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_StatusFromString( "DONE", 4U, &status ) );
+    TEST_ASSERT_FALSE( Jobs_IsStartNextAccepted( topic, strlen( topic ), "thing", 5U ) );
+    TEST_ASSERT_FALSE( Jobs_IsJobUpdateStatus( topic, strlen( topic ), "job", 3U, "thing", 5U, JobUpdateStatus_Rejected ) );
+
+    assertRecord( JobsLogGetTopic, JOBS_LOG_LEVEL_ERROR, JobsBadParameter, JobsMaxTopic );
+    assertRecord( JobsLogMatchTopic, JOBS_LOG_LEVEL_DEBUG, JobsNoMatch, strlen( topic ) );
+    assertRecord( JobsLogStartNext, JOBS_LOG_LEVEL_WARN, JobsBufferTooSmall, 5U );
+    assertRecord( JobsLogUpdate, JOBS_LOG_LEVEL_ERROR, JobsBadParameter, 0U );
+    assertRecord( JobsLogStringToUint, JOBS_LOG_LEVEL_DEBUG, JobsNoMatch, 3U );
+    assertRecord( JobsLogStatusFromString, JOBS_LOG_LEVEL_DEBUG, JobsNoMatch, 4U );
+    assertRecord( JobsLogIsStartNextAccepted, JOBS_LOG_LEVEL_DEBUG, strlen( topic ), 0U );
+    assertRecord( JobsLogIsJobUpdateStatus, JOBS_LOG_LEVEL_DEBUG, strlen( topic ), JobUpdateStatus_Rejected );
+
+    /* Success is not logged. */
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_LogRead( &( JobsLogRecord_t ) { 0 } ) );
+
+    /* Nor are unknown statuses. */
+    Jobs_LogStatus( JobsLogGetTopic, ( JobsStatus_t ) 42, 0U );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_LogRead( &( JobsLogRecord_t ) { 0 } ) );
+    Jobs_LogStatus( JobsLogGetTopic, JobsError, 0U );
+    assertRecord( JobsLogGetTopic, JOBS_LOG_LEVEL_ERROR, JobsError, 0U );
+}
+
+void test_log_recordsFailuresOfMessageFunctions( void )
+{
+    char buffer[ 128 ];
+    const char * value = NULL;
+    JobsUpdateRequest_t update = { Succeeded, NULL, 0U, "{\"a\"", 4U };
+    JobsStartNextRequest_t startNext = { 0 };
+    JobsDescribeRequest_t describe = { 0 };
+    JobsGetPendingRequest_t getPending = { 0 };
+
+    TEST_ASSERT_EQUAL( 0U, Jobs_StartNextMsg( "token", 5U, buffer, 10U ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_UpdateMsg( update, buffer, sizeof( buffer ) ) );
+    update.statusDetails = NULL;
+    update.statusDetailsLength = 0U;
+    TEST_ASSERT_EQUAL( 0U, Jobs_UpdateMsg( update, buffer, 10U ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_StartNextMsgWithOptions( NULL, buffer, sizeof( buffer ) ) );
+    startNext.stepTimeoutInMinutes = UINT32_MAX;
+    TEST_ASSERT_EQUAL( 0U, Jobs_StartNextMsgWithOptions( &startNext, buffer, sizeof( buffer ) ) );
+    describe.clientToken = "bad\"token";
+    describe.clientTokenLength = 9U;
+    TEST_ASSERT_EQUAL( 0U, Jobs_DescribeMsg( &describe, buffer, sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_DescribeMsg( NULL, buffer, sizeof( buffer ) ) );
+    getPending.clientToken = "bad\"token";
+    getPending.clientTokenLength = 9U;
+    TEST_ASSERT_EQUAL( 0U, Jobs_GetPendingMsg( &getPending, buffer, sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_GetPendingMsg( NULL, buffer, sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_GetJobId( "{]", 2U, &value ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_GetJobId( "{}", 2U, &value ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_GetJobDocument( "{}", 2U, &value ) );
+
+    assertRecord( JobsLogStartNextMsg, JOBS_LOG_LEVEL_ERROR, 5U, 10U );
+    assertRecord( JobsLogUpdateMsgInvalid, JOBS_LOG_LEVEL_ERROR, 4U, 0U );
+    assertRecord( JobsLogMessageTooLong, JOBS_LOG_LEVEL_WARN, 22U, 10U );
+    assertRecord( JobsLogStartNextMsgInvalid, JOBS_LOG_LEVEL_ERROR, 0U, 0U );
+    assertRecord( JobsLogStartNextMsgInvalid, JOBS_LOG_LEVEL_ERROR, 0U, 0U );
+    assertRecord( JobsLogDescribeMsgInvalid, JOBS_LOG_LEVEL_ERROR, 9U, 0U );
+    assertRecord( JobsLogDescribeMsgInvalid, JOBS_LOG_LEVEL_ERROR, 0U, 0U );
+    assertRecord( JobsLogGetPendingMsgInvalid, JOBS_LOG_LEVEL_ERROR, 9U, 0U );
+    assertRecord( JobsLogGetPendingMsgInvalid, JOBS_LOG_LEVEL_ERROR, 0U, 0U );
+    assertRecord( JobsLogInvalidJson, JOBS_LOG_LEVEL_WARN, 2U, JSONIllegalDocument );
+    assertRecord( JobsLogNoJobId, JOBS_LOG_LEVEL_DEBUG, 2U, JSONNotFound );
+    assertRecord( JobsLogNoJobDocument, JOBS_LOG_LEVEL_DEBUG, 2U, JSONNotFound );
+}
+
+void test_log_namesTheFailedOtaField( void )
+{
+    AfrOtaJobDocumentFields_t fields;
+
+    memset( &fields, 0, sizeof( fields ) );
+    TEST_ASSERT_EQUAL( -1, otaParser_parseJobDocFile( OTA_DOCUMENT_NO_CERT, strlen( OTA_DOCUMENT_NO_CERT ), 0U, "MQTT", 4U, &fields ) );
+    TEST_ASSERT_EQUAL( -1, otaParser_parseJobDocFile( OTA_DOCUMENT_NO_CERT, strlen( OTA_DOCUMENT_NO_CERT ), 1U, "MQTT", 4U, &fields ) );
+
+    assertRecord( JobsLogOtaCertFile, JOBS_LOG_LEVEL_WARN, 0U, JSONNotFound );
+    assertRecord( JobsLogOtaNotOtaJob, JOBS_LOG_LEVEL_WARN, strlen( OTA_DOCUMENT_NO_CERT ), 1U );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_LogRead( &( JobsLogRecord_t ) { 0 } ) );
+}
+
+void test_log_encodesRecords( void )
+{
+    JobsLogRecord_t record = { 0x01020304U, { 0xA0B0C0D0U, 7U }, ( uint16_t ) JobsLogOtaParsed, JOBS_LOG_LEVEL_INFO };
+    JobsLogRecord_t decoded;
+    uint8_t buffer[ JOBS_LOG_RECORD_SIZE ];
+
+    TEST_ASSERT_EQUAL( JOBS_LOG_RECORD_SIZE, Jobs_LogEncode( &record, buffer, sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL( JobsLogOtaParsed, buffer[ 0 ] );
+    TEST_ASSERT_EQUAL( 0U, buffer[ 1 ] );
+    TEST_ASSERT_EQUAL( JOBS_LOG_LEVEL_INFO, buffer[ 2 ] );
+    TEST_ASSERT_EQUAL( 0x04U, buffer[ 4 ] );
+    TEST_ASSERT_EQUAL( 0xA0U, buffer[ 11 ] );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_LogDecode( buffer, sizeof( buffer ), &decoded ) );
+    TEST_ASSERT_EQUAL( record.id, decoded.id );
+    TEST_ASSERT_EQUAL( record.level, decoded.level );
+    TEST_ASSERT_EQUAL( record.timestamp, decoded.timestamp );
+    TEST_ASSERT_EQUAL( record.args[ 0 ], decoded.args[ 0 ] );
+    TEST_ASSERT_EQUAL( record.args[ 1 ], decoded.args[ 1 ] );
+
+    TEST_ASSERT_EQUAL( 0U, Jobs_LogEncode( NULL, buffer, sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_LogEncode( &record, NULL, sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_LogEncode( &record, buffer, sizeof( buffer ) - 1U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LogDecode( NULL, sizeof( buffer ), &decoded ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LogDecode( buffer, sizeof( buffer ) - 1U, &decoded ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_LogDecode( buffer, sizeof( buffer ), NULL ) );
+
+    /* Bytes that are not a record. */
+    buffer[ 3 ] = 1U;
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_LogDecode( buffer, sizeof( buffer ), &decoded ) );
+    buffer[ 3 ] = 0U;
+    buffer[ 2 ] = 0U;
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_LogDecode( buffer, sizeof( buffer ), &decoded ) );
+    buffer[ 2 ] = JOBS_LOG_LEVEL_DEBUG + 1U;
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_LogDecode( buffer, sizeof( buffer ), &decoded ) );
+    buffer[ 2 ] = JOBS_LOG_LEVEL_DEBUG;
+    buffer[ 0 ] = ( uint8_t ) JobsLogMaxId;
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_LogDecode( buffer, sizeof( buffer ), &decoded ) );
+}
+
+void test_log_countsDroppedRecords( void )
+{
+    JobsLogRecord_t record;
+    uint32_t i;
+
+    for( i = 0U; i < ( SLOT_COUNT + 3U ); i++ )
+    {
+        Jobs_LogWrite( JOBS_LOG_LEVEL_DEBUG, JobsLogMatchTopic, i, 0U );
+    }
+
+    TEST_ASSERT_EQUAL( 3U, Jobs_LogDropped() );
+
+    for( i = 0U; i < SLOT_COUNT; i++ )
+    {
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_LogRead( &record ) );
+        TEST_ASSERT_EQUAL( i, record.args[ 0 ] );
+    }
+
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_LogRead( &record ) );
+
+    /* Slots are reused once read. */
+    Jobs_LogWrite( JOBS_LOG_LEVEL_DEBUG, JobsLogMatchTopic, 42U, 0U );
+    assertRecord( JobsLogMatchTopic, JOBS_LOG_LEVEL_DEBUG, 42U, 0U );
+}
+
+void test_log_concurrentWriters( void )
+{
+    pthread_t threads[ WRITER_COUNT ];
+    uint32_t next[ WRITER_COUNT ] = { 0 };
+    uint32_t received = 0U;
+    uint32_t errors = 0U;
+    JobsLogRecord_t record;
+    uint32_t writer;
+    size_t i;
+    bool running = true;
+
+    for( i = 0U; i < WRITER_COUNT; i++ )
+    {
+        TEST_ASSERT_EQUAL( 0, pthread_create( &threads[ i ], NULL, writeRecords, ( void * ) ( uintptr_t ) i ) );
+    }
+
+    while( running == true )
+    {
+        if( Jobs_LogRead( &record ) == JobsSuccess )
+        {
+            writer = record.args[ 0 ];
+
+            /* Records of a writer arrive in order, with gaps for drops. */
+            if( ( writer >= WRITER_COUNT ) || ( record.args[ 1 ] < next[ writer ] ) ||
+                ( record.id != ( uint16_t ) JobsLogOtaParsed ) )
+            {
+                errors++;
+            }
+            else
+            {
+                next[ writer ] = record.args[ 1 ] + 1U;
+            }
+
+            received++;
+        }
+        else
+        {
+            running = ( ( received + Jobs_LogDropped() ) < ( WRITER_COUNT * RECORDS_PER_WRITER ) ) ? true : false;
+            ( void ) sched_yield();
+        }
+    }
+
+    for( i = 0U; i < WRITER_COUNT; i++ )
+    {
+        TEST_ASSERT_EQUAL( 0, pthread_join( threads[ i ], NULL ) );
+    }
+
+    TEST_ASSERT_EQUAL( 0U, errors );
+    TEST_ASSERT_GREATER_THAN( 0U, received );
+    TEST_ASSERT_EQUAL( WRITER_COUNT * RECORDS_PER_WRITER, received + Jobs_LogDropped() );
+}
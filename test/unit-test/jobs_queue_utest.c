@@ -0,0 +1,250 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_queue_utest.c
+ * @brief Unit tests for the jobs offline update queue.
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "jobs_queue.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+#define ENTRY_COUNT          3U
+#define THING_NAME           "thing"
+#define THING_NAME_LENGTH    ( ( uint16_t ) ( sizeof( THING_NAME ) - 1U ) )
+
+static JobsQueuedUpdate_t entries[ ENTRY_COUNT ];
+static JobsUpdateQueue_t queue;
+static JobsOutboundMessage_t messages[ ENTRY_COUNT ];
+static char buffer[ 512 ];
+
+/**
+ * @brief Queue an update with optional status details.
+ */
+static JobsStatus_t queueUpdate( const char * jobId,
+                                 JobCurrentStatus_t status,
+                                 const char * statusDetails )
+{
+    JobsUpdateRequest_t request = { 0 };
+
+    request.status = status;
+    request.statusDetails = statusDetails;
+    request.statusDetailsLength = ( statusDetails != NULL ) ? strlen( statusDetails ) : 0U;
+
+    return Jobs_QueueUpdate( &queue, jobId, ( uint16_t ) strlen( jobId ), request );
+}
+
+/**
+ * @brief Build a batch and return the number of messages.
+ */
+static size_t getBatch( size_t bufferSize )
+{
+    size_t count = 0U;
+
+    TEST_ASSERT_EQUAL( JobsSuccess,
+                       Jobs_QueueGetBatch( &queue, THING_NAME, THING_NAME_LENGTH,
+                                           messages, ENTRY_COUNT, buffer, bufferSize, &count ) );
+
+    return count;
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_QueueInit( &queue, entries, ENTRY_COUNT ) );
+    memset( messages, 0, sizeof( messages ) );
+    memset( buffer, 0, sizeof( buffer ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_queue_rejectsBadParameters( void )
+{
+    JobsUpdateRequest_t request = { 0 };
+    size_t count = 0U;
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_QueueInit( NULL, entries, ENTRY_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_QueueInit( &queue, entries, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_QueueUpdate( NULL, "job", 3U, request ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, queueUpdate( "bad job", InProgress, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, queueUpdate( "job", InProgress, "{\"a\":" ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_QueueGetBatch( &queue, NULL, 1U, messages, ENTRY_COUNT,
+                                                             buffer, sizeof( buffer ), &count ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_QueueGetBatch( &queue, THING_NAME, THING_NAME_LENGTH, messages, 0U,
+                                                             buffer, sizeof( buffer ), &count ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_QueueConsume( &queue, 1U ) );
+    TEST_ASSERT_EQUAL( 0U, getBatch( sizeof( buffer ) ) );
+}
+
+void test_queue_compactsProgressPerJob( void )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, queueUpdate( "a", InProgress, "{\"step\":\"1\"}" ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, queueUpdate( "b", InProgress, NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, queueUpdate( "a", InProgress, "{\"step\":\"2\"}" ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, queueUpdate( "a", InProgress, "{\"step\":\"3\"}" ) );
+
+    TEST_ASSERT_EQUAL( 2U, getBatch( sizeof( buffer ) ) );
+
+    /* The merged update keeps the place of the first update of job a. */
+    TEST_ASSERT_EQUAL_STRING( "$aws/things/thing/jobs/a/update", messages[ 0 ].pTopic );
+    TEST_ASSERT_EQUAL( strlen( messages[ 0 ].pTopic ), messages[ 0 ].topicLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "{\"status\":\"IN_PROGRESS\",\"statusDetails\":{\"step\":\"3\"}}",
+                                  messages[ 0 ].pPayload, messages[ 0 ].payloadLength );
+    TEST_ASSERT_EQUAL_STRING( "$aws/things/thing/jobs/b/update", messages[ 1 ].pTopic );
+    TEST_ASSERT_EQUAL_STRING_LEN( "{\"status\":\"IN_PROGRESS\"}",
+                                  messages[ 1 ].pPayload, messages[ 1 ].payloadLength );
+}
+
+void test_queue_keepsTerminalUpdates( void )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, queueUpdate( "a", InProgress, NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, queueUpdate( "a", Succeeded, NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, queueUpdate( "a", InProgress, NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, queueUpdate( "a", Failed, NULL ) );
+
+    TEST_ASSERT_EQUAL( 2U, getBatch( sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL_STRING_LEN( "{\"status\":\"SUCCEEDED\"}", messages[ 0 ].pPayload, messages[ 0 ].payloadLength );
+    TEST_ASSERT_EQUAL_STRING_LEN( "{\"status\":\"FAILED\"}", messages[ 1 ].pPayload, messages[ 1 ].payloadLength );
+
+    /* A full queue refuses new jobs but still merges progress. */
+    TEST_ASSERT_EQUAL( JobsSuccess, queueUpdate( "b", InProgress, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, queueUpdate( "c", InProgress, NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, queueUpdate( "b", Rejected, NULL ) );
+}
+
+void test_queue_flushesInBatches( void )
+{
+    size_t count = 0U;
+
+    TEST_ASSERT_EQUAL( JobsSuccess, queueUpdate( "a", InProgress, NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, queueUpdate( "b", InProgress, NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, queueUpdate( "c", InProgress, NULL ) );
+
+    /* Room for a single topic and payload. */
+    TEST_ASSERT_EQUAL( 1U, getBatch( 60U ) );
+    TEST_ASSERT_EQUAL_STRING( "$aws/things/thing/jobs/a/update", messages[ 0 ].pTopic );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_QueueConsume( &queue, 1U ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, queueUpdate( "d", Succeeded, NULL ) );
+    TEST_ASSERT_EQUAL( 3U, getBatch( sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL_STRING( "$aws/things/thing/jobs/b/update", messages[ 0 ].pTopic );
+    TEST_ASSERT_EQUAL_STRING( "$aws/things/thing/jobs/d/update", messages[ 2 ].pTopic );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_QueueConsume( &queue, 3U ) );
+    TEST_ASSERT_EQUAL( 0U, getBatch( sizeof( buffer ) ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, queueUpdate( "e", InProgress, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall,
+                       Jobs_QueueGetBatch( &queue, THING_NAME, THING_NAME_LENGTH,
+                                           messages, ENTRY_COUNT, buffer, 20U, &count ) );
+    TEST_ASSERT_EQUAL( 0U, count );
+}
+
+void test_queue_rejectsUnusableQueuesAndArguments( void )
+{
+    JobsUpdateQueue_t empty = { 0 };
+    JobsUpdateRequest_t request = { 0 };
+    char details[ JOBS_QUEUE_STATUS_DETAILS_MAX_LENGTH + 8U ];
+    size_t count = 0U;
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_QueueInit( &queue, NULL, ENTRY_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_QueueUpdate( &empty, "job", 3U, request ) );
+    request.status = ( JobCurrentStatus_t ) ( Rejected + 1 );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_QueueUpdate( &queue, "job", 3U, request ) );
+
+    /* Status details are valid JSON but do not fit an entry. */
+    memset( details, 'x', sizeof( details ) - 1U );
+    ( void ) memcpy( details, "{\"a\":\"", 6U );
+    ( void ) memcpy( &details[ sizeof( details ) - 3U ], "\"}", 3U );
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, queueUpdate( "job", InProgress, details ) );
+    TEST_ASSERT_EQUAL( 0U, queue.count );
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_QueueGetBatch( NULL, THING_NAME, THING_NAME_LENGTH, messages,
+                                                             ENTRY_COUNT, buffer, sizeof( buffer ), &count ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_QueueGetBatch( &empty, THING_NAME, THING_NAME_LENGTH, messages,
+                                                             ENTRY_COUNT, buffer, sizeof( buffer ), &count ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_QueueGetBatch( &queue, THING_NAME, 0U, messages,
+                                                             ENTRY_COUNT, buffer, sizeof( buffer ), &count ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_QueueGetBatch( &queue, THING_NAME, THING_NAME_LENGTH, NULL,
+                                                             ENTRY_COUNT, buffer, sizeof( buffer ), &count ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_QueueGetBatch( &queue, THING_NAME, THING_NAME_LENGTH, messages,
+                                                             ENTRY_COUNT, NULL, sizeof( buffer ), &count ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_QueueGetBatch( &queue, THING_NAME, THING_NAME_LENGTH, messages,
+                                                             ENTRY_COUNT, buffer, sizeof( buffer ), NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_QueueConsume( NULL, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_QueueConsume( &empty, 0U ) );
+
+    /* Popping from an empty queue consumes nothing. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_QueueConsume( &queue, 0U ) );
+    TEST_ASSERT_EQUAL( 0U, queue.count );
+}
+
+void test_queue_stopsAtBufferAndMessageLimits( void )
+{
+    size_t count = 0U;
+
+    /* Job IDs of different lengths never merge. */
+    TEST_ASSERT_EQUAL( JobsSuccess, queueUpdate( "a", InProgress, NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, queueUpdate( "ab", InProgress, NULL ) );
+    TEST_ASSERT_EQUAL( 2U, queue.count );
+
+    /* No room at all, then room for the topic but not the payload. */
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall,
+                       Jobs_QueueGetBatch( &queue, THING_NAME, THING_NAME_LENGTH,
+                                           messages, ENTRY_COUNT, buffer, 0U, &count ) );
+    TEST_ASSERT_EQUAL( 0U, count );
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall,
+                       Jobs_QueueGetBatch( &queue, THING_NAME, THING_NAME_LENGTH,
+                                           messages, ENTRY_COUNT, buffer, 40U, &count ) );
+    TEST_ASSERT_EQUAL( 0U, count );
+
+    /* The batch is bounded by the number of messages. */
+    TEST_ASSERT_EQUAL( JobsSuccess,
+                       Jobs_QueueGetBatch( &queue, THING_NAME, THING_NAME_LENGTH,
+                                           messages, 1U, buffer, sizeof( buffer ), &count ) );
+    TEST_ASSERT_EQUAL( 1U, count );
+    TEST_ASSERT_EQUAL_STRING( "$aws/things/thing/jobs/a/update", messages[ 0 ].pTopic );
+}
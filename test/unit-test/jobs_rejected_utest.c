@@ -0,0 +1,176 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_rejected_utest.c
+ * @brief Unit tests for the rejected response decoder.
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "jobs_rejected.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+static JobsRejected_t rejected;
+
+/**
+ * @brief Check a string field of the decoded response.
+ */
+static void assertField( const char * expected,
+                         const char * field,
+                         size_t fieldLength )
+{
+    TEST_ASSERT_NOT_NULL( field );
+    TEST_ASSERT_EQUAL( strlen( expected ), fieldLength );
+    TEST_ASSERT_EQUAL_MEMORY( expected, field, fieldLength );
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    memset( &rejected, 0xA5, sizeof( rejected ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_rejected_rejectsBadParameters( void )
+{
+    const char * message = "{\"code\":\"InvalidJson\"}";
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_RejectedDecode( JobsUpdateFailed, NULL, 1U, &rejected ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_RejectedDecode( JobsUpdateFailed, message, strlen( message ), NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_RejectedDecode( JobsUpdateFailed, message, strlen( message ) - 1U, &rejected ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_RejectedDecode( JobsUpdateFailed, "[1]", 3U, &rejected ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_RejectedDecode( JobsUpdateFailed, "", 0U, &rejected ) );
+
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_RejectedDecode( JobsUpdateSuccess, message, strlen( message ), &rejected ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_RejectedDecode( JobsJobsChanged, message, strlen( message ), &rejected ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_RejectedDecode( JobsInvalidTopic, message, strlen( message ), &rejected ) );
+}
+
+void test_rejected_decodesAllFields( void )
+{
+    const char * message = "{\"code\":\"VersionMismatch\",\"message\":\"Version mismatch\","
+                           "\"clientToken\":\"abc123\",\"timestamp\":1700000000,"
+                           "\"executionState\":{\"status\":\"IN_PROGRESS\","
+                           "\"statusDetails\":{\"step\":\"download\"},\"versionNumber\":4}}";
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_RejectedDecode( JobsUpdateFailed, message, strlen( message ), &rejected ) );
+    TEST_ASSERT_EQUAL( JobsRejectedVersionMismatch, rejected.code );
+    assertField( "VersionMismatch", rejected.codeString, rejected.codeStringLength );
+    assertField( "Version mismatch", rejected.message, rejected.messageLength );
+    assertField( "abc123", rejected.clientToken, rejected.clientTokenLength );
+    assertField( "{\"step\":\"download\"}", rejected.statusDetails, rejected.statusDetailsLength );
+    TEST_ASSERT_TRUE( rejected.hasExecutionState );
+    TEST_ASSERT_EQUAL( InProgress, rejected.status );
+    TEST_ASSERT_EQUAL( 4U, rejected.versionNumber );
+    TEST_ASSERT_EQUAL( JobsRejectedResync, Jobs_RejectedAction( rejected.code ) );
+}
+
+void test_rejected_toleratesMissingAndMistypedFields( void )
+{
+    const char * message = "{\"code\":404,\"message\":null,\"clientToken\":\"t\","
+                           "\"executionState\":{\"status\":\"DONE\",\"versionNumber\":\"4\","
+                           "\"statusDetails\":\"none\"},\"other\":\"x\"}";
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_RejectedDecode( JobsDescribeFailed, message, strlen( message ), &rejected ) );
+    TEST_ASSERT_EQUAL( JobsRejectedUnknown, rejected.code );
+    TEST_ASSERT_NULL( rejected.codeString );
+    TEST_ASSERT_NULL( rejected.message );
+    TEST_ASSERT_EQUAL( 0U, rejected.messageLength );
+    assertField( "t", rejected.clientToken, rejected.clientTokenLength );
+    TEST_ASSERT_NULL( rejected.statusDetails );
+    TEST_ASSERT_FALSE( rejected.hasExecutionState );
+    TEST_ASSERT_EQUAL( 0U, rejected.versionNumber );
+
+    message = "{\"executionState\":[],\"code\":\"ResourceNotFound\"}";
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_RejectedDecode( JobsStartNextFailed, message, strlen( message ), &rejected ) );
+    TEST_ASSERT_EQUAL( JobsRejectedResourceNotFound, rejected.code );
+    TEST_ASSERT_NULL( rejected.clientToken );
+    TEST_ASSERT_FALSE( rejected.hasExecutionState );
+
+    message = "{}";
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_RejectedDecode( JobsGetPendingFailed, message, strlen( message ), &rejected ) );
+    TEST_ASSERT_EQUAL( JobsRejectedUnknown, rejected.code );
+    TEST_ASSERT_EQUAL( JobsRejectedGiveUp, Jobs_RejectedAction( rejected.code ) );
+}
+
+void test_rejected_classifiesEveryCode( void )
+{
+    static const struct
+    {
+        const char * string;
+        JobsRejectedCode_t code;
+        JobsRejectedAction_t action;
+    } codes[] =
+    {
+        { "InvalidTopic",           JobsRejectedInvalidTopic,           JobsRejectedGiveUp  },
+        { "InvalidJson",            JobsRejectedInvalidJson,            JobsRejectedGiveUp  },
+        { "InvalidRequest",         JobsRejectedInvalidRequest,         JobsRejectedGiveUp  },
+        { "InvalidStateTransition", JobsRejectedInvalidStateTransition, JobsRejectedResync  },
+        { "ResourceNotFound",       JobsRejectedResourceNotFound,       JobsRejectedGiveUp  },
+        { "VersionMismatch",        JobsRejectedVersionMismatch,        JobsRejectedResync  },
+        { "InternalError",          JobsRejectedInternalError,          JobsRejectedBackoff },
+        { "RequestThrottled",       JobsRejectedRequestThrottled,       JobsRejectedBackoff },
+        { "ThrottlingException",    JobsRejectedRequestThrottled,       JobsRejectedBackoff },
+        { "TerminalStateReached",   JobsRejectedTerminalStateReached,   JobsRejectedGiveUp  },
+    };
+    size_t i;
+
+    for( i = 0U; i < ( sizeof( codes ) / sizeof( codes[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL( codes[ i ].code, Jobs_RejectedCode( codes[ i ].string, strlen( codes[ i ].string ) ) );
+        TEST_ASSERT_EQUAL( codes[ i ].action, Jobs_RejectedAction( codes[ i ].code ) );
+    }
+
+    /* Unknown codes, including ones sharing a slot with a known code. */
+    TEST_ASSERT_EQUAL( JobsRejectedUnknown, Jobs_RejectedCode( "InvalidTopix", 12U ) );
+    TEST_ASSERT_EQUAL( JobsRejectedUnknown, Jobs_RejectedCode( "InvalidJsonX", 12U ) );
+    TEST_ASSERT_EQUAL( JobsRejectedUnknown, Jobs_RejectedCode( "InvalidTopic", 11U ) );
+    TEST_ASSERT_EQUAL( JobsRejectedUnknown, Jobs_RejectedCode( "Ab", 2U ) );
+    TEST_ASSERT_EQUAL( JobsRejectedUnknown, Jobs_RejectedCode( NULL, 12U ) );
+    TEST_ASSERT_EQUAL( JobsRejectedUnknown, Jobs_RejectedCode( "", 0U ) );
+    TEST_ASSERT_EQUAL( JobsRejectedGiveUp, Jobs_RejectedAction( JobsRejectedUnknown ) );
+}
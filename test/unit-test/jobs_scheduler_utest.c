@@ -0,0 +1,463 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_scheduler_utest.c
+ * @brief Unit tests for the request scheduler.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unity.h"
+
+#include "jobs_scheduler.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+/**
+ * @brief Thing name used by most tests.
+ */
+#define THING_NAME           "thing-0001"
+
+/**
+ * @brief Number of devices of the fleet simulation.
+ */
+#define FLEET_SIZE           1000U
+
+/**
+ * @brief Resolution of the fleet simulation in milliseconds.
+ */
+#define FLEET_TICK_MS        10U
+
+/**
+ * @brief Requests per tick accepted by the broker stand-in, 100 per second.
+ */
+#define BROKER_RATE          1U
+
+/**
+ * @brief Burst of requests accepted by the broker stand-in.
+ */
+#define BROKER_BURST         50U
+
+/**
+ * @brief Time the fleet simulation gives up after.
+ */
+#define FLEET_HORIZON_MS     600000U
+
+static const JobsSchedulerConfig_t defaultConfig = { 30000U, 1000U, 60000U, 1000U, 2U };
+
+static JobsScheduler_t scheduler;
+
+/**
+ * @brief Outcome of a fleet simulation.
+ */
+typedef struct
+{
+    uint32_t p50Ms;     /**< @brief Median time for a device to get both responses. */
+    uint32_t p99Ms;     /**< @brief 99th percentile of the time to get both responses. */
+    uint32_t maxMs;     /**< @brief Longest time to get both responses. */
+    uint32_t throttled; /**< @brief Number of throttled requests. */
+    uint32_t done;      /**< @brief Number of devices that got both responses. */
+} FleetResult_t;
+
+static JobsScheduler_t fleet[ FLEET_SIZE ];
+static uint32_t wakeMs[ FLEET_SIZE ];
+static uint32_t doneMs[ FLEET_SIZE ];
+
+/**
+ * @brief Initialize the scheduler of THING_NAME, connected at time 0.
+ */
+static void initScheduler( const JobsSchedulerConfig_t * config )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerInit( &scheduler, config, THING_NAME, strlen( THING_NAME ) ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerConnect( &scheduler, 0U ) );
+}
+
+/**
+ * @brief Check the next request of the scheduler.
+ */
+static void assertPoll( uint32_t nowMs,
+                        JobsApi_t expected )
+{
+    JobsApi_t api = JobsInvalidApi;
+    uint32_t wait = 1U;
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerPoll( &scheduler, nowMs, &api, &wait ) );
+    TEST_ASSERT_EQUAL( expected, api );
+    TEST_ASSERT_EQUAL( 0U, wait );
+}
+
+/**
+ * @brief Check that no request of the scheduler is due, and return the wait.
+ */
+static uint32_t assertWait( uint32_t nowMs )
+{
+    JobsApi_t api = JobsInvalidApi;
+    uint32_t wait = 0U;
+
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_SchedulerPoll( &scheduler, nowMs, &api, &wait ) );
+    TEST_ASSERT_EQUAL( JobsInvalidApi, api );
+
+    return wait;
+}
+
+/**
+ * @brief Sort comparison of unsigned values.
+ */
+static int compareUint( const void * a,
+                        const void * b )
+{
+    uint32_t x = *( const uint32_t * ) a;
+    uint32_t y = *( const uint32_t * ) b;
+
+    return ( x > y ) - ( x < y );
+}
+
+/**
+ * @brief Simulate a fleet reconnecting at once to a rate limited broker.
+ *
+ * Every device asks for GetPendingJobExecutions and
+ * StartNextPendingJobExecution on connection.  The broker stand-in has a
+ * token bucket of BROKER_BURST requests refilled by BROKER_RATE per tick,
+ * and rejects requests with ThrottlingException when it is empty.
+ * Responses arrive in the tick the request was sent.
+ */
+static void simulateFleet( const JobsSchedulerConfig_t * config,
+                           FleetResult_t * result )
+{
+    char thingName[ 16 ];
+    uint32_t brokerTokens = BROKER_BURST;
+    uint32_t now;
+    uint32_t wait;
+    size_t i;
+    JobsApi_t api;
+
+    memset( result, 0, sizeof( *result ) );
+
+    for( i = 0U; i < FLEET_SIZE; i++ )
+    {
+        ( void ) snprintf( thingName, sizeof( thingName ), "sensor-%05u", ( unsigned ) i );
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerInit( &fleet[ i ], config, thingName, strlen( thingName ) ) );
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerConnect( &fleet[ i ], 0U ) );
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRequest( &fleet[ i ], JobsApiGetPending ) );
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRequest( &fleet[ i ], JobsApiStartNext ) );
+        wakeMs[ i ] = 0U;
+    }
+
+    for( now = 0U; ( now < FLEET_HORIZON_MS ) && ( result->done < FLEET_SIZE ); now += FLEET_TICK_MS )
+    {
+        brokerTokens = ( brokerTokens + BROKER_RATE > BROKER_BURST ) ? BROKER_BURST : ( brokerTokens + BROKER_RATE );
+
+        for( i = 0U; i < FLEET_SIZE; i++ )
+        {
+            if( wakeMs[ i ] > now )
+            {
+                continue;
+            }
+
+            while( Jobs_SchedulerPoll( &fleet[ i ], now, &api, &wait ) == JobsSuccess )
+            {
+                if( brokerTokens > 0U )
+                {
+                    brokerTokens--;
+                    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerAccepted( &fleet[ i ], api ) );
+                }
+                else
+                {
+                    result->throttled++;
+                    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRejected( &fleet[ i ], api,
+                                                                            JobsRejectedRequestThrottled, now ) );
+                }
+            }
+
+            if( wait == JOBS_SCHEDULER_IDLE )
+            {
+                wakeMs[ i ] = UINT32_MAX;
+                doneMs[ result->done ] = now;
+                result->done++;
+            }
+            else
+            {
+                wakeMs[ i ] = now + wait;
+            }
+        }
+    }
+
+    if( result->done > 0U )
+    {
+        qsort( doneMs, result->done, sizeof( doneMs[ 0 ] ), compareUint );
+        result->p50Ms = doneMs[ ( result->done - 1U ) / 2U ];
+        result->p99Ms = doneMs[ ( ( result->done - 1U ) * 99U ) / 100U ];
+        result->maxMs = doneMs[ result->done - 1U ];
+    }
+}
+
+/**
+ * @brief Report the outcome of a fleet simulation.
+ */
+static void reportFleet( const char * name,
+                         const FleetResult_t * result )
+{
+    char line[ 160 ];
+
+    ( void ) snprintf( line, sizeof( line ),
+                       "%s: %u/%u devices, p50 %u ms, p99 %u ms, max %u ms, %u throttled",
+                       name, ( unsigned ) result->done, ( unsigned ) FLEET_SIZE,
+                       ( unsigned ) result->p50Ms, ( unsigned ) result->p99Ms,
+                       ( unsigned ) result->maxMs, ( unsigned ) result->throttled );
+    TEST_MESSAGE( line );
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    memset( &scheduler, 0, sizeof( scheduler ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_scheduler_rejectsBadParameters( void )
+{
+    JobsSchedulerConfig_t config = defaultConfig;
+    JobsApi_t api;
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SchedulerInit( NULL, &config, THING_NAME, strlen( THING_NAME ) ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SchedulerInit( &scheduler, NULL, THING_NAME, strlen( THING_NAME ) ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SchedulerInit( &scheduler, &config, NULL, 1U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SchedulerInit( &scheduler, &config, THING_NAME, 0U ) );
+    config.refillIntervalMs = 0U;
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SchedulerInit( &scheduler, &config, THING_NAME, strlen( THING_NAME ) ) );
+    config = defaultConfig;
+    config.bucketSize = 0U;
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SchedulerInit( &scheduler, &config, THING_NAME, strlen( THING_NAME ) ) );
+    config = defaultConfig;
+    config.backoffBaseMs = config.backoffMaxMs + 1U;
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SchedulerInit( &scheduler, &config, THING_NAME, strlen( THING_NAME ) ) );
+    config.backoffMaxMs = ( uint32_t ) INT32_MAX + 1U;
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SchedulerInit( &scheduler, &config, THING_NAME, strlen( THING_NAME ) ) );
+    config = defaultConfig;
+    config.jitterWindowMs = ( uint32_t ) INT32_MAX + 1U;
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SchedulerInit( &scheduler, &config, THING_NAME, strlen( THING_NAME ) ) );
+
+    /* An uninitialized scheduler. */
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SchedulerConnect( &scheduler, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SchedulerRequest( &scheduler, JobsApiStartNext ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SchedulerPoll( &scheduler, 0U, &api, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SchedulerAccepted( NULL, JobsApiStartNext ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SchedulerRejected( NULL, JobsApiStartNext, JobsRejectedRequestThrottled, 0U ) );
+
+    initScheduler( &defaultConfig );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SchedulerRequest( &scheduler, JobsInvalidApi ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SchedulerRequest( &scheduler, JobsMaxApi ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SchedulerPoll( &scheduler, 0U, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SchedulerAccepted( &scheduler, JobsMaxApi ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SchedulerRejected( &scheduler, JobsInvalidApi, JobsRejectedRequestThrottled, 0U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_SchedulerAccepted( &scheduler, JobsApiStartNext ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_SchedulerRejected( &scheduler, JobsApiStartNext, JobsRejectedRequestThrottled, 0U ) );
+    TEST_ASSERT_EQUAL( JOBS_SCHEDULER_IDLE, assertWait( 0U ) );
+}
+
+void test_scheduler_jitterIsPerThingAndSpread( void )
+{
+    JobsSchedulerConfig_t config = defaultConfig;
+    uint32_t histogram[ 10 ] = { 0 };
+    uint32_t offset;
+    uint32_t wait;
+    size_t i;
+    char thingName[ 16 ];
+
+    /* Nothing is sent before the connection. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerInit( &scheduler, &config, THING_NAME, strlen( THING_NAME ) ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRequest( &scheduler, JobsApiStartNext ) );
+    TEST_ASSERT_EQUAL( JOBS_SCHEDULER_IDLE, assertWait( 0U ) );
+
+    /* The offset of a thing is the same on every connection. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerConnect( &scheduler, 1000U ) );
+    offset = assertWait( 1000U );
+    TEST_ASSERT_TRUE( ( offset > 0U ) && ( offset < config.jitterWindowMs ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerConnect( &scheduler, UINT32_MAX - 10U ) );
+    TEST_ASSERT_EQUAL( offset, assertWait( UINT32_MAX - 10U ) );
+    TEST_ASSERT_EQUAL( offset - 1000U, assertWait( UINT32_MAX - 10U + 1000U ) );
+    assertPoll( UINT32_MAX - 10U + offset, JobsApiStartNext );
+
+    /* Offsets of a fleet cover the window evenly. */
+    for( i = 0U; i < FLEET_SIZE; i++ )
+    {
+        ( void ) snprintf( thingName, sizeof( thingName ), "sensor-%05u", ( unsigned ) i );
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerInit( &scheduler, &config, thingName, strlen( thingName ) ) );
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerConnect( &scheduler, 0U ) );
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRequest( &scheduler, JobsApiGetPending ) );
+        wait = assertWait( 0U );
+        histogram[ ( wait * 10U ) / config.jitterWindowMs ]++;
+    }
+
+    for( i = 0U; i < 10U; i++ )
+    {
+        TEST_ASSERT_UINT32_WITHIN( FLEET_SIZE / 20U, FLEET_SIZE / 10U, histogram[ i ] );
+    }
+
+    /* Without a window the first request is sent at once. */
+    config.jitterWindowMs = 0U;
+    initScheduler( &config );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRequest( &scheduler, JobsApiStartNext ) );
+    assertPoll( 0U, JobsApiStartNext );
+}
+
+void test_scheduler_tokenBucketAndOrder( void )
+{
+    JobsSchedulerConfig_t config = defaultConfig;
+
+    config.jitterWindowMs = 0U;
+    initScheduler( &config );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRequest( &scheduler, JobsApiDescribe ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRequest( &scheduler, JobsApiStartNext ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRequest( &scheduler, JobsApiGetPending ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRequest( &scheduler, JobsApiGetPending ) );
+
+    /* Requests go in API order until the bucket is empty. */
+    assertPoll( 100U, JobsApiGetPending );
+    assertPoll( 100U, JobsApiStartNext );
+    TEST_ASSERT_EQUAL( 1000U, assertWait( 100U ) );
+    TEST_ASSERT_EQUAL( 1U, assertWait( 1099U ) );
+    assertPoll( 1100U, JobsApiDescribe );
+
+    /* A request awaiting its response is not sent again. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRequest( &scheduler, JobsApiGetPending ) );
+    TEST_ASSERT_EQUAL( JOBS_SCHEDULER_IDLE, assertWait( 5000U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerAccepted( &scheduler, JobsApiGetPending ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_SchedulerAccepted( &scheduler, JobsApiGetPending ) );
+
+    /* The bucket refilled to its size while idle. */
+    assertPoll( 5000U, JobsApiGetPending );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRequest( &scheduler, JobsApiUpdate ) );
+    assertPoll( 5000U, JobsApiUpdate );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerAccepted( &scheduler, JobsApiGetPending ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRequest( &scheduler, JobsApiGetPending ) );
+    TEST_ASSERT_EQUAL( 1000U, assertWait( 5000U ) );
+
+    /* A reconnection sends the requests awaiting a response again. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerConnect( &scheduler, 6000U ) );
+    assertPoll( 6000U, JobsApiGetPending );
+    assertPoll( 6000U, JobsApiStartNext );
+    TEST_ASSERT_EQUAL( 1000U, assertWait( 6000U ) );
+    assertPoll( 7000U, JobsApiDescribe );
+    TEST_ASSERT_EQUAL( 1000U, assertWait( 7000U ) );
+    assertPoll( 8000U, JobsApiUpdate );
+}
+
+void test_scheduler_backsOffThrottledRequests( void )
+{
+    JobsSchedulerConfig_t config = defaultConfig;
+    uint32_t now = 0U;
+    uint32_t delay = config.backoffBaseMs;
+    uint32_t wait;
+    size_t i;
+
+    config.jitterWindowMs = 0U;
+    config.bucketSize = 100U;
+    initScheduler( &config );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRequest( &scheduler, JobsApiStartNext ) );
+
+    /* Delays double up to the maximum, jittered to half or more. */
+    for( i = 0U; i < 12U; i++ )
+    {
+        assertPoll( now, JobsApiStartNext );
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRejected( &scheduler, JobsApiStartNext,
+                                                                JobsRejectedRequestThrottled, now ) );
+        wait = assertWait( now );
+        TEST_ASSERT_TRUE( ( wait >= ( delay / 2U ) ) && ( wait <= delay ) );
+        now += wait;
+        delay = ( delay * 2U > config.backoffMaxMs ) ? config.backoffMaxMs : ( delay * 2U );
+    }
+
+    /* An accepted response resets the backoff. */
+    assertPoll( now, JobsApiStartNext );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerAccepted( &scheduler, JobsApiStartNext ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRequest( &scheduler, JobsApiStartNext ) );
+    assertPoll( now, JobsApiStartNext );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRejected( &scheduler, JobsApiStartNext,
+                                                            JobsRejectedInternalError, now ) );
+    wait = assertWait( now );
+    TEST_ASSERT_TRUE( ( wait >= ( config.backoffBaseMs / 2U ) ) && ( wait <= config.backoffBaseMs ) );
+
+    /* Other rejections are not retried. */
+    assertPoll( now + wait, JobsApiStartNext );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRejected( &scheduler, JobsApiStartNext,
+                                                            JobsRejectedResourceNotFound, now + wait ) );
+    TEST_ASSERT_EQUAL( JOBS_SCHEDULER_IDLE, assertWait( now + wait ) );
+
+    /* The attempt count saturates with the largest delays. */
+    config.backoffBaseMs = INT32_MAX;
+    config.backoffMaxMs = INT32_MAX;
+    initScheduler( &config );
+    scheduler.attempts = UINT8_MAX;
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRequest( &scheduler, JobsApiGetPending ) );
+    assertPoll( 0U, JobsApiGetPending );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SchedulerRejected( &scheduler, JobsApiGetPending,
+                                                            JobsRejectedRequestThrottled, 0U ) );
+    TEST_ASSERT_EQUAL( UINT8_MAX, scheduler.attempts );
+    TEST_ASSERT_TRUE( assertWait( 0U ) >= ( INT32_MAX / 2U ) );
+}
+
+void test_scheduler_fleetSimulation( void )
+{
+    JobsSchedulerConfig_t config = defaultConfig;
+    FleetResult_t paced;
+    FleetResult_t unpaced;
+
+    /* 1000 devices sending 2 requests each need 20 s at 100 requests per second. */
+    simulateFleet( &config, &paced );
+    reportFleet( "jittered", &paced );
+
+    config.jitterWindowMs = 0U;
+    simulateFleet( &config, &unpaced );
+    reportFleet( "unjittered", &unpaced );
+
+    TEST_ASSERT_EQUAL( FLEET_SIZE, paced.done );
+    TEST_ASSERT_EQUAL( FLEET_SIZE, unpaced.done );
+    /* Spreading the fleet over the window keeps the broker under its
+     * limit, and the tail latency within the window. */
+    TEST_ASSERT_TRUE( paced.throttled < ( unpaced.throttled / 4U ) );
+    TEST_ASSERT_TRUE( paced.maxMs <= ( defaultConfig.jitterWindowMs + defaultConfig.backoffMaxMs ) );
+}
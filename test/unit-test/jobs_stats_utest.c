@@ -0,0 +1,319 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_stats_utest.c
+ * @brief Unit tests for the statistics counters, built with
+ * JOBS_STATS_ENABLED set to 1.
+ */
+
+#include <pthread.h>
+#include <string.h>
+
+#include "unity.h"
+
+#include "jobs.h"
+#include "jobs_stats.h"
+#include "ota_job_processor.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+#define SHARD_COUNT      2U
+
+/* Threads counting at the same time, each in its own shard. */
+#define THREAD_COUNT     4U
+#define THREAD_ADDS      10000U
+
+#define OTA_DOCUMENT                                                                      \
+    "{\"afr_ota\":{\"protocols\":[\"MQTT\"],\"streamname\":\"stream\",\"files\":[{"       \
+    "\"filepath\":\"/image.bin\",\"filesize\":1024,\"fileid\":0,\"certfile\":\"/cert\"," \
+    "\"sig-sha256-ecdsa\":\"c2ln\"}]}}"
+
+#define OTA_DOCUMENT_NO_CERT                                                              \
+    "{\"afr_ota\":{\"protocols\":[\"MQTT\"],\"streamname\":\"stream\",\"files\":[{"       \
+    "\"filepath\":\"/image.bin\",\"filesize\":1024,\"fileid\":0,"                        \
+    "\"sig-sha256-ecdsa\":\"c2ln\"}]}}"
+
+#define OTA_DOCUMENT_NO_URL                                                                 \
+    "{\"afr_ota\":{\"protocols\":[\"HTTP\"],\"files\":[{"                                   \
+    "\"filepath\":\"/image.bin\",\"filesize\":1024,\"fileid\":0,\"certfile\":\"/cert\","   \
+    "\"fileType\":\"x\",\"auth_scheme\":\"s\",\"sig-sha256-ecdsa\":\"c2ln\"}]}}"
+
+static JobsStatsShard_t shards[ SHARD_COUNT ];
+static JobsStatsShard_t threadShards[ THREAD_COUNT + 1U ];
+static JobsStatsSnapshot_t snapshot;
+
+/**
+ * @brief Count THREAD_ADDS messages in the shard of the calling thread.
+ */
+static void * countMessages( void * arg )
+{
+    uint32_t i;
+
+    ( void ) arg;
+
+    for( i = 0U; i < THREAD_ADDS; i++ )
+    {
+        Jobs_StatsAdd( JobsStatsNoMatch, 1U );
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Read the counters into snapshot.
+ */
+static void readCounters( void )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_StatsRead( &snapshot ) );
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_StatsInit( shards, SHARD_COUNT ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_StatsInit( NULL, 0U ) );
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_stats_shardsFillCacheLines( void )
+{
+    TEST_ASSERT_EQUAL( 0U, sizeof( JobsStatsShard_t ) % JOBS_STATS_CACHE_LINE_SIZE );
+    TEST_ASSERT_GREATER_OR_EQUAL( sizeof( uint32_t ) * JobsStatsMaxCounter, sizeof( JobsStatsShard_t ) );
+
+    /* The shard arrays start on a cache line. */
+    TEST_ASSERT_EQUAL( 0U, ( uintptr_t ) shards % JOBS_STATS_CACHE_LINE_SIZE );
+    TEST_ASSERT_EQUAL( 0U, ( uintptr_t ) threadShards % JOBS_STATS_CACHE_LINE_SIZE );
+}
+
+void test_stats_countsTopicResults( void )
+{
+    char topic[] = "$aws/things/thing/jobs/job1/update/accepted";
+    char notify[] = "$aws/things/thing/jobs/notify-next";
+    char buffer[ 64 ];
+    char small[ 20 ];
+    JobsTopic_t api;
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_MatchTopic( topic, strlen( topic ), "thing", 5U, &api, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_MatchTopic( topic, strlen( topic ), "thing", 5U, &api, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_MatchTopic( notify, strlen( notify ), "thing", 5U, &api, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_MatchTopic( topic, strlen( topic ), "other", 5U, &api, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_MatchTopic( NULL, 0U, "thing", 5U, &api, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_GetPending( buffer, sizeof( buffer ), "thing", 5U, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBufferTooSmall, Jobs_StartNext( small, sizeof( small ), "thing", 5U, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_Update( buffer, sizeof( buffer ), "thing", 5U, NULL, 0U, NULL ) );
+
+    readCounters();
+    TEST_ASSERT_EQUAL( 2U, snapshot.counters[ JobsStatsMatchedUpdateSuccess ] );
+    TEST_ASSERT_EQUAL( 1U, snapshot.counters[ JobsStatsMatchedNextJobChanged ] );
+    TEST_ASSERT_EQUAL( 0U, snapshot.counters[ JobsStatsMatchedJobsChanged ] );
+    TEST_ASSERT_EQUAL( 1U, snapshot.counters[ JobsStatsNoMatch ] );
+    TEST_ASSERT_EQUAL( 2U, snapshot.counters[ JobsStatsBadParameter ] );
+    TEST_ASSERT_EQUAL( 1U, snapshot.counters[ JobsStatsBufferTooSmall ] );
+}
+
+void test_stats_countsMessages( void )
+{
+    char buffer[ 128 ];
+    JobsUpdateRequest_t request = { Succeeded, NULL, 0U, "{\"a\":\"b\"}", 9U };
+    size_t length;
+
+    length = Jobs_UpdateMsg( request, buffer, sizeof( buffer ) );
+    TEST_ASSERT_GREATER_THAN( 0U, length );
+
+    /* Computing the length builds no message. */
+    TEST_ASSERT_EQUAL( length, Jobs_UpdateMsgWithOptions( request, NULL, NULL, 0U ) );
+
+    /* A truncated message is not built. */
+    TEST_ASSERT_EQUAL( 0U, Jobs_UpdateMsg( request, buffer, length - 1U ) );
+
+    readCounters();
+    TEST_ASSERT_EQUAL( 1U, snapshot.counters[ JobsStatsUpdateMessages ] );
+    TEST_ASSERT_EQUAL( 1U, snapshot.counters[ JobsStatsBufferTooSmall ] );
+
+    /* The status details were validated twice and in full. */
+    TEST_ASSERT_EQUAL( 27U, snapshot.counters[ JobsStatsJsonBytes ] );
+}
+
+void test_stats_countsJsonBytes( void )
+{
+    const char * message = "{\"execution\":{\"jobId\":\"job1\",\"jobDocument\":{\"a\":1}},\"timestamp\":1}";
+    const char * value = NULL;
+    size_t length;
+
+    length = Jobs_GetJobDocument( message, strlen( message ), &value );
+    TEST_ASSERT_EQUAL( 7U, length );
+
+    /* The document is validated, then searched up to the end of the value. */
+    readCounters();
+    TEST_ASSERT_EQUAL( strlen( message ) + ( size_t ) ( &value[ length ] - message ),
+                       snapshot.counters[ JobsStatsJsonBytes ] );
+
+    /* A failed search covers the whole message. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_StatsInit( shards, SHARD_COUNT ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_GetJobId( "{\"a\":1}", 7U, &value ) );
+    readCounters();
+    TEST_ASSERT_EQUAL( 14U, snapshot.counters[ JobsStatsJsonBytes ] );
+}
+
+void test_stats_countsOtaParserResults( void )
+{
+    AfrOtaJobDocumentFields_t fields;
+
+    memset( &fields, 0, sizeof( fields ) );
+    TEST_ASSERT_EQUAL( 0, otaParser_parseJobDocFile( OTA_DOCUMENT, strlen( OTA_DOCUMENT ), 0U, "MQTT", 4U, &fields ) );
+    TEST_ASSERT_EQUAL( -1, otaParser_parseJobDocFile( OTA_DOCUMENT_NO_CERT, strlen( OTA_DOCUMENT_NO_CERT ), 0U, "MQTT", 4U, &fields ) );
+    TEST_ASSERT_EQUAL( -1, otaParser_parseJobDocFile( OTA_DOCUMENT, strlen( OTA_DOCUMENT ), 0U, "HTTP", 4U, &fields ) );
+    TEST_ASSERT_EQUAL( -1, otaParser_parseJobDocFile( OTA_DOCUMENT_NO_URL, strlen( OTA_DOCUMENT_NO_URL ), 0U, "HTTP", 4U, &fields ) );
+
+    readCounters();
+    TEST_ASSERT_EQUAL( 1U, snapshot.counters[ JobsStatsOtaParsed ] );
+    TEST_ASSERT_EQUAL( 3U, snapshot.counters[ JobsStatsOtaFailed ] );
+    TEST_ASSERT_EQUAL( 1U, snapshot.counters[ JobsStatsOtaBadCertFile ] );
+    TEST_ASSERT_EQUAL( 1U, snapshot.counters[ JobsStatsOtaBadProtocol ] );
+    TEST_ASSERT_EQUAL( 1U, snapshot.counters[ JobsStatsOtaBadFileType ] );
+    TEST_ASSERT_EQUAL( 0U, snapshot.counters[ JobsStatsOtaBadFileSize ] );
+    TEST_ASSERT_EQUAL( 0U, snapshot.counters[ JobsStatsOtaBadStreamName ] );
+    TEST_ASSERT_GREATER_THAN( strlen( OTA_DOCUMENT ), snapshot.counters[ JobsStatsJsonBytes ] );
+}
+
+void test_stats_readMergesShards( void )
+{
+    Jobs_StatsAdd( JobsStatsNoMatch, 3U );
+    shards[ 1 ].counters[ JobsStatsNoMatch ] = 4U;
+    shards[ 1 ].counters[ JobsStatsJsonBytes ] = UINT32_MAX;
+    Jobs_StatsAdd( JobsStatsJsonBytes, 2U );
+
+    /* Unknown counters and empty amounts are dropped. */
+    Jobs_StatsAdd( JobsStatsMaxCounter, 1U );
+    Jobs_StatsAdd( JobsStatsBadParameter, 0U );
+    Jobs_StatsTopic( JobsSuccess, JobsMaxTopic );
+    Jobs_StatsTopic( JobsError, JobsJobsChanged );
+
+    readCounters();
+    TEST_ASSERT_EQUAL( 7U, snapshot.counters[ JobsStatsNoMatch ] );
+
+    /* Counters wrap. */
+    TEST_ASSERT_EQUAL( 1U, snapshot.counters[ JobsStatsJsonBytes ] );
+    TEST_ASSERT_EQUAL( 0U, snapshot.counters[ JobsStatsBadParameter ] );
+    TEST_ASSERT_EQUAL( 0U, snapshot.counters[ JobsStatsMatchedJobsChanged ] );
+    TEST_ASSERT_EQUAL( 0U, snapshot.counters[ JobsStatsMatchedUpdateFailed ] );
+}
+
+void test_stats_initAndReadParameters( void )
+{
+    Jobs_StatsAdd( JobsStatsNoMatch, 1U );
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_StatsInit( shards, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_StatsRead( NULL ) );
+
+    /* Shards must start on a cache line. */
+    TEST_ASSERT_EQUAL( JobsBadParameter,
+                       Jobs_StatsInit( ( JobsStatsShard_t * ) ( ( uintptr_t ) shards + sizeof( uint32_t ) ), 1U ) );
+
+    /* Without shards nothing is counted. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_StatsInit( NULL, 0U ) );
+    Jobs_StatsAdd( JobsStatsNoMatch, 1U );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_StatsRead( &snapshot ) );
+    TEST_ASSERT_EQUAL( 0U, snapshot.counters[ JobsStatsNoMatch ] );
+    TEST_ASSERT_EQUAL( 1U, shards[ 0 ].counters[ JobsStatsNoMatch ] );
+
+    /* Registering zeroes the shards. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_StatsInit( shards, SHARD_COUNT ) );
+    readCounters();
+    TEST_ASSERT_EQUAL( 0U, snapshot.counters[ JobsStatsNoMatch ] );
+}
+
+void test_stats_threadsCountInOwnShards( void )
+{
+    pthread_t threads[ THREAD_COUNT ];
+    size_t index;
+    uint32_t i;
+
+    /* The calling thread keeps its index. */
+    index = Jobs_StatsShardIndex();
+    TEST_ASSERT_EQUAL( index, Jobs_StatsShardIndex() );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_StatsInit( threadShards, THREAD_COUNT + 1U ) );
+
+    for( i = 0U; i < THREAD_COUNT; i++ )
+    {
+        TEST_ASSERT_EQUAL( 0, pthread_create( &threads[ i ], NULL, countMessages, NULL ) );
+    }
+
+    for( i = 0U; i < THREAD_COUNT; i++ )
+    {
+        TEST_ASSERT_EQUAL( 0, pthread_join( threads[ i ], NULL ) );
+    }
+
+    /* No count is lost to another thread writing the same shard. */
+    readCounters();
+    TEST_ASSERT_EQUAL( THREAD_COUNT * THREAD_ADDS, snapshot.counters[ JobsStatsNoMatch ] );
+
+    for( i = 0U; i <= THREAD_COUNT; i++ )
+    {
+        TEST_ASSERT_LESS_OR_EQUAL( THREAD_ADDS, threadShards[ i ].counters[ JobsStatsNoMatch ] );
+    }
+}
+
+void test_stats_threadsShareShardsWithoutLosingCounts( void )
+{
+    pthread_t threads[ THREAD_COUNT ];
+    uint32_t i;
+
+    /* Every thread counts into the same shard. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_StatsInit( threadShards, 1U ) );
+
+    for( i = 0U; i < THREAD_COUNT; i++ )
+    {
+        TEST_ASSERT_EQUAL( 0, pthread_create( &threads[ i ], NULL, countMessages, NULL ) );
+    }
+
+    for( i = 0U; i < THREAD_COUNT; i++ )
+    {
+        TEST_ASSERT_EQUAL( 0, pthread_join( threads[ i ], NULL ) );
+    }
+
+    readCounters();
+    TEST_ASSERT_EQUAL( THREAD_COUNT * THREAD_ADDS, snapshot.counters[ JobsStatsNoMatch ] );
+}
@@ -0,0 +1,157 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_summary_utest.c
+ * @brief Unit tests for the job summary iterator.
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "jobs_summary.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+static JobsSummaryIterator_t iterator;
+static JobsJobSummary_t summary;
+
+/**
+ * @brief Check the next summary of the iterator.
+ */
+static void assertNext( const char * message,
+                        const char * jobId,
+                        JobCurrentStatus_t status,
+                        uint32_t executionNumber,
+                        uint32_t versionNumber )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SummaryNext( &iterator, &summary ) );
+    TEST_ASSERT_EQUAL( strlen( jobId ), summary.jobIdLength );
+    TEST_ASSERT_EQUAL_MEMORY( jobId, summary.jobId, summary.jobIdLength );
+    TEST_ASSERT_TRUE( ( summary.jobId > message ) && ( summary.jobId < &message[ strlen( message ) ] ) );
+    TEST_ASSERT_EQUAL( status, summary.status );
+    TEST_ASSERT_EQUAL( executionNumber, summary.executionNumber );
+    TEST_ASSERT_EQUAL( versionNumber, summary.versionNumber );
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    memset( &iterator, 0, sizeof( iterator ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_summary_rejectsBadParameters( void )
+{
+    const char * message = "{\"timestamp\":1}";
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SummaryInit( NULL, JobsJobsChanged, message, strlen( message ) ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SummaryInit( &iterator, JobsJobsChanged, NULL, 1U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SummaryInit( &iterator, JobsNextJobChanged, message, strlen( message ) ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SummaryInit( &iterator, JobsJobsChanged, message, strlen( message ) - 1U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SummaryNext( &iterator, &summary ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SummaryInit( &iterator, JobsJobsChanged, message, strlen( message ) ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SummaryNext( NULL, &summary ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_SummaryNext( &iterator, NULL ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_SummaryNext( &iterator, &summary ) );
+}
+
+void test_summary_walksJobsChanged( void )
+{
+    const char * message = "{\"timestamp\":1700000100,\"jobs\":{"
+                           "\"QUEUED\":[{\"jobId\":\"q1\",\"queuedAt\":1700000000,"
+                           "\"lastUpdatedAt\":1700000001,\"executionNumber\":1,\"versionNumber\":1},"
+                           "{\"jobId\":\"q2\",\"queuedAt\":1700000002,\"executionNumber\":3,\"versionNumber\":2}],"
+                           "\"IN_PROGRESS\":[{\"jobId\":\"p1\",\"queuedAt\":1600000000,"
+                           "\"lastUpdatedAt\":1600000005,\"executionNumber\":2,\"versionNumber\":7}]}}";
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SummaryInit( &iterator, JobsJobsChanged, message, strlen( message ) ) );
+
+    /* In progress jobs come first. */
+    assertNext( message, "p1", InProgress, 2U, 7U );
+    TEST_ASSERT_EQUAL( 1600000000U, summary.queuedAt );
+    TEST_ASSERT_EQUAL( 1600000005U, summary.lastUpdatedAt );
+    assertNext( message, "q1", Queued, 1U, 1U );
+    TEST_ASSERT_EQUAL( 1700000000U, summary.queuedAt );
+    assertNext( message, "q2", Queued, 3U, 2U );
+    TEST_ASSERT_EQUAL( 0U, summary.lastUpdatedAt );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_SummaryNext( &iterator, &summary ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_SummaryNext( &iterator, &summary ) );
+}
+
+void test_summary_walksGetPending( void )
+{
+    const char * message = "{\"clientToken\":\"token\",\"timestamp\":1,"
+                           "\"inProgressJobs\":[],"
+                           "\"queuedJobs\":[{\"jobId\":\"q1\",\"executionNumber\":1,\"versionNumber\":1},"
+                           "{\"jobId\":\"q2\",\"executionNumber\":2,\"versionNumber\":2},"
+                           "{\"jobId\":\"q3\",\"executionNumber\":3,\"versionNumber\":3}]}";
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SummaryInit( &iterator, JobsGetPendingSuccess, message, strlen( message ) ) );
+    assertNext( message, "q1", Queued, 1U, 1U );
+
+    /* Iteration may stop at any point, and restart. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SummaryInit( &iterator, JobsGetPendingSuccess, message, strlen( message ) ) );
+    assertNext( message, "q1", Queued, 1U, 1U );
+    assertNext( message, "q2", Queued, 2U, 2U );
+    assertNext( message, "q3", Queued, 3U, 3U );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_SummaryNext( &iterator, &summary ) );
+
+    /* The lists of the other topic are not read. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SummaryInit( &iterator, JobsJobsChanged, message, strlen( message ) ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_SummaryNext( &iterator, &summary ) );
+}
+
+void test_summary_skipsInvalidEntries( void )
+{
+    const char * message = "{\"inProgressJobs\":{\"jobId\":\"p0\"},"
+                           "\"queuedJobs\":[1,\"q0\",{\"jobId\":7},{\"jobId\":\"bad id\"},"
+                           "{\"versionNumber\":2},{\"jobId\":\"q1\",\"executionNumber\":\"x\","
+                           "\"versionNumber\":-1,\"status\":\"QUEUED\"}]}";
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_SummaryInit( &iterator, JobsGetPendingSuccess, message, strlen( message ) ) );
+    assertNext( message, "q1", Queued, 0U, 0U );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_SummaryNext( &iterator, &summary ) );
+}
@@ -0,0 +1,244 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_timer_utest.c
+ * @brief Unit tests for the job deadline timing wheel.
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "jobs_timer.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+#define TICK_MS        1000U
+#define TIMER_COUNT    100000U
+
+static JobsTimerWheel_t wheel;
+static JobsTimer_t timers[ TIMER_COUNT ];
+static uint32_t deadlines[ TIMER_COUNT ];
+static uint32_t firedAt[ TIMER_COUNT ];
+static char buffer[ 256 ];
+static char lastMessage[ 256 ];
+static size_t fired;
+static uint32_t nowMs;
+
+/**
+ * @brief Record the expiry of a timer.
+ */
+static void onExpired( JobsTimer_t * timer,
+                       const char * message,
+                       size_t messageLength,
+                       void * pContext )
+{
+    ( void ) pContext;
+
+    firedAt[ timer - timers ] = nowMs;
+    memcpy( lastMessage, message, messageLength );
+    lastMessage[ messageLength ] = '\0';
+    fired++;
+}
+
+/**
+ * @brief Cancel the timer given as context when a timer expires.
+ */
+static void cancelOther( JobsTimer_t * timer,
+                         const char * message,
+                         size_t messageLength,
+                         void * pContext )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_TimerCancel( &wheel, ( JobsTimer_t * ) pContext ) );
+    onExpired( timer, message, messageLength, NULL );
+}
+
+/**
+ * @brief Advance the wheel.
+ */
+static void advance( uint32_t toMs )
+{
+    nowMs = toMs;
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_TimerAdvance( &wheel, nowMs, buffer, sizeof( buffer ), onExpired, NULL ) );
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    memset( timers, 0, sizeof( timers ) );
+    memset( firedAt, 0, sizeof( firedAt ) );
+    fired = 0U;
+    nowMs = 0U;
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_TimerInit( &wheel, 0U, TICK_MS ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_timer_rejectsBadParameters( void )
+{
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_TimerInit( NULL, 0U, TICK_MS ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_TimerInit( &wheel, 0U, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_TimerArm( &wheel, NULL, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_TimerCancel( NULL, &timers[ 0 ] ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_TimerCancel( &wheel, &timers[ 0 ] ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_TimerAdvance( &wheel, 0U, buffer, sizeof( buffer ), NULL, NULL ) );
+}
+
+void test_timer_expiresWithFailedUpdate( void )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_TimerArm( &wheel, &timers[ 0 ], 2500U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_TimerArm( &wheel, &timers[ 1 ], 1000U ) );
+
+    /* Re-arming moves the deadline. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_TimerArm( &wheel, &timers[ 1 ], 5000U ) );
+
+    advance( 2999U );
+    TEST_ASSERT_EQUAL( 0U, fired );
+    advance( 3000U );
+    TEST_ASSERT_EQUAL( 1U, fired );
+    TEST_ASSERT_EQUAL( 3000U, firedAt[ 0 ] );
+    TEST_ASSERT_EQUAL_STRING( "{\"status\":\"FAILED\",\"statusDetails\":" JOBS_TIMER_STATUS_DETAILS "}", lastMessage );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_TimerCancel( &wheel, &timers[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_TimerCancel( &wheel, &timers[ 1 ] ) );
+    advance( 10000U );
+    TEST_ASSERT_EQUAL( 1U, fired );
+
+    /* A passed deadline expires on the next tick. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_TimerArm( &wheel, &timers[ 2 ], 0U ) );
+    advance( 11000U );
+    TEST_ASSERT_EQUAL( 2U, fired );
+}
+
+void test_timer_reportsLinkedExecution( void )
+{
+    JobsExecution_t execution;
+    JobsExecutionAction_t action;
+    const char * accepted = "{\"execution\":{\"jobId\":\"job1\",\"status\":\"IN_PROGRESS\","
+                            "\"versionNumber\":3,\"executionNumber\":2}}";
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionInit( &execution ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionStart( &execution, 0U, &action ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_ExecutionHandle( &execution, JobsStartNextSuccess, NULL, 0U,
+                                                          accepted, strlen( accepted ), 0U, &action ) );
+
+    timers[ 0 ].pExecution = &execution;
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_TimerArm( &wheel, &timers[ 0 ], 60000U ) );
+    advance( 60000U );
+    TEST_ASSERT_EQUAL( 1U, fired );
+    TEST_ASSERT_EQUAL_STRING( "{\"status\":\"FAILED\",\"expectedVersion\":\"3\",\"executionNumber\":2,"
+                              "\"includeJobExecutionState\":false,\"includeJobDocument\":false,"
+                              "\"statusDetails\":" JOBS_TIMER_STATUS_DETAILS "}", lastMessage );
+    TEST_ASSERT_EQUAL( JobsExecutionUpdating, execution.state );
+}
+
+void test_timer_callbackMayCancelOtherTimers( void )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_TimerArm( &wheel, &timers[ 0 ], 1000U ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_TimerArm( &wheel, &timers[ 1 ], 1000U ) );
+
+    nowMs = 1000U;
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_TimerAdvance( &wheel, nowMs, buffer, sizeof( buffer ),
+                                                       cancelOther, &timers[ 0 ] ) );
+    TEST_ASSERT_EQUAL( 1U, fired );
+    TEST_ASSERT_EQUAL( 1000U, firedAt[ 1 ] );
+}
+
+/**
+ * @brief Arm 100000 timers with deadlines spread over the stepTimeout
+ * range, cancel a third of them, and step a fake clock until every timer
+ * expired, checking each expires on its deadline rounded up to a tick.
+ */
+void test_timer_simulated100kTimers( void )
+{
+    uint32_t seed = 1U;
+    size_t i;
+    size_t cancelled = 0U;
+
+    for( i = 0U; i < TIMER_COUNT; i++ )
+    {
+        seed = ( seed * 1103515245U ) + 12345U;
+        deadlines[ i ] = 1U + ( seed % ( JOBS_STEP_TIMEOUT_MAX_MINUTES * 60000U ) );
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_TimerArm( &wheel, &timers[ i ], deadlines[ i ] ) );
+    }
+
+    for( i = 0U; i < TIMER_COUNT; i += 3U )
+    {
+        TEST_ASSERT_EQUAL( JobsSuccess, Jobs_TimerCancel( &wheel, &timers[ i ] ) );
+        cancelled++;
+    }
+
+    /* Advance by uneven steps, several ticks at a time. */
+    while( wheel.count > 0U )
+    {
+        advance( nowMs + ( 7U * TICK_MS ) + 500U );
+    }
+
+    TEST_ASSERT_EQUAL( TIMER_COUNT - cancelled, fired );
+
+    for( i = 0U; i < TIMER_COUNT; i++ )
+    {
+        if( ( i % 3U ) == 0U )
+        {
+            TEST_ASSERT_EQUAL( 0U, firedAt[ i ] );
+        }
+        else
+        {
+            /* Expired on the first advance reaching the deadline tick. */
+            TEST_ASSERT_TRUE( firedAt[ i ] >= deadlines[ i ] );
+            TEST_ASSERT_TRUE( ( firedAt[ i ] - deadlines[ i ] ) < ( 8U * TICK_MS ) + 500U + TICK_MS );
+        }
+    }
+}
+
+void test_timer_clampsFarDeadlines( void )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_TimerInit( &wheel, 0U, 1U ) );
+    /* 2^24 + 2^20 ticks is beyond the 2^24 ticks of the levels. */
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_TimerArm( &wheel, &timers[ 0 ], 0x01100000U ) );
+
+    advance( 0x010FFFFFU );
+    TEST_ASSERT_EQUAL( 0U, fired );
+    advance( 0x01100000U );
+    TEST_ASSERT_EQUAL( 1U, fired );
+}
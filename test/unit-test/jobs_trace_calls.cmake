@@ -0,0 +1,36 @@
+# Check that the library calls coreJSON only through the hooks of
+# jobs_trace.h, so every search and validation is traced and counted.
+#
+# Usage:
+#   cmake -DROOT=<repository root> -P jobs_trace_calls.cmake
+#
+# jobs_trace.c and jobs_stats.c define the wrappers the hooks expand to,
+# so they are the only sources allowed to call coreJSON directly. A call is
+# a coreJSON function name followed by an argument list; mentions such as
+# "JSON_SearchConst()" in comments are not calls.
+cmake_minimum_required(VERSION 3.15)
+
+if(NOT DEFINED ROOT)
+  message(FATAL_ERROR "ROOT must be defined.")
+endif()
+
+file(GLOB sources "${ROOT}/source/*.c" "${ROOT}/source/otaJobParser/*.c")
+list(FILTER sources EXCLUDE REGEX "/jobs_(trace|stats)\\.c$")
+
+set(failures "")
+
+foreach(source IN LISTS sources)
+  file(READ "${source}" text)
+  string(REGEX MATCHALL "JSON_(Search|SearchConst|Validate)\\([^)]" calls "${text}")
+  list(LENGTH calls count)
+
+  if(count GREATER 0)
+    file(RELATIVE_PATH name "${ROOT}" "${source}")
+    string(APPEND failures "  ${name}: ${count} direct call(s)\n")
+  endif()
+endforeach()
+
+if(NOT failures STREQUAL "")
+  message(FATAL_ERROR "Use JOBS_TRACE_JSON_SEARCH and JOBS_TRACE_JSON_VALIDATE "
+                      "instead of calling coreJSON directly:\n${failures}")
+endif()
@@ -0,0 +1,245 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_trace_utest.c
+ * @brief Unit tests for the instrumentation hooks, built with
+ * JOBS_TRACE_ENABLED set to 1.
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "jobs.h"
+#include "jobs_trace.h"
+#include "ota_job_processor.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+#define MAX_EVENTS    64U
+
+#define OTA_DOCUMENT                                                                      \
+    "{\"afr_ota\":{\"protocols\":[\"MQTT\"],\"streamname\":\"stream\",\"files\":[{"       \
+    "\"filepath\":\"/image.bin\",\"filesize\":1024,\"fileid\":0,\"certfile\":\"/cert\"," \
+    "\"sig-sha256-ecdsa\":\"c2ln\"}]}}"
+
+static JobsTraceEvent_t events[ MAX_EVENTS ];
+static size_t eventCount;
+static JobsTraceHistogram_t histogram;
+
+/**
+ * @brief A sink recording events.
+ */
+static void recordEvent( void * pContext,
+                         const JobsTraceEvent_t * event )
+{
+    TEST_ASSERT_EQUAL_PTR( &eventCount, pContext );
+    TEST_ASSERT_LESS_THAN( MAX_EVENTS, eventCount );
+    events[ eventCount ] = *event;
+    eventCount++;
+}
+
+/**
+ * @brief Check a recorded event.
+ */
+static void assertEvent( size_t index,
+                         JobsTracePoint_t point,
+                         size_t bytes,
+                         int32_t result )
+{
+    TEST_ASSERT_LESS_THAN( eventCount, index );
+    TEST_ASSERT_EQUAL( point, events[ index ].point );
+    TEST_ASSERT_EQUAL( bytes, events[ index ].bytes );
+    TEST_ASSERT_EQUAL( result, events[ index ].result );
+}
+
+/**
+ * @brief Feed an event to the histogram sink.
+ */
+static void addEvent( JobsTracePoint_t point,
+                      uint32_t cycles,
+                      size_t bytes )
+{
+    JobsTraceEvent_t event = { point, cycles, bytes, 0 };
+
+    Jobs_TraceHistogramSink( &histogram, &event );
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    eventCount = 0U;
+    memset( &histogram, 0, sizeof( histogram ) );
+    Jobs_TraceSetSink( recordEvent, &eventCount );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+    Jobs_TraceSetSink( NULL, NULL );
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_trace_reportsTopicFunctions( void )
+{
+    char topic[] = "$aws/things/thing/jobs/job1/update/accepted";
+    char buffer[ 64 ];
+    size_t length = 0U;
+    JobsTopic_t api;
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_MatchTopic( topic, strlen( topic ), "thing", 5U, &api, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_MatchTopic( topic, strlen( topic ), "other", 5U, &api, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_StartNext( buffer, sizeof( buffer ), "thing", 5U, &length ) );
+    TEST_ASSERT_TRUE( Jobs_IsStartNextAccepted( "$aws/things/thing/jobs/start-next/accepted", 42U, "thing", 5U ) );
+
+    TEST_ASSERT_EQUAL( 4U, eventCount );
+    assertEvent( 0U, JobsTraceMatchTopic, strlen( topic ), JobsSuccess );
+    assertEvent( 1U, JobsTraceMatchTopic, strlen( topic ), JobsNoMatch );
+    assertEvent( 2U, JobsTraceStartNext, length, JobsSuccess );
+    assertEvent( 3U, JobsTraceIsStartNextAccepted, 42U, 1 );
+
+    /* Without a sink, nothing is reported. */
+    Jobs_TraceSetSink( NULL, NULL );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_MatchTopic( topic, strlen( topic ), "thing", 5U, &api, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( 4U, eventCount );
+}
+
+void test_trace_reportsNestedCallsInnermostFirst( void )
+{
+    const char * message = "{\"execution\":{\"jobId\":\"job1\",\"jobDocument\":{\"a\":1}},\"timestamp\":1}";
+    const char * value = NULL;
+    char buffer[ 128 ];
+    JobsUpdateRequest_t request = { Succeeded, NULL, 0U, "{\"a\":\"b\"}", 9U };
+    size_t length;
+
+    length = Jobs_GetJobDocument( message, strlen( message ), &value );
+    TEST_ASSERT_EQUAL( 7U, length );
+    TEST_ASSERT_EQUAL( 3U, eventCount );
+    assertEvent( 0U, JobsTraceJsonValidate, strlen( message ), ( int32_t ) JSONSuccess );
+    assertEvent( 1U, JobsTraceJsonSearch, ( size_t ) ( &value[ length ] - message ), ( int32_t ) JSONSuccess );
+    assertEvent( 2U, JobsTraceGetJobDocument, strlen( message ), 7 );
+
+    /* A failed search covers the whole message. */
+    eventCount = 0U;
+    TEST_ASSERT_EQUAL( 0U, Jobs_GetJobId( "{\"a\":1}", 7U, &value ) );
+    assertEvent( 1U, JobsTraceJsonSearch, 7U, ( int32_t ) JSONNotFound );
+    assertEvent( 2U, JobsTraceGetJobId, 7U, 0 );
+
+    eventCount = 0U;
+    length = Jobs_UpdateMsg( request, buffer, sizeof( buffer ) );
+    TEST_ASSERT_GREATER_THAN( 0U, length );
+    TEST_ASSERT_EQUAL( 3U, eventCount );
+    assertEvent( 0U, JobsTraceJsonValidate, 9U, ( int32_t ) JSONSuccess );
+    assertEvent( 1U, JobsTraceUpdateMsgWithOptions, length, ( int32_t ) length );
+    assertEvent( 2U, JobsTraceUpdateMsg, length, ( int32_t ) length );
+}
+
+void test_trace_reportsOtaParser( void )
+{
+    AfrOtaJobDocumentFields_t fields;
+    size_t i;
+    size_t searches = 0U;
+
+    memset( &fields, 0, sizeof( fields ) );
+    TEST_ASSERT_EQUAL( 0, otaParser_parseJobDocFile( OTA_DOCUMENT, strlen( OTA_DOCUMENT ), 0U, "MQTT", 4U, &fields ) );
+    TEST_ASSERT_EQUAL( 1024U, fields.fileSize );
+
+    for( i = 0U; i < eventCount; i++ )
+    {
+        TEST_ASSERT_LESS_OR_EQUAL( strlen( OTA_DOCUMENT ), events[ i ].bytes );
+        searches += ( events[ i ].point == JobsTraceJsonSearch ) ? 1U : 0U;
+    }
+
+    /* Every field read is a search. */
+    TEST_ASSERT_GREATER_OR_EQUAL( 8U, searches );
+    assertEvent( eventCount - 2U, JobsTraceJsonSearch, strlen( OTA_DOCUMENT ), ( int32_t ) JSONNotFound );
+    assertEvent( eventCount - 1U, JobsTraceParseJobDocFile, strlen( OTA_DOCUMENT ), 0 );
+
+    i = 0U;
+
+    while( ( i < eventCount ) && ( events[ i ].point != JobsTracePopulateJobDocFields ) )
+    {
+        i++;
+    }
+
+    TEST_ASSERT_LESS_THAN( eventCount, i );
+    assertEvent( i, JobsTracePopulateJobDocFields, strlen( OTA_DOCUMENT ), 1 );
+}
+
+void test_trace_histogramAccumulatesPerFunction( void )
+{
+    uint32_t i;
+
+    for( i = 1U; i <= 100U; i++ )
+    {
+        addEvent( JobsTraceMatchTopic, i * 10U, 40U );
+    }
+
+    addEvent( JobsTraceJsonSearch, 0U, 5U );
+    addEvent( JobsTraceJsonSearch, UINT32_MAX, 5U );
+
+    /* Events of unknown functions are dropped. */
+    addEvent( JobsTraceMaxPoint, 1U, 1U );
+    Jobs_TraceHistogramSink( NULL, &events[ 0 ] );
+    Jobs_TraceHistogramSink( &histogram, NULL );
+
+    TEST_ASSERT_EQUAL( 100U, histogram.points[ JobsTraceMatchTopic ].count );
+    TEST_ASSERT_EQUAL( 1000U, histogram.points[ JobsTraceMatchTopic ].maxCycles );
+    TEST_ASSERT_EQUAL( 50500U, histogram.points[ JobsTraceMatchTopic ].totalCycles );
+    TEST_ASSERT_EQUAL( 4000U, histogram.points[ JobsTraceMatchTopic ].totalBytes );
+
+    /* 10 to 1000 cycles fall in buckets 3 to 9. */
+    TEST_ASSERT_EQUAL( 1U, histogram.points[ JobsTraceMatchTopic ].buckets[ 3 ] );
+    TEST_ASSERT_EQUAL( 49U, histogram.points[ JobsTraceMatchTopic ].buckets[ 9 ] );
+    TEST_ASSERT_EQUAL( 1U, histogram.points[ JobsTraceJsonSearch ].buckets[ 0 ] );
+    TEST_ASSERT_EQUAL( 1U, histogram.points[ JobsTraceJsonSearch ].buckets[ 31 ] );
+
+    /* The 50th call, 500 cycles, is in bucket 8, up to 511. */
+    TEST_ASSERT_EQUAL( 511U, Jobs_TraceHistogramPercentile( &histogram, JobsTraceMatchTopic, 50U ) );
+    TEST_ASSERT_EQUAL( 15U, Jobs_TraceHistogramPercentile( &histogram, JobsTraceMatchTopic, 1U ) );
+    TEST_ASSERT_EQUAL( 1000U, Jobs_TraceHistogramPercentile( &histogram, JobsTraceMatchTopic, 100U ) );
+    TEST_ASSERT_EQUAL( 1U, Jobs_TraceHistogramPercentile( &histogram, JobsTraceJsonSearch, 50U ) );
+    TEST_ASSERT_EQUAL( UINT32_MAX, Jobs_TraceHistogramPercentile( &histogram, JobsTraceJsonSearch, 100U ) );
+
+    TEST_ASSERT_EQUAL( 0U, Jobs_TraceHistogramPercentile( &histogram, JobsTraceGetTopic, 50U ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_TraceHistogramPercentile( &histogram, JobsTraceMatchTopic, 0U ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_TraceHistogramPercentile( &histogram, JobsTraceMatchTopic, 101U ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_TraceHistogramPercentile( &histogram, JobsTraceMaxPoint, 50U ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_TraceHistogramPercentile( NULL, JobsTraceMatchTopic, 50U ) );
+}
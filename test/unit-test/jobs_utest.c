@@ -35,6 +35,7 @@
 
 /* Include paths for public enums, structures, and macros. */
 #include "jobs.h"
+#include "jobs_internal.h"
 #include "jobs_annex.h"
 
 /* thing name */
@@ -1036,3 +1037,286 @@ void test_getUpdateJobExecutionMsg_hasRequiredValidParameters( void )
     TEST_ASSERT_EQUAL( 19U, result );
     TEST_ASSERT_EQUAL_STRING( "{\"status\":\"QUEUED\"}", buffer );
 }
+
+void test_getUpdateJobExecutionMsgWithOptions_hasAllOptions( void )
+{
+    char buffer[ TOPIC_BUFFER_SIZE + 1 ] = { 0 };
+    const char expected[] = "{\"status\":\"IN_PROGRESS\",\"expectedVersion\":\"3\",\"executionNumber\":42,"
+                            "\"includeJobExecutionState\":true,\"includeJobDocument\":false,"
+                            "\"stepTimeoutInMinutes\":10080,\"statusDetails\":{\"step\":\"2\"},"
+                            "\"clientToken\":\"abc\"}";
+    JobsUpdateRequest_t request =
+    {
+        InProgress,
+        "3",
+        strlen( "3" ),
+        "{\"step\":\"2\"}",
+        strlen( "{\"step\":\"2\"}" )
+    };
+    JobsUpdateOptions_t options =
+    {
+        "abc",
+        strlen( "abc" ),
+        42U,
+        JOBS_STEP_TIMEOUT_MAX_MINUTES,
+        JobsOptionTrue,
+        JobsOptionFalse
+    };
+
+    size_t length = Jobs_UpdateMsgWithOptions( request, &options, NULL, 0U );
+    size_t result = Jobs_UpdateMsgWithOptions( request, &options, buffer, length );
+
+    TEST_ASSERT_EQUAL( strlen( expected ), length );
+    TEST_ASSERT_EQUAL( length, result );
+    TEST_ASSERT_EQUAL_STRING( expected, buffer );
+    TEST_ASSERT_EQUAL( 0U, Jobs_UpdateMsgWithOptions( request, &options, buffer, length - 1U ) );
+}
+
+void test_getUpdateJobExecutionMsgWithOptions_omitsDefaults( void )
+{
+    char buffer[ TOPIC_BUFFER_SIZE + 1 ] = { 0 };
+    JobsUpdateRequest_t request = { Succeeded, NULL, 0, NULL, 0 };
+    JobsUpdateOptions_t options = { 0 };
+
+    size_t result = Jobs_UpdateMsgWithOptions( request, &options, buffer, TOPIC_BUFFER_SIZE );
+
+    TEST_ASSERT_EQUAL( 22U, result );
+    TEST_ASSERT_EQUAL_STRING( "{\"status\":\"SUCCEEDED\"}", buffer );
+    TEST_ASSERT_EQUAL( result, Jobs_UpdateMsgWithOptions( request, NULL, NULL, 0U ) );
+}
+
+void test_getUpdateJobExecutionMsgWithOptions_hasInvalidOptions( void )
+{
+    char buffer[ TOPIC_BUFFER_SIZE + 1 ] = { 0 };
+    JobsUpdateRequest_t request = { Succeeded, NULL, 0, NULL, 0 };
+    JobsUpdateOptions_t options = { 0 };
+
+    options.clientToken = "a\"b";
+    options.clientTokenLength = strlen( "a\"b" );
+    TEST_ASSERT_EQUAL( 0U, Jobs_UpdateMsgWithOptions( request, &options, buffer, TOPIC_BUFFER_SIZE ) );
+
+    options.clientToken = "abc";
+    options.clientTokenLength = JOBS_CLIENT_TOKEN_MAX_LENGTH + 1U;
+    TEST_ASSERT_EQUAL( 0U, Jobs_UpdateMsgWithOptions( request, &options, buffer, TOPIC_BUFFER_SIZE ) );
+
+    options.clientToken = "a\\b";
+    options.clientTokenLength = strlen( "a\\b" );
+    TEST_ASSERT_EQUAL( 0U, Jobs_UpdateMsgWithOptions( request, &options, buffer, TOPIC_BUFFER_SIZE ) );
+
+    options.clientToken = "abc";
+    options.clientTokenLength = strlen( "abc" );
+    options.stepTimeoutInMinutes = JOBS_STEP_TIMEOUT_MAX_MINUTES + 1U;
+    TEST_ASSERT_EQUAL( 0U, Jobs_UpdateMsgWithOptions( request, &options, buffer, TOPIC_BUFFER_SIZE ) );
+
+    /* A token of zero length is omitted, not rejected. */
+    options.clientTokenLength = 0U;
+    options.stepTimeoutInMinutes = 0U;
+    TEST_ASSERT_EQUAL( strlen( "{\"status\":\"SUCCEEDED\"}" ),
+                       Jobs_UpdateMsgWithOptions( request, &options, buffer, TOPIC_BUFFER_SIZE ) );
+    TEST_ASSERT_EQUAL_STRING( "{\"status\":\"SUCCEEDED\"}", buffer );
+}
+
+void test_getUpdateJobExecutionMsg_hasNullBuffer( void )
+{
+    JobsUpdateRequest_t request = { Succeeded, NULL, 0, NULL, 0 };
+
+    TEST_ASSERT_EQUAL( 0U, Jobs_UpdateMsg( request, NULL, TOPIC_BUFFER_SIZE ) );
+}
+
+void test_getStartNextMsgWithOptions_hasAllValidParameters( void )
+{
+    char buffer[ TOPIC_BUFFER_SIZE + 1 ] = { 0 };
+    JobsStartNextRequest_t request =
+    {
+        "token",
+        strlen( "token" ),
+        "{\"key\":\"value\"}",
+        strlen( "{\"key\":\"value\"}" ),
+        5U
+    };
+
+    size_t result = Jobs_StartNextMsgWithOptions( &request, buffer, TOPIC_BUFFER_SIZE );
+
+    TEST_ASSERT_EQUAL_STRING( "{\"statusDetails\":{\"key\":\"value\"},\"stepTimeoutInMinutes\":5,\"clientToken\":\"token\"}", buffer );
+    TEST_ASSERT_EQUAL( strlen( buffer ), result );
+    TEST_ASSERT_EQUAL( result, Jobs_StartNextMsgWithOptions( &request, NULL, 0U ) );
+}
+
+void test_getStartNextMsgWithOptions_hasInvalidParameters( void )
+{
+    char buffer[ TOPIC_BUFFER_SIZE + 1 ] = { 0 };
+    JobsStartNextRequest_t request = { NULL, 0U, "malformed", strlen( "malformed" ), 0U };
+
+    TEST_ASSERT_EQUAL( 0U, Jobs_StartNextMsgWithOptions( NULL, buffer, TOPIC_BUFFER_SIZE ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_StartNextMsgWithOptions( &request, buffer, TOPIC_BUFFER_SIZE ) );
+
+    request.statusDetails = NULL;
+    request.statusDetailsLength = 0U;
+    request.clientToken = "a\"b";
+    request.clientTokenLength = strlen( "a\"b" );
+    TEST_ASSERT_EQUAL( 0U, Jobs_StartNextMsgWithOptions( &request, buffer, TOPIC_BUFFER_SIZE ) );
+
+    request.clientToken = NULL;
+    request.clientTokenLength = 0U;
+    request.stepTimeoutInMinutes = JOBS_STEP_TIMEOUT_MAX_MINUTES + 1U;
+    TEST_ASSERT_EQUAL( 0U, Jobs_StartNextMsgWithOptions( &request, buffer, TOPIC_BUFFER_SIZE ) );
+}
+
+void test_getStartNextMsgWithOptions_hasTooSmallBuffer( void )
+{
+    char buffer[ TOPIC_BUFFER_SIZE + 1 ] = { 0 };
+    JobsStartNextRequest_t request = { "token", strlen( "token" ), NULL, 0U, 5U };
+    size_t length = Jobs_StartNextMsgWithOptions( &request, NULL, 0U );
+
+    TEST_ASSERT_EQUAL( strlen( "{\"stepTimeoutInMinutes\":5,\"clientToken\":\"token\"}" ), length );
+    TEST_ASSERT_EQUAL( 0U, Jobs_StartNextMsgWithOptions( &request, buffer, length - 1U ) );
+    TEST_ASSERT_EQUAL( length, Jobs_StartNextMsgWithOptions( &request, buffer, length ) );
+}
+
+void test_getStartNextMsgWithOptions_hasNoFields( void )
+{
+    char buffer[ TOPIC_BUFFER_SIZE + 1 ] = { 0 };
+    JobsStartNextRequest_t request = { 0 };
+
+    TEST_ASSERT_EQUAL( 2U, Jobs_StartNextMsgWithOptions( &request, buffer, TOPIC_BUFFER_SIZE ) );
+    TEST_ASSERT_EQUAL_STRING( "{}", buffer );
+}
+
+void test_getDescribeMsg_hasAllValidParameters( void )
+{
+    char buffer[ TOPIC_BUFFER_SIZE + 1 ] = { 0 };
+    JobsDescribeRequest_t request = { "t1", strlen( "t1" ), 7U, JobsOptionFalse };
+
+    size_t result = Jobs_DescribeMsg( &request, buffer, TOPIC_BUFFER_SIZE );
+
+    TEST_ASSERT_EQUAL_STRING( "{\"executionNumber\":7,\"includeJobDocument\":false,\"clientToken\":\"t1\"}", buffer );
+    TEST_ASSERT_EQUAL( strlen( buffer ), result );
+}
+
+void test_getDescribeMsg_hasTooSmallBuffer( void )
+{
+    char buffer[ TOPIC_BUFFER_SIZE + 1 ] = { 0 };
+    JobsDescribeRequest_t request = { NULL, 0U, 0U, JobsOptionTrue };
+    size_t length = Jobs_DescribeMsg( &request, NULL, 0U );
+
+    TEST_ASSERT_EQUAL( strlen( "{\"includeJobDocument\":true}" ), length );
+    TEST_ASSERT_EQUAL( 0U, Jobs_DescribeMsg( &request, buffer, length - 1U ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_DescribeMsg( NULL, buffer, TOPIC_BUFFER_SIZE ) );
+
+    request.clientToken = "a\tb";
+    request.clientTokenLength = strlen( "a\tb" );
+    TEST_ASSERT_EQUAL( 0U, Jobs_DescribeMsg( &request, buffer, TOPIC_BUFFER_SIZE ) );
+}
+
+void test_getPendingMsg_hasValidParameters( void )
+{
+    char buffer[ TOPIC_BUFFER_SIZE + 1 ] = { 0 };
+    JobsGetPendingRequest_t request = { "t2", strlen( "t2" ) };
+    JobsGetPendingRequest_t invalid = { "\n", 1U };
+
+    TEST_ASSERT_EQUAL( strlen( "{\"clientToken\":\"t2\"}" ), Jobs_GetPendingMsg( &request, buffer, TOPIC_BUFFER_SIZE ) );
+    TEST_ASSERT_EQUAL_STRING( "{\"clientToken\":\"t2\"}", buffer );
+    TEST_ASSERT_EQUAL( 0U, Jobs_GetPendingMsg( &invalid, buffer, TOPIC_BUFFER_SIZE ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_GetPendingMsg( NULL, buffer, TOPIC_BUFFER_SIZE ) );
+}
+
+void test_getPendingMsg_hasTooSmallBuffer( void )
+{
+    char buffer[ TOPIC_BUFFER_SIZE + 1 ] = { 0 };
+    JobsGetPendingRequest_t request = { "t2", strlen( "t2" ) };
+    size_t length = Jobs_GetPendingMsg( &request, NULL, 0U );
+
+    TEST_ASSERT_EQUAL( strlen( "{\"clientToken\":\"t2\"}" ), length );
+    TEST_ASSERT_EQUAL( 0U, Jobs_GetPendingMsg( &request, buffer, length - 1U ) );
+}
+
+void test_uintToString_formatsDecimal( void )
+{
+    char buffer[ JOBS_UINT32_STRING_MAX_LENGTH ] = { 0 };
+
+    TEST_ASSERT_EQUAL( 1U, Jobs_UintToString( 0U, buffer, sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL_STRING_LEN( "0", buffer, 1U );
+    TEST_ASSERT_EQUAL( 10U, Jobs_UintToString( UINT32_MAX, buffer, sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL_STRING_LEN( "4294967295", buffer, 10U );
+    TEST_ASSERT_EQUAL( 0U, Jobs_UintToString( 100U, buffer, 2U ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_UintToString( 1U, NULL, sizeof( buffer ) ) );
+}
+
+void test_stringToUint_parsesDecimal( void )
+{
+    uint32_t value = 0U;
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_StringToUint( "4294967295", 10U, &value ) );
+    TEST_ASSERT_EQUAL( UINT32_MAX, value );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_StringToUint( "12x", 2U, &value ) );
+    TEST_ASSERT_EQUAL( 12U, value );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_StringToUint( "4294967296", 10U, &value ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_StringToUint( "00000000001", 11U, &value ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_StringToUint( "-1", 2U, &value ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_StringToUint( "1", 0U, &value ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_StringToUint( "1", 1U, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_StringToUint( NULL, 1U, &value ) );
+}
+
+void test_statusFromString( void )
+{
+    JobCurrentStatus_t status = Queued;
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_StatusFromString( "IN_PROGRESS", 11U, &status ) );
+    TEST_ASSERT_EQUAL( InProgress, status );
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_StatusFromString( "REJECTED", 8U, &status ) );
+    TEST_ASSERT_EQUAL( Rejected, status );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_StatusFromString( "CANCELED", 8U, &status ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_StatusFromString( "QUEUED_", 7U, &status ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_StatusFromString( NULL, 6U, &status ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_StatusFromString( "QUEUED", 6U, NULL ) );
+}
+
+void test_fnv1a_hashesBytes( void )
+{
+    /* Published FNV-1a test vectors. */
+    TEST_ASSERT_EQUAL_UINT32( JOBS_FNV1A_OFFSET_BASIS, Jobs_Fnv1a( JOBS_FNV1A_OFFSET_BASIS, NULL, 0U ) );
+    TEST_ASSERT_EQUAL_UINT32( 0xBF9CF968U, Jobs_Fnv1a( JOBS_FNV1A_OFFSET_BASIS, "foobar", 6U ) );
+    TEST_ASSERT_EQUAL_UINT64( 0x85944171F73967E8U, Jobs_Fnv1a64( JOBS_FNV1A64_OFFSET_BASIS, "foobar", 6U ) );
+
+    /* A hash continues over several buffers. */
+    TEST_ASSERT_EQUAL_UINT32( 0xBF9CF968U, Jobs_Fnv1a( Jobs_Fnv1a( JOBS_FNV1A_OFFSET_BASIS, "foo", 3U ), "bar", 3U ) );
+    TEST_ASSERT_EQUAL_UINT64( 0x85944171F73967E8U,
+                              Jobs_Fnv1a64( Jobs_Fnv1a64( JOBS_FNV1A64_OFFSET_BASIS, "foo", 3U ), "bar", 3U ) );
+}
+
+void test_isDeadlineReached_wraps( void )
+{
+    TEST_ASSERT_TRUE( Jobs_IsDeadlineReached( 100U, 100U ) );
+    TEST_ASSERT_TRUE( Jobs_IsDeadlineReached( 101U, 100U ) );
+    TEST_ASSERT_FALSE( Jobs_IsDeadlineReached( 99U, 100U ) );
+
+    /* The clock wrapped since the deadline was set. */
+    TEST_ASSERT_TRUE( Jobs_IsDeadlineReached( 5U, UINT32_MAX - 5U ) );
+    TEST_ASSERT_FALSE( Jobs_IsDeadlineReached( UINT32_MAX - 5U, 5U ) );
+}
+
+void test_isTerminalStatus( void )
+{
+    TEST_ASSERT_FALSE( Jobs_IsTerminalStatus( Queued ) );
+    TEST_ASSERT_FALSE( Jobs_IsTerminalStatus( InProgress ) );
+    TEST_ASSERT_TRUE( Jobs_IsTerminalStatus( Failed ) );
+    TEST_ASSERT_TRUE( Jobs_IsTerminalStatus( Succeeded ) );
+    TEST_ASSERT_TRUE( Jobs_IsTerminalStatus( Rejected ) );
+}
+
+void test_isValidJobId( void )
+{
+    TEST_ASSERT_TRUE( Jobs_IsValidJobId( "job-1_a", 7U ) );
+    TEST_ASSERT_FALSE( Jobs_IsValidJobId( "job 1", 5U ) );
+    TEST_ASSERT_FALSE( Jobs_IsValidJobId( "job", 0U ) );
+    TEST_ASSERT_FALSE( Jobs_IsValidJobId( NULL, 3U ) );
+}
+
+void test_isValidThingName( void )
+{
+    TEST_ASSERT_TRUE( Jobs_IsValidThingName( "thing:1", 7U ) );
+    TEST_ASSERT_FALSE( Jobs_IsValidThingName( "thing/1", 7U ) );
+    TEST_ASSERT_FALSE( Jobs_IsValidThingName( "thing", 0U ) );
+    TEST_ASSERT_FALSE( Jobs_IsValidThingName( NULL, 5U ) );
+}
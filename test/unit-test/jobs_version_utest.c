@@ -0,0 +1,282 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_version_utest.c
+ * @brief Unit tests for the jobs version cache.
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "jobs_version.h"
+
+/* ============================   TEST GLOBALS   =============================*/
+
+#define ENTRY_COUNT    2U
+
+static JobsVersionEntry_t entries[ ENTRY_COUNT ];
+static JobsVersionCache_t cache;
+static char buffer[ 128 ];
+
+/**
+ * @brief Observe a message with a job ID from the topic.
+ */
+static JobsStatus_t observe( JobsTopic_t topic,
+                             const char * jobId,
+                             const char * message )
+{
+    return Jobs_VersionCacheObserve( &cache, topic, jobId,
+                                     ( jobId != NULL ) ? ( uint16_t ) strlen( jobId ) : 0U,
+                                     message, strlen( message ) );
+}
+
+/**
+ * @brief Get the cached version of a job, or UINT32_MAX if there is none.
+ */
+static uint32_t cachedVersion( const char * jobId )
+{
+    uint32_t version = UINT32_MAX;
+
+    ( void ) Jobs_VersionCacheGet( &cache, jobId, ( uint16_t ) strlen( jobId ), &version );
+
+    return version;
+}
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_VersionCacheInit( &cache, entries, ENTRY_COUNT ) );
+    memset( buffer, 0, sizeof( buffer ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void test_versionCache_rejectsBadParameters( void )
+{
+    uint32_t version = 0U;
+    JobsUpdateRequest_t request = { Succeeded, NULL, 0U, NULL, 0U };
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_VersionCacheInit( NULL, entries, ENTRY_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_VersionCacheInit( &cache, NULL, ENTRY_COUNT ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_VersionCacheInit( &cache, entries, 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_VersionCacheObserve( NULL, JobsUpdateSuccess, "a", 1U, "{}", 2U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_VersionCacheObserve( &cache, JobsUpdateSuccess, "a", 1U, NULL, 2U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_VersionCacheGet( &cache, "a", 0U, &version ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_VersionCacheGet( &cache, "a", 1U, NULL ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_VersionCacheRemove( &cache, NULL, 1U ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_VersionCacheUpdateMsg( &cache, NULL, 1U, request, NULL, buffer, sizeof( buffer ) ) );
+}
+
+void test_versionCache_recordsExecutionResponses( void )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess,
+                       observe( JobsStartNextSuccess, NULL,
+                                "{\"execution\":{\"jobId\":\"job1\",\"status\":\"IN_PROGRESS\",\"versionNumber\":3}}" ) );
+    TEST_ASSERT_EQUAL( 3U, cachedVersion( "job1" ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess,
+                       observe( JobsDescribeSuccess, "$next",
+                                "{\"execution\":{\"jobId\":\"job1\",\"versionNumber\":5}}" ) );
+    TEST_ASSERT_EQUAL( 5U, cachedVersion( "job1" ) );
+
+    TEST_ASSERT_EQUAL( JobsNoMatch, observe( JobsNextJobChanged, NULL, "{\"timestamp\":1}" ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch,
+                       observe( JobsStartNextSuccess, NULL,
+                                "{\"execution\":{\"jobId\":\"job1\",\"versionNumber\":-1}}" ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch,
+                       observe( JobsStartNextSuccess, NULL,
+                                "{\"execution\":{\"jobId\":\"job1\",\"versionNumber\":4294967296}}" ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, observe( JobsStartNextSuccess, NULL, "{\"execution\":" ) );
+    TEST_ASSERT_EQUAL( 5U, cachedVersion( "job1" ) );
+}
+
+void test_versionCache_tracksUpdateResponses( void )
+{
+    TEST_ASSERT_EQUAL( JobsNoMatch, observe( JobsUpdateSuccess, "job1", "{\"timestamp\":1}" ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess,
+                       observe( JobsUpdateSuccess, "job1",
+                                "{\"executionState\":{\"status\":\"IN_PROGRESS\",\"versionNumber\":2}}" ) );
+    TEST_ASSERT_EQUAL( 2U, cachedVersion( "job1" ) );
+
+    /* Without executionState the service version moved on by one. */
+    TEST_ASSERT_EQUAL( JobsSuccess, observe( JobsUpdateSuccess, "job1", "{\"timestamp\":1}" ) );
+    TEST_ASSERT_EQUAL( 3U, cachedVersion( "job1" ) );
+
+    /* A VersionMismatch rejection reports the current version. */
+    TEST_ASSERT_EQUAL( JobsSuccess,
+                       observe( JobsUpdateFailed, "job1",
+                                "{\"code\":\"VersionMismatch\",\"executionState\":{\"versionNumber\":7}}" ) );
+    TEST_ASSERT_EQUAL( 7U, cachedVersion( "job1" ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, observe( JobsUpdateFailed, "job1", "{\"code\":\"InvalidRequest\"}" ) );
+    TEST_ASSERT_EQUAL( 7U, cachedVersion( "job1" ) );
+}
+
+void test_versionCache_recordsJobSummaries( void )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess,
+                       observe( JobsGetPendingSuccess, NULL,
+                                "{\"inProgressJobs\":[{\"jobId\":\"a\",\"versionNumber\":4}],"
+                                "\"queuedJobs\":[{\"jobId\":\"b\",\"versionNumber\":1}]}" ) );
+    TEST_ASSERT_EQUAL( 4U, cachedVersion( "a" ) );
+    TEST_ASSERT_EQUAL( 1U, cachedVersion( "b" ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess,
+                       observe( JobsJobsChanged, NULL,
+                                "{\"jobs\":{\"QUEUED\":[{\"jobId\":\"b\",\"versionNumber\":2}]}}" ) );
+    TEST_ASSERT_EQUAL( 2U, cachedVersion( "b" ) );
+
+    TEST_ASSERT_EQUAL( JobsNoMatch, observe( JobsGetPendingSuccess, NULL, "{\"inProgressJobs\":[],\"queuedJobs\":[]}" ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, observe( JobsDescribeFailed, "a", "{\"code\":\"ResourceNotFound\"}" ) );
+}
+
+void test_versionCache_evictsLeastRecentlyUsed( void )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, observe( JobsUpdateFailed, "a", "{\"executionState\":{\"versionNumber\":1}}" ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, observe( JobsUpdateFailed, "b", "{\"executionState\":{\"versionNumber\":2}}" ) );
+    TEST_ASSERT_EQUAL( 1U, cachedVersion( "a" ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, observe( JobsUpdateFailed, "c", "{\"executionState\":{\"versionNumber\":3}}" ) );
+    TEST_ASSERT_EQUAL( 1U, cachedVersion( "a" ) );
+    TEST_ASSERT_EQUAL( UINT32_MAX, cachedVersion( "b" ) );
+    TEST_ASSERT_EQUAL( 3U, cachedVersion( "c" ) );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, Jobs_VersionCacheRemove( &cache, "a", 1U ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_VersionCacheRemove( &cache, "a", 1U ) );
+    TEST_ASSERT_EQUAL( UINT32_MAX, cachedVersion( "a" ) );
+}
+
+void test_versionCache_fillsExpectedVersion( void )
+{
+    JobsUpdateRequest_t request = { Succeeded, NULL, 0U, NULL, 0U };
+    size_t length;
+
+    length = Jobs_VersionCacheUpdateMsg( &cache, "job1", 4U, request, NULL, buffer, sizeof( buffer ) );
+    TEST_ASSERT_EQUAL( strlen( "{\"status\":\"SUCCEEDED\"}" ), length );
+    TEST_ASSERT_EQUAL_STRING( "{\"status\":\"SUCCEEDED\"}", buffer );
+
+    TEST_ASSERT_EQUAL( JobsSuccess, observe( JobsUpdateFailed, "job1", "{\"executionState\":{\"versionNumber\":4294967295}}" ) );
+    memset( buffer, 0, sizeof( buffer ) );
+    length = Jobs_VersionCacheUpdateMsg( &cache, "job1", 4U, request, NULL, buffer, sizeof( buffer ) );
+    TEST_ASSERT_EQUAL_STRING( "{\"status\":\"SUCCEEDED\",\"expectedVersion\":\"4294967295\"}", buffer );
+    TEST_ASSERT_EQUAL( strlen( buffer ), length );
+
+    /* A caller supplied expectedVersion is kept. */
+    request.expectedVersion = "9";
+    request.expectedVersionLength = 1U;
+    memset( buffer, 0, sizeof( buffer ) );
+    ( void ) Jobs_VersionCacheUpdateMsg( &cache, "job1", 4U, request, NULL, buffer, sizeof( buffer ) );
+    TEST_ASSERT_EQUAL_STRING( "{\"status\":\"SUCCEEDED\",\"expectedVersion\":\"9\"}", buffer );
+}
+
+void test_versionCache_rejectsUnusableCachesAndJobIds( void )
+{
+    uint32_t version = 0U;
+    JobsVersionCache_t empty = { 0 };
+    JobsUpdateRequest_t request = { Succeeded, NULL, 0U, NULL, 0U };
+    char longJobId[ JOBS_JOBID_MAX_LENGTH + 1U ];
+
+    memset( longJobId, 'a', sizeof( longJobId ) );
+
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_VersionCacheObserve( &empty, JobsUpdateSuccess, "a", 1U, "{}", 2U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_VersionCacheObserve( &cache, JobsUpdateSuccess, "a", 1U, "{}", 0U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_VersionCacheGet( NULL, "a", 1U, &version ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_VersionCacheGet( &empty, "a", 1U, &version ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_VersionCacheGet( &cache, longJobId, sizeof( longJobId ), &version ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_VersionCacheRemove( NULL, "a", 1U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_VersionCacheRemove( &empty, "a", 1U ) );
+    TEST_ASSERT_EQUAL( JobsBadParameter, Jobs_VersionCacheRemove( &cache, "a", 0U ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_VersionCacheUpdateMsg( NULL, "a", 1U, request, NULL, buffer, sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_VersionCacheUpdateMsg( &empty, "a", 1U, request, NULL, buffer, sizeof( buffer ) ) );
+    TEST_ASSERT_EQUAL( 0U, Jobs_VersionCacheUpdateMsg( &cache, "a", 0U, request, NULL, buffer, sizeof( buffer ) ) );
+
+    /* Job IDs that do not fit an entry are not recorded. */
+    TEST_ASSERT_EQUAL( JobsNoMatch, observe( JobsStartNextSuccess, NULL,
+                                             "{\"execution\":{\"jobId\":\"\",\"versionNumber\":3}}" ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, Jobs_VersionCacheObserve( &cache, JobsUpdateFailed, longJobId, sizeof( longJobId ),
+                                                              "{\"executionState\":{\"versionNumber\":1}}",
+                                                              strlen( "{\"executionState\":{\"versionNumber\":1}}" ) ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, observe( JobsUpdateFailed, NULL, "{\"executionState\":{\"versionNumber\":1}}" ) );
+    TEST_ASSERT_EQUAL( 0U, cache.useCount );
+}
+
+void test_versionCache_ignoresMalformedVersions( void )
+{
+    JobsUpdateRequest_t request = { Succeeded, "", 0U, NULL, 0U };
+
+    /* Objects missing a member, or with a version that is not a number. */
+    TEST_ASSERT_EQUAL( JobsNoMatch, observe( JobsDescribeSuccess, "$next", "{\"execution\":{\"versionNumber\":3}}" ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, observe( JobsDescribeSuccess, "$next", "{\"execution\":{\"jobId\":\"a\"}}" ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, observe( JobsDescribeSuccess, "$next",
+                                             "{\"execution\":{\"jobId\":\"a\",\"versionNumber\":\"3\"}}" ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, observe( JobsUpdateFailed, "a", "{\"executionState\":{\"versionNumber\":\"3\"}}" ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, observe( JobsUpdateFailed, "a", "{\"executionState\":{\"versionNumber\":1.5}}" ) );
+
+    /* Summary lists that are not arrays of objects. */
+    TEST_ASSERT_EQUAL( JobsNoMatch, observe( JobsGetPendingSuccess, NULL, "{\"inProgressJobs\":{},\"queuedJobs\":1}" ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, observe( JobsGetPendingSuccess, NULL, "{\"queuedJobs\":[1,\"a\",{\"jobId\":\"a\"}]}" ) );
+    TEST_ASSERT_EQUAL( JobsNoMatch, observe( JobsJobsChanged, NULL, "{\"jobs\":{}}" ) );
+    TEST_ASSERT_EQUAL( UINT32_MAX, cachedVersion( "a" ) );
+
+    /* One recorded list is enough. */
+    TEST_ASSERT_EQUAL( JobsSuccess, observe( JobsGetPendingSuccess, NULL,
+                                             "{\"inProgressJobs\":[{\"jobId\":\"a\",\"versionNumber\":4}]}" ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, observe( JobsJobsChanged, NULL,
+                                             "{\"jobs\":{\"IN_PROGRESS\":[{\"jobId\":\"a\",\"versionNumber\":5}]}}" ) );
+    TEST_ASSERT_EQUAL( 5U, cachedVersion( "a" ) );
+
+    /* An empty expectedVersion is filled from the cache. */
+    ( void ) Jobs_VersionCacheUpdateMsg( &cache, "a", 1U, request, NULL, buffer, sizeof( buffer ) );
+    TEST_ASSERT_EQUAL_STRING( "{\"status\":\"SUCCEEDED\",\"expectedVersion\":\"5\"}", buffer );
+}
+
+void test_versionCache_evictsFirstEntryWhenOldest( void )
+{
+    TEST_ASSERT_EQUAL( JobsSuccess, observe( JobsUpdateFailed, "a", "{\"executionState\":{\"versionNumber\":1}}" ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, observe( JobsUpdateFailed, "b", "{\"executionState\":{\"versionNumber\":2}}" ) );
+    TEST_ASSERT_EQUAL( JobsSuccess, observe( JobsUpdateFailed, "c", "{\"executionState\":{\"versionNumber\":3}}" ) );
+    TEST_ASSERT_EQUAL( UINT32_MAX, cachedVersion( "a" ) );
+    TEST_ASSERT_EQUAL( 2U, cachedVersion( "b" ) );
+    TEST_ASSERT_EQUAL( 3U, cachedVersion( "c" ) );
+}
@@ -0,0 +1,197 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. and its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License. See the LICENSE accompanying this file
+ * for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "unity.h"
+
+#include "ota_job_cache.h"
+#include "ota_job_processor.h"
+
+#define MQTT_OTA_DOCUMENT                                                   \
+    "{\"afr_ota\":{\"protocols\":[\"MQTT\"],"                               \
+    "\"streamname\":\"AFR_OTA-streamname\",\"files\":[{"                    \
+    "\"filepath\":\"/device\",\"filesize\":123456789,\"fileid\":0,"         \
+    "\"certfile\":\"certfile.cert\",\"sig-sha256-ecdsa\":\"signature_hash_" \
+    "239871\"}]}}"
+#define HTTP_OTA_DOCUMENT                                                    \
+    "{\"afr_ota\":{\"protocols\":[\"HTTP\"],\"files\":["                     \
+    "{\"filepath\":\"/device\",\"filesize\":343135,\"fileid\":0,"            \
+    "\"certfile\":\"/certificate.cert\",\"update_data_url\":\"url0\","       \
+    "\"auth_scheme\":\"aws.s3.presigned\",\"sig-sha256-ecdsa\":\"SIG0\"},"   \
+    "{\"filepath\":\"/other\",\"filesize\":2,\"fileid\":1,\"fileType\":7,"   \
+    "\"certfile\":\"/certificate.cert\",\"update_data_url\":\"url1\","       \
+    "\"auth_scheme\":\"aws.s3.presigned\",\"sig-sha256-ecdsa\":\"SIG1\"}]}}"
+#define CUSTOM_DOCUMENT    "{\"custom_job\":\"test\"}"
+
+static OtaJobCacheEntry_t entries[ 2 ];
+static OtaJobCache_t cache;
+static AfrOtaJobDocumentFields_t fields;
+static AfrOtaJobDocumentFields_t expected;
+static char delivery[ 2 ][ 512 ];
+
+/* ===========================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    memset( &fields, 0xA5, sizeof( fields ) );
+    TEST_ASSERT_TRUE( otaParser_cacheInit( &cache, entries, 2U ) );
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ===============================   HELPERS   ============================== */
+
+/* Copy a document to a new buffer, as a later delivery of it would be. */
+static const char * deliver( const char * document )
+{
+    static size_t turn = 0U;
+    char * buffer = delivery[ turn % 2U ];
+
+    turn++;
+    TEST_ASSERT_LESS_THAN( sizeof( delivery[ 0 ] ), strlen( document ) );
+    memcpy( buffer, document, strlen( document ) );
+
+    return buffer;
+}
+
+/* Check a string field of fields is the one of expected, relative to the
+ * document each was parsed from. */
+static void assertString( const char * expectedDoc,
+                          const char * expectedValue,
+                          size_t expectedLength,
+                          const char * doc,
+                          const char * value,
+                          size_t length )
+{
+    if( expectedValue == NULL )
+    {
+        TEST_ASSERT_NULL( value );
+    }
+    else
+    {
+        TEST_ASSERT_EQUAL( expectedValue - expectedDoc, value - doc );
+        TEST_ASSERT_EQUAL( expectedLength, length );
+    }
+}
+
+/* Parse directly and through the cache, and check both agree. */
+static int8_t assertParse( const char * document,
+                           uint8_t fileIndex,
+                           const char * protocol )
+{
+    const char * doc = deliver( document );
+    int8_t next;
+
+    memset( &expected, 0, sizeof( expected ) );
+    next = otaParser_parseJobDocFile( document, strlen( document ), fileIndex,
+                                      protocol, strlen( protocol ), &expected );
+    TEST_ASSERT_EQUAL( next, otaParser_parseJobDocFileCached( &cache, doc, strlen( document ), fileIndex,
+                                                              protocol, strlen( protocol ), &fields ) );
+
+    if( next >= 0 )
+    {
+        assertString( document, expected.signature, expected.signatureLen, doc, fields.signature, fields.signatureLen );
+        assertString( document, expected.filepath, expected.filepathLen, doc, fields.filepath, fields.filepathLen );
+        assertString( document, expected.certfile, expected.certfileLen, doc, fields.certfile, fields.certfileLen );
+        assertString( document, expected.authScheme, expected.authSchemeLen, doc, fields.authScheme, fields.authSchemeLen );
+        assertString( document, expected.imageRef, expected.imageRefLen, doc, fields.imageRef, fields.imageRefLen );
+        TEST_ASSERT_EQUAL( expected.fileId, fields.fileId );
+        TEST_ASSERT_EQUAL( expected.fileSize, fields.fileSize );
+        TEST_ASSERT_EQUAL( expected.fileType, fields.fileType );
+    }
+
+    return next;
+}
+
+/* ===============================   TESTS   =============================== */
+
+void test_cache_returnsError_givenBadParameters( void )
+{
+    TEST_ASSERT_FALSE( otaParser_cacheInit( NULL, entries, 2U ) );
+    TEST_ASSERT_FALSE( otaParser_cacheInit( &cache, NULL, 2U ) );
+    TEST_ASSERT_FALSE( otaParser_cacheInit( &cache, entries, 0U ) );
+
+    TEST_ASSERT_EQUAL( -1, otaParser_parseJobDocFileCached( NULL, MQTT_OTA_DOCUMENT, 10U, 0U, "MQTT", 4U, &fields ) );
+    TEST_ASSERT_EQUAL( -1, otaParser_parseJobDocFileCached( &cache, NULL, 10U, 0U, "MQTT", 4U, &fields ) );
+    TEST_ASSERT_EQUAL( -1, otaParser_parseJobDocFileCached( &cache, MQTT_OTA_DOCUMENT, 0U, 0U, "MQTT", 4U, &fields ) );
+    TEST_ASSERT_EQUAL( -1, otaParser_parseJobDocFileCached( &cache, MQTT_OTA_DOCUMENT, 10U, 0U, NULL, 4U, &fields ) );
+    TEST_ASSERT_EQUAL( -1, otaParser_parseJobDocFileCached( &cache, MQTT_OTA_DOCUMENT, 10U, 0U, "MQTT", 4U, NULL ) );
+    TEST_ASSERT_EQUAL( 0U, cache.next );
+}
+
+void test_cache_reusesParse_givenRepeatDelivery( void )
+{
+    TEST_ASSERT_EQUAL( 0, assertParse( MQTT_OTA_DOCUMENT, 0U, "MQTT" ) );
+    TEST_ASSERT_EQUAL( 1U, cache.next );
+    TEST_ASSERT_NULL( fields.authScheme );
+
+    /* The repeat is served from the cache, relative to the new buffer. */
+    TEST_ASSERT_EQUAL( 0, assertParse( MQTT_OTA_DOCUMENT, 0U, "MQTT" ) );
+    TEST_ASSERT_EQUAL( 1U, cache.next );
+    TEST_ASSERT_EQUAL( 123456789U, fields.fileSize );
+
+    /* Another protocol is another parse. */
+    TEST_ASSERT_EQUAL( -1, assertParse( MQTT_OTA_DOCUMENT, 0U, "HTTP" ) );
+    TEST_ASSERT_EQUAL( 0U, cache.next );
+}
+
+void test_cache_keepsEachFile_givenMultipleFiles( void )
+{
+    uint8_t pass;
+
+    for( pass = 0U; pass < 2U; pass++ )
+    {
+        TEST_ASSERT_EQUAL( 1, assertParse( HTTP_OTA_DOCUMENT, 0U, "HTTP" ) );
+        TEST_ASSERT_EQUAL( 0U, fields.fileType );
+        TEST_ASSERT_EQUAL( 0, assertParse( HTTP_OTA_DOCUMENT, 1U, "HTTP" ) );
+        TEST_ASSERT_EQUAL( 7U, fields.fileType );
+        TEST_ASSERT_EQUAL( 0U, cache.next );
+    }
+}
+
+void test_cache_keepsFailures_givenCustomJob( void )
+{
+    TEST_ASSERT_EQUAL( -1, assertParse( CUSTOM_DOCUMENT, 0U, "MQTT" ) );
+    TEST_ASSERT_EQUAL( 1U, cache.next );
+    TEST_ASSERT_EQUAL( -1, assertParse( CUSTOM_DOCUMENT, 0U, "MQTT" ) );
+    TEST_ASSERT_EQUAL( 1U, cache.next );
+    TEST_ASSERT_NULL( fields.filepath );
+    TEST_ASSERT_EQUAL( 0U, fields.fileSize );
+}
+
+void test_cache_replacesOldest_givenFullCache( void )
+{
+    TEST_ASSERT_EQUAL( 0, assertParse( MQTT_OTA_DOCUMENT, 0U, "MQTT" ) );
+    TEST_ASSERT_EQUAL( 1, assertParse( HTTP_OTA_DOCUMENT, 0U, "HTTP" ) );
+    TEST_ASSERT_EQUAL( 0, assertParse( HTTP_OTA_DOCUMENT, 1U, "HTTP" ) );
+    TEST_ASSERT_EQUAL( 1U, cache.next );
+
+    /* The MQTT document was replaced, and is parsed again. */
+    TEST_ASSERT_EQUAL( 0, assertParse( MQTT_OTA_DOCUMENT, 0U, "MQTT" ) );
+    TEST_ASSERT_EQUAL( 0U, cache.next );
+}
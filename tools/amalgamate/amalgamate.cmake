@@ -0,0 +1,54 @@
+# Generate a single translation unit from the sources of the Jobs library.
+#
+# Usage:
+#   cmake -DSOURCES="a.c|b.c" -DOUTPUT=aws_iot_jobs_amalgamated.c \
+#         [-DROOT=<repository root>] -P amalgamate.cmake
+#
+# SOURCES is separated with '|' rather than ';' so it survives being passed
+# through add_custom_command. Each source is copied verbatim behind a #line
+# directive, so diagnostics and debug information refer to the original file.
+# Paths under ROOT are recorded relative to it.
+cmake_minimum_required(VERSION 3.15)
+
+if(NOT DEFINED SOURCES OR NOT DEFINED OUTPUT)
+  message(FATAL_ERROR "SOURCES and OUTPUT must be defined.")
+endif()
+
+string(REPLACE "|" ";" source_list "${SOURCES}")
+
+set(contents
+    "/*
+ * AWS IoT Jobs amalgamated source, generated by tools/amalgamate.
+ * Do not edit; edit the original sources and regenerate.
+ *
+ * Building the library from this one translation unit lets the compiler
+ * inline across modules, including into coreJSON when it is amalgamated.
+ */
+
+/* Feature test macros must come before the first system header of the
+ * translation unit, see jobs_docstore.c. */
+#if defined( __linux__ ) && !defined( _POSIX_C_SOURCE )
+    #define _POSIX_C_SOURCE    200809L
+#endif
+")
+
+foreach(source IN LISTS source_list)
+  get_filename_component(path "${source}" ABSOLUTE)
+  file(READ "${path}" text)
+
+  set(name "${path}")
+  if(DEFINED ROOT)
+    file(RELATIVE_PATH relative "${ROOT}" "${path}")
+    if(NOT relative MATCHES "^\\.\\./")
+      set(name "${relative}")
+    endif()
+  endif()
+
+  string(APPEND contents "\n/* ---- ${name} ---- */\n#line 1 \"${name}\"\n${text}")
+endforeach()
+
+# Only touch the output when it changes, to avoid needless rebuilds.
+file(WRITE "${OUTPUT}.tmp" "${contents}")
+execute_process(COMMAND ${CMAKE_COMMAND} -E copy_if_different "${OUTPUT}.tmp"
+                        "${OUTPUT}")
+file(REMOVE "${OUTPUT}.tmp")
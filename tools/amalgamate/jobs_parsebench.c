@@ -0,0 +1,235 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+/**
+ * @file jobs_parsebench.c
+ * @brief Time the parsing path of a device, from topic matching to the
+ * OTA file fields, and the update message it answers with.
+ *
+ * CMake builds it twice, against the library built from separate
+ * translation units and against the amalgamation, to compare them.
+ *
+ * Usage: jobs_parsebench [-n iterations] [-r repeats]
+ */
+
+#define _POSIX_C_SOURCE    200809L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "jobs.h"
+#include "ota_job_processor.h"
+
+#define THING_NAME    "bench-thing"
+#define JOB_ID        "ota-update-7"
+
+/**
+ * @brief The StartNextPendingJobExecution response parsed by each stage.
+ */
+static const char startNextAccepted[] =
+    "{\"clientToken\":\"token-0042\",\"timestamp\":1700000000,\"execution\":{"
+    "\"jobId\":\"" JOB_ID "\",\"status\":\"IN_PROGRESS\",\"queuedAt\":1700000000,"
+    "\"startedAt\":1700000001,\"lastUpdatedAt\":1700000001,\"versionNumber\":2,"
+    "\"executionNumber\":1,\"jobDocument\":{\"afr_ota\":{\"protocols\":[\"MQTT\"],"
+    "\"streamname\":\"AFR_OTA-bench\",\"files\":[{\"filepath\":\"/device/image\","
+    "\"filesize\":123456789,\"fileid\":0,\"certfile\":\"certfile.cert\","
+    "\"sig-sha256-ecdsa\":\"MEUCIQDdLwqRTk1Pn0bnD7JPQ9NQ0bSgKGoa0DHvRuf6Z5y8sg\"},"
+    "{\"filepath\":\"/device/config\",\"filesize\":4096,\"fileid\":1,"
+    "\"certfile\":\"certfile.cert\",\"sig-sha256-ecdsa\":\"MEQCIHBxAqyzVt6n4l3A0s\"}]}}}}";
+
+/**
+ * @brief The stages timed.
+ */
+typedef enum
+{
+    StageMatchTopic,
+    StageGetJobId,
+    StageGetJobDocument,
+    StageParseJobDoc,
+    StageUpdateMsg,
+    StageCount
+} Stage_t;
+
+static const char * const stageNames[ StageCount ] =
+{
+    "Jobs_MatchTopic",
+    "Jobs_GetJobId",
+    "Jobs_GetJobDocument",
+    "otaParser_parseJobDocFile",
+    "Jobs_UpdateMsg",
+};
+
+/**
+ * @brief Sum of the lengths each stage returned, so no call is optimized
+ * away.
+ */
+static volatile size_t sink;
+
+/*-----------------------------------------------------------*/
+
+static uint64_t nowNs( void )
+{
+    struct timespec ts;
+
+    ( void ) clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return ( ( uint64_t ) ts.tv_sec * 1000000000ULL ) + ( uint64_t ) ts.tv_nsec;
+}
+
+/**
+ * @brief Run one stage a number of times.
+ *
+ * @return The time per call in nanoseconds.
+ */
+static double runStage( Stage_t stage,
+                        unsigned long iterations )
+{
+    char topic[] = "$aws/things/" THING_NAME "/jobs/start-next/accepted";
+    char buffer[ 256 ];
+    const char * jobDoc = NULL;
+    const char * jobId = NULL;
+    char * topicJobId = NULL;
+    uint16_t topicJobIdLength = 0U;
+    JobsTopic_t api = JobsInvalidTopic;
+    JobsUpdateRequest_t update = { 0 };
+    AfrOtaJobDocumentFields_t fields;
+    size_t jobDocLength;
+    size_t total = 0U;
+    int8_t fileIndex;
+    unsigned long i;
+    uint64_t start;
+
+    jobDocLength = Jobs_GetJobDocument( startNextAccepted, sizeof( startNextAccepted ) - 1U, &jobDoc );
+    update.status = Succeeded;
+    update.expectedVersion = "2";
+    update.expectedVersionLength = 1U;
+    update.statusDetails = "{\"step\":\"verify\",\"file\":\"1\"}";
+    update.statusDetailsLength = strlen( update.statusDetails );
+
+    start = nowNs();
+
+    for( i = 0UL; i < iterations; i++ )
+    {
+        switch( stage )
+        {
+            case StageMatchTopic:
+                ( void ) Jobs_MatchTopic( topic, sizeof( topic ) - 1U, THING_NAME, sizeof( THING_NAME ) - 1U,
+                                          &api, &topicJobId, &topicJobIdLength );
+                total += ( size_t ) api;
+                break;
+
+            case StageGetJobId:
+                total += Jobs_GetJobId( startNextAccepted, sizeof( startNextAccepted ) - 1U, &jobId );
+                break;
+
+            case StageGetJobDocument:
+                total += Jobs_GetJobDocument( startNextAccepted, sizeof( startNextAccepted ) - 1U, &jobDoc );
+                break;
+
+            case StageParseJobDoc:
+                fileIndex = 0;
+
+                do
+                {
+                    ( void ) memset( &fields, 0, sizeof( fields ) );
+                    fileIndex = otaParser_parseJobDocFile( jobDoc, jobDocLength, ( uint8_t ) fileIndex,
+                                                           "MQTT", 4U, &fields );
+                    total += fields.fileSize;
+                } while( fileIndex > 0 );
+
+                break;
+
+            default:
+                total += Jobs_UpdateMsg( update, buffer, sizeof( buffer ) );
+                break;
+        }
+    }
+
+    sink += total;
+
+    return ( double ) ( nowNs() - start ) / ( double ) iterations;
+}
+
+static int usage( const char * program )
+{
+    fprintf( stderr, "usage: %s [-n iterations] [-r repeats]\n", program );
+
+    return 2;
+}
+
+int main( int argc,
+          char ** argv )
+{
+    unsigned long iterations = 1000000UL;
+    unsigned long repeats = 5UL;
+    double best;
+    double ns;
+    unsigned long r;
+    int stage;
+    int opt;
+
+    while( ( opt = getopt( argc, argv, "n:r:" ) ) != -1 )
+    {
+        if( opt == 'n' )
+        {
+            iterations = strtoul( optarg, NULL, 10 );
+        }
+        else if( opt == 'r' )
+        {
+            repeats = strtoul( optarg, NULL, 10 );
+        }
+        else
+        {
+            return usage( argv[ 0 ] );
+        }
+    }
+
+    if( ( optind != argc ) || ( iterations == 0UL ) || ( repeats == 0UL ) )
+    {
+        return usage( argv[ 0 ] );
+    }
+
+    printf( "%lu calls per run, best of %lu\n", iterations, repeats );
+    printf( "%-26s %10s\n", "stage", "ns/call" );
+
+    for( stage = 0; stage < ( int ) StageCount; stage++ )
+    {
+        best = -1.0;
+
+        for( r = 0UL; r < repeats; r++ )
+        {
+            ns = runStage( ( Stage_t ) stage, iterations );
+            best = ( ( best < 0.0 ) || ( ns < best ) ) ? ns : best;
+        }
+
+        printf( "%-26s %10.1f\n", stageNames[ stage ], best );
+    }
+
+    return ( sink > 0U ) ? 0 : 1;
+}
@@ -0,0 +1,358 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+/**
+ * @file jobs_codehash.c
+ * @brief Generate the error code table of jobs_rejected.c.
+ *
+ * Usage: jobs_codehash [jobs_rejected.c]
+ *
+ * Searches for a hash of the form
+ * ( length * M + code[ 0 ] + code[ length - K ] ) & ( SLOTS - 1 )
+ * without collisions between the error codes of the Jobs service, trying
+ * the smallest power of 2 slot count first, then the smallest K and M.
+ * The hash macro and the table are printed to standard output, or replace
+ * the generated section of the given file.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Line starting the generated section.
+ */
+#define BEGIN_MARKER    "/* Generated by tools/codehash/jobs_codehash.c, do not edit. */\n"
+
+/**
+ * @brief Line ending the generated section.
+ */
+#define END_MARKER      "/* End of generated code. */\n"
+
+/**
+ * @brief Most slots of the table.
+ */
+#define MAX_SLOTS       256U
+
+/**
+ * @brief Largest multiplier tried.
+ */
+#define MAX_MULTIPLIER    255U
+
+/**
+ * @brief An error code and the JobsRejectedCode_t it maps to.
+ */
+typedef struct
+{
+    const char * string;
+    const char * code;
+} Code_t;
+
+/**
+ * @brief The error codes of the Jobs service known to the library.
+ */
+static const Code_t codes[] =
+{
+    { "InvalidTopic",           "JobsRejectedInvalidTopic"           },
+    { "InvalidJson",            "JobsRejectedInvalidJson"            },
+    { "InvalidRequest",         "JobsRejectedInvalidRequest"         },
+    { "InvalidStateTransition", "JobsRejectedInvalidStateTransition" },
+    { "ResourceNotFound",       "JobsRejectedResourceNotFound"       },
+    { "VersionMismatch",        "JobsRejectedVersionMismatch"        },
+    { "InternalError",          "JobsRejectedInternalError"          },
+    { "RequestThrottled",       "JobsRejectedRequestThrottled"       },
+    { "ThrottlingException",    "JobsRejectedRequestThrottled"       },
+    { "TerminalStateReached",   "JobsRejectedTerminalStateReached"   },
+};
+
+#define CODE_COUNT    ( sizeof( codes ) / sizeof( codes[ 0 ] ) )
+
+/**
+ * @brief A collision free hash.
+ */
+typedef struct
+{
+    size_t slots;
+    size_t back;
+    size_t multiplier;
+    int slotCode[ MAX_SLOTS ];
+} Hash_t;
+
+/*-----------------------------------------------------------*/
+
+static size_t hashCode( const Hash_t * hash,
+                        const char * code )
+{
+    size_t length = strlen( code );
+
+    return ( ( length * hash->multiplier ) + ( size_t ) ( uint8_t ) code[ 0 ] +
+             ( size_t ) ( uint8_t ) code[ length - hash->back ] ) & ( hash->slots - 1U );
+}
+
+/**
+ * @brief Fill slotCode with the code of each slot.
+ *
+ * @return Whether no two codes share a slot.
+ */
+static bool place( Hash_t * hash )
+{
+    bool ret = true;
+    size_t i;
+    size_t slot;
+
+    for( i = 0U; i < hash->slots; i++ )
+    {
+        hash->slotCode[ i ] = -1;
+    }
+
+    for( i = 0U; ( i < CODE_COUNT ) && ret; i++ )
+    {
+        slot = hashCode( hash, codes[ i ].string );
+        ret = ( hash->slotCode[ slot ] < 0 ) ? true : false;
+        hash->slotCode[ slot ] = ( int ) i;
+    }
+
+    return ret;
+}
+
+static bool search( Hash_t * hash )
+{
+    size_t minLength = SIZE_MAX;
+    bool found = false;
+    size_t i;
+
+    for( i = 0U; i < CODE_COUNT; i++ )
+    {
+        minLength = ( strlen( codes[ i ].string ) < minLength ) ? strlen( codes[ i ].string ) : minLength;
+    }
+
+    hash->slots = 1U;
+
+    while( hash->slots < CODE_COUNT )
+    {
+        hash->slots *= 2U;
+    }
+
+    while( ( hash->slots <= MAX_SLOTS ) && !found )
+    {
+        hash->back = 1U;
+
+        while( ( hash->back <= minLength ) && !found )
+        {
+            hash->multiplier = 1U;
+
+            while( ( hash->multiplier <= MAX_MULTIPLIER ) && !found )
+            {
+                found = place( hash );
+                hash->multiplier += found ? 0U : 1U;
+            }
+
+            hash->back += found ? 0U : 1U;
+        }
+
+        hash->slots *= found ? 1U : 2U;
+    }
+
+    return found;
+}
+
+/**
+ * @brief Print a table cell followed by spaces up to a width.
+ */
+static void printCell( FILE * out,
+                       const char * cell,
+                       size_t width )
+{
+    fprintf( out, "%-*s", ( int ) width, cell );
+}
+
+static void generate( FILE * out,
+                      const Hash_t * hash )
+{
+    size_t stringWidth = sizeof( "NULL," ) - 1U;
+    size_t lengthWidth = sizeof( "0U," ) - 1U;
+    size_t codeWidth = sizeof( "JobsRejectedUnknown" ) - 1U;
+    char cell[ 64 ];
+    size_t length;
+    size_t i;
+    const Code_t * code;
+
+    for( i = 0U; i < CODE_COUNT; i++ )
+    {
+        length = strlen( codes[ i ].string );
+        stringWidth = ( ( length + 3U ) > stringWidth ) ? ( length + 3U ) : stringWidth;
+        lengthWidth = ( ( length + 19U ) > lengthWidth ) ? ( length + 19U ) : lengthWidth;
+        codeWidth = ( strlen( codes[ i ].code ) > codeWidth ) ? strlen( codes[ i ].code ) : codeWidth;
+    }
+
+    fprintf( out,
+             BEGIN_MARKER
+             "\n"
+             "/**\n"
+             " * @brief Number of slots of the error code table, a power of 2.\n"
+             " */\n"
+             "#define CODE_SLOTS           %zuU\n"
+             "\n"
+             "/**\n"
+             " * @brief Length of the shortest error code, the hash reads %zu characters\n"
+             " * from the end.\n"
+             " */\n"
+             "#define CODE_MIN_LENGTH      %zuU\n"
+             "\n"
+             "/**\n"
+             " * @brief Hash an error code to its slot of the error code table.\n"
+             " *\n"
+             " * The multiplier and the characters read were found by searching for a\n"
+             " * function without collisions between the known error codes, so a code\n"
+             " * is classified with one comparison.\n"
+             " */\n"
+             "#define hashCode( code, length )                                  \\\n"
+             "    ( ( ( ( length ) * %zuU ) + ( size_t ) ( uint8_t ) ( code )[ 0 ] + \\\n"
+             "        ( size_t ) ( uint8_t ) ( code )[ ( length ) - %zuU ] ) & ( CODE_SLOTS - 1U ) )\n"
+             "\n"
+             "/**\n"
+             " * @brief Error codes indexed by #hashCode.\n"
+             " */\n"
+             "static const CodeEntry_t codeTable[ CODE_SLOTS ] =\n"
+             "{\n",
+             hash->slots, hash->back, hash->back, hash->multiplier, hash->back );
+
+    for( i = 0U; i < hash->slots; i++ )
+    {
+        fprintf( out, "    { " );
+
+        if( hash->slotCode[ i ] < 0 )
+        {
+            printCell( out, "NULL,", stringWidth + 1U );
+            printCell( out, "0U,", lengthWidth + 1U );
+            printCell( out, "JobsRejectedUnknown", codeWidth + 1U );
+            fprintf( out, "},\n" );
+        }
+        else
+        {
+            code = &codes[ hash->slotCode[ i ] ];
+            ( void ) snprintf( cell, sizeof( cell ), "\"%s\",", code->string );
+            printCell( out, cell, stringWidth + 1U );
+            ( void ) snprintf( cell, sizeof( cell ), "CONST_STRLEN( \"%s\" ),", code->string );
+            printCell( out, cell, lengthWidth + 1U );
+            printCell( out, code->code, codeWidth + 1U );
+            fprintf( out, "}, /* %zu */\n", i );
+        }
+    }
+
+    fprintf( out, "};\n\n" END_MARKER );
+}
+
+/**
+ * @brief Replace the generated section of a file.
+ */
+static int rewrite( const char * path,
+                    const Hash_t * hash )
+{
+    FILE * file = fopen( path, "rb" );
+    char * text = NULL;
+    char * begin = NULL;
+    char * end = NULL;
+    long size = -1L;
+    int ret = EXIT_FAILURE;
+
+    if( ( file != NULL ) && ( fseek( file, 0L, SEEK_END ) == 0 ) )
+    {
+        size = ftell( file );
+        rewind( file );
+    }
+
+    if( size >= 0L )
+    {
+        text = calloc( ( size_t ) size + 1U, 1U );
+    }
+
+    if( ( text != NULL ) && ( fread( text, 1U, ( size_t ) size, file ) == ( size_t ) size ) )
+    {
+        begin = strstr( text, BEGIN_MARKER );
+        end = ( begin != NULL ) ? strstr( begin, END_MARKER ) : NULL;
+    }
+
+    if( file != NULL )
+    {
+        ( void ) fclose( file );
+    }
+
+    if( end == NULL )
+    {
+        fprintf( stderr, "%s: no generated section\n", path );
+    }
+    else
+    {
+        file = fopen( path, "wb" );
+
+        if( file != NULL )
+        {
+            ( void ) fwrite( text, 1U, ( size_t ) ( begin - text ), file );
+            generate( file, hash );
+            end += strlen( END_MARKER );
+            ( void ) fwrite( end, 1U, strlen( end ), file );
+            ret = ( fclose( file ) == 0 ) ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    if( ret != EXIT_SUCCESS )
+    {
+        perror( path );
+    }
+
+    free( text );
+
+    return ret;
+}
+
+int main( int argc,
+          char ** argv )
+{
+    static Hash_t hash;
+    int ret = EXIT_FAILURE;
+
+    if( argc > 2 )
+    {
+        fprintf( stderr, "usage: %s [jobs_rejected.c]\n", argv[ 0 ] );
+    }
+    else if( search( &hash ) == false )
+    {
+        fprintf( stderr, "no collision free hash up to %u slots\n", MAX_SLOTS );
+    }
+    else if( argc == 2 )
+    {
+        ret = rewrite( argv[ 1 ], &hash );
+    }
+    else
+    {
+        generate( stdout, &hash );
+        ret = EXIT_SUCCESS;
+    }
+
+    return ret;
+}
@@ -0,0 +1,366 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_execbench.c
+ * @brief Time the work-stealing executor running a batch of tasks on 1, 2,
+ * 4 ... workers, and report tasks per second and the speedup over one
+ * worker.
+ *
+ * Usage: jobs_execbench [-t workers] [-n tasks] [-k things] [-w work]
+ *                       [-r repeats]
+ */
+
+#define _POSIX_C_SOURCE    200809L
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "jobs_executor.h"
+
+/**
+ * @brief Largest number of workers.
+ */
+#define MAX_WORKERS    32U
+
+/**
+ * @brief Command line settings.
+ */
+typedef struct
+{
+    unsigned workers;
+    uint32_t tasks;
+    uint32_t things;
+    uint32_t work;
+    unsigned repeats;
+} Settings_t;
+
+/**
+ * @brief A task and the value its work computed.
+ */
+typedef struct
+{
+    JobsTask_t task;
+    uint64_t value;
+} BenchTask_t;
+
+/**
+ * @brief State of one timed run.
+ */
+typedef struct
+{
+    const Settings_t * settings;
+    JobsExecutor_t executor;
+    pthread_barrier_t barrier;
+    uint32_t completed;
+    uint32_t mismatches;
+} Run_t;
+
+/**
+ * @brief State of one worker thread.
+ */
+typedef struct
+{
+    Run_t * run;
+    uint32_t index;
+} Worker_t;
+
+static JobsWorker_t jobsWorkers[ MAX_WORKERS ];
+
+/*-----------------------------------------------------------*/
+
+static double nowSeconds( void )
+{
+    struct timespec ts;
+
+    ( void ) clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return ( double ) ts.tv_sec + ( ( double ) ts.tv_nsec / 1e9 );
+}
+
+/**
+ * @brief Spin a number of xorshift64* rounds, seeded by the task.
+ */
+static uint64_t spin( uint64_t seed,
+                      uint32_t rounds )
+{
+    uint64_t state = seed | 1U;
+    uint32_t i;
+
+    for( i = 0U; i < rounds; i++ )
+    {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        state *= 0x2545F4914F6CDD1DULL;
+    }
+
+    return state;
+}
+
+/**
+ * @brief The task function, standing in for the work of one job step.
+ */
+static void runTask( JobsTask_t * task )
+{
+    BenchTask_t * bench = ( BenchTask_t * ) task;
+    const Run_t * run = task->pContext;
+
+    bench->value = spin( ( uint64_t ) ( uintptr_t ) task, run->settings->work );
+    task->status = Succeeded;
+}
+
+/**
+ * @brief Count completions, and check the executor built an update message.
+ */
+static void complete( JobsTask_t * task,
+                      const char * message,
+                      size_t messageLength,
+                      void * pContext )
+{
+    Run_t * run = pContext;
+
+    ( void ) task;
+
+    if( ( message == NULL ) || ( messageLength == 0U ) )
+    {
+        __atomic_fetch_add( &run->mismatches, 1U, __ATOMIC_RELAXED );
+    }
+
+    __atomic_fetch_add( &run->completed, 1U, __ATOMIC_RELEASE );
+}
+
+static void * runWorker( void * argument )
+{
+    Worker_t * worker = argument;
+    Run_t * run = worker->run;
+
+    ( void ) pthread_barrier_wait( &run->barrier );
+
+    while( __atomic_load_n( &run->completed, __ATOMIC_ACQUIRE ) < run->settings->tasks )
+    {
+        ( void ) Jobs_ExecutorRun( &run->executor, worker->index );
+    }
+
+    ( void ) pthread_barrier_wait( &run->barrier );
+
+    return NULL;
+}
+
+/**
+ * @brief Submit every task, then time the workers draining them.
+ *
+ * @return Tasks per second, or a negative value on failure.
+ */
+static double runOnce( const Settings_t * settings,
+                       unsigned count,
+                       BenchTask_t * tasks,
+                       JobsThingTasks_t * things,
+                       uint32_t * outMismatches )
+{
+    static Run_t run;
+    pthread_t threads[ MAX_WORKERS ];
+    Worker_t workers[ MAX_WORKERS ];
+    double start;
+    double elapsed;
+    double ret = -1.0;
+    uint32_t i;
+
+    ( void ) memset( &run, 0, sizeof( run ) );
+    run.settings = settings;
+
+    if( ( Jobs_ExecutorInit( &run.executor, jobsWorkers, count, things, settings->things,
+                             complete, &run ) == JobsSuccess ) &&
+        ( pthread_barrier_init( &run.barrier, NULL, count + 1U ) == 0 ) )
+    {
+        /* Interleave the things, and spread them over the worker queues. */
+        for( i = 0U; i < settings->tasks; i++ )
+        {
+            ( void ) memset( &tasks[ i ], 0, sizeof( tasks[ i ] ) );
+            tasks[ i ].task.function = runTask;
+            tasks[ i ].task.pContext = &run;
+            tasks[ i ].task.thingIndex = i % settings->things;
+            ( void ) Jobs_ExecutorSubmit( &run.executor, &tasks[ i ].task, i % count );
+        }
+
+        for( i = 0U; i < count; i++ )
+        {
+            workers[ i ].run = &run;
+            workers[ i ].index = i;
+            ( void ) pthread_create( &threads[ i ], NULL, runWorker, &workers[ i ] );
+        }
+
+        ( void ) pthread_barrier_wait( &run.barrier );
+        start = nowSeconds();
+        ( void ) pthread_barrier_wait( &run.barrier );
+        elapsed = nowSeconds() - start;
+
+        for( i = 0U; i < count; i++ )
+        {
+            ( void ) pthread_join( threads[ i ], NULL );
+        }
+
+        ( void ) pthread_barrier_destroy( &run.barrier );
+        *outMismatches = run.mismatches;
+        ret = ( double ) settings->tasks / elapsed;
+    }
+
+    return ret;
+}
+
+static int usage( const char * program )
+{
+    fprintf( stderr,
+             "usage: %s [-t workers] [-n tasks] [-k things] [-w work] [-r repeats]\n", program );
+
+    return 2;
+}
+
+int main( int argc,
+          char ** argv )
+{
+    Settings_t settings =
+    {
+        .workers = MAX_WORKERS,
+        .tasks   = 200000U,
+        .things  = 1024U,
+        .work    = 1000U,
+        .repeats = 3U,
+    };
+    BenchTask_t * tasks;
+    JobsThingTasks_t * things;
+    double single = 0.0;
+    double best;
+    double rate;
+    uint32_t mismatches;
+    uint32_t allMismatches = 0U;
+    unsigned count;
+    unsigned r;
+    int opt;
+
+    while( ( opt = getopt( argc, argv, "t:n:k:w:r:" ) ) != -1 )
+    {
+        switch( opt )
+        {
+            case 't':
+                settings.workers = ( unsigned ) strtoul( optarg, NULL, 10 );
+                break;
+
+            case 'n':
+                settings.tasks = ( uint32_t ) strtoul( optarg, NULL, 10 );
+                break;
+
+            case 'k':
+                settings.things = ( uint32_t ) strtoul( optarg, NULL, 10 );
+                break;
+
+            case 'w':
+                settings.work = ( uint32_t ) strtoul( optarg, NULL, 10 );
+                break;
+
+            case 'r':
+                settings.repeats = ( unsigned ) strtoul( optarg, NULL, 10 );
+                break;
+
+            default:
+                return usage( argv[ 0 ] );
+        }
+    }
+
+    if( ( optind != argc ) || ( settings.workers == 0U ) || ( settings.workers > MAX_WORKERS ) ||
+        ( settings.tasks == 0U ) || ( settings.things == 0U ) || ( settings.repeats == 0U ) )
+    {
+        return usage( argv[ 0 ] );
+    }
+
+    tasks = calloc( settings.tasks, sizeof( BenchTask_t ) );
+    things = calloc( settings.things, sizeof( JobsThingTasks_t ) );
+
+    if( ( tasks == NULL ) || ( things == NULL ) )
+    {
+        fprintf( stderr, "out of memory\n" );
+        free( tasks );
+        free( things );
+        return 1;
+    }
+
+    printf( "%u tasks over %u things, %u rounds of work each, best of %u, %ld CPUs\n",
+            settings.tasks, settings.things, settings.work, settings.repeats,
+            sysconf( _SC_NPROCESSORS_ONLN ) );
+    printf( "%8s %14s %10s %12s\n", "workers", "tasks/s", "speedup", "efficiency" );
+
+    count = 1U;
+
+    while( count > 0U )
+    {
+        best = -1.0;
+
+        for( r = 0U; r < settings.repeats; r++ )
+        {
+            rate = runOnce( &settings, count, tasks, things, &mismatches );
+            best = ( rate > best ) ? rate : best;
+            allMismatches += mismatches;
+        }
+
+        if( best < 0.0 )
+        {
+            fprintf( stderr, "failed to start %u workers\n", count );
+            break;
+        }
+
+        if( single == 0.0 )
+        {
+            single = best;
+        }
+
+        printf( "%8u %14.0f %9.2fx %11.0f%%\n", count, best, best / single,
+                ( 100.0 * best ) / ( single * ( double ) count ) );
+
+        /* Double the workers, ending on the requested count. */
+        if( count == settings.workers )
+        {
+            count = 0U;
+        }
+        else
+        {
+            count = ( ( count * 2U ) < settings.workers ) ? ( count * 2U ) : settings.workers;
+        }
+    }
+
+    if( allMismatches > 0U )
+    {
+        printf( "%u tasks completed without an update message\n", allMismatches );
+    }
+
+    free( tasks );
+    free( things );
+
+    return ( ( best < 0.0 ) || ( allMismatches > 0U ) ) ? 1 : 0;
+}
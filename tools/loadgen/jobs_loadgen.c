@@ -0,0 +1,750 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_loadgen.c
+ * @brief Synthesize the Jobs traffic of a gateway serving many things, and
+ * measure how fast the matching and parsing APIs of the library consume it
+ * across threads.
+ *
+ * Usage: jobs_loadgen [-t threads] [-s] [-n things] [-m messages]
+ *                     [-q pool] [-i invalid%] [-f files] [-p protocols]
+ *                     [-P protocol] [-r seed]
+ *
+ * -s sweeps 1, 2, 4 ... threads up to -t to report per-core scaling.
+ */
+
+#define _POSIX_C_SOURCE    200809L
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "jobs.h"
+#include "jobs_rejected.h"
+#include "jobs_summary.h"
+#include "ota_job_processor.h"
+
+/**
+ * @brief Size of a topic buffer, with room for names over the maximum.
+ */
+#define TOPIC_BUFFER_LENGTH      512U
+
+/**
+ * @brief Size of a payload buffer, enough for 10 files and 8 protocols.
+ */
+#define PAYLOAD_BUFFER_LENGTH    8192U
+
+/**
+ * @brief Largest number of files the OTA parser handles.
+ */
+#define MAX_FILES                10U
+
+/**
+ * @brief Largest number of protocols listed in an OTA document.
+ */
+#define MAX_PROTOCOLS            8U
+
+/**
+ * @brief Command line settings.
+ */
+typedef struct
+{
+    unsigned threads;
+    bool sweep;
+    uint32_t things;
+    uint64_t messages;
+    size_t pool;
+    unsigned invalidPercent;
+    unsigned files;
+    unsigned protocols;
+    const char * protocol;
+    uint64_t seed;
+} Settings_t;
+
+/**
+ * @brief A synthesized MQTT message, and what the library should make of it.
+ */
+typedef struct
+{
+    char topic[ TOPIC_BUFFER_LENGTH ];
+    size_t topicLength;
+    char thingName[ THINGNAME_MAX_LENGTH + 2U ];
+    uint16_t thingNameLength;
+    JobsTopic_t kind;
+    bool valid;
+} Message_t;
+
+/**
+ * @brief State of one worker thread.
+ */
+typedef struct
+{
+    const Settings_t * settings;
+    pthread_barrier_t * barrier;
+    unsigned id;
+    unsigned count;
+    Message_t * pool;
+    char * payloads[ JobsMaxTopic ];
+    size_t payloadLengths[ JobsMaxTopic ];
+    uint64_t processed;
+    uint64_t mismatches;
+    uint64_t checksum;
+} Worker_t;
+
+static const char * const topicSuffixes[ JobsMaxTopic ] =
+{
+    "notify",
+    "notify-next",
+    "get/accepted",
+    "get/rejected",
+    "start-next/accepted",
+    "start-next/rejected",
+    "get/accepted",
+    "get/rejected",
+    "update/accepted",
+    "update/rejected",
+};
+
+static const char idAlphabet[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz-_:";
+
+/**
+ * @brief Characters never valid in a thing name or job ID.
+ */
+static const char invalidCharacters[] = "/+#. ";
+
+/*-----------------------------------------------------------*/
+
+static uint64_t nextRandom( uint64_t * state )
+{
+    /* xorshift64* */
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+
+    return *state * 0x2545F4914F6CDD1DULL;
+}
+
+static double nowSeconds( void )
+{
+    struct timespec ts;
+
+    ( void ) clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return ( double ) ts.tv_sec + ( ( double ) ts.tv_nsec / 1e9 );
+}
+
+/**
+ * @brief Write an identifier of random length over a random alphabet.
+ *
+ * The identifier starts with a unique base 62 prefix so that every
+ * index yields a distinct name.
+ *
+ * @return The length written.
+ */
+static size_t writeId( char * buffer,
+                       uint64_t index,
+                       size_t maxLength,
+                       size_t alphabetLength,
+                       uint64_t * state )
+{
+    size_t length = 1U + ( size_t ) ( nextRandom( state ) % maxLength );
+    size_t i = 0U;
+    uint64_t rest = index;
+
+    do
+    {
+        buffer[ i ] = idAlphabet[ rest % 62U ];
+        rest /= 62U;
+        i++;
+    } while( ( rest > 0U ) && ( i < maxLength ) );
+
+    while( i < length )
+    {
+        buffer[ i ] = idAlphabet[ nextRandom( state ) % alphabetLength ];
+        i++;
+    }
+
+    return i;
+}
+
+/**
+ * @brief Make an identifier invalid, by length or by character.
+ *
+ * @return The new length.
+ */
+static size_t breakId( char * buffer,
+                       size_t length,
+                       size_t maxLength,
+                       uint64_t * state )
+{
+    size_t ret = length;
+
+    if( ( nextRandom( state ) & 1U ) != 0U )
+    {
+        while( ret <= maxLength )
+        {
+            buffer[ ret ] = 'x';
+            ret++;
+        }
+    }
+    else
+    {
+        buffer[ nextRandom( state ) % length ] =
+            invalidCharacters[ nextRandom( state ) % ( sizeof( invalidCharacters ) - 1U ) ];
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Synthesize a message for a random thing of the worker's shard.
+ */
+static void makeMessage( const Worker_t * worker,
+                         Message_t * message,
+                         uint64_t * state )
+{
+    const Settings_t * settings = worker->settings;
+    uint32_t shard = settings->things / worker->count;
+    uint32_t first = shard * worker->id;
+    uint64_t thing;
+    char jobId[ JOBID_MAX_LENGTH + 2U ];
+    size_t jobIdLength = 0U;
+    bool invalid = ( ( nextRandom( state ) % 100U ) < settings->invalidPercent ) ? true : false;
+    int written;
+
+    if( worker->id == ( worker->count - 1U ) )
+    {
+        shard = settings->things - first;
+    }
+
+    thing = first + ( nextRandom( state ) % shard );
+    message->kind = ( JobsTopic_t ) ( nextRandom( state ) % ( uint64_t ) JobsMaxTopic );
+    message->thingNameLength = ( uint16_t ) writeId( message->thingName, thing, THINGNAME_MAX_LENGTH,
+                                                     sizeof( idAlphabet ) - 1U, state );
+
+    if( message->kind >= JobsDescribeSuccess )
+    {
+        /* Job IDs do not allow ':'. */
+        jobIdLength = writeId( jobId, nextRandom( state ), JOBID_MAX_LENGTH, sizeof( idAlphabet ) - 2U, state );
+    }
+
+    /* Break the thing name, or the job ID of topics that have one. */
+    if( invalid && ( jobIdLength > 0U ) && ( ( nextRandom( state ) & 1U ) != 0U ) )
+    {
+        jobIdLength = breakId( jobId, jobIdLength, JOBID_MAX_LENGTH, state );
+    }
+    else if( invalid )
+    {
+        message->thingNameLength = ( uint16_t ) breakId( message->thingName, message->thingNameLength,
+                                                         THINGNAME_MAX_LENGTH, state );
+    }
+    else
+    {
+        /* Valid message. */
+    }
+
+    if( jobIdLength > 0U )
+    {
+        written = snprintf( message->topic, sizeof( message->topic ), "%s%.*s%s%.*s/%s",
+                            JOBS_API_PREFIX, ( int ) message->thingNameLength, message->thingName,
+                            JOBS_API_BRIDGE, ( int ) jobIdLength, jobId, topicSuffixes[ message->kind ] );
+    }
+    else
+    {
+        written = snprintf( message->topic, sizeof( message->topic ), "%s%.*s%s%s",
+                            JOBS_API_PREFIX, ( int ) message->thingNameLength, message->thingName,
+                            JOBS_API_BRIDGE, topicSuffixes[ message->kind ] );
+    }
+
+    message->topicLength = ( size_t ) written;
+    message->valid = !invalid;
+}
+
+/**
+ * @brief Write an OTA job document with a number of files and protocols.
+ *
+ * The protocol handed to the parser is listed last.
+ */
+static size_t writeOtaDocument( char * buffer,
+                                size_t length,
+                                const Settings_t * settings )
+{
+    size_t used = 0U;
+    unsigned i;
+
+    used += ( size_t ) snprintf( &buffer[ used ], length - used, "{\"afr_ota\":{\"protocols\":[" );
+
+    for( i = 1U; i < settings->protocols; i++ )
+    {
+        used += ( size_t ) snprintf( &buffer[ used ], length - used, "\"PROTO%u\",", i );
+    }
+
+    used += ( size_t ) snprintf( &buffer[ used ], length - used,
+                                 "\"%s\"],\"streamname\":\"AFR_OTA-stream-0123456789\",\"files\":[",
+                                 settings->protocol );
+
+    for( i = 0U; i < settings->files; i++ )
+    {
+        used += ( size_t ) snprintf( &buffer[ used ], length - used,
+                                     "%s{\"filepath\":\"/ota/image%u.bin\",\"filesize\":%u,\"fileid\":%u,"
+                                     "\"certfile\":\"/ota/signer.crt\",\"fileType\":0,"
+                                     "\"update_data_url\":\"https://example.com/ota/image%u.bin\","
+                                     "\"auth_scheme\":\"aws.s3.presigned\","
+                                     "\"sig-sha256-ecdsa\":\"MEUCIQDxJ8R5bM8mS3e0Zq1sZCwQm2J9j3X0LqKq9kQ2wG1i1AIgY9y1P2h7Jt7kz0x8P4q2qW6r3D1b0Zk3s9y1qg4Xw5c=\"}",
+                                     ( i == 0U ) ? "" : ",", i, 100000U + i, i, i );
+    }
+
+    used += ( size_t ) snprintf( &buffer[ used ], length - used, "]}}" );
+
+    return used;
+}
+
+/**
+ * @brief Write the payload the Jobs service sends on a topic.
+ */
+static size_t writePayload( char * buffer,
+                            size_t length,
+                            JobsTopic_t kind,
+                            const char * otaDocument )
+{
+    int written;
+
+    switch( kind )
+    {
+        case JobsJobsChanged:
+            written = snprintf( buffer, length,
+                                "{\"timestamp\":1700000100,\"jobs\":{\"QUEUED\":[{\"jobId\":\"job-2\","
+                                "\"queuedAt\":1700000000,\"lastUpdatedAt\":1700000000,\"executionNumber\":1,"
+                                "\"versionNumber\":1}],\"IN_PROGRESS\":[{\"jobId\":\"job-1\",\"queuedAt\":1690000000,"
+                                "\"lastUpdatedAt\":1700000050,\"startedAt\":1700000040,\"executionNumber\":1,"
+                                "\"versionNumber\":3}]}}" );
+            break;
+
+        case JobsGetPendingSuccess:
+            written = snprintf( buffer, length,
+                                "{\"timestamp\":1700000100,\"inProgressJobs\":[{\"jobId\":\"job-1\","
+                                "\"queuedAt\":1690000000,\"lastUpdatedAt\":1700000050,\"startedAt\":1700000040,"
+                                "\"executionNumber\":1,\"versionNumber\":3}],\"queuedJobs\":[{\"jobId\":\"job-2\","
+                                "\"queuedAt\":1700000000,\"lastUpdatedAt\":1700000000,\"executionNumber\":1,"
+                                "\"versionNumber\":1}]}" );
+            break;
+
+        case JobsNextJobChanged:
+        case JobsStartNextSuccess:
+        case JobsDescribeSuccess:
+            written = snprintf( buffer, length,
+                                "{\"timestamp\":1700000100,\"execution\":{\"jobId\":\"AFR_OTA-job-1\","
+                                "\"status\":\"IN_PROGRESS\",\"queuedAt\":1700000000,\"startedAt\":1700000040,"
+                                "\"lastUpdatedAt\":1700000050,\"versionNumber\":2,\"executionNumber\":1,"
+                                "\"jobDocument\":%s}}", otaDocument );
+            break;
+
+        case JobsUpdateSuccess:
+            written = snprintf( buffer, length,
+                                "{\"timestamp\":1700000100,\"executionState\":{\"status\":\"SUCCEEDED\","
+                                "\"versionNumber\":4}}" );
+            break;
+
+        default:
+            written = snprintf( buffer, length,
+                                "{\"code\":\"InvalidStateTransition\",\"message\":\"Job is already done\","
+                                "\"timestamp\":1700000100,\"clientToken\":\"0001abcd\",\"executionState\":"
+                                "{\"status\":\"SUCCEEDED\",\"versionNumber\":4}}" );
+            break;
+    }
+
+    return ( size_t ) written;
+}
+
+/**
+ * @brief Consume one message the way a gateway does.
+ *
+ * @return Whether the library matched and parsed the message as expected.
+ */
+static bool consume( Worker_t * worker,
+                     const Message_t * message )
+{
+    char topic[ TOPIC_BUFFER_LENGTH ];
+    JobsTopic_t api = JobsInvalidTopic;
+    char * jobId = NULL;
+    uint16_t jobIdLength = 0U;
+    const char * payload = worker->payloads[ message->kind ];
+    size_t payloadLength = worker->payloadLengths[ message->kind ];
+    const char * value = NULL;
+    size_t valueLength;
+    JobsSummaryIterator_t iterator;
+    JobsJobSummary_t summary;
+    JobsRejected_t rejected;
+    AfrOtaJobDocumentFields_t fields;
+    int8_t fileIndex = 0;
+    JobsStatus_t status;
+    bool parsed = true;
+
+    /* Jobs_MatchTopic takes a writable topic, as the MQTT buffer is. */
+    ( void ) memcpy( topic, message->topic, message->topicLength );
+
+    status = Jobs_MatchTopic( topic, message->topicLength, message->thingName,
+                              message->thingNameLength, &api, &jobId, &jobIdLength );
+
+    if( status == JobsSuccess )
+    {
+        worker->checksum += ( uint64_t ) api + jobIdLength;
+
+        switch( api )
+        {
+            case JobsJobsChanged:
+            case JobsGetPendingSuccess:
+
+                if( Jobs_SummaryInit( &iterator, api, payload, payloadLength ) == JobsSuccess )
+                {
+                    while( Jobs_SummaryNext( &iterator, &summary ) == JobsSuccess )
+                    {
+                        worker->checksum += summary.versionNumber;
+                    }
+                }
+
+                break;
+
+            case JobsNextJobChanged:
+            case JobsStartNextSuccess:
+            case JobsDescribeSuccess:
+                worker->checksum += Jobs_GetJobId( payload, payloadLength, &value );
+                valueLength = Jobs_GetJobDocument( payload, payloadLength, &value );
+
+                do
+                {
+                    fileIndex = otaParser_parseJobDocFile( value, valueLength, ( uint8_t ) fileIndex,
+                                                           worker->settings->protocol,
+                                                           strlen( worker->settings->protocol ), &fields );
+                    worker->checksum += fields.fileSize;
+                } while( fileIndex > 0 );
+
+                parsed = ( fileIndex == 0 ) ? true : false;
+                break;
+
+            case JobsGetPendingFailed:
+            case JobsStartNextFailed:
+            case JobsDescribeFailed:
+            case JobsUpdateFailed:
+
+                parsed = ( Jobs_RejectedDecode( api, payload, payloadLength, &rejected ) == JobsSuccess ) ? true : false;
+                worker->checksum += ( uint64_t ) Jobs_RejectedAction( rejected.code );
+
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    return ( message->valid ) ? ( ( status == JobsSuccess ) && ( api == message->kind ) && parsed )
+                              : ( status != JobsSuccess );
+}
+
+static void * runWorker( void * argument )
+{
+    Worker_t * worker = argument;
+    uint64_t i;
+    size_t next = 0U;
+
+    ( void ) pthread_barrier_wait( worker->barrier );
+
+    for( i = 0U; i < worker->settings->messages; i++ )
+    {
+        if( !consume( worker, &worker->pool[ next ] ) )
+        {
+            worker->mismatches++;
+        }
+
+        next = ( ( next + 1U ) < worker->settings->pool ) ? ( next + 1U ) : 0U;
+    }
+
+    worker->processed = worker->settings->messages;
+    ( void ) pthread_barrier_wait( worker->barrier );
+
+    return NULL;
+}
+
+/**
+ * @brief Build the message pools and payloads of a run.
+ */
+static bool prepare( Worker_t * workers,
+                     unsigned count,
+                     const Settings_t * settings )
+{
+    static char otaDocument[ PAYLOAD_BUFFER_LENGTH ];
+    uint64_t state;
+    unsigned w;
+    size_t i;
+    int kind;
+    bool ret = true;
+
+    ( void ) writeOtaDocument( otaDocument, sizeof( otaDocument ), settings );
+
+    for( w = 0U; ( w < count ) && ret; w++ )
+    {
+        ( void ) memset( &workers[ w ], 0, sizeof( workers[ w ] ) );
+        workers[ w ].settings = settings;
+        workers[ w ].id = w;
+        workers[ w ].count = count;
+        workers[ w ].pool = malloc( settings->pool * sizeof( Message_t ) );
+        ret = ( workers[ w ].pool != NULL ) ? true : false;
+        state = ( settings->seed * 0x9E3779B97F4A7C15ULL ) + w + 1U;
+
+        for( i = 0U; ret && ( i < settings->pool ); i++ )
+        {
+            makeMessage( &workers[ w ], &workers[ w ].pool[ i ], &state );
+        }
+
+        /* Each worker owns its payloads, as each connection owns its buffer. */
+        for( kind = 0; ret && ( kind < ( int ) JobsMaxTopic ); kind++ )
+        {
+            workers[ w ].payloads[ kind ] = malloc( PAYLOAD_BUFFER_LENGTH );
+            ret = ( workers[ w ].payloads[ kind ] != NULL ) ? true : false;
+
+            if( ret )
+            {
+                workers[ w ].payloadLengths[ kind ] = writePayload( workers[ w ].payloads[ kind ], PAYLOAD_BUFFER_LENGTH,
+                                                                    ( JobsTopic_t ) kind, otaDocument );
+            }
+        }
+    }
+
+    return ret;
+}
+
+static void release( Worker_t * workers,
+                     unsigned count )
+{
+    unsigned w;
+    int kind;
+
+    for( w = 0U; w < count; w++ )
+    {
+        free( workers[ w ].pool );
+
+        for( kind = 0; kind < ( int ) JobsMaxTopic; kind++ )
+        {
+            free( workers[ w ].payloads[ kind ] );
+        }
+    }
+}
+
+/**
+ * @brief Run the workers once.
+ *
+ * @return Messages per second over all threads, or a negative value on failure.
+ */
+static double run( const Settings_t * settings,
+                   unsigned count,
+                   uint64_t * outMismatches )
+{
+    Worker_t * workers = calloc( count, sizeof( Worker_t ) );
+    pthread_t * threads = calloc( count, sizeof( pthread_t ) );
+    pthread_barrier_t barrier;
+    uint64_t total = 0U;
+    double start;
+    double elapsed;
+    double ret = -1.0;
+    unsigned w;
+
+    *outMismatches = 0U;
+
+    if( ( workers != NULL ) && ( threads != NULL ) && prepare( workers, count, settings ) &&
+        ( pthread_barrier_init( &barrier, NULL, count + 1U ) == 0 ) )
+    {
+        for( w = 0U; w < count; w++ )
+        {
+            workers[ w ].barrier = &barrier;
+            ( void ) pthread_create( &threads[ w ], NULL, runWorker, &workers[ w ] );
+        }
+
+        ( void ) pthread_barrier_wait( &barrier );
+        start = nowSeconds();
+        ( void ) pthread_barrier_wait( &barrier );
+        elapsed = nowSeconds() - start;
+
+        for( w = 0U; w < count; w++ )
+        {
+            ( void ) pthread_join( threads[ w ], NULL );
+            total += workers[ w ].processed;
+            *outMismatches += workers[ w ].mismatches;
+        }
+
+        ( void ) pthread_barrier_destroy( &barrier );
+        ret = ( double ) total / elapsed;
+    }
+
+    if( workers != NULL )
+    {
+        release( workers, count );
+    }
+
+    free( workers );
+    free( threads );
+
+    return ret;
+}
+
+static int usage( const char * program )
+{
+    fprintf( stderr,
+             "usage: %s [-t threads] [-s] [-n things] [-m messages] [-q pool] [-i invalid%%]\n"
+             "       [-f files] [-p protocols] [-P protocol] [-r seed]\n", program );
+
+    return 2;
+}
+
+int main( int argc,
+          char ** argv )
+{
+    Settings_t settings =
+    {
+        .threads        = 1U,
+        .sweep          = false,
+        .things         = 1000000U,
+        .messages       = 1000000U,
+        .pool           = 16384U,
+        .invalidPercent = 5U,
+        .files          = 1U,
+        .protocols      = 2U,
+        .protocol       = "MQTT",
+        .seed           = 1U,
+    };
+    long cpus = sysconf( _SC_NPROCESSORS_ONLN );
+    double single = 0.0;
+    double rate;
+    uint64_t mismatches;
+    uint64_t allMismatches = 0U;
+    unsigned count;
+    int opt;
+
+    settings.threads = ( cpus > 0L ) ? ( unsigned ) cpus : 1U;
+
+    while( ( opt = getopt( argc, argv, "t:sn:m:q:i:f:p:P:r:" ) ) != -1 )
+    {
+        switch( opt )
+        {
+            case 't':
+                settings.threads = ( unsigned ) strtoul( optarg, NULL, 10 );
+                break;
+
+            case 's':
+                settings.sweep = true;
+                break;
+
+            case 'n':
+                settings.things = ( uint32_t ) strtoul( optarg, NULL, 10 );
+                break;
+
+            case 'm':
+                settings.messages = strtoull( optarg, NULL, 10 );
+                break;
+
+            case 'q':
+                settings.pool = ( size_t ) strtoul( optarg, NULL, 10 );
+                break;
+
+            case 'i':
+                settings.invalidPercent = ( unsigned ) strtoul( optarg, NULL, 10 );
+                break;
+
+            case 'f':
+                settings.files = ( unsigned ) strtoul( optarg, NULL, 10 );
+                break;
+
+            case 'p':
+                settings.protocols = ( unsigned ) strtoul( optarg, NULL, 10 );
+                break;
+
+            case 'P':
+                settings.protocol = optarg;
+                break;
+
+            case 'r':
+                settings.seed = strtoull( optarg, NULL, 10 );
+                break;
+
+            default:
+                return usage( argv[ 0 ] );
+        }
+    }
+
+    if( ( optind != argc ) || ( settings.threads == 0U ) || ( settings.things < settings.threads ) ||
+        ( settings.pool == 0U ) || ( settings.invalidPercent > 100U ) || ( settings.files == 0U ) ||
+        ( settings.files > MAX_FILES ) || ( settings.protocols == 0U ) || ( settings.protocols > MAX_PROTOCOLS ) )
+    {
+        return usage( argv[ 0 ] );
+    }
+
+    printf( "%u things, %llu messages per thread, %u%% invalid, %u files, %u protocols\n",
+            settings.things, ( unsigned long long ) settings.messages, settings.invalidPercent,
+            settings.files, settings.protocols );
+    printf( "%8s %14s %14s %10s\n", "threads", "messages/s", "per thread", "scaling" );
+
+    count = settings.sweep ? 1U : settings.threads;
+
+    while( count > 0U )
+    {
+        rate = run( &settings, count, &mismatches );
+
+        if( rate < 0.0 )
+        {
+            fprintf( stderr, "out of memory\n" );
+            return 1;
+        }
+
+        if( single == 0.0 )
+        {
+            single = rate / ( double ) count;
+        }
+
+        printf( "%8u %14.0f %14.0f %9.0f%%\n", count, rate, rate / ( double ) count,
+                ( 100.0 * rate ) / ( single * ( double ) count ) );
+        allMismatches += mismatches;
+
+        /* Double the threads, ending on the requested count. */
+        if( count == settings.threads )
+        {
+            count = 0U;
+        }
+        else
+        {
+            count = ( ( count * 2U ) < settings.threads ) ? ( count * 2U ) : settings.threads;
+        }
+    }
+
+    if( allMismatches > 0U )
+    {
+        printf( "%llu messages were not classified as generated\n", ( unsigned long long ) allMismatches );
+    }
+
+    return ( allMismatches > 0U ) ? 1 : 0;
+}
@@ -0,0 +1,109 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_logdecode.c
+ * @brief Print the binary log records written by #Jobs_LogEncode with the
+ * format strings of #JOBS_LOG_MESSAGES.
+ *
+ * Usage: jobs_logdecode [log]
+ *
+ * The records are read from standard input when no file is given.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "jobs.h"
+#include "jobs_log.h"
+
+#define JOBS_LOG_FORMAT( id, format )    format,
+
+static const char * const formats[ JobsLogMaxId ] =
+{
+    JOBS_LOG_MESSAGES( JOBS_LOG_FORMAT )
+};
+
+static const char * const levelNames[] =
+{
+    "NONE",
+    "ERROR",
+    "WARN",
+    "INFO",
+    "DEBUG",
+};
+
+int main( int argc,
+          char ** argv )
+{
+    FILE * file = stdin;
+    uint8_t buffer[ JOBS_LOG_RECORD_SIZE ];
+    JobsLogRecord_t record;
+    size_t records = 0U;
+    size_t invalid = 0U;
+
+    if( argc > 2 )
+    {
+        fprintf( stderr, "usage: %s [log]\n", argv[ 0 ] );
+
+        return EXIT_FAILURE;
+    }
+
+    if( argc == 2 )
+    {
+        file = fopen( argv[ 1 ], "rb" );
+
+        if( file == NULL )
+        {
+            perror( argv[ 1 ] );
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    while( fread( buffer, sizeof( buffer ), 1U, file ) == 1U )
+    {
+        if( Jobs_LogDecode( buffer, sizeof( buffer ), &record ) == JobsSuccess )
+        {
+            printf( "%10lu %-5s ", ( unsigned long ) record.timestamp, levelNames[ record.level ] );
+            printf( formats[ record.id ], ( unsigned int ) record.args[ 0 ], ( unsigned int ) record.args[ 1 ] );
+            printf( "\n" );
+            records++;
+        }
+        else
+        {
+            invalid++;
+        }
+    }
+
+    if( file != stdin )
+    {
+        ( void ) fclose( file );
+    }
+
+    fprintf( stderr, "%zu records, %zu invalid\n", records, invalid );
+
+    return ( invalid == 0U ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,330 @@
+/*
+ * AWS IoT Jobs v2.0.0
+ * Copyright (C) 2026 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file jobs_replay.c
+ * @brief Replay a capture of Jobs messages through the parsing path of a
+ * device, and report the latency of each stage.
+ *
+ * Usage: jobs_replay [-r] [-n repeat] [-p protocol] thingName capture
+ *
+ * -r replays at the timing of the capture instead of as fast as possible.
+ */
+
+#define _POSIX_C_SOURCE    200809L
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "jobs.h"
+#include "jobs_capture.h"
+#include "ota_job_processor.h"
+
+/**
+ * @brief Largest topic replayed, longer topics are not Jobs topics.
+ */
+#define TOPIC_BUFFER_LENGTH    512U
+
+/**
+ * @brief The stages timed for each message.
+ */
+typedef enum
+{
+    StageMatchTopic,
+    StageGetJobDocument,
+    StageParseJobDoc,
+    StageCount
+} Stage_t;
+
+static const char * const stageNames[ StageCount ] =
+{
+    "Jobs_MatchTopic",
+    "Jobs_GetJobDocument",
+    "otaParser_parseJobDocFile",
+};
+
+/**
+ * @brief Latencies, in nanoseconds, of one stage.
+ */
+typedef struct
+{
+    uint64_t * samples;
+    size_t count;
+} Samples_t;
+
+static uint64_t nowNs( void )
+{
+    struct timespec ts;
+
+    ( void ) clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return ( ( uint64_t ) ts.tv_sec * 1000000000ULL ) + ( uint64_t ) ts.tv_nsec;
+}
+
+static int compareSamples( const void * a,
+                           const void * b )
+{
+    uint64_t x = *( const uint64_t * ) a;
+    uint64_t y = *( const uint64_t * ) b;
+
+    return ( x > y ) - ( x < y );
+}
+
+static void report( Samples_t * samples,
+                    const char * name )
+{
+    uint64_t * s = samples->samples;
+    size_t n = samples->count;
+
+    if( n == 0U )
+    {
+        printf( "%-26s %8s\n", name, "-" );
+    }
+    else
+    {
+        qsort( s, n, sizeof( s[ 0 ] ), compareSamples );
+        printf( "%-26s %8zu %10llu %10llu %10llu %10llu\n", name, n,
+                ( unsigned long long ) s[ ( n * 50U ) / 100U ],
+                ( unsigned long long ) s[ ( n * 90U ) / 100U ],
+                ( unsigned long long ) s[ ( n * 99U ) / 100U ],
+                ( unsigned long long ) s[ n - 1U ] );
+    }
+}
+
+/**
+ * @brief Sleep until a message is due at its captured time.
+ */
+static void waitUntil( uint64_t startNs,
+                       uint64_t offsetMs )
+{
+    uint64_t due = startNs + ( offsetMs * 1000000ULL );
+    uint64_t now = nowNs();
+    struct timespec ts;
+    int ret;
+
+    if( due > now )
+    {
+        ts.tv_sec = ( time_t ) ( ( due - now ) / 1000000000ULL );
+        ts.tv_nsec = ( long ) ( ( due - now ) % 1000000000ULL );
+
+        do
+        {
+            ret = nanosleep( &ts, &ts );
+        } while( ( ret != 0 ) && ( errno == EINTR ) );
+    }
+}
+
+/**
+ * @brief Run the parsing stages over one captured message.
+ */
+static void replayRecord( const JobsCaptureRecord_t * record,
+                          const char * thingName,
+                          const char * protocol,
+                          Samples_t samples[ StageCount ] )
+{
+    char topic[ TOPIC_BUFFER_LENGTH ];
+    JobsTopic_t api = JobsInvalidTopic;
+    char * jobId = NULL;
+    uint16_t jobIdLength = 0U;
+    const char * jobDoc = NULL;
+    size_t jobDocLength;
+    AfrOtaJobDocumentFields_t fields;
+    int8_t fileIndex = 0;
+    uint64_t start;
+
+    if( record->topicLength < sizeof( topic ) )
+    {
+        /* Jobs_MatchTopic takes a writable topic, as the MQTT buffer is. */
+        ( void ) memcpy( topic, record->topic, record->topicLength );
+
+        start = nowNs();
+        ( void ) Jobs_MatchTopic( topic, record->topicLength, thingName,
+                                  ( uint16_t ) strlen( thingName ), &api, &jobId, &jobIdLength );
+        samples[ StageMatchTopic ].samples[ samples[ StageMatchTopic ].count++ ] = nowNs() - start;
+
+        /* notify-next carries the document of the next job in the same
+         * execution object as the responses. */
+        if( ( api == JobsStartNextSuccess ) || ( api == JobsDescribeSuccess ) ||
+            ( api == JobsNextJobChanged ) )
+        {
+            start = nowNs();
+            jobDocLength = Jobs_GetJobDocument( record->payload, record->payloadLength, &jobDoc );
+            samples[ StageGetJobDocument ].samples[ samples[ StageGetJobDocument ].count++ ] = nowNs() - start;
+
+            if( jobDocLength > 0U )
+            {
+                start = nowNs();
+
+                do
+                {
+                    ( void ) memset( &fields, 0, sizeof( fields ) );
+                    fileIndex = otaParser_parseJobDocFile( jobDoc, jobDocLength, ( uint8_t ) fileIndex,
+                                                           protocol, strlen( protocol ), &fields );
+                } while( fileIndex > 0 );
+
+                samples[ StageParseJobDoc ].samples[ samples[ StageParseJobDoc ].count++ ] = nowNs() - start;
+            }
+        }
+    }
+}
+
+static int usage( const char * program )
+{
+    fprintf( stderr, "usage: %s [-r] [-n repeat] [-p protocol] thingName capture\n", program );
+
+    return 2;
+}
+
+int main( int argc,
+          char ** argv )
+{
+    int realtime = 0;
+    unsigned long repeat = 1UL;
+    const char * protocol = "MQTT";
+    const char * thingName;
+    FILE * file;
+    uint8_t * data;
+    long length;
+    size_t readLength = 0U;
+    size_t records = 0U;
+    Samples_t samples[ StageCount ];
+    JobsReplay_t replay;
+    JobsCaptureRecord_t record;
+    JobsStatus_t status = JobsNoMatch;
+    uint32_t firstMs = 0U;
+    uint64_t startNs;
+    unsigned long pass;
+    int opt;
+    int i;
+
+    while( ( opt = getopt( argc, argv, "rn:p:" ) ) != -1 )
+    {
+        if( opt == 'r' )
+        {
+            realtime = 1;
+        }
+        else if( opt == 'n' )
+        {
+            repeat = strtoul( optarg, NULL, 10 );
+        }
+        else if( opt == 'p' )
+        {
+            protocol = optarg;
+        }
+        else
+        {
+            return usage( argv[ 0 ] );
+        }
+    }
+
+    if( ( ( argc - optind ) != 2 ) || ( repeat == 0UL ) )
+    {
+        return usage( argv[ 0 ] );
+    }
+
+    thingName = argv[ optind ];
+    file = fopen( argv[ optind + 1 ], "rb" );
+
+    if( file == NULL )
+    {
+        perror( argv[ optind + 1 ] );
+        return 1;
+    }
+
+    ( void ) fseek( file, 0L, SEEK_END );
+    length = ftell( file );
+    ( void ) fseek( file, 0L, SEEK_SET );
+    data = malloc( ( length > 0L ) ? ( size_t ) length : 1U );
+
+    if( ( data != NULL ) && ( length >= 0L ) )
+    {
+        readLength = fread( data, 1U, ( size_t ) length, file );
+    }
+
+    ( void ) fclose( file );
+
+    if( ( data == NULL ) || ( length < 0L ) || ( readLength != ( size_t ) length ) ||
+        ( Jobs_ReplayInit( &replay, data, ( size_t ) length ) != JobsSuccess ) )
+    {
+        fprintf( stderr, "%s: not a Jobs capture\n", argv[ optind + 1 ] );
+        free( data );
+        return 1;
+    }
+
+    /* Count the records to size the samples. */
+    while( Jobs_ReplayNext( &replay, &record ) == JobsSuccess )
+    {
+        records++;
+    }
+
+    for( i = 0; i < StageCount; i++ )
+    {
+        samples[ i ].samples = malloc( ( ( records * repeat ) + 1U ) * sizeof( uint64_t ) );
+        samples[ i ].count = 0U;
+
+        if( samples[ i ].samples == NULL )
+        {
+            fprintf( stderr, "out of memory\n" );
+            return 1;
+        }
+    }
+
+    for( pass = 0UL; pass < repeat; pass++ )
+    {
+        ( void ) Jobs_ReplayInit( &replay, data, ( size_t ) length );
+        startNs = nowNs();
+        status = Jobs_ReplayNext( &replay, &record );
+        firstMs = record.timestampMs;
+
+        while( status == JobsSuccess )
+        {
+            if( realtime != 0 )
+            {
+                waitUntil( startNs, record.timestampMs - firstMs );
+            }
+
+            replayRecord( &record, thingName, protocol, samples );
+            status = Jobs_ReplayNext( &replay, &record );
+        }
+    }
+
+    printf( "%zu messages, %lu passes%s\n", records, repeat,
+            ( status == JobsError ) ? ", capture is corrupt after the last message" : "" );
+    printf( "%-26s %8s %10s %10s %10s %10s\n", "stage (ns)", "count", "p50", "p90", "p99", "max" );
+
+    for( i = 0; i < StageCount; i++ )
+    {
+        report( &samples[ i ], stageNames[ i ] );
+        free( samples[ i ].samples );
+    }
+
+    free( data );
+
+    return 0;
+}